@@ -0,0 +1,39 @@
+#ifndef TGBOT_BENCH_ALLOCATIONCOUNTER_H
+#define TGBOT_BENCH_ALLOCATIONCOUNTER_H
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace bench {
+
+// Number of global operator new calls made by this process so far.
+std::uint64_t allocationCount();
+
+// Counts the allocations of the timed loop of a benchmark and reports them
+// as the "allocs/op" counter once it goes out of scope:
+//
+//     AllocationScope allocations(state);
+//     for (auto _ : state) { ... }
+class AllocationScope {
+   public:
+    explicit AllocationScope(benchmark::State& state)
+        : _state(state), _start(allocationCount()) {}
+
+    ~AllocationScope() {
+        _state.counters["allocs/op"] = benchmark::Counter(
+            static_cast<double>(allocationCount() - _start),
+            benchmark::Counter::kAvgIterations);
+    }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+   private:
+    benchmark::State& _state;
+    std::uint64_t _start;
+};
+
+}  // namespace bench
+
+#endif  // TGBOT_BENCH_ALLOCATIONCOUNTER_H
@@ -0,0 +1,114 @@
+#ifndef TGBOT_BENCH_CORPUS_H
+#define TGBOT_BENCH_CORPUS_H
+
+#include <string>
+
+namespace bench::corpus {
+
+// Update payloads shaped like what the Bot API actually delivers.
+
+inline std::string textMessage() {
+    return R"({"update_id":100000001,"message":{"message_id":4242,)"
+           R"("from":{"id":123456789,"is_bot":false,"first_name":"Alice",)"
+           R"("last_name":"Smith","username":"alice","language_code":"en"},)"
+           R"("chat":{"id":123456789,"first_name":"Alice","last_name":"Smith",)"
+           R"("username":"alice","type":"private"},"date":1700000000,)"
+           R"("text":"/start hello there, how are you doing today?",)"
+           R"("entities":[{"offset":0,"length":6,"type":"bot_command"}]}})";
+}
+
+inline std::string photoMessage(int updateId = 100000002,
+                                const std::string& mediaGroupId = {}) {
+    std::string update =
+        R"({"update_id":)" + std::to_string(updateId) +
+        R"(,"message":{"message_id":)" + std::to_string(updateId % 100000) +
+        R"(,"from":{"id":123456789,"is_bot":false,"first_name":"Alice"},)"
+        R"("chat":{"id":-1001234567890,"title":"Photos","type":"supergroup"},)"
+        R"("date":1700000000,)";
+    if (!mediaGroupId.empty()) {
+        update += R"("media_group_id":")" + mediaGroupId + R"(",)";
+    }
+    update += R"("photo":[)";
+    const char* sizes[][3] = {{"90", "67", "1280"},
+                              {"320", "240", "15000"},
+                              {"800", "600", "72000"},
+                              {"1280", "960", "160000"}};
+    for (int i = 0; i < 4; ++i) {
+        if (i > 0) {
+            update += ',';
+        }
+        update += R"({"file_id":"AgACAgIAAxkBAAIBZ2V)" + std::to_string(i) +
+                  R"(xQ3FzZmRzZmRzZmRzZmRzAAJ",)"
+                  R"("file_unique_id":"AQADx)" +
+                  std::to_string(i) + R"(","width":)" + sizes[i][0] +
+                  R"(,"height":)" + sizes[i][1] + R"(,"file_size":)" +
+                  sizes[i][2] + '}';
+    }
+    update += R"(],"caption":"Holiday pictures",)"
+              R"("caption_entities":[{"offset":0,"length":7,"type":"bold"}]}})";
+    return update;
+}
+
+// getUpdates result holding one album of ten photos.
+inline std::string album() {
+    std::string result = "[";
+    for (int i = 0; i < 10; ++i) {
+        if (i > 0) {
+            result += ',';
+        }
+        result += photoMessage(100000100 + i, "13579246801357924");
+    }
+    result += ']';
+    return result;
+}
+
+// A long formatted message with many entities.
+inline std::string largeEntityList(int entityCount = 500) {
+    std::string text;
+    std::string entities;
+    const char* types[] = {"bold", "italic", "code", "underline",
+                           "strikethrough"};
+    for (int i = 0; i < entityCount; ++i) {
+        const std::size_t offset = text.size();
+        text += "word" + std::to_string(i) + ' ';
+        if (i > 0) {
+            entities += ',';
+        }
+        entities += R"({"offset":)" + std::to_string(offset) +
+                    R"(,"length":)" + std::to_string(text.size() - offset - 1) +
+                    R"(,"type":")" + types[i % 5] + R"("})";
+    }
+    return R"({"update_id":100000003,"message":{"message_id":77,)"
+           R"("from":{"id":123456789,"is_bot":false,"first_name":"Alice"},)"
+           R"("chat":{"id":123456789,"first_name":"Alice","type":"private"},)"
+           R"("date":1700000000,"text":")" +
+           text + R"(","entities":[)" + entities + "]}}";
+}
+
+inline std::string callbackQuery() {
+    return R"({"update_id":100000004,"callback_query":{"id":"4382bfdwdsb323b2d9",)"
+           R"("from":{"id":123456789,"is_bot":false,"first_name":"Alice"},)"
+           R"("message":{"message_id":4243,"from":{"id":987654321,"is_bot":true,)"
+           R"("first_name":"Bot","username":"example_bot"},)"
+           R"("chat":{"id":123456789,"first_name":"Alice","type":"private"},)"
+           R"("date":1700000000,"text":"Pick one",)"
+           R"("reply_markup":{"inline_keyboard":[[{"text":"A","callback_data":"a"},)"
+           R"({"text":"B","callback_data":"b"}]]}},)"
+           R"("chat_instance":"-1234567890123456789","data":"a"}})";
+}
+
+// A rich text document whose styled nodes nest depth levels deep.
+inline std::string nestedRichText(int depth) {
+    const char* styles[] = {"bold", "italic", "underline", "spoiler",
+                            "strikethrough", "code"};
+    std::string result = R"("leaf")";
+    for (int i = 0; i < depth; ++i) {
+        result = R"({"type":")" + std::string(styles[i % 6]) +
+                 R"(","text":["level ",)" + result + "]}";
+    }
+    return result;
+}
+
+}  // namespace bench::corpus
+
+#endif  // TGBOT_BENCH_CORPUS_H
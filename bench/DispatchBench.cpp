@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <nlohmann/json.hpp>
+#include <string>
+
+#include <tgbot/EventBroadcaster.h>
+#include <tgbot/EventHandler.h>
+#include <tgbot/TgTypeParser.h>
+#include <tgbot/types/Update.h>
+
+#include "AllocationCounter.h"
+#include "Corpus.h"
+
+using namespace TgBot;
+
+namespace {
+
+// Registers range(0) listeners for every message event and range(1) commands,
+// then dispatches a command message and a callback query.
+void BM_HandleUpdate(benchmark::State& state, const std::string& payload) {
+    EventBroadcaster broadcaster;
+    std::int64_t calls = 0;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        broadcaster.onAnyMessage([&calls](const Message::Ptr&) { ++calls; });
+        broadcaster.onNonCommandMessage(
+            [&calls](const Message::Ptr&) { ++calls; });
+        broadcaster.onCallbackQuery(
+            [&calls](const CallbackQuery::Ptr&) { ++calls; });
+    }
+    for (std::int64_t i = 0; i < state.range(1); ++i) {
+        broadcaster.onCommand("command" + std::to_string(i),
+                              [&calls](const Message::Ptr&) { ++calls; });
+    }
+    broadcaster.onCommand("start", [&calls](const Message::Ptr&) { ++calls; });
+
+    EventHandler handler(&broadcaster);
+    const Update::Ptr update = parse<Update>(nlohmann::json::parse(payload));
+
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        handler.handleUpdate(update);
+    }
+    benchmark::DoNotOptimize(calls);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_HandleUpdate, command, bench::corpus::textMessage())
+    ->Args({1, 10})
+    ->Args({100, 1000});
+BENCHMARK_CAPTURE(BM_HandleUpdate, callback_query,
+                  bench::corpus::callbackQuery())
+    ->Args({1, 10})
+    ->Args({100, 1000});
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <tgbot/net/Url.h>
+#include <tgbot/tools/StringTools.h>
+
+#include "AllocationCounter.h"
+
+using namespace TgBot;
+
+namespace {
+
+void BM_Url(benchmark::State& state) {
+    const std::string url =
+        "https://api.telegram.org/bot123456:ABC-DEF1234ghIkl-zyx57W2v1u123ew11/"
+        "sendMessage?chat_id=123456789&text=hello#fragment";
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        Url parsed(url);
+        benchmark::DoNotOptimize(parsed);
+    }
+}
+
+void BM_UrlEncode(benchmark::State& state, const std::string& value) {
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto encoded = StringTools::urlEncode(value);
+        benchmark::DoNotOptimize(encoded);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(value.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_Url);
+BENCHMARK_CAPTURE(BM_UrlEncode, ascii,
+                  std::string("Hello world, this is a plain message text"));
+BENCHMARK_CAPTURE(BM_UrlEncode, json_keyboard,
+                  std::string(R"({"inline_keyboard":[[{"text":"A",)"
+                              R"("callback_data":"select:0:0"},{"text":"B",)"
+                              R"("callback_data":"select:0:1"}]]})"));
+BENCHMARK_CAPTURE(BM_UrlEncode, utf8,
+                  std::string("Привет, мир! こんにちは世界 🌍🚀"));
@@ -0,0 +1,140 @@
+#include <benchmark/benchmark.h>
+
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include <tgbot/ParseCache.h>
+#include <tgbot/TgTypeParser.h>
+#include <tgbot/tools/Utf16.h>
+#include <tgbot/types/RichText.h>
+#include <tgbot/types/Update.h>
+
+#include "AllocationCounter.h"
+#include "Corpus.h"
+
+using namespace TgBot;
+
+namespace {
+
+// parse<Update> alone, on an already decoded document.
+void BM_ParseUpdate(benchmark::State& state, const std::string& payload) {
+    const nlohmann::json json = nlohmann::json::parse(payload);
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto update = parse<Update>(json);
+        benchmark::DoNotOptimize(update);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(payload.size()));
+}
+
+// parse<Update> of a regular sender's messages with ParseCache on: the
+// sender and the chat come from the cache.
+void BM_ParseUpdateCached(benchmark::State& state,
+                          const std::string& payload) {
+    const nlohmann::json json = nlohmann::json::parse(payload);
+    ParseCache::enable();
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto update = parse<Update>(json);
+        benchmark::DoNotOptimize(update);
+    }
+    ParseCache::disable();
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(payload.size()));
+}
+
+// What a webhook request costs: JSON decoding plus parse<Update>.
+void BM_ParseUpdateFromText(benchmark::State& state,
+                            const std::string& payload) {
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto update = parse<Update>(nlohmann::json::parse(payload));
+        benchmark::DoNotOptimize(update);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(payload.size()));
+}
+
+// A getUpdates result holding one album.
+void BM_ParseAlbum(benchmark::State& state) {
+    const nlohmann::json json = nlohmann::json::parse(bench::corpus::album());
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto updates = parseArray<Update>(json);
+        benchmark::DoNotOptimize(updates);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(json.size()));
+}
+
+// Styled rich text nodes, each dispatched on its "type".
+void BM_ParseRichText(benchmark::State& state) {
+    const nlohmann::json json = nlohmann::json::parse(
+        bench::corpus::nestedRichText(static_cast<int>(state.range(0))));
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto text = parse<RichText>(json);
+        benchmark::DoNotOptimize(text);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+// Byte ranges of all entities of a message, in one pass over its text.
+void BM_EntityRanges(benchmark::State& state) {
+    const auto update = parse<Update>(nlohmann::json::parse(
+        bench::corpus::largeEntityList(static_cast<int>(state.range(0)))));
+    const Message& message = **update->message;
+    for (auto _ : state) {
+        auto ranges = utf8Ranges(message);
+        benchmark::DoNotOptimize(ranges);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+// The same, counting from the start of the text for every entity, as
+// handlers usually do.
+void BM_EntityRangesPerEntity(benchmark::State& state) {
+    const auto update = parse<Update>(nlohmann::json::parse(
+        bench::corpus::largeEntityList(static_cast<int>(state.range(0)))));
+    const Message& message = **update->message;
+    const std::string& text = *message.text;
+    const auto byteOf = [&text](std::size_t units) {
+        std::size_t pos = 0;
+        for (std::size_t seen = 0; pos < text.size() && seen < units; ++pos) {
+            const auto byte = static_cast<unsigned char>(text[pos]);
+            seen += ((byte & 0xC0) != 0x80) + (byte >= 0xF0);
+        }
+        return pos;
+    };
+    for (auto _ : state) {
+        std::vector<Utf8Range> ranges;
+        for (const auto& entity : *message.entities) {
+            const std::size_t begin = byteOf(entity->offset);
+            ranges.push_back({begin, byteOf(entity->offset + entity->length) - begin});
+        }
+        benchmark::DoNotOptimize(ranges);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_ParseUpdate, text, bench::corpus::textMessage());
+BENCHMARK_CAPTURE(BM_ParseUpdate, photo, bench::corpus::photoMessage());
+BENCHMARK_CAPTURE(BM_ParseUpdate, entities_500,
+                  bench::corpus::largeEntityList());
+BENCHMARK_CAPTURE(BM_ParseUpdate, callback_query,
+                  bench::corpus::callbackQuery());
+BENCHMARK_CAPTURE(BM_ParseUpdateCached, text, bench::corpus::textMessage());
+BENCHMARK_CAPTURE(BM_ParseUpdateFromText, text, bench::corpus::textMessage());
+BENCHMARK_CAPTURE(BM_ParseUpdateFromText, entities_500,
+                  bench::corpus::largeEntityList());
+BENCHMARK(BM_ParseAlbum);
+BENCHMARK(BM_ParseRichText)->Arg(4)->Arg(64);
+BENCHMARK(BM_EntityRanges)->Arg(50)->Arg(500);
+BENCHMARK(BM_EntityRangesPerEntity)->Arg(50)->Arg(500);
@@ -0,0 +1,158 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tgbot/TgTypeParser.h>
+#include <tgbot/types/InlineKeyboardButton.h>
+#include <tgbot/types/InlineKeyboardMarkup.h>
+#include <tgbot/types/InlineQueryResultArticle.h>
+#include <tgbot/types/InputTextMessageContent.h>
+#include <tgbot/types/KeyboardButton.h>
+#include <tgbot/types/ReplyKeyboardMarkup.h>
+#include <tgbot/types/RichText.h>
+#include <tgbot/tools/MessageBuilder.h>
+
+#include "AllocationCounter.h"
+#include "Corpus.h"
+
+using namespace TgBot;
+
+namespace {
+
+InlineKeyboardMarkup::Ptr inlineKeyboard(int rows, int columns) {
+    auto markup = std::make_shared<InlineKeyboardMarkup>();
+    for (int r = 0; r < rows; ++r) {
+        std::vector<InlineKeyboardButton::Ptr> row;
+        for (int c = 0; c < columns; ++c) {
+            auto button = std::make_shared<InlineKeyboardButton>();
+            button->text = "Option " + std::to_string(r * columns + c);
+            button->callbackData =
+                "select:" + std::to_string(r) + ':' + std::to_string(c);
+            row.push_back(std::move(button));
+        }
+        markup->inlineKeyboard.push_back(std::move(row));
+    }
+    return markup;
+}
+
+ReplyKeyboardMarkup::Ptr replyKeyboard(int rows, int columns) {
+    auto markup = std::make_shared<ReplyKeyboardMarkup>();
+    for (int r = 0; r < rows; ++r) {
+        std::vector<KeyboardButton::Ptr> row;
+        for (int c = 0; c < columns; ++c) {
+            auto button = std::make_shared<KeyboardButton>();
+            button->text = "Key " + std::to_string(r * columns + c);
+            row.push_back(std::move(button));
+        }
+        markup->keyboard.push_back(std::move(row));
+    }
+    markup->resizeKeyboard = true;
+    return markup;
+}
+
+std::vector<InlineQueryResult::Ptr> articles(int count) {
+    std::vector<InlineQueryResult::Ptr> results;
+    for (int i = 0; i < count; ++i) {
+        auto content = std::make_shared<InputTextMessageContent>();
+        content->messageText = "Result number " + std::to_string(i) +
+                               " with a reasonably long body of text";
+        content->parseMode = "HTML";
+
+        auto article = std::make_shared<InlineQueryResultArticle>();
+        article->id = "article-" + std::to_string(i);
+        article->title = "Article " + std::to_string(i);
+        article->description = "Short description of article " +
+                                std::to_string(i);
+        article->thumbnailUrl =
+            "https://example.com/thumbs/" + std::to_string(i) + ".jpg";
+        article->inputMessageContent = content;
+        article->replyMarkup = inlineKeyboard(1, 2);
+        results.push_back(std::move(article));
+    }
+    return results;
+}
+
+void BM_PutInlineKeyboard(benchmark::State& state) {
+    const auto markup = inlineKeyboard(static_cast<int>(state.range(0)),
+                                       static_cast<int>(state.range(1)));
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto json = putJSON(markup);
+        benchmark::DoNotOptimize(json);
+    }
+}
+
+void BM_PutReplyKeyboard(benchmark::State& state) {
+    const auto markup = replyKeyboard(4, 3);
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto json = putJSON(markup);
+        benchmark::DoNotOptimize(json);
+    }
+}
+
+void BM_PutInlineQueryResults(benchmark::State& state) {
+    const auto results = articles(static_cast<int>(state.range(0)));
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto json = putJSON(results);
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+// Putting a styled node no longer copies the nodes below it at every level.
+void BM_PutRichText(benchmark::State& state) {
+    const auto text = parse<RichText>(nlohmann::json::parse(
+        bench::corpus::nestedRichText(static_cast<int>(state.range(0)))));
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto json = put(text);
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+// One pass over a lookup table instead of a search per special character.
+void BM_EscapeMarkdownV2(benchmark::State& state) {
+    std::string text;
+    while (text.size() < static_cast<std::size_t>(state.range(0))) {
+        text += "Price: 1.5 (approx.) - see https://example.org/a_b! ";
+    }
+    for (auto _ : state) {
+        auto escaped = escapeMarkdownV2(text);
+        benchmark::DoNotOptimize(escaped);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(text.size()));
+}
+
+// Splitting a long styled report into messages of at most 4096 units.
+void BM_BuildLongMessage(benchmark::State& state) {
+    MessageBuilder builder;
+    for (int i = 0; i < state.range(0); ++i) {
+        builder.bold("Item " + std::to_string(i)).text(": ");
+        builder.link("details", "https://example.org/" + std::to_string(i));
+        builder.text(" \u2014 \u00e9t\u00e9 summary line\n");
+    }
+    bench::AllocationScope allocations(state);
+    for (auto _ : state) {
+        auto parts = builder.build();
+        benchmark::DoNotOptimize(parts);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_PutInlineKeyboard)->Args({1, 2})->Args({5, 8});
+BENCHMARK(BM_PutReplyKeyboard);
+BENCHMARK(BM_PutInlineQueryResults)->Arg(1)->Arg(50);
+BENCHMARK(BM_PutRichText)->Arg(4)->Arg(64);
+BENCHMARK(BM_EscapeMarkdownV2)->Arg(64)->Arg(4096);
+BENCHMARK(BM_BuildLongMessage)->Arg(16)->Arg(1000);
@@ -8,12 +8,15 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#include "tgbot/TgException.h"
 #include "tgbot/net/HttpClient.h"
 #include "tgbot/net/HttpReqArg.h"
+#include "tgbot/net/RetryPolicy.h"
 #include "tgbot/types/BotCommand.h"
 #include "tgbot/types/BotCommandScope.h"
 #include "tgbot/types/BotDescription.h"
@@ -92,18 +95,28 @@ struct minmax_type<float> {
 
 template <typename T>
 using minmax_type_t = typename minmax_type<T>::type;
+
+struct ApiContext;
 }  // namespace detail
 
+class TgLongPoll;
+class UpdateRecorder;
+
 /**
  * @brief This class executes telegram api methods. Telegram docs:
  * <https://core.telegram.org/bots/api#available-methods>
  *
+ * Read-only methods (getChat, getFile, getStickerSet, getUserProfilePhotos,
+ * ...) are coalesced: concurrent calls with identical arguments share a single
+ * in-flight request and its response. Methods with side effects are always
+ * sent individually.
+ *
  * @ingroup general
  */
 class TGBOT_API Api {
    public:
     Api(std::string token, HttpClient* httpClient, std::string url);
-    ~Api() = default;
+    ~Api();
 
     // Optional with default value
     template <typename T, T default_value>
@@ -3838,12 +3851,108 @@ class TGBOT_API Api {
     /**
      * @brief Check if user has blocked the bot
      *
+     * Answered from the outcome of a recent send to the chat when there is
+     * one (see validateAudience); only otherwise a chat action is sent to
+     * find out.
+     *
      * @param chatId Unique identifier for the target chat
      *
      * @return Returns True if bot is blocked by user
      */
     bool blockedByUser(std::int64_t chatId) const;
 
+    /**
+     * @brief What earlier requests revealed about a set of chats.
+     */
+    struct AudienceReport {
+        /// Chats the last send went through to.
+        std::vector<std::int64_t> reachable;
+        /// Chats that can't receive messages from the bot, with the reason.
+        std::vector<std::pair<std::int64_t, TgException::Reason>> unreachable;
+        /// Chats nothing is known about yet.
+        std::vector<std::int64_t> unknown;
+    };
+
+    /**
+     * @brief Sorts chats by whether the bot can still message them, without
+     * sending any request.
+     *
+     * Every send* call records whether its chat accepted the message, and any
+     * call that fails because the user blocked the bot, deleted their account
+     * or the chat is gone marks the chat as unreachable. This method reports
+     * that knowledge, so cleaning up an audience costs nothing beyond the
+     * messages that were sent anyway.
+     *
+     * Outcomes are forgotten after a while, and beyond a number of chats the
+     * least recently used ones are forgotten first; see setAudienceLimits().
+     * Forgotten chats are reported as unknown.
+     *
+     * @param chatIds Chats to look up
+     */
+    AudienceReport validateAudience(
+        const std::vector<std::int64_t>& chatIds) const;
+
+    /// Default capacity of setAudienceLimits().
+    constexpr static std::size_t kDefaultAudienceCapacity = 100000;
+
+    /// Default time to live of setAudienceLimits().
+    constexpr static std::chrono::milliseconds kDefaultAudienceTtl =
+        std::chrono::hours(1);
+
+    /**
+     * @brief Bounds what validateAudience() and blockedByUser() remember.
+     *
+     * @param capacity Chats whose outcome is kept
+     * @param ttl How long an outcome is trusted; afterwards the chat is
+     * checked again, e.g. because the user unblocked the bot
+     */
+    void setAudienceLimits(std::size_t capacity,
+                           std::chrono::milliseconds ttl) const;
+
+    /**
+     * @brief Remembers that a group was upgraded to a supergroup.
+     *
+     * From then on every request addressed to @p fromChatId (chat_id or
+     * from_chat_id) goes to @p toChatId instead. Api records migrations by
+     * itself when a send fails with migrate_to_chat_id, in which case the
+     * request is transparently resent to the new chat. Requests with a
+     * from_chat_id (forwards and copies) are not, since the error does not
+     * say which of their two chats migrated: the TgException reaches the
+     * caller, who can record the migration here. Bot records them
+     * from incoming messages carrying migrateToChatId or migrateFromChatId.
+     * Call this to restore migrations persisted by the application.
+     *
+     * @param fromChatId Identifier of the old group
+     * @param toChatId Identifier of the supergroup
+     */
+    void recordChatMigration(std::int64_t fromChatId,
+                             std::int64_t toChatId) const;
+
+    /**
+     * @brief Returns the identifier requests to @p chatId are sent to: the
+     * supergroup it was migrated to, or @p chatId itself.
+     */
+    std::int64_t resolveChatId(std::int64_t chatId) const;
+
+    /**
+     * @brief Sets how calls of @p methodClass are retried after network
+     * errors; see RetryPolicy. Takes effect for calls that start afterwards.
+     * The retry budget and circuit breaker of the class keep their state.
+     *
+     * getUpdates bypasses the circuit breaker, so that long polling goes on
+     * at its own pace, and its outcomes do not count towards it.
+     */
+    void setRetryPolicy(MethodClass methodClass,
+                        const RetryPolicy& policy) const;
+
+    /// The RetryPolicy of @p methodClass.
+    RetryPolicy retryPolicy(MethodClass methodClass) const;
+
+    /**
+     * @brief Returns all known migrations, from old group to supergroup.
+     */
+    std::unordered_map<std::int64_t, std::int64_t> chatMigrations() const;
+
     /**
      * @brief Use this method to send paid media.
      *
@@ -4479,10 +4588,21 @@ class TGBOT_API Api {
         optional<std::int64_t> actorChatId = {}) const;
 
    private:
-    std::string _bot_api_baseurl;
+    friend class TgLongPoll;
+    friend class BotHost;
+
+    // getUpdates that also appends every raw update to @p recorder.
+    std::vector<Update::Ptr> getUpdates(
+        optional<std::int32_t> offset,
+        bounded_optional_default<std::int32_t, 0, 100, 100> limit,
+        optional_default<std::int32_t, 0> timeout,
+        const optional<Update::Types> allowedUpdates,
+        UpdateRecorder* recorder) const;
+
     std::string _token;
     std::string _url;
     HttpClient* _httpClient;
+    std::unique_ptr<detail::ApiContext> _ctx;
 };
 }  // namespace TgBot
 
@@ -24,9 +24,13 @@ class EventBroadcaster;
  */
 class TGBOT_API Bot {
    public:
+    /**
+     * @param httpClient Client for all requests of this bot. It may be shared
+     * with other bots, see BotHost.
+     */
     explicit Bot(
         std::string token,
-        std::unique_ptr<HttpClient> httpClient = _getDefaultHttpClient(),
+        std::shared_ptr<HttpClient> httpClient = _getDefaultHttpClient(),
         std::string url = "https://api.telegram.org");
 
     /**
@@ -90,12 +94,13 @@ class TGBOT_API Bot {
 #endif
 
     friend class TgLongPoll;
+    friend class BotHost;
 
    private:
     static std::unique_ptr<HttpClient> _getDefaultHttpClient();
 
     std::string _token;
-    std::unique_ptr<HttpClient> _httpClient;
+    std::shared_ptr<HttpClient> _httpClient;
     std::unique_ptr<Api> _api;
     std::unique_ptr<EventBroadcaster> _eventBroadcaster;
     std::unique_ptr<EventHandler> _eventHandler;
@@ -0,0 +1,156 @@
+#ifndef TGBOT_BOTHOST_H
+#define TGBOT_BOTHOST_H
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "tgbot/Bot.h"
+#include "tgbot/export.h"
+#include "tgbot/net/HttpClient.h"
+
+namespace TgBot {
+
+/**
+ * @brief Settings of a BotHost.
+ *
+ * @ingroup general
+ */
+struct BotHostOptions {
+    /// Connections per host of the default HttpClient for the bots' requests.
+    /// Long polls do not count against them.
+    std::size_t maxConnections = 16;
+
+    /// Threads that run the listeners, and handle webhook requests.
+    std::size_t workerThreads = 8;
+
+    /// Listening sockets of runWebhook(), see TgWebhookServer::setAcceptors().
+    std::size_t webhookAcceptors = 1;
+
+    /**
+     * @brief How long each bot's getUpdates waits for updates when the bots'
+     * HttpClient is an EpollHttpClient.
+     */
+    std::chrono::seconds longPollTimeout{25};
+
+    /**
+     * @brief Pause between two polls of a bot that had no updates when the
+     * bots' HttpClient is not an EpollHttpClient. Such a client blocks a
+     * worker for every request, so bots are then polled without a long
+     * polling timeout, so that a worker is never parked on an idle bot; a
+     * bot that received updates is polled again right away.
+     */
+    std::chrono::milliseconds pollInterval{1000};
+
+    /**
+     * @brief Times the listeners may fail on one update received by long
+     * polling before it is skipped; 0 retries it for good.
+     *
+     * An update whose listener throws is not confirmed, and the bot tries it
+     * again after HttpClient::kRequestBackoff, holding back its later
+     * updates meanwhile. Once it failed this often it is confirmed all the
+     * same: it is logged, counted in tgbot_bothost_dropped_updates_total
+     * and handed to onDroppedUpdate, and the bot goes on with the next one.
+     */
+    std::size_t maxUpdateAttempts = 5;
+
+    /**
+     * @brief Called on a worker with the bot, the update it skips and what
+     * its listeners threw the last time, e.g. to store the update for a
+     * later look. Exceptions it throws are logged and ignored.
+     */
+    std::function<void(Bot&, const Update::Ptr&, std::exception_ptr)>
+        onDroppedUpdate;
+
+    /**
+     * @brief Secret token that runWebhook() requires on every request, see
+     * TgWebhookServer::setSecretToken(). Pass the same one to
+     * Api::setWebhook() of every bot.
+     */
+    std::string webhookSecretToken;
+};
+
+/**
+ * @brief Runs many bots in one process on shared resources.
+ *
+ * All bots send their requests through one HttpClient, so they share its
+ * connection pool, and their updates are handled by a fixed set of worker
+ * threads. runWebhook() receives them with a single webhook server that
+ * routes each bot's path to that bot. runLongPolling() receives them with
+ * getUpdates: with an EpollHttpClient, the default on Linux, every bot has
+ * one long poll waiting on an event loop, on a client of its own with a
+ * connection per bot, and a worker is only taken once updates arrived. With
+ * other clients the workers take turns polling every bot, see
+ * BotHostOptions::pollInterval.
+ *
+ * A 429 or a network error on a bot's getUpdates only defers that bot's next
+ * poll, without holding a worker. An update whose listeners keep failing is
+ * retried, and skipped after BotHostOptions::maxUpdateAttempts. At most one worker handles a given bot at a
+ * time, so its updates keep their order, and the metrics recorded for a bot
+ * carry a bot label with its numeric id. Listeners do share the workers: one
+ * that blocks, including a request waiting out its own 429, holds a worker,
+ * and the other bots wait once every worker is held.
+ *
+ * @ingroup general
+ */
+class TGBOT_API BotHost {
+   public:
+    using Options = BotHostOptions;
+
+    /**
+     * @brief Hosts bots on a shared EpollHttpClient on Linux, HttplibClient
+     * elsewhere.
+     */
+    explicit BotHost(Options options = {});
+
+    /**
+     * @brief Hosts bots on @p httpClient, which must be safe to use from
+     * several threads.
+     */
+    explicit BotHost(std::shared_ptr<HttpClient> httpClient,
+                     Options options = {});
+
+    ~BotHost();
+
+    BotHost(const BotHost&) = delete;
+    BotHost& operator=(const BotHost&) = delete;
+
+    /**
+     * @brief Adds a bot. Register its listeners on the returned Bot before
+     * calling runLongPolling() or runWebhook().
+     */
+    Bot& addBot(std::string token,
+                std::string url = "https://api.telegram.org");
+
+    /// Number of hosted bots.
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Receives the updates of all bots with getUpdates. Blocks until
+     * stop() is called.
+     */
+    void runLongPolling();
+
+    /**
+     * @brief Receives the updates of all bots with one webhook server on
+     * @p port, each bot on the path "/<token>". Blocks until stop() is
+     * called.
+     */
+    void runWebhook(unsigned short port, std::string host = "0.0.0.0");
+
+    /**
+     * @brief Makes runLongPolling() or runWebhook() return. Thread-safe.
+     */
+    void stop();
+
+   private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace TgBot
+
+#endif  // TGBOT_BOTHOST_H
@@ -0,0 +1,200 @@
+#ifndef TGBOT_BROADCASTER_H
+#define TGBOT_BROADCASTER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "tgbot/Api.h"
+#include "tgbot/export.h"
+
+namespace TgBot {
+
+/**
+ * @brief Sends one message to a large number of chats.
+ *
+ * Recipients are pulled from a RecipientSource and handed to a pool of worker
+ * threads, which pace their sends to stay within Telegram's global and
+ * per-chat limits. Every recipient gets a Result (delivered, blocked,
+ * deactivated, migrated or failed), and the job reports its throughput, ETA
+ * and a checkpoint from which an interrupted job can be resumed.
+ *
+ * The workers share the Api's HttpClient, so create it with as many
+ * connections as workers (see HttplibClient's maxConnections), otherwise the
+ * sends are serialized on a single connection.
+ *
+ * @ingroup general
+ */
+class TGBOT_API Broadcaster {
+   public:
+    /**
+     * @brief What happened to a single recipient.
+     */
+    enum class Outcome {
+        Delivered,
+        /// The user has blocked the bot.
+        Blocked,
+        /// The user's account was deleted.
+        Deactivated,
+        /**
+         * The group was upgraded to a supergroup and has a new id. Api
+         * resends to the supergroup by itself, so this is only
+         * reported if the resend is answered with yet another migration, or
+         * for forwards and copies, which Api does not resend.
+         */
+        Migrated,
+        /// Any other error; see Result::description.
+        Failed,
+    };
+
+    struct Result {
+        std::int64_t chatId = 0;
+        Outcome outcome = Outcome::Delivered;
+        /// Error message, empty on delivery.
+        std::string description;
+        /// New chat id if the outcome is Migrated and Telegram reported it.
+        std::optional<std::int64_t> migrateToChatId;
+    };
+
+    struct Stats {
+        /// Recipients processed in this run.
+        std::uint64_t processed = 0;
+        std::uint64_t delivered = 0;
+        std::uint64_t blocked = 0;
+        std::uint64_t deactivated = 0;
+        std::uint64_t migrated = 0;
+        std::uint64_t failed = 0;
+
+        /**
+         * @brief Number of recipients from the start of the source that are
+         * fully processed. Pass it as resumeFrom to continue an interrupted
+         * job without sending anything twice.
+         */
+        std::uint64_t checkpoint = 0;
+
+        std::chrono::steady_clock::duration elapsed{};
+
+        /// Recipients processed per second.
+        [[nodiscard]] double throughput() const;
+
+        /**
+         * @brief Estimated time to finish a job of @p total recipients, or
+         * nothing if no throughput has been measured yet.
+         */
+        [[nodiscard]] std::optional<std::chrono::seconds> eta(
+            std::uint64_t total) const;
+    };
+
+    /**
+     * @brief Thrown by run() when the job stops on an exception.
+     *
+     * Carries the statistics of the run up to that point, including the
+     * checkpoint to resume from. The exception that stopped the job is
+     * nested; std::rethrow_if_nested() rethrows it.
+     */
+    class Stopped : public std::runtime_error, public std::nested_exception {
+       public:
+        // Must be constructed while the original exception is handled.
+        Stopped(const std::string& what, const Stats& stats)
+            : std::runtime_error(what), stats(stats) {}
+
+        Stats stats;
+    };
+
+    struct Options {
+        /// Messages per second across all chats.
+        double globalRate = 30;
+        /// Minimum delay between two messages to the same private chat.
+        std::chrono::milliseconds privateChatInterval{1000};
+        /// Minimum delay between two messages to the same group or channel.
+        std::chrono::milliseconds groupChatInterval{3000};
+        /// Number of sending threads.
+        std::size_t workers = 4;
+        /// How often the progress listener is called.
+        std::chrono::milliseconds progressInterval{1000};
+    };
+
+    /**
+     * @brief Returns the next recipient, or nothing when exhausted. Called
+     * from one thread at a time.
+     */
+    using RecipientSource = std::function<std::optional<std::int64_t>()>;
+
+    /**
+     * @brief Sends the message to one chat. Any TgException it throws is
+     * recorded as that recipient's outcome. Its requests take the
+     * RequestPriority::Bulk lane.
+     */
+    using Sender = std::function<void(const Api& api, std::int64_t chatId)>;
+
+    using ResultListener = std::function<void(const Result& result)>;
+    using ProgressListener = std::function<void(const Stats& stats)>;
+
+    explicit Broadcaster(const Api& api);
+    Broadcaster(const Api& api, Options options);
+
+    /**
+     * @brief Registers a listener called once per recipient. Called from the
+     * worker threads, so it must be thread-safe.
+     */
+    void onResult(ResultListener listener) { _onResult = std::move(listener); }
+
+    /**
+     * @brief Registers a listener called every Options::progressInterval and
+     * once at the end of the job. Called from the worker threads, one at a
+     * time.
+     */
+    void onProgress(ProgressListener listener) {
+        _onProgress = std::move(listener);
+    }
+
+    /**
+     * @brief Runs the job. Blocks until the source is exhausted or cancel()
+     * is called.
+     *
+     * An exception from @p recipients, from a listener, or one that @p sender
+     * throws and that is not a std::exception stops the job: the other
+     * workers finish their sends in progress, and run() throws Stopped with
+     * the statistics so far and that exception nested in it.
+     *
+     * @param recipients Source of chat ids. To resume a job it must yield the
+     * same recipients in the same order as the interrupted run.
+     * @param sender Sends the message to one chat.
+     * @param resumeFrom Number of recipients to skip, usually the checkpoint
+     * of an earlier run.
+     *
+     * @return Final statistics of this run.
+     */
+    Stats run(const RecipientSource& recipients, const Sender& sender,
+              std::uint64_t resumeFrom = 0);
+
+    /**
+     * @brief Stops handing out new recipients. Sends already in progress are
+     * completed and run() returns. If no job is running, the next run()
+     * returns right away. Thread-safe.
+     */
+    void cancel() { _cancelled = true; }
+
+    /**
+     * @brief Sender for a plain text message.
+     */
+    static Sender textMessage(std::string text,
+                              Api::ParseMode parseMode = Api::ParseMode::None);
+
+   private:
+    const Api& _api;
+    Options _options;
+    ResultListener _onResult;
+    ProgressListener _onProgress;
+    std::atomic<bool> _cancelled{false};
+};
+
+}  // namespace TgBot
+
+#endif  // TGBOT_BROADCASTER_H
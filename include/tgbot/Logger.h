@@ -1,8 +1,13 @@
 #ifndef TGBOT_LOGGER_H
 #define TGBOT_LOGGER_H
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "tgbot/export.h"
 
@@ -22,6 +27,34 @@ enum class LogLevel {
     Off,
 };
 
+/**
+ * @brief One key/value pair attached to a log record, e.g. the method name of
+ * a request.
+ *
+ * @ingroup tools
+ */
+struct LogField {
+    std::string key;
+    std::string value;
+};
+
+/**
+ * @brief A structured log record: a short message plus key/value fields.
+ *
+ * @ingroup tools
+ */
+struct LogRecord {
+    LogLevel level = LogLevel::Info;
+    std::chrono::system_clock::time_point time;
+    std::string message;
+    std::vector<LogField> fields;
+
+    /**
+     * @brief Renders the record as "message key=value key=value".
+     */
+    [[nodiscard]] TGBOT_API std::string format() const;
+};
+
 /**
  * @brief Sink interface for the library's diagnostics.
  *
@@ -43,6 +76,23 @@ class TGBOT_API Logger {
      * threads.
      */
     virtual void log(LogLevel level, const std::string& message) = 0;
+
+    /**
+     * @brief Receives a structured record. The default implementation passes
+     * LogRecord::format() to log(LogLevel, const std::string&); override it to
+     * keep the fields separate.
+     */
+    virtual void log(const LogRecord& record) {
+        log(record.level, record.format());
+    }
+
+    /**
+     * @brief Lowest level this logger is interested in.
+     *
+     * Read once when the logger is registered: records below it are dropped
+     * by the library before any formatting happens.
+     */
+    [[nodiscard]] virtual LogLevel minLevel() const { return LogLevel::Trace; }
 };
 
 /**
@@ -54,15 +104,63 @@ class TGBOT_API Logger {
 class TGBOT_API DefaultLogger : public Logger {
    public:
     explicit DefaultLogger(LogLevel minLevel = LogLevel::Warning);
+    using Logger::log;
     void log(LogLevel level, const std::string& message) override;
+    [[nodiscard]] LogLevel minLevel() const override { return _minLevel; }
 
    private:
     LogLevel _minLevel;
 };
 
+/**
+ * @brief Logger that hands records to another logger on a background thread.
+ *
+ * Records are pushed into a fixed-size lock-free ring buffer, so logging
+ * threads never block on the sink or on each other. When the buffer is full
+ * new records are dropped and counted rather than stalling the caller.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API AsyncLogger : public Logger {
+   public:
+    /**
+     * @param sink Logger that receives the records on the background thread
+     * @param capacity Number of records the buffer holds, rounded up to a
+     * power of two
+     */
+    explicit AsyncLogger(std::shared_ptr<Logger> sink,
+                         std::size_t capacity = 8192);
+
+    /**
+     * @brief Delivers the records still buffered and stops the thread.
+     */
+    ~AsyncLogger() override;
+
+    void log(LogLevel level, const std::string& message) override;
+    void log(const LogRecord& record) override;
+    [[nodiscard]] LogLevel minLevel() const override;
+
+    /**
+     * @brief Blocks until every record logged before the call has been
+     * delivered to the sink.
+     */
+    void flush();
+
+    /**
+     * @brief Number of records dropped because the buffer was full.
+     */
+    [[nodiscard]] std::uint64_t dropped() const;
+
+   private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
 /**
  * @brief Registers the logger used by the library. Pass nullptr to restore the
- * default (stderr) logger. Thread-safe.
+ * default (stderr) logger. Thread-safe, and may be called from inside
+ * Logger::log(). Calls still running on the previous logger finish on it; it
+ * is released once they returned.
  *
  * @ingroup tools
  */
@@ -77,11 +175,18 @@ TGBOT_API std::shared_ptr<Logger> getLogger();
 
 namespace detail {
 
+/**
+ * @brief Whether records of @p level reach the registered logger. Check it
+ * before building an expensive message.
+ */
+TGBOT_API bool enabled(LogLevel level) noexcept;
+
 /**
  * @brief Convenience wrapper used by the library to emit a log record through
  * the registered logger.
  */
-TGBOT_API void log(LogLevel level, const std::string& message);
+TGBOT_API void log(LogLevel level, std::string message,
+                   std::vector<LogField> fields = {});
 
 }  // namespace detail
 
@@ -0,0 +1,223 @@
+#ifndef TGBOT_METRICS_H
+#define TGBOT_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "tgbot/export.h"
+
+namespace TgBot {
+
+/**
+ * @brief Label name/value pairs identifying one series of a metric, e.g.
+ * {{"method", "sendMessage"}}.
+ *
+ * @ingroup tools
+ */
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Monotonically increasing count. Thread-safe and lock-free.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API Counter {
+   public:
+    void add(std::uint64_t n = 1) noexcept {
+        _value.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t value() const noexcept {
+        return _value.load(std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic<std::uint64_t> _value{0};
+};
+
+/**
+ * @brief Distribution of durations with HDR-style log-linear buckets.
+ *
+ * Values are recorded in microseconds into buckets that split every power of
+ * two into 8 linear steps, so any recorded value is known to within 12.5%
+ * from 1us up to several days, with a fixed memory footprint and a single
+ * atomic increment per record. Thread-safe and lock-free.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API Histogram {
+   public:
+    static constexpr std::size_t kBucketCount = 8 + 40 * 8;
+
+    void record(std::chrono::nanoseconds value) noexcept;
+
+    [[nodiscard]] std::uint64_t count() const noexcept {
+        return _count.load(std::memory_order_relaxed);
+    }
+
+    /// Sum of all recorded values.
+    [[nodiscard]] std::chrono::microseconds sum() const noexcept {
+        return std::chrono::microseconds(_sum.load(std::memory_order_relaxed));
+    }
+
+    [[nodiscard]] std::chrono::microseconds max() const noexcept {
+        return std::chrono::microseconds(_max.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Value below which the fraction @p q of the records fall, e.g.
+     * quantile(0.99) for p99. Accurate to the bucket width.
+     */
+    [[nodiscard]] std::chrono::microseconds quantile(double q) const noexcept;
+
+    /**
+     * @brief Number of records in buckets entirely at or below @p bound. A
+     * bucket that straddles @p bound is counted from the first bound at or
+     * above its largest value on.
+     */
+    [[nodiscard]] std::uint64_t countAtOrBelow(
+        std::chrono::microseconds bound) const noexcept;
+
+    static std::size_t bucketOf(std::uint64_t micros) noexcept;
+    static std::uint64_t bucketUpperBound(std::size_t bucket) noexcept;
+
+   private:
+    std::array<std::atomic<std::uint64_t>, kBucketCount> _buckets{};
+    std::atomic<std::uint64_t> _count{0};
+    std::atomic<std::uint64_t> _sum{0};
+    std::atomic<std::uint64_t> _max{0};
+};
+
+/**
+ * @brief Registry of the library's counters and histograms.
+ *
+ * Register an instance with setMetrics() and the library records, among
+ * others:
+ * - tgbot_api_request_duration_seconds{method}: Bot API call latency,
+ *   including retries;
+ * - tgbot_api_responses_total{method,status}: responses by Bot API error code
+ *   (200 on success), "network" for transport failures, "timeout" and
+ *   "cancelled" for calls ended by their RequestOptions, or "circuit_open"
+ *   for calls failed by their RetryPolicy's circuit breaker;
+ * - tgbot_api_retries_total{method,cause}: retries after rate limiting or
+ *   network errors;
+ * - tgbot_api_rate_limit_wait_seconds{method}: time slept on 429 responses;
+ * - tgbot_update_parse_duration_seconds{type}: parse time per update type;
+ * - tgbot_listener_duration_seconds{event}: time spent in the listeners of
+ *   each event.
+ * - tgbot_webhook_rejections_total{reason}: webhook requests rejected
+ *   before parsing, see TgWebhookServer.
+ * - tgbot_bothost_dropped_updates_total{bot}: updates a BotHost skipped
+ *   after their listeners kept failing, see
+ *   BotHostOptions::maxUpdateAttempts.
+ *
+ * Series recorded inside a MetricsLabelScope carry its labels as well.
+ *
+ * toPrometheus() renders everything in the Prometheus text format; see
+ * TgWebhookServer::exposeMetrics() to serve it next to the webhook.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API Metrics {
+   public:
+    /**
+     * @brief Returns the counter @p name with @p labels, creating it on first
+     * use. The reference stays valid for the lifetime of the registry.
+     */
+    Counter& counter(std::string_view name, const MetricLabels& labels = {});
+
+    /**
+     * @brief Returns the histogram @p name with @p labels, creating it on
+     * first use. The reference stays valid for the lifetime of the registry.
+     */
+    Histogram& histogram(std::string_view name,
+                         const MetricLabels& labels = {});
+
+    /**
+     * @brief Sets the HELP text printed for @p name.
+     */
+    void describe(std::string_view name, std::string help);
+
+    /**
+     * @brief Renders all metrics in the Prometheus text exposition format.
+     * Histograms are reported in seconds.
+     */
+    [[nodiscard]] std::string toPrometheus() const;
+
+   private:
+    struct Family {
+        std::string help;
+        // Keyed by the rendered label set, e.g. method="getMe".
+        std::map<std::string, std::unique_ptr<Counter>> counters;
+        std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    };
+
+    Family& family(std::string_view name);
+
+    mutable std::shared_mutex _mutex;
+    std::map<std::string, Family, std::less<>> _families;
+};
+
+/**
+ * @brief Registers the metrics registry the library records into. Pass
+ * nullptr to stop recording. A registry that is replaced lives on until the
+ * requests in flight are done recording into it. Thread-safe.
+ *
+ * @ingroup tools
+ */
+TGBOT_API void setMetrics(std::shared_ptr<Metrics> metrics);
+
+/**
+ * @brief Returns the registered metrics registry, or nullptr. Thread-safe.
+ *
+ * @ingroup tools
+ */
+TGBOT_API std::shared_ptr<Metrics> getMetrics();
+
+/**
+ * @brief Adds the label @p name=@p value to every series the library records
+ * on this thread while the scope is alive, e.g. {"bot", "123456"} so that
+ * several bots in one process (see BotHost) are told apart. Scopes nest.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API MetricsLabelScope {
+   public:
+    MetricsLabelScope(std::string name, std::string value);
+    ~MetricsLabelScope();
+
+    MetricsLabelScope(const MetricsLabelScope&) = delete;
+    MetricsLabelScope& operator=(const MetricsLabelScope&) = delete;
+};
+
+namespace detail {
+
+/**
+ * @brief @p labels followed by the labels of the thread's active
+ * MetricsLabelScopes.
+ */
+TGBOT_API MetricLabels scopedLabels(MetricLabels labels);
+
+/**
+ * @brief The registry to record into, or nullptr when metrics are off, in
+ * which case it is a single atomic load; callers check it before taking any
+ * timestamps. Hold on to the result for as long as a recording is under way.
+ */
+TGBOT_API std::shared_ptr<Metrics> metrics() noexcept;
+
+}  // namespace detail
+
+}  // namespace TgBot
+
+#endif  // TGBOT_METRICS_H
@@ -0,0 +1,78 @@
+#ifndef TGBOT_OFFSETSTORE_H
+#define TGBOT_OFFSETSTORE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tgbot/export.h"
+
+namespace TgBot {
+
+/**
+ * @brief Long polling progress as persisted by an OffsetStore.
+ *
+ * @ingroup net
+ */
+struct OffsetState {
+    /// Offset to resume getUpdates from: every update below it was handled.
+    std::int32_t offset = 0;
+
+    /// Ids of the most recently handled updates, oldest first, used to skip
+    /// updates that are delivered again after a restart or a handoff.
+    std::vector<std::int32_t> handled;
+};
+
+/**
+ * @brief Persists long polling progress so that a restarted bot, or another
+ * instance taking over, resumes after the last handled update.
+ *
+ * See TgLongPoll::setOffsetStore().
+ *
+ * @ingroup net
+ */
+class TGBOT_API OffsetStore {
+   public:
+    virtual ~OffsetStore() = default;
+
+    /**
+     * @brief Returns the state saved last, or a default state if there is
+     * none.
+     */
+    virtual OffsetState load() = 0;
+
+    /**
+     * @brief Saves @p state durably. Called once per batch of updates, after
+     * their handlers returned and before the batch is confirmed to Telegram.
+     */
+    virtual void save(const OffsetState& state) = 0;
+};
+
+/**
+ * @brief OffsetStore backed by a small text file.
+ *
+ * Each save writes a temporary file, flushes it to disk with fsync and
+ * renames it over the previous one, so the file always holds a complete
+ * state even if the process or machine crashes mid-save. The directory is
+ * flushed as well, so that a saved state survives a crash.
+ *
+ * load() throws std::runtime_error if the file exists but cannot be read
+ * as a state, rather than starting over from offset 0. Failing file
+ * operations throw std::system_error carrying errno.
+ *
+ * @ingroup net
+ */
+class TGBOT_API FileOffsetStore : public OffsetStore {
+   public:
+    explicit FileOffsetStore(std::string path);
+
+    OffsetState load() override;
+    void save(const OffsetState& state) override;
+
+   private:
+    std::string _path;
+};
+
+}  // namespace TgBot
+
+#endif  // TGBOT_OFFSETSTORE_H
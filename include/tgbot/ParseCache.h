@@ -0,0 +1,97 @@
+#ifndef TGBOT_PARSECACHE_H
+#define TGBOT_PARSECACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include <nlohmann/json.hpp>
+
+#include "tgbot/export.h"
+
+namespace TgBot {
+
+/**
+ * @brief Process-wide cache that lets parse() return the same User, Chat and
+ * Sticker object for every update carrying an identical copy of it.
+ *
+ * A bot sees the same senders, chats and stickers over and over; with the
+ * cache enabled, an object whose id and content hash match one parsed before
+ * is not parsed again, and every update that keeps it shares one copy of its
+ * strings. Entries are evicted least recently used first once @p capacity is
+ * reached. The cache is split into independently locked shards, so threads
+ * parsing updates concurrently rarely wait for each other.
+ *
+ * Cached objects are shared between updates and must not be modified. Off by
+ * default.
+ *
+ * @ingroup general
+ */
+class TGBOT_API ParseCache {
+   public:
+    struct Stats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+
+        /// Objects currently cached.
+        std::size_t size = 0;
+    };
+
+    /**
+     * @brief Starts caching, keeping at most about @p capacity objects.
+     * Enabling it again changes the capacity and keeps what is cached.
+     */
+    static void enable(std::size_t capacity = 4096);
+
+    /// Stops caching and drops every cached object.
+    static void disable();
+
+    [[nodiscard]] static bool enabled() noexcept;
+
+    [[nodiscard]] static Stats stats();
+};
+
+namespace detail {
+
+enum class CachedType : std::uint8_t { User, Chat, Sticker };
+
+struct CacheKey {
+    CachedType type;
+    std::uint64_t id;
+    std::size_t hash;
+};
+
+/**
+ * @brief Where data would be cached, or nothing if the cache is disabled or
+ * data has no id.
+ */
+TGBOT_API std::optional<CacheKey> cacheKey(CachedType type,
+                                           const nlohmann::json& data);
+
+TGBOT_API std::shared_ptr<void> findCached(const CacheKey& key);
+
+TGBOT_API void storeCached(const CacheKey& key, std::shared_ptr<void> object);
+
+/// The object cached under @p key, or nullptr.
+template <typename T>
+std::shared_ptr<T> findCached(const std::optional<CacheKey>& key) {
+    if (!key) {
+        return nullptr;
+    }
+    return std::static_pointer_cast<T>(findCached(*key));
+}
+
+template <typename T>
+void storeCached(const std::optional<CacheKey>& key,
+                 const std::shared_ptr<T>& object) {
+    if (key) {
+        storeCached(*key, std::static_pointer_cast<void>(object));
+    }
+}
+
+}  // namespace detail
+
+}  // namespace TgBot
+
+#endif  // TGBOT_PARSECACHE_H
@@ -1,11 +1,16 @@
 #ifndef TGBOT_TGEXCEPTION_H
 #define TGBOT_TGEXCEPTION_H
 
+#include <chrono>
 #include <cstdint>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
 
 #include "tgbot/export.h"
+#include "tgbot/types/ResponseParameters.h"
 
 namespace TgBot {
 
@@ -27,15 +32,120 @@ class TGBOT_API TgException : public std::runtime_error {
         NotFound = 404,
         Flood = 402,
         Conflict = 409,
+        TooManyRequests = 429,
         Internal = 500,
         HtmlResponse = 100,
         InvalidJson = 101
     };
 
-    explicit TgException(const std::string& description, ErrorCode errorCode)
-        : runtime_error(description), errorCode(errorCode) {}
+    /**
+     * @brief Why Telegram refused the request, classified from the error code
+     * and description so callers don't have to match the message text.
+     */
+    enum class Reason {
+        Unknown,
+        /// The user has blocked the bot.
+        BotBlocked,
+        /// The user's account was deleted.
+        UserDeactivated,
+        /// The bot was removed from the group or channel.
+        BotKicked,
+        /// The user never started a conversation with the bot.
+        CannotInitiateConversation,
+        ChatNotFound,
+        /// The group was upgraded to a supergroup, see migrateToChatId().
+        ChatMigrated,
+        /// Flood control, see retryAfter().
+        RateLimited,
+    };
+
+    explicit TgException(const std::string& description, ErrorCode errorCode,
+                         ResponseParameters::Ptr parameters = nullptr)
+        : runtime_error(description),
+          errorCode(errorCode),
+          reason(classify(errorCode, description, parameters.get())),
+          parameters(std::move(parameters)) {}
 
     ErrorCode errorCode;
+
+    Reason reason;
+
+    /**
+     * @brief Extra information Telegram sent along with the error, nullptr if
+     * none.
+     */
+    ResponseParameters::Ptr parameters;
+
+    /**
+     * @brief Seconds to wait before the request can be repeated, if Telegram
+     * reported a flood wait.
+     */
+    [[nodiscard]] std::optional<std::chrono::seconds> retryAfter() const {
+        if (parameters && parameters->retryAfter) {
+            return std::chrono::seconds(*parameters->retryAfter);
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief New identifier of a group that was upgraded to a supergroup.
+     */
+    [[nodiscard]] std::optional<std::int64_t> migrateToChatId() const {
+        if (parameters) {
+            return parameters->migrateToChatId;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief True if the chat can't receive messages from the bot (blocked,
+     * deleted, kicked, never started or gone).
+     */
+    [[nodiscard]] bool isRecipientUnreachable() const {
+        switch (reason) {
+            case Reason::BotBlocked:
+            case Reason::UserDeactivated:
+            case Reason::BotKicked:
+            case Reason::CannotInitiateConversation:
+            case Reason::ChatNotFound:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static Reason classify(ErrorCode errorCode, std::string_view description,
+                           const ResponseParameters* parameters = nullptr) {
+        const auto mentions = [description](std::string_view text) {
+            return description.find(text) != std::string_view::npos;
+        };
+        if (errorCode == ErrorCode::TooManyRequests ||
+            (parameters && parameters->retryAfter)) {
+            return Reason::RateLimited;
+        }
+        if ((parameters && parameters->migrateToChatId) ||
+            mentions("upgraded to a supergroup")) {
+            return Reason::ChatMigrated;
+        }
+        if (errorCode == ErrorCode::Forbidden) {
+            if (mentions("blocked by the user")) {
+                return Reason::BotBlocked;
+            }
+            if (mentions("deactivated")) {
+                return Reason::UserDeactivated;
+            }
+            if (mentions("kicked") || mentions("not a member")) {
+                return Reason::BotKicked;
+            }
+            if (mentions("can't initiate conversation")) {
+                return Reason::CannotInitiateConversation;
+            }
+        }
+        if (mentions("chat not found")) {
+            return Reason::ChatNotFound;
+        }
+        return Reason::Unknown;
+    }
 };
 
 /**
@@ -46,7 +156,22 @@ class TGBOT_API TgException : public std::runtime_error {
  */
 class TGBOT_API NetworkException : public std::runtime_error {
    public:
-    enum class State { Unknown, Connect, Handshake, Write, Read } state{};
+    /**
+     * @brief Where the request failed. Timeout and Cancelled come from
+     * RequestOptions: the call's budget ran out or its token was cancelled.
+     * CircuitOpen means the request was not sent at all, because its
+     * RetryPolicy's circuit breaker is open.
+     */
+    enum class State {
+        Unknown,
+        Connect,
+        Handshake,
+        Write,
+        Read,
+        Timeout,
+        Cancelled,
+        CircuitOpen
+    } state{};
 
     explicit inline NetworkException(State state,
                                      const std::string& description)
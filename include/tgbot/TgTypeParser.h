@@ -5,9 +5,12 @@
 
 #include "tgbot/TgException.h"
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -73,6 +76,19 @@ constexpr bool is_matrix_v = is_matrix<T>::value;
 template <typename>
 inline constexpr bool always_false_v = false;
 
+// data[key] if data is an object that has key, else nullptr. One lookup, and
+// since nlohmann::json 3.11 no std::string is built for the key.
+inline const nlohmann::json *field(const nlohmann::json &data,
+                                   std::string_view key) {
+#if NLOHMANN_JSON_VERSION_MAJOR > 3 || \
+    (NLOHMANN_JSON_VERSION_MAJOR == 3 && NLOHMANN_JSON_VERSION_MINOR >= 11)
+    const auto it = data.find(key);
+#else
+    const auto it = data.find(std::string(key));
+#endif
+    return it != data.end() ? &*it : nullptr;
+}
+
 }  // namespace detail
 
 // Parse function for shared_ptr<T>. This primary template is only selected when
@@ -99,20 +115,22 @@ std::vector<std::shared_ptr<T>> parseArray(const nlohmann::json &data) {
 // Parse array from a key.
 template <typename T>
 std::vector<std::shared_ptr<T>> parseRequiredArray(const nlohmann::json &data,
-                                           const std::string &key) {
-    if (!data.contains(key)) {
+                                                   std::string_view key) {
+    const nlohmann::json *value = detail::field(data, key);
+    if (value == nullptr) {
         return {};
     }
-    return parseArray<T>(data[key]);
+    return parseArray<T>(*value);
 }
 
 template <typename T>
 std::optional<std::vector<std::shared_ptr<T>>> parseArray(const nlohmann::json& data,
-    const std::string& key) {
-    if (!data.contains(key)) {
+    std::string_view key) {
+    const nlohmann::json *value = detail::field(data, key);
+    if (value == nullptr) {
         return std::nullopt;
     }
-    return parseArray<T>(data[key]);
+    return parseArray<T>(*value);
 }
 
 // Parse 2D array of T from JSON.
@@ -127,38 +145,43 @@ Matrix<std::shared_ptr<T>> parseMatrix(const nlohmann::json &data) {
 
 template <typename T>
 Matrix<std::shared_ptr<T>> parseMatrix(const nlohmann::json &data,
-                                       const std::string &key) {
-    if (!data.contains(key)) {
+                                       std::string_view key) {
+    const nlohmann::json *value = detail::field(data, key);
+    if (value == nullptr) {
         return {};
     }
-    return parseMatrix<T>(data[key]);
+    return parseMatrix<T>(*value);
 }
 
 // Parse an array of primitive types.
 template <typename T>
-std::optional<std::vector<T>> parsePrimitiveArray(const nlohmann::json &data,
-                                   const std::string &key) {
-    if (!data.contains(key)) {
-        return std::nullopt;
-    }
+std::vector<T> parsePrimitiveArray(const nlohmann::json &data) {
     std::vector<T> result;
-    for (const auto &item : data[key]) {
+    result.reserve(data.size());
+    for (const auto &item : data) {
         result.emplace_back(item.get<T>());
     }
     return result;
 }
 
+template <typename T>
+std::optional<std::vector<T>> parsePrimitiveArray(const nlohmann::json &data,
+                                                  std::string_view key) {
+    const nlohmann::json *value = detail::field(data, key);
+    if (value == nullptr) {
+        return std::nullopt;
+    }
+    return parsePrimitiveArray<T>(*value);
+}
+
 template <typename T>
 std::vector<T> parsePrimitiveRequiredArray(const nlohmann::json& data,
-    const std::string& key) {
-    if (!data.contains(key)) {
+    std::string_view key) {
+    const nlohmann::json *value = detail::field(data, key);
+    if (value == nullptr) {
         return {};
     }
-    std::vector<T> result;
-    for (const auto& item : data[key]) {
-        result.emplace_back(item.get<T>());
-    }
-    return result;
+    return parsePrimitiveArray<T>(*value);
 }
 
 // Put function for objects to JSON. This primary template is only selected when
@@ -219,19 +242,21 @@ std::string putJSON(const T &object) {
 
 // T should be instance of std::shared_ptr.
 template <typename T>
-std::optional<std::shared_ptr<T>> parse(const nlohmann::json& data, const std::string& key) {
-    if (!data.contains(key)) {
+std::optional<std::shared_ptr<T>> parse(const nlohmann::json& data, std::string_view key) {
+    const nlohmann::json *value = detail::field(data, key);
+    if (value == nullptr) {
         return std::nullopt;
     }
-    return parse<T>(data[key]);
+    return parse<T>(*value);
 }
 
 template <typename T>
-std::shared_ptr<T> parseRequired(const nlohmann::json& data, const std::string& key) {
-    if (!data.contains(key)) {
+std::shared_ptr<T> parseRequired(const nlohmann::json& data, std::string_view key) {
+    const nlohmann::json *value = detail::field(data, key);
+    if (value == nullptr) {
         return nullptr;
     }
-    return parse<T>(data[key]);
+    return parse<T>(*value);
 }
 
 
@@ -249,19 +274,19 @@ struct JsonWrapper {
     template <typename T,
         std::enable_if_t<detail::is_primitive_v<T>, bool> = true>
     void put(const std::string_view key, T value) {
-        data_[std::string(key)] = std::move(value);
+        slot(key) = std::move(value);
     }
     // Required objects
     template <typename T,
         std::enable_if_t<!detail::is_primitive_v<T>, bool> = true>
     void put(const std::string_view key, const std::shared_ptr<T>& value) {
-        data_[std::string(key)] = TgBot::put(value);
+        slot(key) = TgBot::put(value);
     }
 
     // Support for vector of primitives and objects
     template <typename T>
     void put(const std::string_view key, const std::vector<T>& value) {
-        data_[std::string(key)] = TgBot::put(value);
+        slot(key) = TgBot::put(value);
     }
 
     // Overload for optional types
@@ -271,7 +296,7 @@ struct JsonWrapper {
         if (!value) {
             return;  // Skip empty optional
         }
-        data_[std::string(key)] = *value;
+        slot(key) = *value;
     }
     template <typename T,
         std::enable_if_t<!detail::is_primitive_v<T>, bool> = true>
@@ -279,7 +304,7 @@ struct JsonWrapper {
         if (!value) {
             return;  // Skip empty optional
         }
-        data_[std::string(key)] = TgBot::put(*value);
+        slot(key) = TgBot::put(*value);
     }
 
     static void merge(nlohmann::json& thiz, const nlohmann::json& other) {
@@ -303,14 +328,172 @@ struct JsonWrapper {
         data_ = std::move(other);
         return *this;
     }
-    operator nlohmann::json() const { return data_; }
+    operator nlohmann::json() const& { return data_; }
+    // Returning a local wrapper moves the document out instead of copying
+    // it, which would copy every nested object once per level.
+    operator nlohmann::json() && { return std::move(data_); }
 
 private:
+    // The value under key, created as null if missing. Generated serializers
+    // put keys in ascending order, so each one is appended in constant time
+    // instead of searched for from the root of the object.
+    nlohmann::json& slot(const std::string_view key) {
+        if (!data_.is_object()) {
+            return data_[std::string(key)];
+        }
+        auto& object = data_.get_ref<nlohmann::json::object_t&>();
+        return object.emplace_hint(object.end(), key, nullptr)->second;
+    }
+
     nlohmann::json data_;
 };
 
+namespace detail {
+
+// FNV-1a hash of a discriminator string, for TypeTable.
+constexpr std::uint32_t typeNameHash(std::string_view name) noexcept {
+    std::uint32_t hash = 2166136261U;
+    for (const char c : name) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 16777619U;
+    }
+    return hash;
+}
+
+// Maps the discriminator strings of a type ("bold", "photo", ...) to values.
+// The compiler lays the names out in an open-addressing hash table at most
+// half full, so a lookup hashes the name once and compares it with about one
+// candidate instead of walking an if/else chain of string compares.
+template <typename Value, std::size_t N>
+class TypeTable {
+   public:
+    constexpr explicit TypeTable(
+        const std::pair<std::string_view, Value> (&entries)[N])
+        : _entries(), _slots() {
+        for (std::size_t i = 0; i < N; ++i) {
+            _entries[i].name = entries[i].first;
+            _entries[i].value = entries[i].second;
+            std::size_t slot = typeNameHash(entries[i].first) & (kSlots - 1);
+            while (_slots[slot] != 0) {
+                slot = (slot + 1) & (kSlots - 1);
+            }
+            _slots[slot] = static_cast<std::uint16_t>(i + 1);
+        }
+    }
+
+    // The value of name, or nullptr if the table does not have it.
+    constexpr const Value* find(std::string_view name) const noexcept {
+        std::size_t slot = typeNameHash(name) & (kSlots - 1);
+        for (; _slots[slot] != 0; slot = (slot + 1) & (kSlots - 1)) {
+            const Entry& entry = _entries[_slots[slot] - 1];
+            if (entry.name == name) {
+                return &entry.value;
+            }
+        }
+        return nullptr;
+    }
+
+   private:
+    struct Entry {
+        std::string_view name;
+        Value value{};
+    };
+
+    static constexpr std::size_t slotCount() {
+        std::size_t count = 1;
+        while (count < 2 * N) {
+            count <<= 1;
+        }
+        return count;
+    }
+    static constexpr std::size_t kSlots = slotCount();
+
+    std::array<Entry, N> _entries;
+    // Index + 1 into _entries; 0 marks a free slot.
+    std::array<std::uint16_t, kSlots> _slots;
+};
+
+template <typename Value, std::size_t N>
+constexpr TypeTable<Value, N> makeTypeTable(
+    const std::pair<std::string_view, Value> (&entries)[N]) {
+    return TypeTable<Value, N>(entries);
+}
+
+// Calls parseField(field, value) for every key of data that fields knows.
+// Generated parsers switch on the field, so an object costs one hash per key
+// it has rather than one lookup per field its type could have.
+template <typename Field, std::size_t N, typename ParseField>
+void parseFields(const nlohmann::json& data, const TypeTable<Field, N>& fields,
+                 ParseField&& parseField) {
+    if (!data.is_object()) {
+        return;
+    }
+    for (auto it = data.begin(); it != data.end(); ++it) {
+        if (const Field* field = fields.find(it.key())) {
+            parseField(*field, it.value());
+        }
+    }
+}
+
+// How to parse and put one subtype of a polymorphic Base.
+template <typename Base>
+struct Subtype {
+    std::shared_ptr<Base> (*parse)(const nlohmann::json&);
+    nlohmann::json (*put)(const std::shared_ptr<Base>&);
+};
+
+template <typename Base, typename Derived>
+constexpr Subtype<Base> subtype() noexcept {
+    return {[](const nlohmann::json& data) -> std::shared_ptr<Base> {
+                return TgBot::parse<Derived>(data);
+            },
+            [](const std::shared_ptr<Base>& object) {
+                return TgBot::put(std::static_pointer_cast<Derived>(object));
+            }};
+}
+
+// The string at data[key], without copying it; empty if there is none.
+inline std::string_view typeName(const nlohmann::json& data, const char* key) {
+    const auto it = data.find(key);
+    if (it == data.end() || !it->is_string()) {
+        return {};
+    }
+    return it->get_ref<const std::string&>();
+}
+
+// Parses the subtype of Base that data[key] names.
+template <typename Base, std::size_t N>
+std::shared_ptr<Base> parseSubtype(
+    const nlohmann::json& data, const char* key,
+    const TypeTable<Subtype<Base>, N>& subtypes, std::string_view baseName) {
+    const std::string_view type = typeName(data, key);
+    const Subtype<Base>* subtype = subtypes.find(type);
+    if (subtype == nullptr) {
+        throw invalidType(baseName, type);
+    }
+    return subtype->parse(data);
+}
+
+// Puts object as the subtype that type names. Subtypes put their own
+// discriminator, so their JSON is returned as is.
+template <typename Base, std::size_t N>
+nlohmann::json putSubtype(const std::shared_ptr<Base>& object,
+                          std::string_view type,
+                          const TypeTable<Subtype<Base>, N>& subtypes,
+                          std::string_view baseName) {
+    const Subtype<Base>* subtype = subtypes.find(type);
+    if (subtype == nullptr) {
+        throw invalidType(baseName, type);
+    }
+    return subtype->put(object);
+}
+
+}  // namespace detail
+
+namespace detail {
+
+// Reads the JSON value of a field into *value; null leaves it as it is.
 template <typename T>
-void parse(const nlohmann::json& data, const std::string& key, T* value) {
+void parseValue(const nlohmann::json& data, T* value) {
     using Type = std::conditional_t<detail::is_optional_v<T>,
         typename detail::is_optional<T>::type, T>;
     using FixedType =
@@ -319,16 +502,25 @@ void parse(const nlohmann::json& data, const std::string& key, T* value) {
         std::conditional_t<std::is_integral_v<Type>, int64_t, FixedType>;
     using FinalType =
         std::conditional_t<std::is_same_v<Type, bool>, bool, MoreFixedType>;
-    if (data.contains(key) && !data[key].is_null()) {
-        if constexpr (detail::is_primitive_v<Type>) {
-            *value = static_cast<Type>(data[key].get<FinalType>());
+    if (!data.is_null()) {
+        if constexpr (is_primitive_v<Type>) {
+            *value = static_cast<Type>(data.get<FinalType>());
         }
         else {
-            *value = parse<typename detail::is_shared_ptr<Type>::type>(data[key]);
+            *value = parse<typename is_shared_ptr<Type>::type>(data);
         }
     }
 }
 
+}  // namespace detail
+
+template <typename T>
+void parse(const nlohmann::json& data, std::string_view key, T* value) {
+    if (const nlohmann::json *field = detail::field(data, key)) {
+        detail::parseValue(*field, value);
+    }
+}
+
 
 // Declares the parse/put specializations for a registered type. Spelled as
 // std::shared_ptr<type> rather than type::Ptr so the declaration only needs a
@@ -386,6 +578,7 @@ IMPLEMENT_PARSERS(ChatPermissions);
 IMPLEMENT_PARSERS(ChatPhoto);
 IMPLEMENT_PARSERS(ChatShared);
 IMPLEMENT_PARSERS(ChosenInlineResult);
+IMPLEMENT_PARSERS(CompactMessage);
 IMPLEMENT_PARSERS(Contact);
 IMPLEMENT_PARSERS(Dice);
 IMPLEMENT_PARSERS(Document);
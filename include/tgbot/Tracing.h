@@ -0,0 +1,213 @@
+#ifndef TGBOT_TRACING_H
+#define TGBOT_TRACING_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "tgbot/export.h"
+
+namespace TgBot {
+
+/**
+ * @brief Identifies a span within a trace, in the W3C Trace Context /
+ * OpenTelemetry format (16-byte trace id, 8-byte span id).
+ *
+ * @ingroup tools
+ */
+struct TGBOT_API SpanContext {
+    std::array<std::uint8_t, 16> traceId{};
+    std::array<std::uint8_t, 8> spanId{};
+
+    [[nodiscard]] bool valid() const noexcept;
+
+    /// Lowercase hex of traceId.
+    [[nodiscard]] std::string traceIdHex() const;
+
+    /// Lowercase hex of spanId.
+    [[nodiscard]] std::string spanIdHex() const;
+
+    /**
+     * @brief Renders the context as a W3C traceparent header value.
+     */
+    [[nodiscard]] std::string toTraceparent() const;
+
+    /**
+     * @brief Parses a W3C traceparent header value, e.g. one received with a
+     * webhook request. Returns nothing for a malformed value, version ff, or
+     * an all-zero trace or parent id.
+     */
+    static std::optional<SpanContext> fromTraceparent(std::string_view header);
+};
+
+/**
+ * @brief A finished span, as handed to a SpanExporter.
+ *
+ * @ingroup tools
+ */
+struct SpanData {
+    std::string name;
+    SpanContext context;
+    /// All zero for a root span.
+    std::array<std::uint8_t, 8> parentSpanId{};
+    std::chrono::system_clock::time_point start;
+    std::chrono::system_clock::time_point end;
+    std::vector<std::pair<std::string, std::string>> attributes;
+    bool error = false;
+    std::string statusMessage;
+};
+
+/**
+ * @brief Receives finished spans. Implement it to forward spans to an
+ * OpenTelemetry SDK or collector. Called from the thread that ended the span,
+ * so implementations must be thread-safe.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API SpanExporter {
+   public:
+    virtual ~SpanExporter() = default;
+
+    virtual void exportSpan(const SpanData& span) = 0;
+};
+
+/**
+ * @brief Writes each span as one line of JSON, using the field names of the
+ * OTLP/JSON span encoding (traceId, spanId, parentSpanId, name,
+ * startTimeUnixNano, endTimeUnixNano, attributes, status), so the file can be
+ * loaded by tools that understand OTLP or replayed into a collector.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API FileSpanExporter : public SpanExporter {
+   public:
+    explicit FileSpanExporter(const std::string& path);
+
+    void exportSpan(const SpanData& span) override;
+
+   private:
+    std::mutex _mutex;
+    std::ofstream _out;
+};
+
+/**
+ * @brief Registers the exporter that receives finished spans. Pass nullptr to
+ * disable tracing, which reduces every span to a single atomic load. An
+ * exporter that is replaced lives on until the spans started on it have
+ * ended. Thread-safe.
+ *
+ * @ingroup tools
+ */
+TGBOT_API void setSpanExporter(std::shared_ptr<SpanExporter> exporter);
+
+/**
+ * @brief A timed operation within a trace.
+ *
+ * Creating a Span makes it the current span of the thread until it is
+ * destroyed, so spans opened meanwhile on the same thread (for instance the
+ * Api calls made by a listener) become its children. Use ContextScope to
+ * carry the current span over to another thread. A span that may end on
+ * another thread than the one that started it, such as an asynchronous
+ * request, is started Detached instead.
+ *
+ * When no exporter is registered a Span does nothing.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API Span {
+   public:
+    /**
+     * @brief Starts a span as a child of the thread's current span, or as the
+     * root of a new trace if there is none.
+     */
+    explicit Span(std::string_view name);
+
+    /**
+     * @brief Starts a span as a child of @p parent, e.g. a context received
+     * from a remote caller.
+     */
+    Span(std::string_view name, const SpanContext& parent);
+
+    /// Tag of the constructor below.
+    struct Detached {};
+
+    /**
+     * @brief Starts a span as a child of the thread's current span without
+     * making it the current span, so that it may end on any thread; spans
+     * started meanwhile do not become its children.
+     */
+    Span(std::string_view name, Detached);
+
+    /**
+     * @brief Ends the span and hands it to the exporter.
+     */
+    ~Span();
+
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+    /// Whether the span is recorded, i.e. an exporter is registered.
+    [[nodiscard]] bool recording() const noexcept { return _data != nullptr; }
+
+    void setAttribute(std::string_view key, std::string value);
+
+    /// Marks the span as failed.
+    void setError(std::string message);
+
+    [[nodiscard]] SpanContext context() const noexcept;
+
+    /**
+     * @brief Context of the thread's current span; invalid if there is none.
+     */
+    static SpanContext current() noexcept;
+
+   private:
+    void begin(std::string_view name, const SpanContext* parent,
+               bool makeCurrent);
+
+    std::unique_ptr<SpanData> _data;
+    std::shared_ptr<SpanExporter> _exporter;
+    const SpanContext* _previous = nullptr;
+    bool _current = false;
+};
+
+/**
+ * @brief Makes @p context the current span context of the thread for the
+ * lifetime of the scope, so that work handed to another thread or executor
+ * stays in the trace it was started from.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API ContextScope {
+   public:
+    explicit ContextScope(const SpanContext& context);
+    ~ContextScope();
+
+    ContextScope(const ContextScope&) = delete;
+    ContextScope& operator=(const ContextScope&) = delete;
+
+   private:
+    SpanContext _context;
+    const SpanContext* _previous;
+};
+
+namespace detail {
+
+/**
+ * @brief Whether an exporter is registered. A single atomic load.
+ */
+TGBOT_API bool tracingEnabled() noexcept;
+
+}  // namespace detail
+
+}  // namespace TgBot
+
+#endif  // TGBOT_TRACING_H
@@ -0,0 +1,105 @@
+#ifndef TGBOT_UPDATERECORDER_H
+#define TGBOT_UPDATERECORDER_H
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "tgbot/export.h"
+
+namespace TgBot {
+
+class EventHandler;
+
+/**
+ * @brief One captured update: the raw JSON payload and when it was received.
+ *
+ * @ingroup tools
+ */
+struct UpdateRecord {
+    std::chrono::system_clock::time_point time;
+    std::string payload;
+};
+
+/**
+ * @brief Appends received updates to a capture file, for replaying real
+ * traffic later with UpdateReplayer.
+ *
+ * Attach it with TgLongPoll::record() or TgWebhookServer::record(). Each
+ * record is framed as the 4 bytes F5 54 47 55, an 8-byte receive time
+ * (microseconds since the epoch), a 4-byte payload length and the CRC-32 of
+ * the time, the length and the payload, all little-endian, followed by the
+ * JSON payload. The file is only ever appended to, so several runs can be
+ * captured into one file. A record cut short by a crash, or damaged
+ * otherwise, is skipped on replay, which goes on with the next intact one.
+ *
+ * The constructor throws std::system_error if the file cannot be opened.
+ * Thread-safe.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API UpdateRecorder {
+   public:
+    explicit UpdateRecorder(const std::string& path);
+    ~UpdateRecorder();
+
+    UpdateRecorder(const UpdateRecorder&) = delete;
+    UpdateRecorder& operator=(const UpdateRecorder&) = delete;
+
+    /**
+     * @brief Appends @p payload, a single Update as JSON, received at @p time.
+     */
+    void record(std::string_view payload,
+                std::chrono::system_clock::time_point time =
+                    std::chrono::system_clock::now());
+
+    /**
+     * @brief Writes buffered records to the file.
+     */
+    void flush();
+
+   private:
+    std::mutex _mutex;
+    std::ofstream _out;
+};
+
+/**
+ * @brief Reads a file written by UpdateRecorder and feeds the updates back
+ * through an EventHandler, so handlers and the library can be benchmarked
+ * against a real traffic mix without Telegram. The constructor throws
+ * std::system_error if the file cannot be opened.
+ *
+ * @ingroup tools
+ */
+class TGBOT_API UpdateReplayer {
+   public:
+    explicit UpdateReplayer(const std::string& path);
+
+    /**
+     * @brief Reads the next record, or returns nothing at the end of the file.
+     */
+    std::optional<UpdateRecord> next();
+
+    /**
+     * @brief Parses every remaining record and passes it to @p handler.
+     *
+     * @param speed Pace relative to the capture: 1 keeps the original gaps
+     * between updates, 2 halves them, and 0 replays as fast as possible.
+     * @return Number of updates replayed.
+     */
+    std::size_t replay(const EventHandler& handler, double speed = 1.0);
+
+   private:
+    // Moves to the next record start, or returns false at the end.
+    bool seekMagic();
+
+    std::ifstream _in;
+};
+
+}  // namespace TgBot
+
+#endif  // TGBOT_UPDATERECORDER_H
@@ -0,0 +1,181 @@
+#ifndef TGBOT_CORO_ASYNCAPI_H
+#define TGBOT_CORO_ASYNCAPI_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "tgbot/Api.h"
+#include "tgbot/TgTypeParser.h"
+#include "tgbot/coro/AsyncGenerator.h"
+#include "tgbot/coro/Task.h"
+#include "tgbot/export.h"
+#include "tgbot/net/EpollHttpClient.h"
+#include "tgbot/net/HttpReqArg.h"
+#include "tgbot/net/RequestOptions.h"
+#include "tgbot/types/File.h"
+#include "tgbot/types/GenericReply.h"
+#include "tgbot/types/InputFile.h"
+#include "tgbot/types/Message.h"
+#include "tgbot/types/ReplyParameters.h"
+#include "tgbot/types/Update.h"
+#include "tgbot/types/User.h"
+
+namespace TgBot::coro {
+
+/**
+ * @brief Awaitable Bot API calls on an EpollHttpClient.
+ *
+ * Every call is a Task that suspends while the request is in flight instead
+ * of blocking a thread, so a handler that chains several calls (getFile,
+ * downloadFile, sendPhoto) holds no thread between its round trips and many
+ * thousands of conversations can run on the client's few event loop threads.
+ *
+ * Calls go through the same pipeline as Api's: chat migrations, the
+ * RetryPolicy with its retry budget and circuit breaker, rate limits,
+ * metrics and tracing, and the RequestOptions in scope on the thread that
+ * first awaits the task. Any other error is thrown as TgException. Waits
+ * before a retry use EpollHttpClient::schedule(), so they hold no thread
+ * either.
+ *
+ * Coroutines resume on an event loop thread, possibly a different one after
+ * each call; they must not block there, in particular not with the blocking
+ * Api or syncWait(). The AsyncApi must outlive the tasks it returned.
+ *
+ * The common methods have typed wrappers below; call() and request() reach
+ * every other Bot API method.
+ *
+ * @ingroup coro
+ */
+class TGBOT_API AsyncApi {
+   public:
+    using ChatIdType = Api::ChatIdType;
+    using FileHandleType = Api::FileHandleType;
+    using ParseMode = Api::ParseMode;
+
+    AsyncApi(std::string token, std::shared_ptr<EpollHttpClient> httpClient,
+             std::string url = "https://api.telegram.org");
+
+    /**
+     * @brief Calls Bot API method @p method with @p args.
+     * @return The "result" field of the response.
+     */
+    Task<nlohmann::json> call(std::string method,
+                              HttpReqArg::Vec args = {}) const;
+
+    /**
+     * @brief Like call(), with the result converted to @p T: a type's Ptr
+     * (e.g. Message::Ptr), a std::vector of those, or a JSON primitive such
+     * as bool or std::string.
+     */
+    template <typename T>
+    Task<T> request(std::string method, HttpReqArg::Vec args = {}) const {
+        co_return convert<T>(co_await call(std::move(method), std::move(args)));
+    }
+
+    /// Awaitable Api::getMe().
+    Task<User::Ptr> getMe() const;
+
+    /**
+     * @brief Awaitable Api::getUpdates(). The request gets @p timeout plus a
+     * margin as its own budget, so the long poll is not cut short by the
+     * EpollHttpClient's timeout.
+     */
+    Task<std::vector<Update::Ptr>> getUpdates(
+        std::optional<std::int32_t> offset = {}, std::int32_t limit = 100,
+        std::int32_t timeout = 0) const;
+
+    /// Awaitable Api::sendMessage() with its most used parameters.
+    Task<Message::Ptr> sendMessage(
+        ChatIdType chatId, std::string text,
+        std::optional<ParseMode> parseMode = {},
+        ReplyParameters::Ptr replyParameters = nullptr,
+        GenericReply::Ptr replyMarkup = nullptr) const;
+
+    /// Awaitable Api::sendPhoto() with its most used parameters.
+    Task<Message::Ptr> sendPhoto(ChatIdType chatId, FileHandleType photo,
+                                 std::string caption = {},
+                                 std::optional<ParseMode> parseMode = {},
+                                 GenericReply::Ptr replyMarkup = nullptr) const;
+
+    /// Awaitable Api::sendDocument() with its most used parameters.
+    Task<Message::Ptr> sendDocument(
+        ChatIdType chatId, FileHandleType document, std::string caption = {},
+        std::optional<ParseMode> parseMode = {},
+        GenericReply::Ptr replyMarkup = nullptr) const;
+
+    /// Awaitable Api::answerCallbackQuery() with its most used parameters.
+    Task<bool> answerCallbackQuery(std::string callbackQueryId,
+                                   std::string text = {},
+                                   bool showAlert = false) const;
+
+    /// Awaitable Api::deleteMessage().
+    Task<bool> deleteMessage(ChatIdType chatId, std::int32_t messageId) const;
+
+    /// Awaitable Api::getFile().
+    Task<File::Ptr> getFile(std::string fileId) const;
+
+    /**
+     * @brief Awaitable Api::downloadFile() for file paths served by the Bot
+     * API (not absolute paths of a local Bot API server).
+     */
+    Task<std::string> downloadFile(std::string filePath) const;
+
+    /**
+     * @brief Receives updates with getUpdates like TgLongPoll does, and yields
+     * them one by one. An update counts as handled once the consumer asks
+     * for the next one, and is confirmed by the getUpdates call after that.
+     *
+     * A stream that ends, because a getUpdates failed (with its exception)
+     * or because its consumer stopped, leaves the updates it did not hand
+     * over or that were not handled unconfirmed: the next stream of this
+     * AsyncApi, or of its copies, starts with them.
+     */
+    AsyncGenerator<Update::Ptr> updates(std::int32_t limit = 100,
+                                        std::int32_t timeout = 10) const;
+
+    /**
+     * @brief Suspends the calling coroutine for @p delay without holding a
+     * thread.
+     */
+    Task<void> sleep(std::chrono::milliseconds delay) const;
+
+   private:
+    Task<nlohmann::json> perform(std::string method, HttpReqArg::Vec args,
+                                 RequestOptions defaults) const;
+
+    template <typename T>
+    static T convert(const nlohmann::json& result) {
+        if constexpr (TgBot::detail::is_shared_ptr_v<T>) {
+            return parse<typename T::element_type>(result);
+        } else if constexpr (TgBot::detail::is_vector_v<T>) {
+            using Item = typename T::value_type;
+            if constexpr (TgBot::detail::is_shared_ptr_v<Item>) {
+                return parseArray<typename Item::element_type>(result);
+            } else {
+                return result.get<T>();
+            }
+        } else {
+            return result.get<T>();
+        }
+    }
+
+    std::string _url;
+    std::string _token;
+    std::string _methodUrl;
+    std::shared_ptr<EpollHttpClient> _httpClient;
+    std::shared_ptr<TgBot::detail::ApiContext> _ctx;
+    // First update_id not yet handled by a consumer of updates().
+    std::shared_ptr<std::atomic<std::int32_t>> _nextUpdateId;
+};
+
+}  // namespace TgBot::coro
+
+#endif  // TGBOT_CORO_ASYNCAPI_H
@@ -0,0 +1,136 @@
+#ifndef TGBOT_CORO_ASYNCGENERATOR_H
+#define TGBOT_CORO_ASYNCGENERATOR_H
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace TgBot::coro {
+
+/**
+ * @brief A coroutine that co_yields a sequence of T and may co_await in
+ * between, consumed one value at a time with next().
+ *
+ * @code
+ * auto updates = api.updates();
+ * while (auto update = co_await updates.next()) {
+ *     ...
+ * }
+ * @endcode
+ *
+ * The generator starts on the first next() and runs until its next co_yield
+ * or its end. It has a single consumer, which must not call next() again
+ * before the previous one completed.
+ *
+ * @ingroup coro
+ */
+template <typename T>
+class [[nodiscard]] AsyncGenerator {
+   public:
+    struct promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    // Hands control back to the consumer, on co_yield and at the end.
+    struct YieldAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        std::coroutine_handle<> await_suspend(Handle handle) const noexcept {
+            return handle.promise().consumer;
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type {
+        std::optional<T> current;
+        std::exception_ptr error;
+        std::coroutine_handle<> consumer;
+
+        AsyncGenerator get_return_object() noexcept {
+            return AsyncGenerator(Handle::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        YieldAwaiter final_suspend() const noexcept { return {}; }
+
+        template <typename U>
+        YieldAwaiter yield_value(U&& value) {
+            current.emplace(std::forward<U>(value));
+            return {};
+        }
+
+        void return_void() const noexcept {}
+        void unhandled_exception() noexcept {
+            error = std::current_exception();
+        }
+    };
+
+    explicit AsyncGenerator(Handle handle) noexcept : _handle(handle) {}
+
+    AsyncGenerator(AsyncGenerator&& other) noexcept
+        : _handle(std::exchange(other._handle, {})) {}
+
+    AsyncGenerator& operator=(AsyncGenerator&& other) noexcept {
+        if (this != &other) {
+            if (_handle) {
+                _handle.destroy();
+            }
+            _handle = std::exchange(other._handle, {});
+        }
+        return *this;
+    }
+
+    ~AsyncGenerator() {
+        if (_handle) {
+            _handle.destroy();
+        }
+    }
+
+    AsyncGenerator(const AsyncGenerator&) = delete;
+    AsyncGenerator& operator=(const AsyncGenerator&) = delete;
+
+    /**
+     * @brief Awaits the next value.
+     * @return The value, or std::nullopt once the generator has ended. An
+     * exception thrown by the generator is rethrown here and ends it.
+     */
+    auto next() noexcept {
+        struct Awaiter {
+            Handle handle;
+
+            bool await_ready() const noexcept {
+                return !handle || handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<> consumer) const noexcept {
+                handle.promise().consumer = consumer;
+                handle.promise().current.reset();
+                return handle;
+            }
+
+            std::optional<T> await_resume() const {
+                if (!handle) {
+                    return std::nullopt;
+                }
+                auto& promise = handle.promise();
+                if (promise.error) {
+                    std::rethrow_exception(std::exchange(promise.error, {}));
+                }
+                if (handle.done()) {
+                    return std::nullopt;
+                }
+                return std::move(promise.current);
+            }
+        };
+        return Awaiter{_handle};
+    }
+
+   private:
+    Handle _handle;
+};
+
+}  // namespace TgBot::coro
+
+#endif  // TGBOT_CORO_ASYNCGENERATOR_H
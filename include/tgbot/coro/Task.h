@@ -0,0 +1,204 @@
+#ifndef TGBOT_CORO_TASK_H
+#define TGBOT_CORO_TASK_H
+
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "tgbot/export.h"
+
+namespace TgBot::coro {
+
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+// Resumes whoever awaited the finished task.
+struct FinalAwaiter {
+    bool await_ready() const noexcept { return false; }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(
+        std::coroutine_handle<Promise> handle) const noexcept {
+        if (auto continuation = handle.promise().continuation) {
+            return continuation;
+        }
+        return std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+struct PromiseBase {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr error;
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+};
+
+template <typename T>
+struct Promise : PromiseBase {
+    std::optional<T> value;
+
+    Task<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U&& result) {
+        value.emplace(std::forward<U>(result));
+    }
+
+    T result() {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return std::move(*value);
+    }
+};
+
+template <>
+struct Promise<void> : PromiseBase {
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void result() const {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+// Coroutine that starts at once and frees itself when done.
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+template <typename T>
+Detached complete(Task<T> task, std::promise<T>& result) {
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(task);
+            result.set_value();
+        } else {
+            result.set_value(co_await std::move(task));
+        }
+    } catch (...) {
+        result.set_exception(std::current_exception());
+    }
+}
+
+}  // namespace detail
+
+/**
+ * @brief A lazily started coroutine that produces a T.
+ *
+ * The coroutine body runs when the task is co_awaited, and the awaiting
+ * coroutine resumes when it finishes, on whichever thread finished it. An
+ * exception thrown by the body is rethrown from co_await. Run a task from
+ * ordinary code with syncWait() or spawn().
+ *
+ * @ingroup coro
+ */
+template <typename T>
+class [[nodiscard]] Task {
+   public:
+    using promise_type = detail::Promise<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+        : _handle(handle) {}
+
+    Task(Task&& other) noexcept : _handle(std::exchange(other._handle, {})) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (_handle) {
+                _handle.destroy();
+            }
+            _handle = std::exchange(other._handle, {});
+        }
+        return *this;
+    }
+
+    ~Task() {
+        if (_handle) {
+            _handle.destroy();
+        }
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() const noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<> awaiting) const noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume() const { return handle.promise().result(); }
+        };
+        return Awaiter{_handle};
+    }
+
+   private:
+    std::coroutine_handle<promise_type> _handle;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> Promise<T>::get_return_object() noexcept {
+    return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> Promise<void>::get_return_object() noexcept {
+    return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Runs @p task and blocks the calling thread until it finishes.
+ *
+ * Must not be called from a thread that the task needs to make progress,
+ * such as an EpollHttpClient event loop thread.
+ *
+ * @return The task's result; its exception is rethrown.
+ * @ingroup coro
+ */
+template <typename T>
+T syncWait(Task<T> task) {
+    std::promise<T> result;
+    auto future = result.get_future();
+    detail::complete(std::move(task), result);
+    return future.get();
+}
+
+/**
+ * @brief Starts @p task without waiting for it. The task owns itself from
+ * then on; an exception escaping it is logged and dropped.
+ *
+ * @ingroup coro
+ */
+TGBOT_API void spawn(Task<void> task);
+
+}  // namespace TgBot::coro
+
+#endif  // TGBOT_CORO_TASK_H
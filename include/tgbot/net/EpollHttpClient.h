@@ -0,0 +1,119 @@
+#ifndef TGBOT_EPOLLHTTPCLIENT_H
+#define TGBOT_EPOLLHTTPCLIENT_H
+
+#ifdef __linux__
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "tgbot/net/HttpClient.h"
+#include "tgbot/net/HttpReqArg.h"
+#include "tgbot/net/RequestOptions.h"
+#include "tgbot/net/Url.h"
+
+namespace TgBot {
+
+/**
+ * @brief This class makes http requests on epoll event loops (Linux only).
+ *
+ * Every request is written, read and timed out by one of a few event loop
+ * threads on non-blocking sockets, with OpenSSL in non-blocking mode for
+ * HTTPS, so hundreds of Bot API calls in flight cost open sockets rather
+ * than threads. Connections are kept alive and reused per host, up to
+ * maxConnectionsPerHost at a time; further requests to that host queue on
+ * the loop until a connection is free. Queued requests are served by
+ * RequestPriority, and interactive ones may use
+ * interactiveConnectionsPerHost more connections.
+ *
+ * makeRequestAsync() is the native interface: it returns at once and calls
+ * back on the loop thread. makeRequest() submits the same way and blocks the
+ * calling thread until the response arrives, so the client also works as a
+ * drop-in HttpClient for Bot and Api.
+ *
+ * Host names are resolved on a thread of the client's own, so a slow DNS
+ * server never stalls a loop, and the addresses are reused for a minute.
+ * When connecting to one address fails or times out, the next is tried.
+ * Connections idle for 30 seconds are closed.
+ *
+ * @ingroup net
+ */
+class TGBOT_API EpollHttpClient : public HttpClient {
+   public:
+    /**
+     * @brief Receives the response body, or the exception the request failed
+     * with and an empty body.
+     */
+    using Callback =
+        std::function<void(std::string body, std::exception_ptr error)>;
+
+    /**
+     * @param timeout Time for a request to connect, be sent and be answered.
+     * @param maxConnectionsPerHost Simultaneous connections to one host.
+     * @param loopThreads Event loop threads; requests are spread over them.
+     * @param interactiveConnectionsPerHost Connections to one host beyond
+     * maxConnectionsPerHost that only RequestPriority::Interactive requests
+     * use.
+     */
+    explicit EpollHttpClient(std::chrono::seconds timeout = kDefaultTimeout,
+                             std::size_t maxConnectionsPerHost = 64,
+                             std::size_t loopThreads = 1,
+                             std::size_t interactiveConnectionsPerHost = 4);
+
+    /**
+     * @brief Stops the event loops. Requests still in flight fail with a
+     * NetworkException.
+     */
+    ~EpollHttpClient() override;
+
+    /**
+     * @brief Sends a request to the url and waits for the response.
+     *
+     * If there's no args specified, a GET request will be sent, otherwise a
+     * POST request will be sent. If at least 1 arg is marked as file, the
+     * content type of a request will be multipart/form-data, otherwise it will
+     * be application/x-www-form-urlencoded. Must not be called from a
+     * Callback, which runs on an event loop thread.
+     */
+    std::string makeRequest(const Url& url,
+                            const HttpReqArg::Vec& args) const override;
+
+    /**
+     * @brief Sends a request like makeRequest(url, args), bounded by the
+     * timeouts of @p options and aborted as soon as its token is cancelled.
+     */
+    std::string makeRequest(const Url& url, const HttpReqArg::Vec& args,
+                            const RequestOptions& options) const override;
+
+    [[nodiscard]] bool honoursRequestTimeout() const override { return true; }
+
+    /**
+     * @brief Sends a request like makeRequest() without waiting. @p callback
+     * is called exactly once, on an event loop thread, so it must not block.
+     * @p options bound and cancel the request like in makeRequest().
+     */
+    void makeRequestAsync(const Url& url, const HttpReqArg::Vec& args,
+                          Callback callback,
+                          const RequestOptions& options = {}) const;
+
+    /**
+     * @brief Calls @p task on an event loop thread once @p delay has passed,
+     * without holding a thread meanwhile. Tasks still waiting when the client
+     * is destroyed are dropped.
+     */
+    void schedule(std::chrono::milliseconds delay,
+                  std::function<void()> task) const;
+
+   private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace TgBot
+
+#endif  // __linux__
+
+#endif  // TGBOT_EPOLLHTTPCLIENT_H
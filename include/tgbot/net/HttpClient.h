@@ -7,7 +7,9 @@
 #include <optional>
 #include <string>
 
+#include "tgbot/TgException.h"
 #include "tgbot/net/HttpReqArg.h"
+#include "tgbot/net/RequestOptions.h"
 #include "tgbot/net/Url.h"
 
 namespace TgBot {
@@ -28,7 +30,7 @@ class TGBOT_API HttpClient {
 
     /**
      * @brief Maximum number of makeRequest() retries before giving up and
-     * throwing an exception.
+     * throwing an exception, unless a RetryPolicy says otherwise.
      */
     constexpr static int kRequestMaxRetries = 3;
     /**
@@ -51,6 +53,31 @@ class TGBOT_API HttpClient {
     virtual std::string makeRequest(const Url& url,
                                     const HttpReqArg::Vec& args) const = 0;
 
+    /**
+     * @brief Sends a request like makeRequest(url, args) within the limits of
+     * @p options. options.timeout is the time left for this attempt and
+     * replaces timeout(); a cancelled token aborts the request.
+     *
+     * The library's clients honour every field. This default only checks the
+     * token before sending, so that custom clients keep working unchanged;
+     * TgLongPoll raises their timeout() to fit its long polls instead.
+     */
+    virtual std::string makeRequest(const Url& url, const HttpReqArg::Vec& args,
+                                    const RequestOptions& options) const {
+        if (options.cancellation.cancelled()) {
+            throw NetworkException(NetworkException::State::Cancelled,
+                                   "Request cancelled");
+        }
+        return makeRequest(url, args);
+    }
+
+    /**
+     * @brief Whether makeRequest(url, args, options) bounds the request by
+     * options.timeout rather than timeout(). Clients that override it to do
+     * so should return true.
+     */
+    [[nodiscard]] virtual bool honoursRequestTimeout() const { return false; }
+
     /**
      * @brief Set the certificate required for the server to be authenticated
      * with HTTPS
@@ -2,6 +2,7 @@
 #define TGBOT_HTTPLIBCLIENT_H
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -16,16 +17,30 @@ namespace TgBot {
  *
  * It is the default HttpClient used by Bot and supports HTTPS out of the box
  * using the system's trusted CA store (or a custom certificate set through
- * HttpClient::setServerCert). The underlying connection is kept alive and
- * reused across requests; access is serialized so a single instance can be
- * shared between threads. The vendored cpp-httplib is fully hidden behind this
- * class (pimpl), so it never appears in the public headers.
+ * HttpClient::setServerCert). Connections are kept alive and reused across
+ * requests. Up to maxConnections requests run in parallel, each on its own
+ * connection; further callers wait for a connection to become free, so a
+ * single instance can be shared between threads. Waiting callers are served
+ * by RequestPriority, and interactive requests may use interactiveConnections
+ * more, so a reply to a callback query never waits behind an upload or a
+ * broadcast. The vendored cpp-httplib is
+ * fully hidden behind this class (pimpl), so it never appears in the public
+ * headers.
  *
  * @ingroup net
  */
 class TGBOT_API HttplibClient : public HttpClient {
    public:
-    explicit HttplibClient(std::chrono::seconds timeout = kDefaultTimeout);
+    /**
+     * @param timeout Connection, read and write timeout.
+     * @param maxConnections Maximum number of simultaneous connections. The
+     * default of 1 serializes all requests but interactive ones.
+     * @param interactiveConnections Connections beyond maxConnections that
+     * only RequestPriority::Interactive requests use.
+     */
+    explicit HttplibClient(std::chrono::seconds timeout = kDefaultTimeout,
+                           std::size_t maxConnections = 1,
+                           std::size_t interactiveConnections = 1);
     ~HttplibClient() override;
 
     /**
@@ -39,6 +54,15 @@ class TGBOT_API HttplibClient : public HttpClient {
     std::string makeRequest(const Url& url,
                             const HttpReqArg::Vec& args) const override;
 
+    /**
+     * @brief Sends a request like makeRequest(url, args), bounded by the
+     * timeouts of @p options and aborted when its token is cancelled.
+     */
+    std::string makeRequest(const Url& url, const HttpReqArg::Vec& args,
+                            const RequestOptions& options) const override;
+
+    [[nodiscard]] bool honoursRequestTimeout() const override { return true; }
+
    private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -0,0 +1,182 @@
+#ifndef TGBOT_REQUESTOPTIONS_H
+#define TGBOT_REQUESTOPTIONS_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "tgbot/export.h"
+
+namespace TgBot {
+
+namespace detail {
+struct CancellationState;
+}
+
+/**
+ * @brief Observes whether a CancellationSource was cancelled. Cheap to copy;
+ * a default-constructed token is never cancelled.
+ *
+ * @ingroup net
+ */
+class TGBOT_API CancellationToken {
+   public:
+    /**
+     * @brief Keeps a callback registered with onCancel(); destroying it
+     * unregisters the callback, waiting for it to return if it is running on
+     * another thread.
+     */
+    class TGBOT_API Registration {
+       public:
+        Registration() = default;
+        Registration(Registration&& other) noexcept;
+        Registration& operator=(Registration&& other) noexcept;
+        ~Registration();
+
+        Registration(const Registration&) = delete;
+        Registration& operator=(const Registration&) = delete;
+
+       private:
+        friend class CancellationToken;
+        Registration(std::shared_ptr<detail::CancellationState> state,
+                     std::uint64_t id)
+            : _state(std::move(state)), _id(id) {}
+
+        std::shared_ptr<detail::CancellationState> _state;
+        std::uint64_t _id = 0;
+    };
+
+    CancellationToken() = default;
+
+    [[nodiscard]] bool cancelled() const noexcept;
+
+    /// Whether the token can be cancelled at all.
+    [[nodiscard]] bool cancellable() const noexcept {
+        return static_cast<bool>(_state);
+    }
+
+    /**
+     * @brief Calls @p callback once when the source is cancelled, on the
+     * thread that cancels it, or right away if it already was. The callback
+     * must not block.
+     */
+    [[nodiscard]] Registration onCancel(std::function<void()> callback) const;
+
+    /**
+     * @brief Sleeps for @p duration unless cancelled first.
+     * @return false if cancelled.
+     */
+    bool waitFor(std::chrono::steady_clock::duration duration) const;
+
+   private:
+    friend class CancellationSource;
+    explicit CancellationToken(std::shared_ptr<detail::CancellationState> state)
+        : _state(std::move(state)) {}
+
+    std::shared_ptr<detail::CancellationState> _state;
+};
+
+/**
+ * @brief Cancels the requests that were given its token(), e.g. all calls
+ * still in flight when a bot shuts down.
+ *
+ * @ingroup net
+ */
+class TGBOT_API CancellationSource {
+   public:
+    CancellationSource();
+
+    [[nodiscard]] CancellationToken token() const;
+
+    /**
+     * @brief Cancels the token's requests and runs its callbacks. Later calls
+     * do nothing. Thread-safe.
+     */
+    void cancel();
+
+    [[nodiscard]] bool cancelled() const noexcept;
+
+   private:
+    std::shared_ptr<detail::CancellationState> _state;
+};
+
+/**
+ * @brief Lane a request takes through the HttpClient.
+ *
+ * Interactive requests (answerCallbackQuery and the other answer* methods,
+ * whose users are watching a spinner) are served first and may use
+ * connections reserved for them; Bulk requests (uploads, broadcasts) wait
+ * behind everything else. Api picks the lane from the method unless
+ * RequestOptions::priority says otherwise.
+ *
+ * @ingroup net
+ */
+enum class RequestPriority { Interactive, Normal, Bulk };
+
+/**
+ * @brief Per-call limits of a Bot API request.
+ *
+ * Unset fields fall back to the HttpClient's timeout() and
+ * the RetryPolicy of the method. A request that runs out of time throws
+ * NetworkException with State::Timeout, a cancelled one State::Cancelled;
+ * neither is retried.
+ *
+ * @ingroup net
+ */
+struct RequestOptions {
+    /// Time to establish a connection, for every attempt.
+    std::optional<std::chrono::milliseconds> connectTimeout;
+
+    /// Budget of the whole call: every attempt, rate limit wait and backoff.
+    std::optional<std::chrono::milliseconds> timeout;
+
+    /// Retries after network errors and 429 responses.
+    std::optional<int> maxRetries;
+
+    CancellationToken cancellation;
+
+    std::optional<RequestPriority> priority;
+};
+
+/**
+ * @brief Applies @p options to every Bot API call that the thread makes
+ * while the scope is alive, including the ones inside Api methods. Scopes
+ * nest: an inner scope overrides the fields it sets and keeps the rest.
+ *
+ * @code
+ * RequestOptions options;
+ * options.timeout = std::chrono::seconds(2);
+ * RequestOptionsScope scope(options);
+ * bot.getApi().sendMessage(chatId, "fast or not at all");
+ * @endcode
+ *
+ * @ingroup net
+ */
+class TGBOT_API RequestOptionsScope {
+   public:
+    explicit RequestOptionsScope(const RequestOptions& options);
+    ~RequestOptionsScope();
+
+    RequestOptionsScope(const RequestOptionsScope&) = delete;
+    RequestOptionsScope& operator=(const RequestOptionsScope&) = delete;
+
+   private:
+    RequestOptions _previous;
+    bool _hadPrevious;
+};
+
+namespace detail {
+
+/**
+ * @brief The options of the thread's innermost RequestOptionsScope, or
+ * nullptr outside of any.
+ */
+TGBOT_API const RequestOptions* requestOptions() noexcept;
+
+}  // namespace detail
+
+}  // namespace TgBot
+
+#endif  // TGBOT_REQUESTOPTIONS_H
@@ -0,0 +1,83 @@
+#ifndef TGBOT_RETRYPOLICY_H
+#define TGBOT_RETRYPOLICY_H
+
+#include <chrono>
+
+#include "tgbot/net/HttpClient.h"
+
+namespace TgBot {
+
+/**
+ * @brief Kinds of Bot API methods that get their own RetryPolicy.
+ *
+ * - Read: get* methods, which have no side effects;
+ * - Send: every other method without a file;
+ * - Upload: any method that carries a file.
+ *
+ * @ingroup net
+ */
+enum class MethodClass { Read, Send, Upload };
+
+/**
+ * @brief How Api retries the methods of one MethodClass after network
+ * errors, and when it stops trying altogether.
+ *
+ * Backoff uses decorrelated jitter: every delay is drawn at random between
+ * baseDelay and three times the previous one, capped at maxDelay, so clients
+ * that failed together do not retry together.
+ *
+ * Retries also draw from a budget shared by all calls of the class, refilled
+ * at retryBudget per budgetWindow; when it is empty a failed call gives up at
+ * once instead of adding to the load of an API that is already struggling.
+ *
+ * After breakerThreshold consecutive failures (network errors and 5xx
+ * responses) the circuit breaker opens: calls fail immediately with
+ * NetworkException::State::CircuitOpen for breakerCooldown. Then a single
+ * call is let through as a probe, and its outcome closes the breaker or opens
+ * it again.
+ *
+ * Rate limits (429) are always waited out as Telegram asks, within
+ * maxRetries, and touch neither the budget nor the breaker.
+ *
+ * @ingroup net
+ */
+struct RetryPolicy {
+    /// Retries per call; a negative value retries without limit.
+    int maxRetries = HttpClient::kRequestMaxRetries;
+
+    /// Shortest delay before a retry.
+    std::chrono::milliseconds baseDelay{250};
+
+    /// Longest delay before a retry.
+    std::chrono::milliseconds maxDelay{10000};
+
+    /// Retries all calls of the class may make per budgetWindow; negative
+    /// for no budget.
+    int retryBudget = 20;
+
+    std::chrono::milliseconds budgetWindow{10000};
+
+    /// Consecutive failures that open the breaker; 0 disables it.
+    int breakerThreshold = 10;
+
+    /// How long an open breaker fails calls before probing again.
+    std::chrono::milliseconds breakerCooldown{5000};
+
+    /**
+     * @brief The defaults of @p methodClass: uploads are retried once, after
+     * a longer pause, since every attempt sends the whole file again.
+     */
+    static RetryPolicy defaults(MethodClass methodClass) {
+        RetryPolicy policy;
+        if (methodClass == MethodClass::Upload) {
+            policy.maxRetries = 1;
+            policy.baseDelay = std::chrono::seconds(1);
+            policy.retryBudget = 5;
+        }
+        return policy;
+    }
+};
+
+}  // namespace TgBot
+
+#endif  // TGBOT_RETRYPOLICY_H
@@ -1,12 +1,18 @@
 #ifndef TGBOT_TGLONGPOLL_H
 #define TGBOT_TGLONGPOLL_H
 
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "tgbot/Api.h"
+#include "tgbot/OffsetStore.h"
+#include "tgbot/Tracing.h"
+#include "tgbot/UpdateRecorder.h"
 #include "tgbot/export.h"
 
 namespace TgBot {
@@ -30,9 +36,48 @@ class TGBOT_API TgLongPoll {
      * @brief Starts long poll. After new update will come, this method will
      * parse it and send to EventHandler which invokes your listeners. Designed
      * to be executed in a loop.
+     *
+     * An update counts as handled once its listeners returned. If a listener
+     * throws, the exception propagates and the next call resumes with that
+     * same update, so nothing is skipped.
+     *
+     * The getUpdates call runs with a RequestOptions::timeout of the long
+     * polling timeout plus a margin, leaving the HttpClient's timeout alone.
+     * Wrap start() in a RequestOptionsScope with a cancellation token to be
+     * able to interrupt a long poll in flight.
      */
     void start();
 
+    /**
+     * @brief Persists progress in @p store for at-least-once processing
+     * across restarts. Call before the first start().
+     *
+     * The offset is loaded from the store on the first start() and saved
+     * before a batch of updates is confirmed to Telegram, so a crash leads
+     * to redelivery rather than loss. The ids of the last @p dedupWindow
+     * handled updates are saved as well, after every handled update, and
+     * redelivered updates among them are not handled again. That costs one
+     * save per update; with a @p dedupWindow of 0 the store is written once
+     * per batch and a crash mid-batch redelivers the whole batch.
+     */
+    void setOffsetStore(std::shared_ptr<OffsetStore> store,
+                        std::size_t dedupWindow = 1024);
+
+    /**
+     * @brief Number of updates fetched by the last start() that the next
+     * start() will handle.
+     */
+    [[nodiscard]] std::size_t pendingUpdates() const noexcept {
+        return _updates.size() - _nextUpdate;
+    }
+
+    /**
+     * @brief Appends every update received from now on to @p recorder; pass
+     * nullptr to stop capturing. May be called while another thread is in
+     * start().
+     */
+    void record(std::shared_ptr<UpdateRecorder> recorder);
+
    private:
     Bot* _bot;
     std::int32_t _lastUpdateId = 0;
@@ -40,6 +85,23 @@ class TGBOT_API TgLongPoll {
     timeout_t _timeout;
     Update::Types _allowedUpdates;
     std::vector<Update::Ptr> _updates;
+    SpanContext _pollContext;
+    // Only accessed with std::atomic_load() and std::atomic_store().
+    std::shared_ptr<UpdateRecorder> _recorder;
+
+    // Index in _updates of the next update to handle.
+    std::size_t _nextUpdate = 0;
+
+    std::shared_ptr<OffsetStore> _offsetStore;
+    bool _offsetLoaded = false;
+    std::size_t _dedupWindow = 0;
+    // Recently handled ids, oldest first, and the same ids for lookups.
+    std::deque<std::int32_t> _handled;
+    std::unordered_set<std::int32_t> _handledIds;
+
+    void restoreOffset();
+    void saveOffset();
+    void markHandled(std::int32_t updateId);
 };
 
 }  // namespace TgBot
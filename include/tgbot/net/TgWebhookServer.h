@@ -1,14 +1,18 @@
 #ifndef TGBOT_TGWEBHOOKSERVER_H
 #define TGBOT_TGWEBHOOKSERVER_H
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string>
 
+#include "tgbot/Metrics.h"
 #include "tgbot/export.h"
 
 namespace TgBot {
 
 class EventHandler;
+class UpdateRecorder;
 
 /**
  * @brief Base HTTP server for receiving Telegram Update objects via webhooks.
@@ -17,25 +21,111 @@ class EventHandler;
  * TgWebhookLocalServer (UNIX socket) subclasses, or Bot::createWebHookTcp /
  * Bot::createWebHookLocal.
  *
+ * Webhook requests are screened on their headers, before the body is read or
+ * parsed: requests to unknown paths (404), without the secret token set with
+ * setSecretToken() (403), with a content type other than application/json
+ * (415), or without a Content-Length (411) or with one above the limit set
+ * with setMaxBodySize() (413) are rejected and counted in
+ * tgbot_webhook_rejections_total{reason} of the registered Metrics.
+ *
  * @ingroup net
  */
 class TGBOT_API TgWebhookServer {
    public:
+    /// Default limit of setMaxBodySize().
+    static constexpr std::size_t kDefaultMaxBodySize = 1024 * 1024;
+
     virtual ~TgWebhookServer();
 
     TgWebhookServer(const TgWebhookServer&) = delete;
     TgWebhookServer& operator=(const TgWebhookServer&) = delete;
 
     /**
-     * @brief Starts listening for connections. Blocks until stop() is called.
+     * @brief Starts listening for connections. Blocks until stop() is called
+     * and the requests in flight are handled.
      */
     void start();
 
     /**
-     * @brief Stops the server.
+     * @brief Stops accepting connections and waits until the requests
+     * already received are handled, at most for the drain timeout (see
+     * setDrainTimeout()). Called from a listener, it returns without
+     * waiting.
      */
     void stop();
 
+    /**
+     * @brief Listens with @p acceptors sockets bound to the same address
+     * with SO_REUSEPORT, so the kernel spreads incoming connections over
+     * them instead of a single thread accepting all of them. Has no effect
+     * on UNIX sockets or where SO_REUSEPORT is not available. Call before
+     * start().
+     */
+    void setAcceptors(std::size_t acceptors);
+
+    /**
+     * @brief Handles requests on @p threads threads in total, split evenly
+     * between the acceptors. 0, the default, leaves the sizing to
+     * cpp-httplib. Call before start().
+     */
+    void setWorkerThreads(std::size_t threads);
+
+    /**
+     * @brief Closes a kept-alive connection after @p maxRequests requests or
+     * after @p timeout without one. Call before start().
+     */
+    void setKeepAlive(std::size_t maxRequests, std::chrono::seconds timeout);
+
+    /**
+     * @brief Drops a connection that sends nothing for @p timeout while a
+     * request is being read. Call before start().
+     */
+    void setReadTimeout(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Longest time stop() waits for requests in flight; 30 seconds by
+     * default.
+     */
+    void setDrainTimeout(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Also accepts updates on @p path and passes them to
+     * @p eventHandler, so one server on one port can serve several bots.
+     * Call before start().
+     *
+     * @param labels Added to the metrics recorded while handling requests on
+     * this path, e.g. {{"bot", "123456"}}.
+     */
+    void addPath(const std::string& path, EventHandler* eventHandler,
+                 MetricLabels labels = {});
+
+    /**
+     * @brief Only accepts webhook requests whose
+     * X-Telegram-Bot-Api-Secret-Token header equals @p secretToken, the
+     * secret passed to Api::setWebhook(). The comparison takes constant time.
+     * An empty token accepts any request. Call before start().
+     */
+    void setSecretToken(std::string secretToken);
+
+    /**
+     * @brief Rejects webhook requests with a body larger than @p bytes
+     * without reading it. Call before start().
+     */
+    void setMaxBodySize(std::size_t bytes);
+
+    /**
+     * @brief Serves the registered Metrics in the Prometheus text format on
+     * GET @p path, next to the webhook. Call before start(). Answers 404
+     * while no registry is set (see setMetrics()).
+     */
+    void exposeMetrics(const std::string& path = "/metrics");
+
+    /**
+     * @brief Appends the body of every webhook request to @p recorder. Call
+     * before start().
+     */
+    void record(std::shared_ptr<UpdateRecorder> recorder);
+
    protected:
     struct Bind {
         bool unixSocket = false;
@@ -3,10 +3,17 @@
 
 #include "tgbot/Api.h"
 #include "tgbot/Bot.h"
+#include "tgbot/BotHost.h"
+#include "tgbot/Broadcaster.h"
 #include "tgbot/EventBroadcaster.h"
 #include "tgbot/EventHandler.h"
 #include "tgbot/Logger.h"
+#include "tgbot/Metrics.h"
+#include "tgbot/OffsetStore.h"
+#include "tgbot/ParseCache.h"
 #include "tgbot/TgException.h"
+#include "tgbot/Tracing.h"
+#include "tgbot/UpdateRecorder.h"
 #include "tgbot/net/HttpClient.h"
 #include "tgbot/net/HttpReqArg.h"
 #include "tgbot/net/HttplibClient.h"
@@ -17,7 +24,9 @@
 #include "tgbot/net/TgWebhookServer.h"
 #include "tgbot/net/TgWebhookTcpServer.h"
 #include "tgbot/net/Url.h"
+#include "tgbot/tools/MessageBuilder.h"
 #include "tgbot/tools/StringTools.h"
+#include "tgbot/tools/Utf16.h"
 #include "tgbot/types/AcceptedGiftTypes.h"
 #include "tgbot/types/AffiliateInfo.h"
 #include "tgbot/types/Animation.h"
@@ -91,6 +100,7 @@
 #include "tgbot/types/Community.h"
 #include "tgbot/types/CommunityChatAdded.h"
 #include "tgbot/types/CommunityChatRemoved.h"
+#include "tgbot/types/CompactMessage.h"
 #include "tgbot/types/Contact.h"
 #include "tgbot/types/CopyTextButton.h"
 #include "tgbot/types/Dice.h"
@@ -414,6 +424,7 @@
  * @defgroup types
  * @defgroup net
  * @defgroup tools
+ * @defgroup coro
  *
  * @mainpage
  * [Go to GitHub](https://github.com/reo7sp/tgbot-cpp)
@@ -0,0 +1,162 @@
+#ifndef TGBOT_MESSAGEBUILDER_H
+#define TGBOT_MESSAGEBUILDER_H
+
+#include "tgbot/Api.h"
+#include "tgbot/export.h"
+#include "tgbot/types/Message.h"
+#include "tgbot/types/MessageEntity.h"
+#include "tgbot/types/User.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TgBot {
+
+/**
+ * @brief Escapes @p text for Api::ParseMode::MarkdownV2, so that it is shown
+ * as is.
+ *
+ * @ingroup tools
+ */
+TGBOT_API std::string escapeMarkdownV2(std::string_view text);
+
+/**
+ * @brief Escapes @p text for Api::ParseMode::HTML, so that it is shown as is.
+ *
+ * @ingroup tools
+ */
+TGBOT_API std::string escapeHtml(std::string_view text);
+
+/**
+ * @brief Builds the text of a message together with its entities.
+ *
+ * Formatting is sent as explicit MessageEntity objects instead of markup, so
+ * nothing needs escaping and no parse mode is involved. The builder counts
+ * the text in UTF-16 code units as it grows, and build() splits it into
+ * messages within Telegram's limit, cutting the entities at the splits.
+ *
+ * @code
+ * MessageBuilder builder;
+ * builder.bold(user->firstName).text(" joined, say hi!\n")
+ *     .link("Rules", "https://example.com/rules");
+ * builder.send(bot.getApi(), chatId);
+ * @endcode
+ *
+ * @ingroup tools
+ */
+class TGBOT_API MessageBuilder {
+   public:
+    /// Longest text of a message, in UTF-16 code units.
+    static constexpr std::size_t kMessageLimit = 4096;
+
+    /// The text and entities of one message.
+    struct Part {
+        std::string text;
+        std::vector<MessageEntity::Ptr> entities;
+    };
+
+    /// Appends plain @p text.
+    MessageBuilder& text(std::string_view text);
+
+    /// Appends @p text as an entity of @p type.
+    MessageBuilder& styled(MessageEntity::Type type, std::string_view text);
+
+    MessageBuilder& bold(std::string_view text) {
+        return styled(MessageEntity::Type::Bold, text);
+    }
+    MessageBuilder& italic(std::string_view text) {
+        return styled(MessageEntity::Type::Italic, text);
+    }
+    MessageBuilder& underline(std::string_view text) {
+        return styled(MessageEntity::Type::Underline, text);
+    }
+    MessageBuilder& strikethrough(std::string_view text) {
+        return styled(MessageEntity::Type::Strikethrough, text);
+    }
+    MessageBuilder& spoiler(std::string_view text) {
+        return styled(MessageEntity::Type::Spoiler, text);
+    }
+    MessageBuilder& code(std::string_view text) {
+        return styled(MessageEntity::Type::Code, text);
+    }
+
+    /// Appends a block of monowidth @p text, highlighted as @p language if
+    /// given.
+    MessageBuilder& pre(std::string_view text, std::string_view language = {});
+
+    /// Appends @p text that opens @p url.
+    MessageBuilder& link(std::string_view text, std::string_view url);
+
+    /// Appends @p text that mentions @p user, who need not have a username.
+    MessageBuilder& mention(std::string_view text, User::Ptr user);
+
+    /// Appends @p emoji shown as the custom emoji @p customEmojiId.
+    MessageBuilder& customEmoji(std::string_view emoji,
+                                std::string_view customEmojiId);
+
+    /**
+     * @brief Starts an entity of @p type that covers everything appended
+     * until the matching end(), for nesting, e.g. bold text with a link in it.
+     */
+    MessageBuilder& begin(MessageEntity::Type type);
+
+    /// Ends the entity of the latest begin() that was not ended yet.
+    MessageBuilder& end();
+
+    /// The text so far.
+    [[nodiscard]] const std::string& str() const noexcept { return _text; }
+
+    /// Length of the text in UTF-16 code units.
+    [[nodiscard]] std::size_t utf16Length() const noexcept { return _length; }
+
+    /// The entities so far, in the order they were started.
+    [[nodiscard]] std::vector<MessageEntity::Ptr> entities() const;
+
+    /**
+     * @brief Splits the text into messages of at most @p limit UTF-16 code
+     * units each.
+     *
+     * A message ends at the last line break that fits, or else at the last
+     * space, which is then dropped; only a line without either is cut inside
+     * a word, and never inside a character or a custom emoji. Entities that
+     * span a split continue in the next message. Entities still open end with
+     * the text. Parts that would hold nothing but whitespace, which Telegram
+     * rejects, are left out, so blank text gives no messages.
+     */
+    [[nodiscard]] std::vector<Part> build(
+        std::size_t limit = kMessageLimit) const;
+
+    /**
+     * @brief Sends the messages of build() to @p chatId one after another.
+     * @return The messages sent.
+     */
+    std::vector<Message::Ptr> send(const Api& api, Api::ChatIdType chatId) const;
+
+   private:
+    // An entity with where it is in bytes as well as in UTF-16 code units.
+    struct Span {
+        MessageEntity::Ptr entity;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::size_t begin16 = 0;
+        std::size_t end16 = 0;
+    };
+
+    // Starts an entity at the end of the text; returns its index in _spans.
+    std::size_t open(MessageEntity::Type type);
+    void close(std::size_t index);
+
+    std::string _text;
+    std::size_t _length = 0;
+    std::vector<Span> _spans;
+    // Indices into _spans of the entities begin() started and end() did not
+    // end yet.
+    std::vector<std::size_t> _open;
+};
+
+}  // namespace TgBot
+
+#endif  // TGBOT_MESSAGEBUILDER_H
@@ -62,6 +62,16 @@ std::string urlEncode(const std::string& value, const std::string& additionalLeg
 TGBOT_API
 std::string urlDecode(const std::string& value);
 
+/**
+ * Compares two strings in time that depends only on their lengths, not on
+ * where they differ, so comparing a secret against untrusted input does not
+ * leak how much of it matched.
+ * @param str1 First string
+ * @param str2 Second string
+ */
+TGBOT_API
+bool constantTimeEquals(const std::string& str1, const std::string& str2);
+
 /**
  * Splits string to smaller substrings which have between them a delimiter. Resulting substrings won't have delimiter.
  * @param str Source string
@@ -0,0 +1,92 @@
+#ifndef TGBOT_UTF16_H
+#define TGBOT_UTF16_H
+
+#include "tgbot/export.h"
+#include "tgbot/types/MessageEntity.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace TgBot {
+
+class Message;
+
+/**
+ * @brief Bytes of a UTF-8 string.
+ *
+ * @ingroup tools
+ */
+struct Utf8Range {
+    std::size_t offset = 0;
+    std::size_t length = 0;
+};
+
+/**
+ * @brief UTF-16 code units of a string, the unit of MessageEntity::offset
+ * and MessageEntity::length.
+ *
+ * @ingroup tools
+ */
+struct Utf16Range {
+    std::int32_t offset = 0;
+    std::int32_t length = 0;
+};
+
+/**
+ * @brief Length of UTF-8 @p text in UTF-16 code units, as Telegram counts
+ * it, e.g. against the 4096 limit of a message.
+ *
+ * @ingroup tools
+ */
+TGBOT_API std::size_t utf16Length(std::string_view text) noexcept;
+
+/**
+ * @brief The bytes of @p text that each of @p entities covers: result[i]
+ * belongs to entities[i].
+ *
+ * All entities are converted in one pass over the text, which is scanned 16
+ * or 32 bytes at a time where SSE2 or AVX2 is available. Ranges are clamped to
+ * the text, and a boundary inside a surrogate pair moves past the character.
+ *
+ * @code
+ * const std::string& text = *message->text;
+ * const auto ranges = utf8Ranges(text, *message->entities);
+ * std::string_view first(text.data() + ranges[0].offset, ranges[0].length);
+ * @endcode
+ *
+ * @ingroup tools
+ */
+TGBOT_API std::vector<Utf8Range> utf8Ranges(
+    std::string_view text, const std::vector<MessageEntity::Ptr>& entities);
+
+/**
+ * @brief utf8Ranges() of the entities of @p message's text, or of its caption
+ * when it has no text.
+ *
+ * @ingroup tools
+ */
+TGBOT_API std::vector<Utf8Range> utf8Ranges(const Message& message);
+
+/**
+ * @brief The inverse of utf8Ranges(): the UTF-16 offset and length of each
+ * byte range of @p text, in one pass, for building outgoing entities.
+ *
+ * @ingroup tools
+ */
+TGBOT_API std::vector<Utf16Range> utf16Ranges(
+    std::string_view text, const std::vector<Utf8Range>& ranges);
+
+/**
+ * @brief An entity of @p type over the bytes @p range of @p text.
+ *
+ * @ingroup tools
+ */
+TGBOT_API MessageEntity::Ptr makeEntity(std::string_view text,
+                                        const Utf8Range& range,
+                                        MessageEntity::Type type);
+
+}  // namespace TgBot
+
+#endif  // TGBOT_UTF16_H
@@ -0,0 +1,317 @@
+#ifndef TGBOT_COMPACTMESSAGE_H
+#define TGBOT_COMPACTMESSAGE_H
+
+#include "tgbot/export.h"
+#include "tgbot/types/Message.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * The rarely set fields of Message that CompactMessage keeps in its side
+ * table, as X(member, "json_key"); every other field of Message is a member
+ * of CompactMessage. CompactMessage.cpp checks at compile time that the two
+ * together cover every field of Message.
+ */
+#define TGBOT_COMPACT_MESSAGE_SIDE_FIELDS(X) \
+    X(directMessagesTopic, "direct_messages_topic") \
+    X(senderBoostCount, "sender_boost_count") \
+    X(senderBusinessBot, "sender_business_bot") \
+    X(senderTag, "sender_tag") \
+    X(businessConnectionId, "business_connection_id") \
+    X(forwardOrigin, "forward_origin") \
+    X(isTopicMessage, "is_topic_message") \
+    X(isAutomaticForward, "is_automatic_forward") \
+    X(externalReply, "external_reply") \
+    X(quote, "quote") \
+    X(replyToStory, "reply_to_story") \
+    X(replyToChecklistTaskId, "reply_to_checklist_task_id") \
+    X(viaBot, "via_bot") \
+    X(hasProtectedContent, "has_protected_content") \
+    X(isFromOffline, "is_from_offline") \
+    X(isPaidPost, "is_paid_post") \
+    X(mediaGroupId, "media_group_id") \
+    X(authorSignature, "author_signature") \
+    X(paidStarCount, "paid_star_count") \
+    X(linkPreviewOptions, "link_preview_options") \
+    X(suggestedPostInfo, "suggested_post_info") \
+    X(effectId, "effect_id") \
+    X(animation, "animation") \
+    X(audio, "audio") \
+    X(document, "document") \
+    X(paidMedia, "paid_media") \
+    X(sticker, "sticker") \
+    X(story, "story") \
+    X(video, "video") \
+    X(videoNote, "video_note") \
+    X(voice, "voice") \
+    X(captionEntities, "caption_entities") \
+    X(showCaptionAboveMedia, "show_caption_above_media") \
+    X(hasMediaSpoiler, "has_media_spoiler") \
+    X(checklist, "checklist") \
+    X(contact, "contact") \
+    X(dice, "dice") \
+    X(game, "game") \
+    X(poll, "poll") \
+    X(venue, "venue") \
+    X(location, "location") \
+    X(newChatMembers, "new_chat_members") \
+    X(leftChatMember, "left_chat_member") \
+    X(chatOwnerLeft, "chat_owner_left") \
+    X(chatOwnerChanged, "chat_owner_changed") \
+    X(newChatTitle, "new_chat_title") \
+    X(newChatPhoto, "new_chat_photo") \
+    X(deleteChatPhoto, "delete_chat_photo") \
+    X(groupChatCreated, "group_chat_created") \
+    X(supergroupChatCreated, "supergroup_chat_created") \
+    X(channelChatCreated, "channel_chat_created") \
+    X(messageAutoDeleteTimerChanged, "message_auto_delete_timer_changed") \
+    X(migrateToChatId, "migrate_to_chat_id") \
+    X(migrateFromChatId, "migrate_from_chat_id") \
+    X(pinnedMessage, "pinned_message") \
+    X(invoice, "invoice") \
+    X(successfulPayment, "successful_payment") \
+    X(refundedPayment, "refunded_payment") \
+    X(usersShared, "users_shared") \
+    X(chatShared, "chat_shared") \
+    X(gift, "gift") \
+    X(uniqueGift, "unique_gift") \
+    X(giftUpgradeSent, "gift_upgrade_sent") \
+    X(connectedWebsite, "connected_website") \
+    X(writeAccessAllowed, "write_access_allowed") \
+    X(passportData, "passport_data") \
+    X(proximityAlertTriggered, "proximity_alert_triggered") \
+    X(boostAdded, "boost_added") \
+    X(chatBackgroundSet, "chat_background_set") \
+    X(checklistTasksDone, "checklist_tasks_done") \
+    X(checklistTasksAdded, "checklist_tasks_added") \
+    X(directMessagePriceChanged, "direct_message_price_changed") \
+    X(forumTopicCreated, "forum_topic_created") \
+    X(forumTopicEdited, "forum_topic_edited") \
+    X(forumTopicClosed, "forum_topic_closed") \
+    X(forumTopicReopened, "forum_topic_reopened") \
+    X(generalForumTopicHidden, "general_forum_topic_hidden") \
+    X(generalForumTopicUnhidden, "general_forum_topic_unhidden") \
+    X(giveawayCreated, "giveaway_created") \
+    X(giveaway, "giveaway") \
+    X(giveawayWinners, "giveaway_winners") \
+    X(giveawayCompleted, "giveaway_completed") \
+    X(paidMessagePriceChanged, "paid_message_price_changed") \
+    X(suggestedPostApproved, "suggested_post_approved") \
+    X(suggestedPostApprovalFailed, "suggested_post_approval_failed") \
+    X(suggestedPostDeclined, "suggested_post_declined") \
+    X(suggestedPostPaid, "suggested_post_paid") \
+    X(suggestedPostRefunded, "suggested_post_refunded") \
+    X(videoChatScheduled, "video_chat_scheduled") \
+    X(videoChatStarted, "video_chat_started") \
+    X(videoChatEnded, "video_chat_ended") \
+    X(videoChatParticipantsInvited, "video_chat_participants_invited") \
+    X(webAppData, "web_app_data") \
+    X(replyMarkup, "reply_markup") \
+    X(guestQueryId, "guest_query_id") \
+    X(replyToPollOptionId, "reply_to_poll_option_id") \
+    X(guestBotCallerUser, "guest_bot_caller_user") \
+    X(guestBotCallerChat, "guest_bot_caller_chat") \
+    X(richMessage, "rich_message") \
+    X(livePhoto, "live_photo") \
+    X(managedBotCreated, "managed_bot_created") \
+    X(pollOptionAdded, "poll_option_added") \
+    X(pollOptionDeleted, "poll_option_deleted") \
+    X(receiverUser, "receiver_user") \
+    X(ephemeralMessageId, "ephemeral_message_id") \
+    X(communityChatAdded, "community_chat_added") \
+    X(communityChatRemoved, "community_chat_removed")
+
+namespace TgBot {
+
+namespace detail {
+
+enum class MessageSideField : std::size_t {
+#define TGBOT_SIDE_FIELD(member, key) member,
+    TGBOT_COMPACT_MESSAGE_SIDE_FIELDS(TGBOT_SIDE_FIELD)
+#undef TGBOT_SIDE_FIELD
+    Count
+};
+
+// Slot of a rare Message field. Not defined for the fields CompactMessage
+// keeps inline, so that has<>/get<>/set<> on them does not compile.
+template <auto Member>
+struct MessageSideFieldOf;
+
+#define TGBOT_SIDE_FIELD(member, key)                                  \
+    template <>                                                        \
+    struct MessageSideFieldOf<&Message::member> {                      \
+        static constexpr std::size_t index =                           \
+            static_cast<std::size_t>(MessageSideField::member);        \
+    };
+TGBOT_COMPACT_MESSAGE_SIDE_FIELDS(TGBOT_SIDE_FIELD)
+#undef TGBOT_SIDE_FIELD
+
+// Type of Message::*Member, e.g. std::optional<Sticker::Ptr>.
+template <auto Member>
+using MessageFieldType =
+    std::remove_cv_t<std::remove_reference_t<decltype(std::declval<Message&>().*Member)>>;
+
+// Objects are kept as they are; everything else is boxed.
+template <typename T>
+struct MessageSideStorage {
+    static std::shared_ptr<void> wrap(T value) {
+        return std::make_shared<T>(std::move(value));
+    }
+    static T unwrap(const std::shared_ptr<void>& stored) {
+        return *std::static_pointer_cast<T>(stored);
+    }
+};
+
+template <typename T>
+struct MessageSideStorage<std::shared_ptr<T>> {
+    static std::shared_ptr<void> wrap(std::shared_ptr<T> value) {
+        return value;
+    }
+    static std::shared_ptr<T> unwrap(const std::shared_ptr<void>& stored) {
+        return std::static_pointer_cast<T>(stored);
+    }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A Message that only pays for the fields it has.
+ *
+ * Message spends an std::optional on each of its ~120 fields, so even a plain
+ * text message takes kilobytes. CompactMessage keeps the fields of ordinary
+ * text and media messages inline, under the same names and types as in
+ * Message; the rest (service messages, payments, giveaways...) go to a side
+ * table that holds only the fields that are set, found through a presence
+ * bitmap.
+ *
+ * Rare fields are read and written through the Message member they stand
+ * for:
+ * @code
+ * if (message->has<&Message::sticker>()) {
+ *     Sticker::Ptr sticker = *message->get<&Message::sticker>();
+ * }
+ * @endcode
+ *
+ * Parse it with parse<CompactMessage>(), or convert with compact() and
+ * expand() where a full Message is needed.
+ *
+ * @ingroup types
+ */
+class TGBOT_API CompactMessage {
+
+public:
+    using Ptr = std::shared_ptr<CompactMessage>;
+
+    /// @see Message::messageId
+    std::int32_t messageId{};
+
+    /// @see Message::messageThreadId
+    std::optional<std::int32_t> messageThreadId;
+
+    /// @see Message::from
+    std::optional<User::Ptr> from;
+
+    /// @see Message::senderChat
+    std::optional<Chat::Ptr> senderChat;
+
+    /// @see Message::date
+    std::uint32_t date{};
+
+    /// @see Message::chat
+    Chat::Ptr chat;
+
+    /// @see Message::replyToMessage
+    std::optional<Message::Ptr> replyToMessage;
+
+    /// @see Message::editDate
+    std::optional<std::uint32_t> editDate;
+
+    /// @see Message::text
+    std::optional<std::string> text;
+
+    /// @see Message::entities
+    std::optional<std::vector<MessageEntity::Ptr>> entities;
+
+    /// @see Message::photo
+    std::optional<std::vector<PhotoSize::Ptr>> photo;
+
+    /// @see Message::caption
+    std::optional<std::string> caption;
+
+    /**
+     * @brief Whether the rare field Member, e.g. &Message::sticker, is set.
+     */
+    template <auto Member>
+    [[nodiscard]] bool has() const noexcept {
+        return test(detail::MessageSideFieldOf<Member>::index);
+    }
+
+    /**
+     * @brief The rare field Member, as the std::optional Message holds it.
+     */
+    template <auto Member>
+    [[nodiscard]] detail::MessageFieldType<Member> get() const {
+        using Value = typename detail::MessageFieldType<Member>::value_type;
+        constexpr std::size_t index = detail::MessageSideFieldOf<Member>::index;
+        if (!test(index)) {
+            return std::nullopt;
+        }
+        return detail::MessageSideStorage<Value>::unwrap(_side[slot(index)]);
+    }
+
+    /**
+     * @brief Sets the rare field Member; std::nullopt clears it.
+     */
+    template <auto Member>
+    void set(detail::MessageFieldType<Member> value) {
+        using Value = typename detail::MessageFieldType<Member>::value_type;
+        constexpr std::size_t index = detail::MessageSideFieldOf<Member>::index;
+        if (!value) {
+            erase(index);
+            return;
+        }
+        store(index, detail::MessageSideStorage<Value>::wrap(std::move(*value)));
+    }
+
+    /// Number of rare fields that are set.
+    [[nodiscard]] std::size_t sideFieldCount() const noexcept {
+        return _side.size();
+    }
+
+    /**
+     * @brief A full Message with the same fields.
+     */
+    [[nodiscard]] Message::Ptr expand() const;
+
+    /**
+     * @brief A CompactMessage with the fields of @p message.
+     */
+    static Ptr compact(const Message& message);
+
+private:
+    static constexpr std::size_t kWords =
+        (static_cast<std::size_t>(detail::MessageSideField::Count) + 63) / 64;
+
+    bool test(std::size_t index) const noexcept {
+        return (_present[index / 64] >> (index % 64)) & 1U;
+    }
+
+    // Position of field index in _side: the number of set fields before it.
+    std::size_t slot(std::size_t index) const noexcept;
+    void store(std::size_t index, std::shared_ptr<void> value);
+    void erase(std::size_t index);
+
+    std::array<std::uint64_t, kWords> _present{};
+    std::vector<std::shared_ptr<void>> _side;
+};
+}
+
+#endif //TGBOT_COMPACTMESSAGE_H
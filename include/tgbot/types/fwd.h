@@ -80,6 +80,7 @@ class ChosenInlineResult;
 class Community;
 class CommunityChatAdded;
 class CommunityChatRemoved;
+class CompactMessage;
 class Contact;
 class CopyTextButton;
 class Dice;
@@ -5,13 +5,22 @@ Generates src/types/<Type>.cpp (the parse/put bodies) from the Telegram Bot API
 spec (api.json) plus the hand-written headers (which carry the C++ field types,
 i.e. the int-width / optional / enum decisions the spec doesn't express).
 
-This is a prototype: by default it writes nothing, it regenerates each type into
-memory and diffs against the committed .cpp, reporting how many reproduce
-byte-for-byte. Types whose shape the generator does not yet model (enums, a few
-specials) are reported as skipped.
+Each type gets a table of its JSON field names and a parser that switches on
+the field every key of the object names, writing straight into the member;
+see detail::parseFields() in TgTypeParser.h. Serializers put the fields in key
+order.
+
+By default it writes nothing, it regenerates each type into memory and diffs
+against the committed .cpp, reporting how many reproduce byte-for-byte. Types
+whose shape the generator does not yet model (enums, a few specials) are
+reported as skipped. Configuring with -DTGBOT_GENERATE_PARSERS=ON runs it with
+--write --out into the build directory whenever the spec, this script or a
+type header changes, and builds the library from those sources instead of the
+committed ones.
 
     python scripts/gen_parsers.py            # parity report (no writes)
     python scripts/gen_parsers.py --write    # overwrite the .cpp files
+    python scripts/gen_parsers.py --list     # names of the generated .cpp files
 """
 import argparse
 import json
@@ -47,6 +56,11 @@ HAND_WRITTEN = {
 # type, so we collapse the poll bases into the single base InputMedia: it is not
 # emitted as its own class/.cpp, and InputMedia's dispatcher covers the union of
 # all leaves. (gen_types collapses the leaf inheritance + field types to match.)
+# Types whose parsers go through the optional ParseCache (see ParseCache.h):
+# the same senders are parsed from update after update. Chat and Sticker use
+# it too, by hand.
+CACHED = {"User"}
+
 MEDIA_BASE = "InputMedia"
 MEDIA_COLLAPSED = {"InputPollMedia", "InputPollOptionMedia"}
 
@@ -136,42 +150,30 @@ def classify(cpp_type):
 
 
 def gen_field(field, members):
+    """(parse statement, put statement) for one field. The parse statement
+    reads the field's JSON `value`, which parseFields() has already found."""
     snake = field["name"]
     camel = snake_to_camel(snake)
     if camel not in members:
         return None  # member name doesn't match spec field -> bail
     kind, inner = classify(members[camel])
+    put = f'        json.put("{snake}", object->{camel});'
     if kind == "primitive":
-        return (f'    parse(data, "{snake}", &result->{camel});',
-                f'        json.put("{snake}", object->{camel});')
-    if kind == "ptr_req":
-        return (f'    result->{camel} = parseRequired<{inner}>(data, "{snake}");',
-                f'        json.put("{snake}", object->{camel});')
-    if kind == "ptr_opt":
-        return (f'    result->{camel} = parse<{inner}>(data, "{snake}");',
-                f'        json.put("{snake}", object->{camel});')
-    if kind == "array":
-        return (f'    result->{camel} = parseArray<{inner}>(data, "{snake}");',
-                f'        json.put("{snake}", object->{camel});')
-    if kind == "array_req":
-        return (f'    result->{camel} = parseRequiredArray<{inner}>(data, "{snake}");',
-                f'        json.put("{snake}", object->{camel});')
+        return f"detail::parseValue(value, &result->{camel});", put
+    if kind in ("ptr_req", "ptr_opt"):
+        return f"result->{camel} = parse<{inner}>(value);", put
+    if kind in ("array", "array_req"):
+        return f"result->{camel} = parseArray<{inner}>(value);", put
     if kind == "matrix":
-        return (f'    result->{camel} = parseMatrix<{inner}>(data, "{snake}");',
-                f'        json.put("{snake}", object->{camel});')
-    if kind == "prim_array":
-        return (f'    result->{camel} = parsePrimitiveArray<{inner}>(data, "{snake}");',
-                f'        json.put("{snake}", object->{camel});')
-    if kind == "prim_array_req":
-        return (f'    result->{camel} = parsePrimitiveRequiredArray<{inner}>(data, "{snake}");',
-                f'        json.put("{snake}", object->{camel});')
+        return f"result->{camel} = parseMatrix<{inner}>(value);", put
+    if kind in ("prim_array", "prim_array_req"):
+        return f"result->{camel} = parsePrimitiveArray<{inner}>(value);", put
     if kind == "maybe_msg_opt":
-        return (f'    if (data.contains("{snake}") && !data["{snake}"].is_null()) {{\n'
-                f'        result->{camel} = parse(data["{snake}"]);\n    }}',
-                f'        json.put("{snake}", object->{camel});')
+        return (f"if (!value.is_null()) {{\n"
+                f"                    result->{camel} = parse(value);\n"
+                f"                }}", put)
     if kind == "maybe_msg_req":
-        return (f'    result->{camel} = parse(data["{snake}"]);',
-                f'        json.put("{snake}", object->{camel});')
+        return f"result->{camel} = parse(value);", put
     return None  # enum -> not modelled (kept hand-written)
 
 
@@ -199,7 +201,9 @@ def gen_type(spec, name):
 
     inc = ["#include <tgbot/TgTypeParser.h>",
            f"#include <tgbot/types/{name}.h>"]
-    body_parse, body_put = [], []
+    if name in CACHED:
+        inc.insert(0, "#include <tgbot/ParseCache.h>")
+    body_parse, body_put, table = [], [], []
 
     if subtypes:
         # Polymorphic base: dispatch on the discriminator field.
@@ -213,37 +217,45 @@ def gen_type(spec, name):
         for sub in sorted(subtypes):
             inc.append(f"#include <tgbot/types/{sub}.h>")
         dcamel = snake_to_camel(df)
-        body_parse.append("    std::string type;")
-        body_parse.append(f"    {name}::Ptr result;")
-        body_parse.append(f'    parse(data, "{df}", &type);')
-        first = True
-        for sub in subtypes:
-            kw = "if" if first else "} else if"
-            body_parse.append(f'    {kw} (type == "{disc[sub]}") {{')
-            body_parse.append(f"        result = parse<{sub}>(data);")
-            first = False
-        body_parse.append("    } else {")
-        body_parse.append(f'        throw invalidType("{name}", type);')
-        body_parse.append("    }")
-        body_put.append(f'        json.put("{df}", object->{dcamel});')
-        first = True
+        # One compile-time hash table per base, shared by parse and put.
+        table = [f"constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<{name}>>({{"]
         for sub in subtypes:
-            kw = "if" if first else "} else if"
-            body_put.append(f'        {kw} (object->{dcamel} == "{disc[sub]}") {{')
-            body_put.append(f"            json += put<{sub}>(object);")
-            first = False
-        body_put.append("        } else {")
-        body_put.append(f'            throw invalidType("{name}", object->{dcamel});')
-        body_put.append("        }")
+            table.append(f'    {{"{disc[sub]}", detail::subtype<{name}, {sub}>()}},')
+        table.append("});")
+        body_parse.append(
+            f'    return detail::parseSubtype(data, "{df}", subtypes, "{name}");')
+        body_put.append(
+            f'        json = detail::putSubtype(object, object->{dcamel}, subtypes, "{name}");')
         ret_extra = True
     else:
+        # One field table per type: parseFields() hashes each key of the
+        # object once and switches on the field it names.
         members = header_member_types(name)
+        cases, puts = [], []
         for f in fields:
             g = gen_field(f, members)
             if g is None:
                 return None, f"field:{f['name']}"
-            body_parse.append(g[0])
-            body_put.append(g[1])
+            cases.append((snake_to_camel(f["name"]), f["name"], g[0]))
+            puts.append((f["name"], g[1]))
+        if cases:
+            table = ["enum class Field {"]
+            table += [f"    {camel}," for camel, _, _ in cases]
+            table += ["};", "",
+                      "constexpr auto fields = detail::makeTypeTable<Field>({"]
+            table += [f'    {{"{snake}", Field::{camel}}},' for camel, snake, _ in cases]
+            table.append("});")
+            body_parse.append("    detail::parseFields(data, fields, "
+                              "[&result](Field field, const nlohmann::json &value) {")
+            body_parse.append("        switch (field) {")
+            for camel, _, stmt in cases:
+                body_parse.append(f"            case Field::{camel}:")
+                body_parse.append(f"                {stmt}")
+                body_parse.append("                break;")
+            body_parse.append("        }")
+            body_parse.append("    });")
+        # In key order, so that every put appends to the end of the object.
+        body_put = [line for _, line in sorted(puts)]
         ret_extra = False
 
     inc.append("#include <nlohmann/json.hpp>")
@@ -251,14 +263,22 @@ def gen_type(spec, name):
     out = []
     out += inc
     out += ["", "namespace TgBot {", ""]
+    if table:
+        out += ["namespace {", ""] + table + ["", "}  // namespace", ""]
     out.append("template <>")
     out.append(f"std::shared_ptr<{name}> parse(const nlohmann::json &data) {{")
     if subtypes:
         out += body_parse
-        out += ["", "    return result;", "}"]
+        out += ["}"]
     else:
+        if name in CACHED:
+            out.append(f"    const auto key = detail::cacheKey(detail::CachedType::{name}, data);")
+            out.append(f"    if (auto cached = detail::findCached<{name}>(key)) {{")
+            out += ["        return cached;", "    }"]
         out.append(f"    auto result = std::make_shared<{name}>();")
         out += body_parse
+        if name in CACHED:
+            out.append("    detail::storeCached(key, result);")
         out += ["    return result;", "}"]
     out += ["", "template <>",
             f"nlohmann::json put(const std::shared_ptr<{name}> &object) {{",
@@ -273,6 +293,12 @@ def main():
     ap.add_argument("--spec", default=os.path.join(ROOT, "api.json"))
     ap.add_argument("--write", action="store_true",
                     help="overwrite the generated .cpp files")
+    ap.add_argument("--out", default=SRC_DIR,
+                    help="directory the .cpp files are compared against and "
+                         "written to")
+    ap.add_argument("--list", action="store_true",
+                    help="print the names of the .cpp files it generates, "
+                         "one per line, and exit")
     ap.add_argument("--only", help="comma-separated type names to limit to")
     ap.add_argument("--check", action="store_true",
                     help="exit non-zero if any non-exception type differs from "
@@ -280,6 +306,8 @@ def main():
     args = ap.parse_args()
     spec = json.load(open(args.spec, encoding="utf-8"))
     only = set(args.only.split(",")) if args.only else None
+    if args.write:
+        os.makedirs(args.out, exist_ok=True)
 
     match = mismatch = 0
     mism_list, skip_list = [], []
@@ -295,7 +323,10 @@ def main():
         if gen is None:
             skip_list.append((name, reason))
             continue
-        path = os.path.join(SRC_DIR, f"{name}.cpp")
+        if args.list:
+            print(f"{name}.cpp")
+            continue
+        path = os.path.join(args.out, f"{name}.cpp")
         # Text mode normalises line endings, so the check is CRLF/LF agnostic.
         cur = open(path, encoding="utf-8").read() if os.path.exists(path) else ""
         if gen == cur:
@@ -303,9 +334,14 @@ def main():
         else:
             mismatch += 1
             mism_list.append(name)
-        if args.write:
+        # Only rewrite what changed, so a build that runs the generator
+        # recompiles just those types.
+        if args.write and gen != cur:
             open(path, "w", encoding="utf-8", newline="\n").write(gen)
 
+    if args.list:
+        return 0
+
     # Skips that are NOT declared hand-written mean the generator can't model a
     # type yet -- that must fail the gate so it's either fixed or declared.
     unexpected = [n for n, r in skip_list if n not in HAND_WRITTEN]
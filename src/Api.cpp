@@ -1,24 +1,34 @@
 #include <tgbot/Api.h>
 #include <tgbot/Logger.h>
+#include <tgbot/Metrics.h>
+#include <tgbot/Tracing.h>
 #include <tgbot/TgException.h>
 #include <tgbot/TgTypeParser.h>
+#include <tgbot/UpdateRecorder.h>
 #include <tgbot/net/HttpReqArg.h>
 #include <tgbot/tools/StringTools.h>
 
 #include <chrono>
 #include <cstdint>
+#include <exception>
 #include <iostream>
+#include <mutex>
 #include <nlohmann/json.hpp>
-#include <sstream>
+#include <optional>
+#include <shared_mutex>
 #include <string_view>
 #include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 
 #include "tgbot/net/HttpClient.h"
+#include "tgbot/net/RequestOptions.h"
 #include "tgbot/types/InputFile.h"
 #include "tgbot/types/Update.h"
+#include "tools/ApiCall.h"
+#include "tools/Instrumentation.h"
 
 namespace detail {
 
@@ -103,14 +113,8 @@ auto putArg(std::string name, const T& data) {
 using TgBot::TgException;
 
 template <typename... Args>
-nlohmann::json sendRequest(const std::string_view _bot_url,
-                           TgBot::HttpClient* _httpClient,
-                           const std::string_view method,
-                           std::pair<const char*, Args>&&... args) {
+TgBot::HttpReqArg::Vec collectArgs(std::pair<const char*, Args>&&... args) {
     TgBot::HttpReqArg::Vec vec;
-    std::string url(_bot_url);
-    url += method;
-
     vec.reserve(sizeof...(Args));
     (
         [&vec](const std::pair<const char*, Args> arg) {
@@ -147,86 +151,62 @@ nlohmann::json sendRequest(const std::string_view _bot_url,
             }
         }(args),
         ...);
+    return vec;
+}
 
-    int retries = 0;
-    {
-        std::ostringstream trace;
-        trace << "Sending request: " << method;
-        for (const auto& arg : vec) {
-            trace << "\n  ";
-            arg->print(trace);
-        }
-        TgBot::detail::log(TgBot::LogLevel::Trace, trace.str());
-    }
-    constexpr int max_retries = TgBot::HttpClient::kRequestMaxRetries;
+// Sends a request through the pipeline of ApiCall, blocking the thread for
+// every attempt and every wait between them.
+nlohmann::json performRequest(TgBot::detail::ApiContext& ctx,
+                              const std::string_view method,
+                              const TgBot::HttpReqArg::Vec& vec) {
+    TgBot::detail::ApiCall call(ctx, method, vec);
     while (true) {
+        const TgBot::RequestOptions options = call.attempt();
+        std::string body;
+        std::exception_ptr error;
         try {
-            std::string serverResponse = _httpClient->makeRequest(url, vec);
-
-            if (!serverResponse.compare(0, 6, "<html>")) {
-                throw TgException(
-                    "tgbot-cpp library have got html page instead of json "
-                    "response. Maybe you entered wrong bot token.",
-                    TgException::ErrorCode::HtmlResponse);
-            }
-
-            nlohmann::json result;
-            try {
-                result = nlohmann::json::parse(serverResponse);
-            } catch (const nlohmann::json::parse_error&) {
-                TgBot::detail::log(
-                    TgBot::LogLevel::Error,
-                    "Failed to parse json response: " + serverResponse);
-                throw TgException(
-                    "tgbot-cpp library can't parse json response.",
-                    TgException::ErrorCode::InvalidJson);
-            }
-
-            if (result.value("ok", false)) {
-                return result["result"];
-            }
+            body = ctx.httpClient->makeRequest(call.url(), vec, options);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        TgBot::detail::ApiCall::Step step =
+            call.complete(std::move(body), std::move(error));
+        if (step.result) {
+            return std::move(*step.result);
+        }
+        call.sleep(step.delay);
+    }
+}
 
-            const std::string message =
-                result.value("description", "Unknown error");
-            const int errorCode = result.value("error_code", 0);
-
-            // Honour Telegram rate limiting (HTTP 429): the request never
-            // reached the bot logic, so wait the suggested time and retry.
-            if (errorCode == 429 &&
-                (max_retries < 0 || retries < max_retries)) {
-                std::chrono::seconds delay = TgBot::HttpClient::kRequestBackoff;
-                if (result.contains("parameters") &&
-                    result["parameters"].contains("retry_after")) {
-                    delay = std::chrono::seconds(
-                        result["parameters"]["retry_after"].get<int>());
-                }
-                TgBot::detail::log(
-                    TgBot::LogLevel::Warning,
-                    "Rate limited by Telegram, retrying " + std::string(method) +
-                        " after " + std::to_string(delay.count()) + "s");
-                std::this_thread::sleep_for(delay);
-                retries++;
-                continue;
-            }
+template <typename... Args>
+nlohmann::json sendRequest(TgBot::detail::ApiContext& ctx,
+                           const std::string_view method,
+                           std::pair<const char*, Args>&&... args) {
+    return performRequest(ctx, method, collectArgs(std::move(args)...));
+}
 
-            throw TgException(message,
-                              static_cast<TgException::ErrorCode>(errorCode));
-        } catch (const TgBot::NetworkException& ex) {
-            // Only transient network failures are retried; API errors above are
-            // deterministic and must propagate (retrying could duplicate
-            // non-idempotent requests such as sendMessage).
-            const bool willRetry = max_retries < 0 || retries < max_retries;
-            TgBot::detail::log(
-                willRetry ? TgBot::LogLevel::Warning : TgBot::LogLevel::Error,
-                std::string("Network error on ") + std::string(method) + ": " +
-                    ex.what() + (willRetry ? " (retrying)" : " (giving up)"));
-            if (!willRetry) {
-                throw;
-            }
-            std::this_thread::sleep_for(TgBot::HttpClient::kRequestBackoff);
-            retries++;
-        }
+// Like sendRequest, but for read-only methods: concurrent calls with the same
+// method and arguments share one in-flight request and its parsed response.
+// Each caller still waits no longer than its own RequestOptions allow.
+// Never use this for methods with side effects.
+template <typename... Args>
+nlohmann::json sendReadRequest(TgBot::detail::ApiContext& ctx,
+                               const std::string_view method,
+                               std::pair<const char*, Args>&&... args) {
+    const TgBot::HttpReqArg::Vec vec = collectArgs(std::move(args)...);
+
+    // Read methods never carry files, so name/value pairs identify the call.
+    std::string key(method);
+    for (const auto& arg : vec) {
+        key += '\0';
+        key += arg->name;
+        key += '=';
+        key += arg->value;
     }
+    const TgBot::detail::CallLimits limits;
+    return ctx.readFlights.run(
+        key, {limits.deadline(), limits.cancellation()},
+        [&ctx, method, &vec] { return performRequest(ctx, method, vec); });
 }
 
 }  // namespace
@@ -390,21 +370,50 @@ std::string putJSON<Sticker::Type>(const Sticker::Type& object) {
 }
 
 Api::Api(std::string token, HttpClient* httpClient, std::string url)
-    : _bot_api_baseurl(url + "/bot" + token + "/"),
-      _token(std::move(token)),
+    : _token(std::move(token)),
       _url(std::move(url)),
-      _httpClient(httpClient) {}
+      _httpClient(httpClient),
+      _ctx(std::make_unique<detail::ApiContext>(_url + "/bot" + _token + "/",
+                                                httpClient)) {}
+
+Api::~Api() = default;
 
 std::vector<Update::Ptr> Api::getUpdates(
     optional<std::int32_t> offset,
     bounded_optional_default<std::int32_t, 0, 100, 100> limit,
     optional_default<std::int32_t, 0> timeout,
     const optional<Update::Types> allowedUpdates) const {
-    return parseArray<Update>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getUpdates",
+    return getUpdates(offset, limit, timeout, allowedUpdates, nullptr);
+}
+
+std::vector<Update::Ptr> Api::getUpdates(
+    optional<std::int32_t> offset,
+    bounded_optional_default<std::int32_t, 0, 100, 100> limit,
+    optional_default<std::int32_t, 0> timeout,
+    const optional<Update::Types> allowedUpdates,
+    UpdateRecorder* recorder) const {
+    const nlohmann::json updates =
+        sendRequest(*_ctx, "getUpdates",
                     std::pair{"offset", offset}, std::pair{"limit", limit},
                     std::pair{"timeout", timeout},
-                    std::pair{"allowed_updates", allowedUpdates}));
+                    std::pair{"allowed_updates", allowedUpdates});
+
+    if (recorder) {
+        const auto received = std::chrono::system_clock::now();
+        for (const auto& update : updates) {
+            recorder->record(update.dump(), received);
+        }
+    }
+
+    if (!detail::metrics() && !detail::tracingEnabled()) {
+        return parseArray<Update>(updates);
+    }
+    std::vector<Update::Ptr> result;
+    result.reserve(updates.size());
+    for (const auto& update : updates) {
+        result.push_back(detail::parseUpdate(update));
+    }
+    return result;
 }
 
 bool Api::setWebhook(
@@ -414,7 +423,7 @@ bool Api::setWebhook(
     const optional<std::string_view> ipAddress,
     optional<bool> dropPendingUpdates,
     const optional<std::string_view> secretToken) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setWebhook",
+    return sendRequest(*_ctx, "setWebhook",
                        std::pair{"url", url},
                        std::pair{"certificate", std::move(certificate)},
                        std::pair{"max_connections", maxConnections},
@@ -426,14 +435,14 @@ bool Api::setWebhook(
 }
 
 bool Api::deleteWebhook(optional<bool> dropPendingUpdates) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteWebhook",
+    return sendRequest(*_ctx, "deleteWebhook",
                        std::pair{"drop_pending_updates", dropPendingUpdates})
         .get<bool>();
 }
 
 WebhookInfo::Ptr Api::getWebhookInfo() const {
     const auto& p =
-        sendRequest(_bot_api_baseurl, _httpClient, "getWebhookInfo");
+        sendReadRequest(*_ctx, "getWebhookInfo");
 
     if (!p.contains("url")) {
         return nullptr;
@@ -447,15 +456,15 @@ WebhookInfo::Ptr Api::getWebhookInfo() const {
 }
 
 User::Ptr Api::getMe() const {
-    return parse<User>(sendRequest(_bot_api_baseurl, _httpClient, "getMe"));
+    return parse<User>(sendReadRequest(*_ctx, "getMe"));
 }
 
 bool Api::logOut() const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "logOut").get<bool>();
+    return sendRequest(*_ctx, "logOut").get<bool>();
 }
 
 bool Api::close() const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "close").get<bool>();
+    return sendRequest(*_ctx, "close").get<bool>();
 }
 
 Message::Ptr Api::sendMessage(
@@ -473,7 +482,7 @@ Message::Ptr Api::sendMessage(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendMessage",
+        *_ctx, "sendMessage",
         std::pair{"chat_id", std::move(chatId)}, std::pair{"text", text},
         std::pair{"parse_mode", parseMode},
         std::pair{"disable_notification", disableNotification},
@@ -502,7 +511,7 @@ Message::Ptr Api::forwardMessage(
     const optional<std::string_view> messageEffectId,
     SuggestedPostParameters::Ptr suggestedPostParameters) const {
     return parse<Message>(
-        sendRequest(_bot_api_baseurl, _httpClient, "forwardMessage",
+        sendRequest(*_ctx, "forwardMessage",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"from_chat_id", std::move(fromChatId)},
                     std::pair{"message_id", messageId},
@@ -523,7 +532,7 @@ std::vector<MessageId::Ptr> Api::forwardMessages(
     optional<bool> protectContent,
     optional<std::int32_t> directMessagesTopicId) const {
     return parseArray<MessageId>(
-        sendRequest(_bot_api_baseurl, _httpClient, "forwardMessages",
+        sendRequest(*_ctx, "forwardMessages",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"from_chat_id", std::move(fromChatId)},
                     std::pair{"message_ids", messageIds},
@@ -548,7 +557,7 @@ MessageId::Ptr Api::copyMessage(
     const optional<std::string_view> messageEffectId,
     SuggestedPostParameters::Ptr suggestedPostParameters) const {
     return parse<MessageId>(sendRequest(
-        _bot_api_baseurl, _httpClient, "copyMessage",
+        *_ctx, "copyMessage",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"from_chat_id", std::move(fromChatId)},
         std::pair{"message_id", messageId}, std::pair{"caption", caption},
@@ -575,7 +584,7 @@ std::vector<MessageId::Ptr> Api::copyMessages(
     optional<bool> protectContent, optional<bool> removeCaption,
     optional<std::int32_t> directMessagesTopicId) const {
     return parseArray<MessageId>(
-        sendRequest(_bot_api_baseurl, _httpClient, "copyMessages",
+        sendRequest(*_ctx, "copyMessages",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"from_chat_id", std::move(fromChatId)},
                     std::pair{"message_ids", messageIds},
@@ -603,7 +612,7 @@ Message::Ptr Api::sendPhoto(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendPhoto",
+        *_ctx, "sendPhoto",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"photo", std::move(photo)}, std::pair{"caption", caption},
         std::pair{"reply_parameters", std::move(replyParameters)},
@@ -642,7 +651,7 @@ Message::Ptr Api::sendAudio(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendAudio",
+        *_ctx, "sendAudio",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"audio", std::move(audio)}, std::pair{"caption", caption},
         std::pair{"duration", duration}, std::pair{"performer", performer},
@@ -680,7 +689,7 @@ Message::Ptr Api::sendDocument(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(
-        sendRequest(_bot_api_baseurl, _httpClient, "sendDocument",
+        sendRequest(*_ctx, "sendDocument",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"document", std::move(document)},
                     std::pair{"thumbnail", std::move(thumbnail)},
@@ -723,7 +732,7 @@ Message::Ptr Api::sendVideo(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(
-        sendRequest(_bot_api_baseurl, _httpClient, "sendVideo",
+        sendRequest(*_ctx, "sendVideo",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"video", std::move(video)},
                     std::pair{"supports_streaming", supportsStreaming},
@@ -770,7 +779,7 @@ Message::Ptr Api::sendAnimation(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(
-        sendRequest(_bot_api_baseurl, _httpClient, "sendAnimation",
+        sendRequest(*_ctx, "sendAnimation",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"animation", std::move(animation)},
                     std::pair{"duration", duration}, std::pair{"width", width},
@@ -811,7 +820,7 @@ Message::Ptr Api::sendVoice(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendVoice",
+        *_ctx, "sendVoice",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"voice", std::move(voice)}, std::pair{"caption", caption},
         std::pair{"duration", duration},
@@ -846,7 +855,7 @@ Message::Ptr Api::sendVideoNote(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendVideoNote",
+        *_ctx, "sendVideoNote",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"video_note", std::move(videoNote)},
         std::pair{"reply_parameters", std::move(replyParameters)},
@@ -875,7 +884,7 @@ std::vector<Message::Ptr> Api::sendMediaGroup(
     optional<bool> allowPaidBroadcast,
     const optional<std::string_view> messageEffectId) const {
     return parseArray<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendMediaGroup",
+        *_ctx, "sendMediaGroup",
         std::pair{"chat_id", std::move(chatId)}, std::pair{"media", media},
         std::pair{"disable_notification", disableNotification},
         std::pair{"reply_parameters", std::move(replyParameters)},
@@ -904,7 +913,7 @@ Message::Ptr Api::sendLocation(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendLocation",
+        *_ctx, "sendLocation",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"latitude", latitude}, std::pair{"longitude", longitude},
         std::pair{"live_period", livePeriod},
@@ -937,7 +946,7 @@ Message::Ptr Api::editMessageLiveLocation(
     const optional<std::string_view> businessConnectionId,
     optional<std::int32_t> livePeriod) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "editMessageLiveLocation",
+        *_ctx, "editMessageLiveLocation",
         std::pair{"latitude", latitude}, std::pair{"longitude", longitude},
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"message_id", messageId},
@@ -956,7 +965,7 @@ Message::Ptr Api::stopMessageLiveLocation(
     InlineKeyboardMarkup::Ptr replyMarkup,
     const optional<std::string_view> businessConnectionId) const {
     return parse<Message>(
-        sendRequest(_bot_api_baseurl, _httpClient, "stopMessageLiveLocation",
+        sendRequest(*_ctx, "stopMessageLiveLocation",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"message_id", messageId},
                     std::pair{"inline_message_id", inlineMessageId},
@@ -982,7 +991,7 @@ Message::Ptr Api::sendVenue(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendVenue",
+        *_ctx, "sendVenue",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"latitude", latitude}, std::pair{"longitude", longitude},
         std::pair{"title", title}, std::pair{"address", address},
@@ -1019,7 +1028,7 @@ Message::Ptr Api::sendContact(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(
-        sendRequest(_bot_api_baseurl, _httpClient, "sendContact",
+        sendRequest(*_ctx, "sendContact",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"phone_number", phoneNumber},
                     std::pair{"first_name", firstName},
@@ -1068,7 +1077,7 @@ Message::Ptr Api::sendPoll(
     const optional<std::string_view> description, InputMedia::Ptr media,
     InputMedia::Ptr explanationMedia) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendPoll",
+        *_ctx, "sendPoll",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"question", question}, std::pair{"options", options},
         std::pair{"disable_notification", disableNotification},
@@ -1098,7 +1107,8 @@ Message::Ptr Api::sendPoll(
         std::pair{"correct_option_ids", correctOptionIds},
         std::pair{"description_parse_mode", descriptionParseMode},
         std::pair{"description_entities", descriptionEntities},
-        std::pair{"description", description}, std::pair{"media", std::move(media)},
+        std::pair{"description", description},
+        std::pair{"media", std::move(media)},
         std::pair{"explanation_media", std::move(explanationMedia)}));
 }
 
@@ -1113,7 +1123,7 @@ Message::Ptr Api::sendDice(
     const optional<std::string_view> messageEffectId,
     SuggestedPostParameters::Ptr suggestedPostParameters) const {
     return parse<Message>(
-        sendRequest(_bot_api_baseurl, _httpClient, "sendDice",
+        sendRequest(*_ctx, "sendDice",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"disable_notification", disableNotification},
                     std::pair{"reply_parameters", std::move(replyParameters)},
@@ -1133,7 +1143,7 @@ bool Api::setMessageReaction(ChatIdType chatId,
                              optional<std::int32_t> messageId,
                              const std::vector<ReactionType::Ptr>& reaction,
                              optional<bool> isBig) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setMessageReaction",
+    return sendRequest(*_ctx, "setMessageReaction",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_id", messageId},
                        std::pair{"reaction", reaction},
@@ -1146,7 +1156,7 @@ bool Api::sendChatAction(
     optional<std::int32_t> messageThreadId,
     const optional<std::string_view> businessConnectionId) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "sendChatAction",
+               *_ctx, "sendChatAction",
                std::pair{"chat_id", chatId}, std::pair{"action", action},
                std::pair{"message_thread_id", messageThreadId},
                std::pair{"business_connection_id", businessConnectionId})
@@ -1157,21 +1167,22 @@ UserProfilePhotos::Ptr Api::getUserProfilePhotos(
     std::int64_t userId, optional<std::int32_t> offset,
     bounded_optional_default<std::int32_t, 1, 100, 100> limit) const {
     return parse<UserProfilePhotos>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getUserProfilePhotos",
-                    std::pair{"user_id", userId}, std::pair{"offset", offset},
-                    std::pair{"limit", limit}));
+        sendReadRequest(*_ctx, "getUserProfilePhotos",
+                        std::pair{"user_id", userId},
+                        std::pair{"offset", offset},
+                        std::pair{"limit", limit}));
 }
 
 File::Ptr Api::getFile(const std::string_view fileId) const {
-    return parse<File>(sendRequest(_bot_api_baseurl, _httpClient, "getFile",
-                                   std::pair{"file_id", fileId}));
+    return parse<File>(sendReadRequest(*_ctx, "getFile",
+                                       std::pair{"file_id", fileId}));
 }
 
 bool Api::banChatMember(
     ChatIdType chatId, std::int64_t userId,
     optional<std::chrono::system_clock::time_point> untilDate,
     optional<bool> revokeMessages) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "banChatMember",
+    return sendRequest(*_ctx, "banChatMember",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"user_id", userId},
                        std::pair{"until_date", untilDate},
@@ -1181,7 +1192,7 @@ bool Api::banChatMember(
 
 bool Api::unbanChatMember(ChatIdType chatId, std::int64_t userId,
                           optional<bool> onlyIfBanned) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "unbanChatMember",
+    return sendRequest(*_ctx, "unbanChatMember",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"user_id", userId},
                        std::pair{"only_if_banned", onlyIfBanned})
@@ -1192,7 +1203,7 @@ bool Api::restrictChatMember(
     ChatIdType chatId, std::int64_t userId, ChatPermissions::Ptr permissions,
     optional<std::chrono::system_clock::time_point> untilDate,
     optional<bool> useIndependentChatPermissions) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "restrictChatMember",
+    return sendRequest(*_ctx, "restrictChatMember",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"user_id", userId},
                        std::pair{"permissions", std::move(permissions)},
@@ -1213,7 +1224,7 @@ bool Api::promoteChatMember(
     optional<bool> canEditStories, optional<bool> canDeleteStories,
     optional<bool> canManageDirectMessages, optional<bool> canManageTags) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "promoteChatMember",
+               *_ctx, "promoteChatMember",
                std::pair{"chat_id", std::move(chatId)},
                std::pair{"user_id", userId},
                std::pair{"can_change_info", canChangeInfo},
@@ -1239,8 +1250,7 @@ bool Api::promoteChatMember(
 bool Api::setChatAdministratorCustomTitle(
     ChatIdType chatId, std::int64_t userId,
     const std::string_view customTitle) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "setChatAdministratorCustomTitle",
+    return sendRequest(*_ctx, "setChatAdministratorCustomTitle",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"user_id", userId},
                        std::pair{"custom_title", customTitle})
@@ -1249,7 +1259,7 @@ bool Api::setChatAdministratorCustomTitle(
 
 bool Api::banChatSenderChat(ChatIdType chatId,
                             std::int64_t senderChatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "banChatSenderChat",
+    return sendRequest(*_ctx, "banChatSenderChat",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"sender_chat_id", senderChatId})
         .get<bool>();
@@ -1257,7 +1267,7 @@ bool Api::banChatSenderChat(ChatIdType chatId,
 
 bool Api::unbanChatSenderChat(ChatIdType chatId,
                               std::int64_t senderChatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "unbanChatSenderChat",
+    return sendRequest(*_ctx, "unbanChatSenderChat",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"sender_chat_id", senderChatId})
         .get<bool>();
@@ -1266,7 +1276,7 @@ bool Api::unbanChatSenderChat(ChatIdType chatId,
 bool Api::setChatPermissions(
     ChatIdType chatId, ChatPermissions::Ptr permissions,
     optional<bool> useIndependentChatPermissions) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setChatPermissions",
+    return sendRequest(*_ctx, "setChatPermissions",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"permissions", std::move(permissions)},
                        std::pair{"use_independent_chat_permissions",
@@ -1275,7 +1285,7 @@ bool Api::setChatPermissions(
 }
 
 std::string Api::exportChatInviteLink(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "exportChatInviteLink",
+    return sendRequest(*_ctx, "exportChatInviteLink",
                        std::pair{"chat_id", std::move(chatId)})
         .get<std::string>();
 }
@@ -1286,7 +1296,7 @@ ChatInviteLink::Ptr Api::createChatInviteLink(
     optional<std::int32_t> memberLimit, const optional<std::string_view> name,
     optional<bool> createsJoinRequest) const {
     return parse<ChatInviteLink>(sendRequest(
-        _bot_api_baseurl, _httpClient, "createChatInviteLink",
+        *_ctx, "createChatInviteLink",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"expire_date", expireDate},
         std::pair{"member_limit", memberLimit}, std::pair{"name", name},
@@ -1299,7 +1309,7 @@ ChatInviteLink::Ptr Api::editChatInviteLink(
     optional<std::int32_t> memberLimit, const optional<std::string_view> name,
     optional<bool> createsJoinRequest) const {
     return parse<ChatInviteLink>(sendRequest(
-        _bot_api_baseurl, _httpClient, "editChatInviteLink",
+        *_ctx, "editChatInviteLink",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"invite_link", inviteLink},
         std::pair{"expire_date", expireDate},
@@ -1310,40 +1320,40 @@ ChatInviteLink::Ptr Api::editChatInviteLink(
 ChatInviteLink::Ptr Api::revokeChatInviteLink(
     ChatIdType chatId, const std::string_view inviteLink) const {
     return parse<ChatInviteLink>(
-        sendRequest(_bot_api_baseurl, _httpClient, "revokeChatInviteLink",
+        sendRequest(*_ctx, "revokeChatInviteLink",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"invite_link", inviteLink}));
 }
 
 bool Api::approveChatJoinRequest(ChatIdType chatId, std::int64_t userId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "approveChatJoinRequest",
+    return sendRequest(*_ctx, "approveChatJoinRequest",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"user_id", userId})
         .get<bool>();
 }
 
 bool Api::declineChatJoinRequest(ChatIdType chatId, std::int64_t userId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "declineChatJoinRequest",
+    return sendRequest(*_ctx, "declineChatJoinRequest",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"user_id", userId})
         .get<bool>();
 }
 
 bool Api::setChatPhoto(ChatIdType chatId, InputFile::Ptr photo) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setChatPhoto",
+    return sendRequest(*_ctx, "setChatPhoto",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"photo", std::move(photo)})
         .get<bool>();
 }
 
 bool Api::deleteChatPhoto(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteChatPhoto",
+    return sendRequest(*_ctx, "deleteChatPhoto",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
 
 bool Api::setChatTitle(ChatIdType chatId, const std::string_view title) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setChatTitle",
+    return sendRequest(*_ctx, "setChatTitle",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"title", title})
         .get<bool>();
@@ -1351,7 +1361,7 @@ bool Api::setChatTitle(ChatIdType chatId, const std::string_view title) const {
 
 bool Api::setChatDescription(ChatIdType chatId,
                              const std::string_view description) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setChatDescription",
+    return sendRequest(*_ctx, "setChatDescription",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"description", description})
         .get<bool>();
@@ -1361,7 +1371,7 @@ bool Api::pinChatMessage(
     ChatIdType chatId, std::int32_t messageId,
     optional<bool> disableNotification,
     const optional<std::string_view> businessConnectionId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "pinChatMessage",
+    return sendRequest(*_ctx, "pinChatMessage",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_id", messageId},
                        std::pair{"disable_notification", disableNotification},
@@ -1372,7 +1382,7 @@ bool Api::pinChatMessage(
 bool Api::unpinChatMessage(
     ChatIdType chatId, optional<std::int32_t> messageId,
     const optional<std::string_view> businessConnectionId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "unpinChatMessage",
+    return sendRequest(*_ctx, "unpinChatMessage",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_id", messageId},
                        std::pair{"business_connection_id", businessConnectionId})
@@ -1380,60 +1390,60 @@ bool Api::unpinChatMessage(
 }
 
 bool Api::unpinAllChatMessages(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "unpinAllChatMessages",
+    return sendRequest(*_ctx, "unpinAllChatMessages",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
 
 bool Api::leaveChat(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "leaveChat",
+    return sendRequest(*_ctx, "leaveChat",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
 
 Chat::Ptr Api::getChat(ChatIdType chatId) const {
-    return parse<Chat>(sendRequest(_bot_api_baseurl, _httpClient, "getChat",
-                                   std::pair{"chat_id", std::move(chatId)}));
+    return parse<Chat>(sendReadRequest(
+        *_ctx, "getChat", std::pair{"chat_id", std::move(chatId)}));
 }
 
 std::vector<ChatMember::Ptr> Api::getChatAdministrators(
     ChatIdType chatId, optional<bool> returnBots) const {
     return parseArray<ChatMember>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getChatAdministrators",
-                    std::pair{"chat_id", std::move(chatId)},
-                    std::pair{"return_bots", returnBots}));
+        sendReadRequest(*_ctx, "getChatAdministrators",
+                        std::pair{"chat_id", std::move(chatId)},
+                        std::pair{"return_bots", returnBots}));
 }
 
 int32_t Api::getChatMemberCount(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "getChatMemberCount",
-                       std::pair{"chat_id", std::move(chatId)})
+    return sendReadRequest(*_ctx, "getChatMemberCount",
+                           std::pair{"chat_id", std::move(chatId)})
         .get<int>();
 }
 
 ChatMember::Ptr Api::getChatMember(ChatIdType chatId,
                                    std::int64_t userId) const {
-    return parse<ChatMember>(sendRequest(
-        _bot_api_baseurl, _httpClient, "getChatMember",
+    return parse<ChatMember>(sendReadRequest(
+        *_ctx, "getChatMember",
         std::pair{"chat_id", std::move(chatId)}, std::pair{"user_id", userId}));
 }
 
 bool Api::setChatStickerSet(ChatIdType chatId,
                             const std::string_view stickerSetName) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setChatStickerSet",
+    return sendRequest(*_ctx, "setChatStickerSet",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"sticker_set_name", stickerSetName})
         .get<bool>();
 }
 
 bool Api::deleteChatStickerSet(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteChatStickerSet",
+    return sendRequest(*_ctx, "deleteChatStickerSet",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
 
 std::vector<Sticker::Ptr> Api::getForumTopicIconStickers() const {
-    return parseArray<Sticker>(sendRequest(_bot_api_baseurl, _httpClient,
-                                           "getForumTopicIconStickers"));
+    return parseArray<Sticker>(
+        sendReadRequest(*_ctx, "getForumTopicIconStickers"));
 }
 
 ForumTopic::Ptr Api::createForumTopic(
@@ -1441,7 +1451,7 @@ ForumTopic::Ptr Api::createForumTopic(
     optional<std::int32_t> iconColor,
     const optional<std::string_view> iconCustomEmojiId) const {
     return parse<ForumTopic>(
-        sendRequest(_bot_api_baseurl, _httpClient, "createForumTopic",
+        sendRequest(*_ctx, "createForumTopic",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"name", name}, std::pair{"icon_color", iconColor},
                     std::pair{"icon_custom_emoji_id", iconCustomEmojiId}));
@@ -1452,7 +1462,7 @@ bool Api::editForumTopic(
     const optional<std::string_view> name,
     std::variant<std::int32_t, std::string> iconCustomEmojiId) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "editForumTopic",
+               *_ctx, "editForumTopic",
                std::pair{"chat_id", std::move(chatId)},
                std::pair{"message_thread_id", messageThreadId},
                std::pair{"name", name},
@@ -1462,7 +1472,7 @@ bool Api::editForumTopic(
 
 bool Api::closeForumTopic(ChatIdType chatId,
                           std::int32_t messageThreadId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "closeForumTopic",
+    return sendRequest(*_ctx, "closeForumTopic",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_thread_id", messageThreadId})
         .get<bool>();
@@ -1470,7 +1480,7 @@ bool Api::closeForumTopic(ChatIdType chatId,
 
 bool Api::reopenForumTopic(ChatIdType chatId,
                            std::int32_t messageThreadId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "reopenForumTopic",
+    return sendRequest(*_ctx, "reopenForumTopic",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_thread_id", messageThreadId})
         .get<bool>();
@@ -1478,7 +1488,7 @@ bool Api::reopenForumTopic(ChatIdType chatId,
 
 bool Api::deleteForumTopic(ChatIdType chatId,
                            std::int32_t messageThreadId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteForumTopic",
+    return sendRequest(*_ctx, "deleteForumTopic",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_thread_id", messageThreadId})
         .get<bool>();
@@ -1486,47 +1496,45 @@ bool Api::deleteForumTopic(ChatIdType chatId,
 
 bool Api::unpinAllForumTopicMessages(ChatIdType chatId,
                                      std::int32_t messageThreadId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "unpinAllForumTopicMessages",
+    return sendRequest(*_ctx, "unpinAllForumTopicMessages",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_thread_id", messageThreadId})
         .get<bool>();
 }
 
 bool Api::editGeneralForumTopic(ChatIdType chatId, std::string name) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "editGeneralForumTopic",
+    return sendRequest(*_ctx, "editGeneralForumTopic",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"name", std::move(name)})
         .get<bool>();
 }
 
 bool Api::closeGeneralForumTopic(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "closeGeneralForumTopic",
+    return sendRequest(*_ctx, "closeGeneralForumTopic",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
 
 bool Api::reopenGeneralForumTopic(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "reopenGeneralForumTopic",
+    return sendRequest(*_ctx, "reopenGeneralForumTopic",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
 
 bool Api::hideGeneralForumTopic(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "hideGeneralForumTopic",
+    return sendRequest(*_ctx, "hideGeneralForumTopic",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
 
 bool Api::unhideGeneralForumTopic(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "unhideGeneralForumTopic",
+    return sendRequest(*_ctx, "unhideGeneralForumTopic",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
 
 bool Api::unpinAllGeneralForumTopicMessages(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "unpinAllGeneralForumTopicMessages",
+    return sendRequest(*_ctx, "unpinAllGeneralForumTopicMessages",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
@@ -1537,7 +1545,7 @@ bool Api::answerCallbackQuery(const std::string_view callbackQueryId,
                               const optional<std::string_view> url,
                               optional<std::int32_t> cacheTime) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "answerCallbackQuery",
+               *_ctx, "answerCallbackQuery",
                std::pair{"callback_query_id", callbackQueryId},
                std::pair{"text", text}, std::pair{"show_alert", showAlert},
                std::pair{"url", url}, std::pair{"cache_time", cacheTime})
@@ -1546,22 +1554,23 @@ bool Api::answerCallbackQuery(const std::string_view callbackQueryId,
 
 UserChatBoosts::Ptr Api::getUserChatBoosts(ChatIdType chatId,
                                            std::int32_t userId) const {
-    return parse<UserChatBoosts>(sendRequest(
-        _bot_api_baseurl, _httpClient, "getUserChatBoosts",
+    return parse<UserChatBoosts>(sendReadRequest(
+        *_ctx, "getUserChatBoosts",
         std::pair{"chat_id", std::move(chatId)}, std::pair{"user_id", userId}));
 }
 
 BusinessConnection::Ptr Api::getBusinessConnection(
     const std::string_view businessConnectionId) const {
     return parse<BusinessConnection>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getBusinessConnection",
-                    std::pair{"business_connection_id", businessConnectionId}));
+        sendReadRequest(
+            *_ctx, "getBusinessConnection",
+            std::pair{"business_connection_id", businessConnectionId}));
 }
 
 bool Api::setMyCommands(const std::vector<BotCommand::Ptr>& commands,
                         BotCommandScope::Ptr scope,
                         const optional<LanguageCode> languageCode) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setMyCommands",
+    return sendRequest(*_ctx, "setMyCommands",
                        std::pair{"commands", commands},
                        std::pair{"scope", std::move(scope)},
                        std::pair{"language_code", languageCode})
@@ -1570,7 +1579,7 @@ bool Api::setMyCommands(const std::vector<BotCommand::Ptr>& commands,
 
 bool Api::deleteMyCommands(BotCommandScope::Ptr scope,
                            const optional<LanguageCode> languageCode) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteMyCommands",
+    return sendRequest(*_ctx, "deleteMyCommands",
                        std::pair{"scope", std::move(scope)},
                        std::pair{"language_code", languageCode})
         .get<bool>();
@@ -1580,14 +1589,14 @@ std::vector<BotCommand::Ptr> Api::getMyCommands(
     BotCommandScope::Ptr scope,
     const optional<LanguageCode> languageCode) const {
     return parseArray<BotCommand>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getMyCommands",
-                    std::pair{"scope", std::move(scope)},
-                    std::pair{"language_code", languageCode}));
+        sendReadRequest(*_ctx, "getMyCommands",
+                        std::pair{"scope", std::move(scope)},
+                        std::pair{"language_code", languageCode}));
 }
 
 bool Api::setMyName(const optional<std::string_view> name,
                     const optional<LanguageCode> languageCode) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setMyName",
+    return sendRequest(*_ctx, "setMyName",
                        std::pair{"name", name},
                        std::pair{"language_code", languageCode})
         .get<bool>();
@@ -1595,13 +1604,13 @@ bool Api::setMyName(const optional<std::string_view> name,
 
 BotName::Ptr Api::getMyName(const optional<LanguageCode> languageCode) const {
     return parse<BotName>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getMyName",
-                    std::pair{"language_code", languageCode}));
+        sendReadRequest(*_ctx, "getMyName",
+                        std::pair{"language_code", languageCode}));
 }
 
 bool Api::setMyDescription(const optional<std::string_view> description,
                            const optional<LanguageCode> languageCode) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setMyDescription",
+    return sendRequest(*_ctx, "setMyDescription",
                        std::pair{"description", description},
                        std::pair{"language_code", languageCode})
         .get<bool>();
@@ -1610,14 +1619,14 @@ bool Api::setMyDescription(const optional<std::string_view> description,
 BotDescription::Ptr Api::getMyDescription(
     const optional<LanguageCode> languageCode) const {
     return parse<BotDescription>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getMyDescription",
-                    std::pair{"language_code", languageCode}));
+        sendReadRequest(*_ctx, "getMyDescription",
+                        std::pair{"language_code", languageCode}));
 }
 
 bool Api::setMyShortDescription(
     const optional<std::string_view> shortDescription,
     const optional<LanguageCode> languageCode) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setMyShortDescription",
+    return sendRequest(*_ctx, "setMyShortDescription",
                        std::pair{"short_description", shortDescription},
                        std::pair{"language_code", languageCode})
         .get<bool>();
@@ -1626,28 +1635,26 @@ bool Api::setMyShortDescription(
 BotShortDescription::Ptr Api::getMyShortDescription(
     const optional<LanguageCode> languageCode) const {
     return parse<BotShortDescription>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getMyShortDescription",
-                    std::pair{"language_code", languageCode}));
+        sendReadRequest(*_ctx, "getMyShortDescription",
+                        std::pair{"language_code", languageCode}));
 }
 
 bool Api::setChatMenuButton(optional<std::int64_t> chatId,
                             MenuButton::Ptr menuButton) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setChatMenuButton",
+    return sendRequest(*_ctx, "setChatMenuButton",
                        std::pair{"chat_id", chatId},
                        std::pair{"menu_button", std::move(menuButton)})
         .get<bool>();
 }
 
 MenuButton::Ptr Api::getChatMenuButton(optional<std::int64_t> chatId) const {
-    return parse<MenuButton>(sendRequest(_bot_api_baseurl, _httpClient,
-                                         "getChatMenuButton",
-                                         std::pair{"chat_id", chatId}));
+    return parse<MenuButton>(sendReadRequest(*_ctx, "getChatMenuButton",
+                                             std::pair{"chat_id", chatId}));
 }
 
 bool Api::setMyDefaultAdministratorRights(ChatAdministratorRights::Ptr rights,
                                           optional<bool> forChannels) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "setMyDefaultAdministratorRights",
+    return sendRequest(*_ctx, "setMyDefaultAdministratorRights",
                        std::pair{"rights", std::move(rights)},
                        std::pair{"for_channels", forChannels})
         .get<bool>();
@@ -1655,8 +1662,8 @@ bool Api::setMyDefaultAdministratorRights(ChatAdministratorRights::Ptr rights,
 
 ChatAdministratorRights::Ptr Api::getMyDefaultAdministratorRights(
     optional<bool> forChannels) const {
-    return parse<ChatAdministratorRights>(sendRequest(
-        _bot_api_baseurl, _httpClient, "getMyDefaultAdministratorRights",
+    return parse<ChatAdministratorRights>(sendReadRequest(
+        *_ctx, "getMyDefaultAdministratorRights",
         std::pair{"for_channels", forChannels}));
 }
 
@@ -1671,7 +1678,7 @@ Message::Ptr Api::editMessageText(
     const optional<std::string_view> businessConnectionId,
     InputRichMessage::Ptr richMessage) const {
     const auto p = sendRequest(
-        _bot_api_baseurl, _httpClient, "editMessageText",
+        *_ctx, "editMessageText",
         std::pair{"text", text}, std::pair{"chat_id", std::move(chatId)},
         std::pair{"message_id", messageId},
         std::pair{"inline_message_id", inlineMessageId},
@@ -1697,7 +1704,7 @@ Message::Ptr Api::editMessageCaption(
     const optional<std::string_view> businessConnectionId,
     optional<bool> showCaptionAboveMedia) const {
     const auto p = sendRequest(
-        _bot_api_baseurl, _httpClient, "editMessageCaption",
+        *_ctx, "editMessageCaption",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"message_id", messageId}, std::pair{"caption", caption},
         std::pair{"inline_message_id", inlineMessageId},
@@ -1719,7 +1726,7 @@ Message::Ptr Api::editMessageMedia(
     GenericReply::Ptr replyMarkup,
     const optional<std::string_view> businessConnectionId) const {
     const auto& p =
-        sendRequest(_bot_api_baseurl, _httpClient, "editMessageMedia",
+        sendRequest(*_ctx, "editMessageMedia",
                     std::pair{"media", std::move(media)},
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"message_id", messageId},
@@ -1739,7 +1746,7 @@ Message::Ptr Api::editMessageReplyMarkup(
     GenericReply::Ptr replyMarkup,
     const optional<std::string_view> businessConnectionId) const {
     const auto& p =
-        sendRequest(_bot_api_baseurl, _httpClient, "editMessageReplyMarkup",
+        sendRequest(*_ctx, "editMessageReplyMarkup",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"message_id", messageId},
                     std::pair{"inline_message_id", inlineMessageId},
@@ -1757,7 +1764,7 @@ Poll::Ptr Api::stopPoll(
     InlineKeyboardMarkup::Ptr replyMarkup,
     const optional<std::string_view> businessConnectionId) const {
     return parse<Poll>(
-        sendRequest(_bot_api_baseurl, _httpClient, "stopPoll",
+        sendRequest(*_ctx, "stopPoll",
                     std::pair{"chat_id", std::move(chatId)},
                     std::pair{"message_id", messageId},
                     std::pair{"reply_markup", std::move(replyMarkup)},
@@ -1765,7 +1772,7 @@ Poll::Ptr Api::stopPoll(
 }
 
 bool Api::deleteMessage(ChatIdType chatId, std::int32_t messageId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteMessage",
+    return sendRequest(*_ctx, "deleteMessage",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_id", messageId})
         .get<bool>();
@@ -1773,7 +1780,7 @@ bool Api::deleteMessage(ChatIdType chatId, std::int32_t messageId) const {
 
 bool Api::deleteMessages(ChatIdType chatId,
                          const std::vector<std::int32_t>& messageIds) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteMessages",
+    return sendRequest(*_ctx, "deleteMessages",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_ids", messageIds})
         .get<bool>();
@@ -1781,7 +1788,7 @@ bool Api::deleteMessages(ChatIdType chatId,
 
 bool Api::deleteEphemeralMessage(ChatIdType chatId, std::int64_t receiverUserId,
                                  std::int32_t ephemeralMessageId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteEphemeralMessage",
+    return sendRequest(*_ctx, "deleteEphemeralMessage",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"receiver_user_id", receiverUserId},
                        std::pair{"ephemeral_message_id", ephemeralMessageId})
@@ -1794,8 +1801,7 @@ bool Api::editEphemeralMessageCaption(
     const optional<ParseMode> parseMode,
     const std::vector<MessageEntity::Ptr>& captionEntities,
     InlineKeyboardMarkup::Ptr replyMarkup) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "editEphemeralMessageCaption",
+    return sendRequest(*_ctx, "editEphemeralMessageCaption",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"receiver_user_id", receiverUserId},
                        std::pair{"ephemeral_message_id", ephemeralMessageId},
@@ -1811,8 +1817,7 @@ bool Api::editEphemeralMessageMedia(ChatIdType chatId,
                                     std::int32_t ephemeralMessageId,
                                     InputMedia::Ptr media,
                                     InlineKeyboardMarkup::Ptr replyMarkup) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "editEphemeralMessageMedia",
+    return sendRequest(*_ctx, "editEphemeralMessageMedia",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"receiver_user_id", receiverUserId},
                        std::pair{"ephemeral_message_id", ephemeralMessageId},
@@ -1825,8 +1830,7 @@ bool Api::editEphemeralMessageReplyMarkup(
     ChatIdType chatId, std::int64_t receiverUserId,
     std::int32_t ephemeralMessageId,
     InlineKeyboardMarkup::Ptr replyMarkup) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "editEphemeralMessageReplyMarkup",
+    return sendRequest(*_ctx, "editEphemeralMessageReplyMarkup",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"receiver_user_id", receiverUserId},
                        std::pair{"ephemeral_message_id", ephemeralMessageId},
@@ -1841,8 +1845,7 @@ bool Api::editEphemeralMessageText(
     const std::vector<MessageEntity::Ptr>& entities,
     LinkPreviewOptions::Ptr linkPreviewOptions,
     InlineKeyboardMarkup::Ptr replyMarkup) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "editEphemeralMessageText",
+    return sendRequest(*_ctx, "editEphemeralMessageText",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"receiver_user_id", receiverUserId},
                        std::pair{"ephemeral_message_id", ephemeralMessageId},
@@ -1867,7 +1870,7 @@ Message::Ptr Api::sendSticker(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendSticker",
+        *_ctx, "sendSticker",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"sticker", std::move(sticker)},
         std::pair{"reply_markup", std::move(replyMarkup)},
@@ -1886,22 +1889,21 @@ Message::Ptr Api::sendSticker(
 }
 
 StickerSet::Ptr Api::getStickerSet(const std::string_view name) const {
-    return parse<StickerSet>(sendRequest(_bot_api_baseurl, _httpClient,
-                                         "getStickerSet",
-                                         std::pair{"name", name}));
+    return parse<StickerSet>(sendReadRequest(*_ctx, "getStickerSet",
+                                             std::pair{"name", name}));
 }
 
 std::vector<Sticker::Ptr> Api::getCustomEmojiStickers(
     const std::vector<std::string>& customEmojiIds) const {
     return parseArray<Sticker>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getCustomEmojiStickers",
-                    std::pair{"custom_emoji_ids", customEmojiIds}));
+        sendReadRequest(*_ctx, "getCustomEmojiStickers",
+                        std::pair{"custom_emoji_ids", customEmojiIds}));
 }
 
 File::Ptr Api::uploadStickerFile(std::int64_t userId, InputFile::Ptr sticker,
                                  const StickerFormat stickerFormat) const {
     return parse<File>(sendRequest(
-        _bot_api_baseurl, _httpClient, "uploadStickerFile",
+        *_ctx, "uploadStickerFile",
         std::pair{"user_id", userId}, std::pair{"sticker", std::move(sticker)},
         std::pair{"sticker_format", stickerFormat}));
 }
@@ -1912,7 +1914,7 @@ bool Api::createNewStickerSet(
     const std::vector<InputSticker::Ptr>& stickers,
     optional_default<Sticker::Type, Sticker::Type::Regular> stickerType,
     optional<bool> needsRepainting) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "createNewStickerSet",
+    return sendRequest(*_ctx, "createNewStickerSet",
                        std::pair{"user_id", userId}, std::pair{"name", name},
                        std::pair{"title", title},
                        std::pair{"stickers", stickers},
@@ -1923,7 +1925,7 @@ bool Api::createNewStickerSet(
 
 bool Api::addStickerToSet(std::int64_t userId, const std::string_view name,
                           InputSticker::Ptr sticker) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "addStickerToSet",
+    return sendRequest(*_ctx, "addStickerToSet",
                        std::pair{"user_id", userId}, std::pair{"name", name},
                        std::pair{"sticker", std::move(sticker)})
         .get<bool>();
@@ -1931,14 +1933,14 @@ bool Api::addStickerToSet(std::int64_t userId, const std::string_view name,
 
 bool Api::setStickerPositionInSet(const std::string_view sticker,
                                   std::int32_t position) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setStickerPositionInSet",
+    return sendRequest(*_ctx, "setStickerPositionInSet",
                        std::pair{"sticker", sticker},
                        std::pair{"position", position})
         .get<bool>();
 }
 
 bool Api::deleteStickerFromSet(const std::string_view sticker) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteStickerFromSet",
+    return sendRequest(*_ctx, "deleteStickerFromSet",
                        std::pair{"sticker", sticker})
         .get<bool>();
 }
@@ -1946,7 +1948,7 @@ bool Api::deleteStickerFromSet(const std::string_view sticker) const {
 bool Api::replaceStickerInSet(std::int64_t userId, const std::string_view name,
                               const std::string_view oldSticker,
                               InputSticker::Ptr sticker) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "replaceStickerInSet",
+    return sendRequest(*_ctx, "replaceStickerInSet",
                        std::pair{"user_id", userId}, std::pair{"name", name},
                        std::pair{"old_sticker", oldSticker},
                        std::pair{"sticker", std::move(sticker)})
@@ -1955,7 +1957,7 @@ bool Api::replaceStickerInSet(std::int64_t userId, const std::string_view name,
 
 bool Api::setStickerEmojiList(const std::string_view sticker,
                               const std::vector<std::string>& emojiList) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setStickerEmojiList",
+    return sendRequest(*_ctx, "setStickerEmojiList",
                        std::pair{"sticker", sticker},
                        std::pair{"emoji_list", emojiList})
         .get<bool>();
@@ -1963,7 +1965,7 @@ bool Api::setStickerEmojiList(const std::string_view sticker,
 
 bool Api::setStickerKeywords(const std::string_view sticker,
                              const std::vector<std::string>& keywords) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setStickerKeywords",
+    return sendRequest(*_ctx, "setStickerKeywords",
                        std::pair{"sticker", sticker},
                        std::pair{"keywords", keywords})
         .get<bool>();
@@ -1971,7 +1973,7 @@ bool Api::setStickerKeywords(const std::string_view sticker,
 
 bool Api::setStickerMaskPosition(const std::string_view sticker,
                                  MaskPosition::Ptr maskPosition) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setStickerMaskPosition",
+    return sendRequest(*_ctx, "setStickerMaskPosition",
                        std::pair{"sticker", sticker},
                        std::pair{"mask_position", std::move(maskPosition)})
         .get<bool>();
@@ -1979,7 +1981,7 @@ bool Api::setStickerMaskPosition(const std::string_view sticker,
 
 bool Api::setStickerSetTitle(const std::string_view name,
                              const std::string_view title) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setStickerSetTitle",
+    return sendRequest(*_ctx, "setStickerSetTitle",
                        std::pair{"name", name}, std::pair{"title", title})
         .get<bool>();
 }
@@ -1988,7 +1990,7 @@ bool Api::setStickerSetThumbnail(const std::string_view name,
                                  std::int64_t userId,
                                  const StickerFormat format,
                                  FileHandleType thumbnail) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setStickerSetThumbnail",
+    return sendRequest(*_ctx, "setStickerSetThumbnail",
                        std::pair{"name", name}, std::pair{"user_id", userId},
                        std::pair{"format", format},
                        std::pair{"thumbnail", std::move(thumbnail)})
@@ -1998,15 +2000,14 @@ bool Api::setStickerSetThumbnail(const std::string_view name,
 bool Api::setCustomEmojiStickerSetThumbnail(
     const std::string_view name,
     const optional<std::string_view> customEmojiId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "setCustomEmojiStickerSetThumbnail",
+    return sendRequest(*_ctx, "setCustomEmojiStickerSetThumbnail",
                        std::pair{"name", name},
                        std::pair{"custom_emoji_id", customEmojiId})
         .get<bool>();
 }
 
 bool Api::deleteStickerSet(const std::string_view name) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteStickerSet",
+    return sendRequest(*_ctx, "deleteStickerSet",
                        std::pair{"name", name})
         .get<bool>();
 }
@@ -2017,7 +2018,7 @@ bool Api::answerInlineQuery(const std::string_view inlineQueryId,
                             optional<bool> isPersonal,
                             const optional<std::string_view> nextOffset,
                             InlineQueryResultsButton::Ptr button) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "answerInlineQuery",
+    return sendRequest(*_ctx, "answerInlineQuery",
                        std::pair{"inline_query_id", inlineQueryId},
                        std::pair{"results", results},
                        std::pair{"cache_time", cacheTime},
@@ -2030,7 +2031,7 @@ bool Api::answerInlineQuery(const std::string_view inlineQueryId,
 SentWebAppMessage::Ptr Api::answerWebAppQuery(
     const std::string_view webAppQueryId, InlineQueryResult::Ptr result) const {
     return parse<SentWebAppMessage>(
-        sendRequest(_bot_api_baseurl, _httpClient, "answerWebAppQuery",
+        sendRequest(*_ctx, "answerWebAppQuery",
                     std::pair{"web_app_query_id", webAppQueryId},
                     std::pair{"result", std::move(result)}));
 }
@@ -2057,7 +2058,7 @@ Message::Ptr Api::sendInvoice(
     const optional<std::string_view> messageEffectId,
     SuggestedPostParameters::Ptr suggestedPostParameters) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendInvoice",
+        *_ctx, "sendInvoice",
         std::pair{"chat_id", std::move(chatId)}, std::pair{"title", title},
         std::pair{"description", description}, std::pair{"payload", payload},
         std::pair{"provider_token", providerToken},
@@ -2105,7 +2106,7 @@ std::string Api::createInvoiceLink(
     const optional<std::string_view> businessConnectionId,
     optional<std::int32_t> subscriptionPeriod) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "createInvoiceLink",
+               *_ctx, "createInvoiceLink",
                std::pair{"title", title}, std::pair{"description", description},
                std::pair{"payload", payload},
                std::pair{"provider_token", providerToken},
@@ -2134,7 +2135,7 @@ bool Api::answerShippingQuery(
     const std::string_view shippingQueryId, bool ok,
     const std::vector<ShippingOption::Ptr>& shippingOptions,
     const optional<std::string_view> errorMessage) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "answerShippingQuery",
+    return sendRequest(*_ctx, "answerShippingQuery",
                        std::pair{"shipping_query_id", shippingQueryId},
                        std::pair{"ok", ok},
                        std::pair{"shipping_options", shippingOptions},
@@ -2145,7 +2146,7 @@ bool Api::answerShippingQuery(
 bool Api::answerPreCheckoutQuery(
     const std::string_view preCheckoutQueryId, bool ok,
     const optional<std::string_view> errorMessage) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "answerPreCheckoutQuery",
+    return sendRequest(*_ctx, "answerPreCheckoutQuery",
                        std::pair{"pre_checkout_query_id", preCheckoutQueryId},
                        std::pair{"ok", ok},
                        std::pair{"error_message", errorMessage})
@@ -2155,7 +2156,7 @@ bool Api::answerPreCheckoutQuery(
 bool Api::setPassportDataErrors(
     std::int64_t userId,
     const std::vector<PassportElementError::Ptr>& errors) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setPassportDataErrors",
+    return sendRequest(*_ctx, "setPassportDataErrors",
                        std::pair{"user_id", userId},
                        std::pair{"errors", errors})
         .get<bool>();
@@ -2170,7 +2171,7 @@ Message::Ptr Api::sendGame(
     optional<bool> allowPaidBroadcast,
     const optional<std::string_view> messageEffectId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendGame", std::pair{"chat_id", chatId},
+        *_ctx, "sendGame", std::pair{"chat_id", chatId},
         std::pair{"game_short_name", gameShortName},
         std::pair{"reply_parameters", std::move(replyParameters)},
         std::pair{"reply_markup", std::move(replyMarkup)},
@@ -2188,7 +2189,7 @@ Message::Ptr Api::setGameScore(
     optional<std::int32_t> messageId,
     const optional<std::string_view> inlineMessageId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "setGameScore",
+        *_ctx, "setGameScore",
         std::pair{"user_id", userId}, std::pair{"score", score},
         std::pair{"force", force},
         std::pair{"disable_edit_message", disableEditMessage},
@@ -2201,10 +2202,11 @@ std::vector<GameHighScore::Ptr> Api::getGameHighScores(
     optional<std::int32_t> messageId,
     const optional<std::string_view> inlineMessageId) const {
     return parseArray<GameHighScore>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getGameHighScores",
-                    std::pair{"user_id", userId}, std::pair{"chat_id", chatId},
-                    std::pair{"message_id", messageId},
-                    std::pair{"inline_message_id", inlineMessageId}));
+        sendReadRequest(*_ctx, "getGameHighScores",
+                        std::pair{"user_id", userId},
+                        std::pair{"chat_id", chatId},
+                        std::pair{"message_id", messageId},
+                        std::pair{"inline_message_id", inlineMessageId}));
 }
 
 std::string Api::downloadFile(const std::string_view filePath,
@@ -2238,24 +2240,75 @@ std::string Api::downloadFile(const std::string_view filePath,
         url += filePath;
     }
 
-    return _httpClient->makeRequest(url, args);
+    return _httpClient->makeRequest(url, args,
+                                  detail::CallLimits().attempt());
 }
 
 bool Api::blockedByUser(std::int64_t chatId) const {
-    bool isBotBlocked = false;
+    {
+        std::lock_guard<std::mutex> lock(_ctx->audienceMutex);
+        if (const auto reason = _ctx->knownAudience(chatId)) {
+            return *reason == TgException::Reason::BotBlocked;
+        }
+    }
 
     try {
         sendChatAction(chatId, ChatAction::typing);
+    } catch (const TgException& e) {
+        return e.reason == TgException::Reason::BotBlocked;
+    } catch (const std::exception&) {
+    }
+    return false;
+}
 
-    } catch (std::exception& e) {
-        std::string_view error = e.what();
+void Api::recordChatMigration(std::int64_t fromChatId,
+                              std::int64_t toChatId) const {
+    _ctx->recordMigration(fromChatId, toChatId);
+}
+
+std::int64_t Api::resolveChatId(std::int64_t chatId) const {
+    return _ctx->resolve(chatId);
+}
 
-        if (error == "Forbidden: bot was blocked by the user") {
-            isBotBlocked = true;
+void Api::setRetryPolicy(MethodClass methodClass,
+                         const RetryPolicy& policy) const {
+    detail::RetryControl& control = _ctx->retryControl(methodClass);
+    std::lock_guard<std::mutex> lock(control.policyMutex);
+    control.policy = policy;
+}
+
+RetryPolicy Api::retryPolicy(MethodClass methodClass) const {
+    return _ctx->retryControl(methodClass).currentPolicy();
+}
+
+std::unordered_map<std::int64_t, std::int64_t> Api::chatMigrations() const {
+    std::shared_lock<std::shared_mutex> lock(_ctx->migrationMutex);
+    return _ctx->migrations;
+}
+
+Api::AudienceReport Api::validateAudience(
+    const std::vector<std::int64_t>& chatIds) const {
+    AudienceReport report;
+    std::lock_guard<std::mutex> lock(_ctx->audienceMutex);
+    for (const std::int64_t chatId : chatIds) {
+        const auto reason = _ctx->knownAudience(chatId);
+        if (!reason) {
+            report.unknown.push_back(chatId);
+        } else if (*reason == TgException::Reason::Unknown) {
+            report.reachable.push_back(chatId);
+        } else {
+            report.unreachable.emplace_back(chatId, *reason);
         }
     }
+    return report;
+}
 
-    return isBotBlocked;
+void Api::setAudienceLimits(std::size_t capacity,
+                            std::chrono::milliseconds ttl) const {
+    std::lock_guard<std::mutex> lock(_ctx->audienceMutex);
+    _ctx->audienceCapacity = capacity;
+    _ctx->audienceTtl = ttl;
+    _ctx->trimAudience();
 }
 
 Message::Ptr Api::sendPaidMedia(
@@ -2272,7 +2325,7 @@ Message::Ptr Api::sendPaidMedia(
     SuggestedPostParameters::Ptr suggestedPostParameters,
     ReplyParameters::Ptr replyParameters, GenericReply::Ptr replyMarkup) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendPaidMedia",
+        *_ctx, "sendPaidMedia",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"star_count", starCount}, std::pair{"media", media},
         std::pair{"business_connection_id", businessConnectionId},
@@ -2297,7 +2350,7 @@ Message::Ptr Api::sendChecklist(
     ReplyParameters::Ptr replyParameters,
     InlineKeyboardMarkup::Ptr replyMarkup) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendChecklist",
+        *_ctx, "sendChecklist",
         std::pair{"business_connection_id", businessConnectionId},
         std::pair{"chat_id", chatId},
         std::pair{"checklist", std::move(checklist)},
@@ -2313,7 +2366,7 @@ bool Api::sendMessageDraft(std::int64_t chatId, std::int32_t draftId,
                            optional<std::int32_t> messageThreadId,
                            const optional<ParseMode> parseMode,
                            const std::vector<MessageEntity::Ptr>& entities) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "sendMessageDraft",
+    return sendRequest(*_ctx, "sendMessageDraft",
                        std::pair{"chat_id", chatId},
                        std::pair{"draft_id", draftId}, std::pair{"text", text},
                        std::pair{"message_thread_id", messageThreadId},
@@ -2326,9 +2379,10 @@ UserProfileAudios::Ptr Api::getUserProfileAudios(
     std::int64_t userId, optional<std::int32_t> offset,
     optional<std::int32_t> limit) const {
     return parse<UserProfileAudios>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getUserProfileAudios",
-                    std::pair{"user_id", userId}, std::pair{"offset", offset},
-                    std::pair{"limit", limit}));
+        sendReadRequest(*_ctx, "getUserProfileAudios",
+                        std::pair{"user_id", userId},
+                        std::pair{"offset", offset},
+                        std::pair{"limit", limit}));
 }
 
 bool Api::setUserEmojiStatus(
@@ -2336,7 +2390,7 @@ bool Api::setUserEmojiStatus(
     const optional<std::string_view> emojiStatusCustomEmojiId,
     optional<std::int32_t> emojiStatusExpirationDate) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "setUserEmojiStatus",
+               *_ctx, "setUserEmojiStatus",
                std::pair{"user_id", userId},
                std::pair{"emoji_status_custom_emoji_id", emojiStatusCustomEmojiId},
                std::pair{"emoji_status_expiration_date",
@@ -2346,7 +2400,7 @@ bool Api::setUserEmojiStatus(
 
 bool Api::setChatMemberTag(ChatIdType chatId, std::int64_t userId,
                            const optional<std::string_view> tag) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setChatMemberTag",
+    return sendRequest(*_ctx, "setChatMemberTag",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"user_id", userId}, std::pair{"tag", tag})
         .get<bool>();
@@ -2356,7 +2410,7 @@ ChatInviteLink::Ptr Api::createChatSubscriptionInviteLink(
     ChatIdType chatId, std::int32_t subscriptionPeriod,
     std::int32_t subscriptionPrice, const optional<std::string_view> name) const {
     return parse<ChatInviteLink>(sendRequest(
-        _bot_api_baseurl, _httpClient, "createChatSubscriptionInviteLink",
+        *_ctx, "createChatSubscriptionInviteLink",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"subscription_period", subscriptionPeriod},
         std::pair{"subscription_price", subscriptionPrice},
@@ -2367,25 +2421,25 @@ ChatInviteLink::Ptr Api::editChatSubscriptionInviteLink(
     ChatIdType chatId, const std::string_view inviteLink,
     const optional<std::string_view> name) const {
     return parse<ChatInviteLink>(sendRequest(
-        _bot_api_baseurl, _httpClient, "editChatSubscriptionInviteLink",
+        *_ctx, "editChatSubscriptionInviteLink",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"invite_link", inviteLink}, std::pair{"name", name}));
 }
 
 bool Api::setMyProfilePhoto(InputProfilePhoto::Ptr photo) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setMyProfilePhoto",
+    return sendRequest(*_ctx, "setMyProfilePhoto",
                        std::pair{"photo", std::move(photo)})
         .get<bool>();
 }
 
 bool Api::removeMyProfilePhoto() const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "removeMyProfilePhoto")
+    return sendRequest(*_ctx, "removeMyProfilePhoto")
         .get<bool>();
 }
 
 Gifts::Ptr Api::getAvailableGifts() const {
     return parse<Gifts>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getAvailableGifts"));
+        sendReadRequest(*_ctx, "getAvailableGifts"));
 }
 
 bool Api::sendGift(const std::string_view giftId, optional<std::int64_t> userId,
@@ -2393,7 +2447,7 @@ bool Api::sendGift(const std::string_view giftId, optional<std::int64_t> userId,
                    const optional<std::string_view> text,
                    const optional<ParseMode> textParseMode,
                    const std::vector<MessageEntity::Ptr>& textEntities) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "sendGift",
+    return sendRequest(*_ctx, "sendGift",
                        std::pair{"gift_id", giftId},
                        std::pair{"user_id", userId},
                        std::pair{"chat_id", std::move(chatId)},
@@ -2409,7 +2463,7 @@ bool Api::giftPremiumSubscription(
     const optional<std::string_view> text,
     const optional<ParseMode> textParseMode,
     const std::vector<MessageEntity::Ptr>& textEntities) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "giftPremiumSubscription",
+    return sendRequest(*_ctx, "giftPremiumSubscription",
                        std::pair{"user_id", userId},
                        std::pair{"month_count", monthCount},
                        std::pair{"star_count", starCount},
@@ -2421,7 +2475,7 @@ bool Api::giftPremiumSubscription(
 
 bool Api::verifyUser(std::int64_t userId,
                      const optional<std::string_view> customDescription) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "verifyUser",
+    return sendRequest(*_ctx, "verifyUser",
                        std::pair{"user_id", userId},
                        std::pair{"custom_description", customDescription})
         .get<bool>();
@@ -2429,27 +2483,27 @@ bool Api::verifyUser(std::int64_t userId,
 
 bool Api::verifyChat(ChatIdType chatId,
                      const optional<std::string_view> customDescription) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "verifyChat",
+    return sendRequest(*_ctx, "verifyChat",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"custom_description", customDescription})
         .get<bool>();
 }
 
 bool Api::removeUserVerification(std::int64_t userId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "removeUserVerification",
+    return sendRequest(*_ctx, "removeUserVerification",
                        std::pair{"user_id", userId})
         .get<bool>();
 }
 
 bool Api::removeChatVerification(ChatIdType chatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "removeChatVerification",
+    return sendRequest(*_ctx, "removeChatVerification",
                        std::pair{"chat_id", std::move(chatId)})
         .get<bool>();
 }
 
 bool Api::readBusinessMessage(const std::string_view businessConnectionId,
                               std::int64_t chatId, std::int32_t messageId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "readBusinessMessage",
+    return sendRequest(*_ctx, "readBusinessMessage",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"chat_id", chatId},
                        std::pair{"message_id", messageId})
@@ -2459,7 +2513,7 @@ bool Api::readBusinessMessage(const std::string_view businessConnectionId,
 bool Api::deleteBusinessMessages(
     const std::string_view businessConnectionId,
     const std::vector<std::int32_t>& messageIds) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteBusinessMessages",
+    return sendRequest(*_ctx, "deleteBusinessMessages",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"message_ids", messageIds})
         .get<bool>();
@@ -2469,7 +2523,7 @@ bool Api::setBusinessAccountName(
     const std::string_view businessConnectionId,
     const std::string_view firstName,
     const optional<std::string_view> lastName) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setBusinessAccountName",
+    return sendRequest(*_ctx, "setBusinessAccountName",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"first_name", firstName},
                        std::pair{"last_name", lastName})
@@ -2479,8 +2533,7 @@ bool Api::setBusinessAccountName(
 bool Api::setBusinessAccountUsername(
     const std::string_view businessConnectionId,
     const optional<std::string_view> username) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "setBusinessAccountUsername",
+    return sendRequest(*_ctx, "setBusinessAccountUsername",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"username", username})
         .get<bool>();
@@ -2489,7 +2542,7 @@ bool Api::setBusinessAccountUsername(
 bool Api::setBusinessAccountBio(
     const std::string_view businessConnectionId,
     const optional<std::string_view> bio) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "setBusinessAccountBio",
+    return sendRequest(*_ctx, "setBusinessAccountBio",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"bio", bio})
         .get<bool>();
@@ -2498,8 +2551,7 @@ bool Api::setBusinessAccountBio(
 bool Api::setBusinessAccountProfilePhoto(
     const std::string_view businessConnectionId, InputProfilePhoto::Ptr photo,
     optional<bool> isPublic) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "setBusinessAccountProfilePhoto",
+    return sendRequest(*_ctx, "setBusinessAccountProfilePhoto",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"photo", std::move(photo)},
                        std::pair{"is_public", isPublic})
@@ -2508,8 +2560,7 @@ bool Api::setBusinessAccountProfilePhoto(
 
 bool Api::removeBusinessAccountProfilePhoto(
     const std::string_view businessConnectionId, optional<bool> isPublic) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "removeBusinessAccountProfilePhoto",
+    return sendRequest(*_ctx, "removeBusinessAccountProfilePhoto",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"is_public", isPublic})
         .get<bool>();
@@ -2518,8 +2569,7 @@ bool Api::removeBusinessAccountProfilePhoto(
 bool Api::setBusinessAccountGiftSettings(
     const std::string_view businessConnectionId, bool showGiftButton,
     AcceptedGiftTypes::Ptr acceptedGiftTypes) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "setBusinessAccountGiftSettings",
+    return sendRequest(*_ctx, "setBusinessAccountGiftSettings",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"show_gift_button", showGiftButton},
                        std::pair{"accepted_gift_types",
@@ -2529,15 +2579,14 @@ bool Api::setBusinessAccountGiftSettings(
 
 StarAmount::Ptr Api::getBusinessAccountStarBalance(
     const std::string_view businessConnectionId) const {
-    return parse<StarAmount>(sendRequest(
-        _bot_api_baseurl, _httpClient, "getBusinessAccountStarBalance",
+    return parse<StarAmount>(sendReadRequest(
+        *_ctx, "getBusinessAccountStarBalance",
         std::pair{"business_connection_id", businessConnectionId}));
 }
 
 bool Api::transferBusinessAccountStars(
     const std::string_view businessConnectionId, std::int32_t starCount) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "transferBusinessAccountStars",
+    return sendRequest(*_ctx, "transferBusinessAccountStars",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"star_count", starCount})
         .get<bool>();
@@ -2550,8 +2599,8 @@ OwnedGifts::Ptr Api::getBusinessAccountGifts(
     optional<bool> excludeLimitedNonUpgradable, optional<bool> excludeUnique,
     optional<bool> excludeFromBlockchain, optional<bool> sortByPrice,
     const optional<std::string_view> offset, optional<std::int32_t> limit) const {
-    return parse<OwnedGifts>(sendRequest(
-        _bot_api_baseurl, _httpClient, "getBusinessAccountGifts",
+    return parse<OwnedGifts>(sendReadRequest(
+        *_ctx, "getBusinessAccountGifts",
         std::pair{"business_connection_id", businessConnectionId},
         std::pair{"exclude_unsaved", excludeUnsaved},
         std::pair{"exclude_saved", excludeSaved},
@@ -2572,8 +2621,8 @@ OwnedGifts::Ptr Api::getUserGifts(
     optional<bool> excludeFromBlockchain, optional<bool> excludeUnique,
     optional<bool> sortByPrice, const optional<std::string_view> offset,
     optional<std::int32_t> limit) const {
-    return parse<OwnedGifts>(sendRequest(
-        _bot_api_baseurl, _httpClient, "getUserGifts",
+    return parse<OwnedGifts>(sendReadRequest(
+        *_ctx, "getUserGifts",
         std::pair{"user_id", userId},
         std::pair{"exclude_unlimited", excludeUnlimited},
         std::pair{"exclude_limited_upgradable", excludeLimitedUpgradable},
@@ -2592,8 +2641,8 @@ OwnedGifts::Ptr Api::getChatGifts(
     optional<bool> excludeFromBlockchain, optional<bool> excludeUnique,
     optional<bool> sortByPrice, const optional<std::string_view> offset,
     optional<std::int32_t> limit) const {
-    return parse<OwnedGifts>(sendRequest(
-        _bot_api_baseurl, _httpClient, "getChatGifts",
+    return parse<OwnedGifts>(sendReadRequest(
+        *_ctx, "getChatGifts",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"exclude_unsaved", excludeUnsaved},
         std::pair{"exclude_saved", excludeSaved},
@@ -2609,7 +2658,7 @@ OwnedGifts::Ptr Api::getChatGifts(
 
 bool Api::convertGiftToStars(const std::string_view businessConnectionId,
                              const std::string_view ownedGiftId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "convertGiftToStars",
+    return sendRequest(*_ctx, "convertGiftToStars",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"owned_gift_id", ownedGiftId})
         .get<bool>();
@@ -2619,7 +2668,7 @@ bool Api::upgradeGift(const std::string_view businessConnectionId,
                       const std::string_view ownedGiftId,
                       optional<bool> keepOriginalDetails,
                       optional<std::int32_t> starCount) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "upgradeGift",
+    return sendRequest(*_ctx, "upgradeGift",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"owned_gift_id", ownedGiftId},
                        std::pair{"keep_original_details", keepOriginalDetails},
@@ -2631,7 +2680,7 @@ bool Api::transferGift(const std::string_view businessConnectionId,
                        const std::string_view ownedGiftId,
                        std::int64_t newOwnerChatId,
                        optional<std::int32_t> starCount) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "transferGift",
+    return sendRequest(*_ctx, "transferGift",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"owned_gift_id", ownedGiftId},
                        std::pair{"new_owner_chat_id", newOwnerChatId},
@@ -2647,7 +2696,7 @@ Story::Ptr Api::postStory(
     const std::vector<StoryArea::Ptr>& areas, optional<bool> postToChatPage,
     optional<bool> protectContent) const {
     return parse<Story>(sendRequest(
-        _bot_api_baseurl, _httpClient, "postStory",
+        *_ctx, "postStory",
         std::pair{"business_connection_id", businessConnectionId},
         std::pair{"content", std::move(content)},
         std::pair{"active_period", activePeriod}, std::pair{"caption", caption},
@@ -2664,7 +2713,7 @@ Story::Ptr Api::repostStory(const std::string_view businessConnectionId,
                             optional<bool> postToChatPage,
                             optional<bool> protectContent) const {
     return parse<Story>(sendRequest(
-        _bot_api_baseurl, _httpClient, "repostStory",
+        *_ctx, "repostStory",
         std::pair{"business_connection_id", businessConnectionId},
         std::pair{"from_chat_id", fromChatId},
         std::pair{"from_story_id", fromStoryId},
@@ -2680,7 +2729,7 @@ Story::Ptr Api::editStory(
     const std::vector<MessageEntity::Ptr>& captionEntities,
     const std::vector<StoryArea::Ptr>& areas) const {
     return parse<Story>(sendRequest(
-        _bot_api_baseurl, _httpClient, "editStory",
+        *_ctx, "editStory",
         std::pair{"business_connection_id", businessConnectionId},
         std::pair{"story_id", storyId},
         std::pair{"content", std::move(content)}, std::pair{"caption", caption},
@@ -2691,7 +2740,7 @@ Story::Ptr Api::editStory(
 
 bool Api::deleteStory(const std::string_view businessConnectionId,
                       std::int32_t storyId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteStory",
+    return sendRequest(*_ctx, "deleteStory",
                        std::pair{"business_connection_id", businessConnectionId},
                        std::pair{"story_id", storyId})
         .get<bool>();
@@ -2702,7 +2751,7 @@ Message::Ptr Api::editMessageChecklist(
     std::int32_t messageId, InputChecklist::Ptr checklist,
     InlineKeyboardMarkup::Ptr replyMarkup) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "editMessageChecklist",
+        *_ctx, "editMessageChecklist",
         std::pair{"business_connection_id", businessConnectionId},
         std::pair{"chat_id", chatId}, std::pair{"message_id", messageId},
         std::pair{"checklist", std::move(checklist)},
@@ -2711,7 +2760,7 @@ Message::Ptr Api::editMessageChecklist(
 
 bool Api::approveSuggestedPost(std::int64_t chatId, std::int32_t messageId,
                                optional<std::int32_t> sendDate) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "approveSuggestedPost",
+    return sendRequest(*_ctx, "approveSuggestedPost",
                        std::pair{"chat_id", chatId},
                        std::pair{"message_id", messageId},
                        std::pair{"send_date", sendDate})
@@ -2720,7 +2769,7 @@ bool Api::approveSuggestedPost(std::int64_t chatId, std::int32_t messageId,
 
 bool Api::declineSuggestedPost(std::int64_t chatId, std::int32_t messageId,
                                const optional<std::string_view> comment) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "declineSuggestedPost",
+    return sendRequest(*_ctx, "declineSuggestedPost",
                        std::pair{"chat_id", chatId},
                        std::pair{"message_id", messageId},
                        std::pair{"comment", comment})
@@ -2732,7 +2781,7 @@ PreparedInlineMessage::Ptr Api::savePreparedInlineMessage(
     optional<bool> allowUserChats, optional<bool> allowBotChats,
     optional<bool> allowGroupChats, optional<bool> allowChannelChats) const {
     return parse<PreparedInlineMessage>(sendRequest(
-        _bot_api_baseurl, _httpClient, "savePreparedInlineMessage",
+        *_ctx, "savePreparedInlineMessage",
         std::pair{"user_id", userId}, std::pair{"result", std::move(result)},
         std::pair{"allow_user_chats", allowUserChats},
         std::pair{"allow_bot_chats", allowBotChats},
@@ -2742,21 +2791,22 @@ PreparedInlineMessage::Ptr Api::savePreparedInlineMessage(
 
 StarAmount::Ptr Api::getMyStarBalance() const {
     return parse<StarAmount>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getMyStarBalance"));
+        sendReadRequest(*_ctx, "getMyStarBalance"));
 }
 
 StarTransactions::Ptr Api::getStarTransactions(
     optional<std::int32_t> offset, optional<std::int32_t> limit) const {
     return parse<StarTransactions>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getStarTransactions",
-                    std::pair{"offset", offset}, std::pair{"limit", limit}));
+        sendReadRequest(*_ctx, "getStarTransactions",
+                        std::pair{"offset", offset},
+                        std::pair{"limit", limit}));
 }
 
 bool Api::refundStarPayment(
     std::int64_t userId,
     const std::string_view telegramPaymentChargeId) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "refundStarPayment",
+               *_ctx, "refundStarPayment",
                std::pair{"user_id", userId},
                std::pair{"telegram_payment_charge_id", telegramPaymentChargeId})
         .get<bool>();
@@ -2766,7 +2816,7 @@ bool Api::editUserStarSubscription(
     std::int64_t userId, const std::string_view telegramPaymentChargeId,
     bool isCanceled) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "editUserStarSubscription",
+               *_ctx, "editUserStarSubscription",
                std::pair{"user_id", userId},
                std::pair{"telegram_payment_charge_id", telegramPaymentChargeId},
                std::pair{"is_canceled", isCanceled})
@@ -2784,7 +2834,7 @@ Message::Ptr Api::sendRichMessage(
     SuggestedPostParameters::Ptr suggestedPostParameters,
     ReplyParameters::Ptr replyParameters, GenericReply::Ptr replyMarkup) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendRichMessage",
+        *_ctx, "sendRichMessage",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"rich_message", std::move(richMessage)},
         std::pair{"business_connection_id", businessConnectionId},
@@ -2803,7 +2853,7 @@ Message::Ptr Api::sendRichMessage(
 bool Api::sendRichMessageDraft(std::int64_t chatId, std::int32_t draftId,
                                InputRichMessage::Ptr richMessage,
                                optional<std::int32_t> messageThreadId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "sendRichMessageDraft",
+    return sendRequest(*_ctx, "sendRichMessageDraft",
                        std::pair{"chat_id", chatId},
                        std::pair{"draft_id", draftId},
                        std::pair{"rich_message", std::move(richMessage)},
@@ -2827,7 +2877,7 @@ Message::Ptr Api::sendLivePhoto(
     optional<std::int64_t> receiverUserId,
     const optional<std::string_view> callbackQueryId) const {
     return parse<Message>(sendRequest(
-        _bot_api_baseurl, _httpClient, "sendLivePhoto",
+        *_ctx, "sendLivePhoto",
         std::pair{"chat_id", std::move(chatId)},
         std::pair{"live_photo", std::move(livePhoto)},
         std::pair{"photo", std::move(photo)}, std::pair{"caption", caption},
@@ -2853,7 +2903,7 @@ bool Api::answerChatJoinRequestQuery(
     const std::string_view chatJoinRequestQueryId,
     const std::string_view result) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "answerChatJoinRequestQuery",
+               *_ctx, "answerChatJoinRequestQuery",
                std::pair{"chat_join_request_query_id", chatJoinRequestQueryId},
                std::pair{"result", result})
         .get<bool>();
@@ -2863,7 +2913,7 @@ bool Api::sendChatJoinRequestWebApp(
     const std::string_view chatJoinRequestQueryId,
     const std::string_view webAppUrl) const {
     return sendRequest(
-               _bot_api_baseurl, _httpClient, "sendChatJoinRequestWebApp",
+               *_ctx, "sendChatJoinRequestWebApp",
                std::pair{"chat_join_request_query_id", chatJoinRequestQueryId},
                std::pair{"web_app_url", webAppUrl})
         .get<bool>();
@@ -2872,26 +2922,27 @@ bool Api::sendChatJoinRequestWebApp(
 std::vector<Message::Ptr> Api::getUserPersonalChatMessages(
     std::int64_t userId, std::int32_t limit) const {
     return parseArray<Message>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getUserPersonalChatMessages",
-                    std::pair{"user_id", userId}, std::pair{"limit", limit}));
+        sendReadRequest(*_ctx, "getUserPersonalChatMessages",
+                        std::pair{"user_id", userId},
+                        std::pair{"limit", limit}));
 }
 
 SentGuestMessage::Ptr Api::answerGuestQuery(
     const std::string_view guestQueryId, InlineQueryResult::Ptr result) const {
     return parse<SentGuestMessage>(
-        sendRequest(_bot_api_baseurl, _httpClient, "answerGuestQuery",
+        sendRequest(*_ctx, "answerGuestQuery",
                     std::pair{"guest_query_id", guestQueryId},
                     std::pair{"result", std::move(result)}));
 }
 
 std::string Api::getManagedBotToken(std::int64_t userId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "getManagedBotToken",
-                       std::pair{"user_id", userId})
+    return sendReadRequest(*_ctx, "getManagedBotToken",
+                           std::pair{"user_id", userId})
         .get<std::string>();
 }
 
 std::string Api::replaceManagedBotToken(std::int64_t userId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "replaceManagedBotToken",
+    return sendRequest(*_ctx, "replaceManagedBotToken",
                        std::pair{"user_id", userId})
         .get<std::string>();
 }
@@ -2899,15 +2950,14 @@ std::string Api::replaceManagedBotToken(std::int64_t userId) const {
 BotAccessSettings::Ptr Api::getManagedBotAccessSettings(
     std::int64_t userId) const {
     return parse<BotAccessSettings>(
-        sendRequest(_bot_api_baseurl, _httpClient, "getManagedBotAccessSettings",
-                    std::pair{"user_id", userId}));
+        sendReadRequest(*_ctx, "getManagedBotAccessSettings",
+                        std::pair{"user_id", userId}));
 }
 
 bool Api::setManagedBotAccessSettings(
     std::int64_t userId, bool isAccessRestricted,
     const std::vector<std::int64_t>& addedUserIds) const {
-    return sendRequest(_bot_api_baseurl, _httpClient,
-                       "setManagedBotAccessSettings",
+    return sendRequest(*_ctx, "setManagedBotAccessSettings",
                        std::pair{"user_id", userId},
                        std::pair{"is_access_restricted", isAccessRestricted},
                        std::pair{"added_user_ids", addedUserIds})
@@ -2917,7 +2967,7 @@ bool Api::setManagedBotAccessSettings(
 PreparedKeyboardButton::Ptr Api::savePreparedKeyboardButton(
     std::int64_t userId, KeyboardButton::Ptr button) const {
     return parse<PreparedKeyboardButton>(
-        sendRequest(_bot_api_baseurl, _httpClient, "savePreparedKeyboardButton",
+        sendRequest(*_ctx, "savePreparedKeyboardButton",
                     std::pair{"user_id", userId},
                     std::pair{"button", std::move(button)}));
 }
@@ -2925,7 +2975,7 @@ PreparedKeyboardButton::Ptr Api::savePreparedKeyboardButton(
 bool Api::deleteMessageReaction(ChatIdType chatId, std::int32_t messageId,
                                 optional<std::int64_t> userId,
                                 optional<std::int64_t> actorChatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteMessageReaction",
+    return sendRequest(*_ctx, "deleteMessageReaction",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"message_id", messageId},
                        std::pair{"user_id", userId},
@@ -2936,7 +2986,7 @@ bool Api::deleteMessageReaction(ChatIdType chatId, std::int32_t messageId,
 bool Api::deleteAllMessageReactions(ChatIdType chatId,
                                     optional<std::int64_t> userId,
                                     optional<std::int64_t> actorChatId) const {
-    return sendRequest(_bot_api_baseurl, _httpClient, "deleteAllMessageReactions",
+    return sendRequest(*_ctx, "deleteAllMessageReactions",
                        std::pair{"chat_id", std::move(chatId)},
                        std::pair{"user_id", userId},
                        std::pair{"actor_chat_id", actorChatId})
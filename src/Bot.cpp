@@ -9,12 +9,24 @@
 
 namespace TgBot {
 
-Bot::Bot(std::string token, std::unique_ptr<HttpClient> httpClient, std::string url)
+Bot::Bot(std::string token, std::shared_ptr<HttpClient> httpClient, std::string url)
     : _token(std::move(token))
     , _httpClient(std::move(httpClient))
     , _api(std::make_unique<Api>(_token, _httpClient.get(), std::move(url)))
     , _eventBroadcaster(std::make_unique<EventBroadcaster>())
     , _eventHandler(std::make_unique<EventHandler>(_eventBroadcaster.get())) {
+    // Keep the Api's chat id remap table in sync with group upgrades seen in
+    // incoming service messages.
+    _eventBroadcaster->onAnyMessage([api = _api.get()](const Message::Ptr& message) {
+        if (!message->chat) {
+            return;
+        }
+        if (message->migrateToChatId) {
+            api->recordChatMigration(message->chat->id, *message->migrateToChatId);
+        } else if (message->migrateFromChatId) {
+            api->recordChatMigration(*message->migrateFromChatId, message->chat->id);
+        }
+    });
 }
 
 std::unique_ptr<HttpClient> Bot::_getDefaultHttpClient() {
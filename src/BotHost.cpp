@@ -0,0 +1,390 @@
+#include "tgbot/BotHost.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tgbot/Logger.h"
+#include "tgbot/Metrics.h"
+#include "tgbot/net/EpollHttpClient.h"
+#include "tgbot/net/HttplibClient.h"
+#include "tgbot/net/TgWebhookTcpServer.h"
+#include "tools/ApiCall.h"
+#include "tools/Instrumentation.h"
+
+namespace TgBot {
+
+namespace {
+
+// Time the server may take beyond the long poll timeout to answer.
+constexpr std::chrono::seconds kLongPollMargin{5};
+
+// The numeric bot id, i.e. the token up to the colon. Unlike the token it is
+// not secret, so it can label metrics.
+std::string botId(const std::string& token) {
+    return token.substr(0, token.find(':'));
+}
+
+std::shared_ptr<HttpClient> defaultHttpClient(std::size_t maxConnections) {
+#ifdef __linux__
+    return std::make_shared<EpollHttpClient>(HttpClient::kDefaultTimeout,
+                                             maxConnections);
+#else
+    return std::make_shared<HttplibClient>(HttpClient::kDefaultTimeout,
+                                           maxConnections);
+#endif
+}
+
+}  // namespace
+
+struct BotHost::Impl {
+    using Clock = std::chrono::steady_clock;
+
+    struct Hosted {
+        std::unique_ptr<Bot> bot;
+        std::string id;
+        // Confirms every update before it with the next getUpdates.
+        std::int32_t offset = 0;
+        // Failed attempts at updates[next].
+        std::size_t failures = 0;
+        // The getUpdates in progress, retries included, and its arguments.
+        // Started on a worker and possibly ended on the poll client's loop,
+        // which its detached span allows.
+        HttpReqArg::Vec args;
+        std::unique_ptr<detail::ApiCall> call;
+        // The last batch, handled up to [next].
+        nlohmann::json updates = nlohmann::json::array();
+        std::size_t next = 0;
+    };
+
+    Options options;
+    std::shared_ptr<HttpClient> httpClient;
+#ifdef __linux__
+    // Carries the long polls when the bots' client is an EpollHttpClient.
+    std::shared_ptr<EpollHttpClient> pollClient;
+#endif
+    std::vector<Hosted> bots;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+    CancellationSource stopped;
+    // Bots a worker is to serve, and deferred bots by the time they are due.
+    // A bot is in at most one of them; while a worker serves it or its long
+    // poll is in flight, in neither.
+    std::deque<std::size_t> ready;
+    std::priority_queue<std::pair<Clock::time_point, std::size_t>,
+                        std::vector<std::pair<Clock::time_point, std::size_t>>,
+                        std::greater<>>
+        idle;
+    // Long polls whose callback has not run yet.
+    std::size_t inFlight = 0;
+    std::condition_variable settled;
+    std::unique_ptr<TgWebhookTcpServer> webhook;
+
+    Impl(std::shared_ptr<HttpClient> httpClient_, Options options_)
+        : options(options_), httpClient(std::move(httpClient_)) {}
+
+    [[nodiscard]] bool asyncPolls() const {
+#ifdef __linux__
+        return pollClient != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping) {
+            const auto now = Clock::now();
+            while (!idle.empty() && idle.top().first <= now) {
+                ready.push_back(idle.top().second);
+                idle.pop();
+            }
+            if (ready.empty()) {
+                if (idle.empty()) {
+                    wake.wait(lock);
+                } else {
+                    wake.wait_until(lock, idle.top().first);
+                }
+                continue;
+            }
+            const std::size_t index = ready.front();
+            ready.pop_front();
+            lock.unlock();
+
+            const std::optional<Clock::time_point> due = serve(index);
+
+            lock.lock();
+            if (due) {
+                requeue(index, *due);
+            }
+        }
+    }
+
+    // Puts a bot back in line for a worker at @p due. Callers hold mutex.
+    void requeue(std::size_t index, Clock::time_point due) {
+        if (due <= Clock::now()) {
+            ready.push_back(index);
+        } else {
+            idle.emplace(due, index);
+        }
+        wake.notify_one();
+    }
+
+    // Handles the bot's last batch and polls it again. Returns when the bot
+    // is due next, or nothing while its long poll is in flight.
+    std::optional<Clock::time_point> serve(std::size_t index) {
+        Hosted& hosted = bots[index];
+        MetricsLabelScope label("bot", hosted.id);
+        for (; hosted.next < hosted.updates.size(); ++hosted.next) {
+            const Update::Ptr update =
+                detail::parseUpdate(hosted.updates[hosted.next]);
+            try {
+                hosted.bot->_eventHandler->handleUpdate(update);
+            } catch (const std::exception& e) {
+                ++hosted.failures;
+                if (options.maxUpdateAttempts == 0 ||
+                    hosted.failures < options.maxUpdateAttempts) {
+                    // Not confirmed: the update is handled again later.
+                    detail::log(LogLevel::Error, "Hosted bot listener failed",
+                                {{"bot", hosted.id}, {"error", e.what()}});
+                    return Clock::now() + HttpClient::kRequestBackoff;
+                }
+                drop(hosted, update, e);
+            }
+            // Only advance once the listeners returned, or gave up on it.
+            hosted.failures = 0;
+            hosted.offset = std::max(hosted.offset, update->updateId + 1);
+        }
+        hosted.updates = nlohmann::json::array();
+        hosted.next = 0;
+        return poll(index);
+    }
+
+    // Skips an update the listeners failed on maxUpdateAttempts times. Called
+    // while @p error is being handled.
+    void drop(Hosted& hosted, const Update::Ptr& update,
+              const std::exception& error) {
+        detail::log(LogLevel::Error, "Hosted bot skipped an update",
+                    {{"bot", hosted.id},
+                     {"update_id", std::to_string(update->updateId)},
+                     {"attempts", std::to_string(hosted.failures)},
+                     {"error", error.what()}});
+        if (const auto metrics = detail::metrics()) {
+            metrics
+                ->counter("tgbot_bothost_dropped_updates_total",
+                          detail::scopedLabels({}))
+                .add();
+        }
+        if (!options.onDroppedUpdate) {
+            return;
+        }
+        try {
+            options.onDroppedUpdate(*hosted.bot, update,
+                                    std::current_exception());
+        } catch (const std::exception& e) {
+            detail::log(LogLevel::Error, "onDroppedUpdate failed",
+                        {{"bot", hosted.id}, {"error", e.what()}});
+        }
+    }
+
+    std::optional<Clock::time_point> poll(std::size_t index) {
+        Hosted& hosted = bots[index];
+        try {
+            if (!hosted.call) {
+                const std::chrono::seconds timeout =
+                    asyncPolls() ? options.longPollTimeout
+                                 : std::chrono::seconds(0);
+                hosted.args.clear();
+                hosted.args.push_back(
+                    std::make_unique<HttpReqArg>("offset", hosted.offset));
+                hosted.args.push_back(
+                    std::make_unique<HttpReqArg>("timeout", timeout.count()));
+                RequestOptions defaults;
+                defaults.timeout = timeout + kLongPollMargin;
+                defaults.cancellation = stopped.token();
+                hosted.call = std::make_unique<detail::ApiCall>(
+                    *hosted.bot->_api->_ctx, "getUpdates", hosted.args,
+                    std::move(defaults));
+            }
+            const RequestOptions attempt = hosted.call->attempt();
+#ifdef __linux__
+            if (asyncPolls()) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++inFlight;
+                }
+                pollClient->makeRequestAsync(
+                    hosted.call->url(), hosted.args,
+                    [this, index](std::string body, std::exception_ptr error) {
+                        received(index, std::move(body), std::move(error));
+                    },
+                    attempt);
+                return std::nullopt;
+            }
+#endif
+            std::string body;
+            std::exception_ptr error;
+            try {
+                body = httpClient->makeRequest(hosted.call->url(), hosted.args,
+                                               attempt);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            return complete(hosted, std::move(body), std::move(error));
+        } catch (const std::exception& e) {
+            return failed(hosted, e);
+        }
+    }
+
+    // Runs on an event loop thread once a long poll was answered.
+    void received(std::size_t index, std::string body,
+                  std::exception_ptr error) {
+        Hosted& hosted = bots[index];
+        Clock::time_point due;
+        try {
+            due = complete(hosted, std::move(body), std::move(error));
+        } catch (const std::exception& e) {
+            due = failed(hosted, e);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!stopping) {
+            requeue(index, due);
+        }
+        --inFlight;
+        settled.notify_all();
+    }
+
+    // Takes in the outcome of a getUpdates attempt; a 429 or a network error
+    // defers the bot by the delay its retry policy asks for.
+    Clock::time_point complete(Hosted& hosted, std::string body,
+                               std::exception_ptr error) {
+        detail::ApiCall::Step step =
+            hosted.call->complete(std::move(body), std::move(error));
+        if (!step.result) {
+            return Clock::now() + step.delay;
+        }
+        hosted.call.reset();
+        hosted.updates = std::move(*step.result);
+        hosted.next = 0;
+        if (hosted.updates.empty() && !asyncPolls()) {
+            return Clock::now() + options.pollInterval;
+        }
+        return Clock::now();
+    }
+
+    Clock::time_point failed(Hosted& hosted, const std::exception& e) {
+        hosted.call.reset();
+        if (!stopped.cancelled()) {
+            detail::log(LogLevel::Error, "Hosted bot poll failed",
+                        {{"bot", hosted.id}, {"error", e.what()}});
+        }
+        return Clock::now() +
+               std::max<Clock::duration>(options.pollInterval,
+                                         HttpClient::kRequestBackoff);
+    }
+};
+
+BotHost::BotHost(Options options)
+    : BotHost(defaultHttpClient(options.maxConnections), options) {}
+
+BotHost::BotHost(std::shared_ptr<HttpClient> httpClient, Options options)
+    : _impl(std::make_unique<Impl>(std::move(httpClient), options)) {}
+
+BotHost::~BotHost() { stop(); }
+
+Bot& BotHost::addBot(std::string token, std::string url) {
+    Impl::Hosted hosted;
+    hosted.id = botId(token);
+    hosted.bot = std::make_unique<Bot>(std::move(token), _impl->httpClient,
+                                       std::move(url));
+    _impl->bots.push_back(std::move(hosted));
+    return *_impl->bots.back().bot;
+}
+
+std::size_t BotHost::size() const { return _impl->bots.size(); }
+
+void BotHost::runLongPolling() {
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        if (_impl->stopping) {
+            return;
+        }
+#ifdef __linux__
+        // Each bot holds a connection for as long as its long poll waits, so
+        // the polls get a client of their own with a connection per bot.
+        if (!_impl->pollClient &&
+            dynamic_cast<EpollHttpClient*>(_impl->httpClient.get())) {
+            _impl->pollClient = std::make_shared<EpollHttpClient>(
+                HttpClient::kDefaultTimeout,
+                std::max<std::size_t>(_impl->bots.size(), 1), 1, 0);
+        }
+#endif
+        for (std::size_t i = 0; i < _impl->bots.size(); ++i) {
+            _impl->ready.push_back(i);
+        }
+    }
+
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < std::max<std::size_t>(
+                                    _impl->options.workerThreads, 1);
+         ++i) {
+        workers.emplace_back([this] { _impl->work(); });
+    }
+    _impl->work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // stop() cancelled the long polls; their callbacks still touch the bots.
+    std::unique_lock<std::mutex> lock(_impl->mutex);
+    _impl->settled.wait(lock, [this] { return _impl->inFlight == 0; });
+}
+
+void BotHost::runWebhook(unsigned short port, std::string host) {
+    TgWebhookTcpServer* server;
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        if (_impl->stopping || _impl->bots.empty()) {
+            return;
+        }
+        // Every bot, the first included, is routed with addPath() so that
+        // its requests are labelled.
+        _impl->webhook = std::make_unique<TgWebhookTcpServer>(
+            port, std::string(), nullptr, std::move(host));
+        _impl->webhook->setSecretToken(_impl->options.webhookSecretToken);
+        _impl->webhook->setAcceptors(_impl->options.webhookAcceptors);
+        _impl->webhook->setWorkerThreads(_impl->options.workerThreads);
+        for (auto& hosted : _impl->bots) {
+            _impl->webhook->addPath("/" + hosted.bot->getToken(),
+                                    hosted.bot->_eventHandler.get(),
+                                    {{"bot", hosted.id}});
+        }
+        server = _impl->webhook.get();
+    }
+    server->start();
+}
+
+void BotHost::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        _impl->stopping = true;
+        _impl->wake.notify_all();
+        if (_impl->webhook) {
+            _impl->webhook->stop();
+        }
+    }
+    // Outside the lock: a cancelled long poll may call back right away.
+    _impl->stopped.cancel();
+}
+
+}  // namespace TgBot
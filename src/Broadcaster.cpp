@@ -0,0 +1,272 @@
+#include "tgbot/Broadcaster.h"
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tgbot/Logger.h"
+#include "tgbot/TgException.h"
+#include "tgbot/net/RequestOptions.h"
+
+namespace TgBot {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+Broadcaster::Outcome classify(const TgException& e) {
+    switch (e.reason) {
+        case TgException::Reason::BotBlocked:
+            return Broadcaster::Outcome::Blocked;
+        case TgException::Reason::UserDeactivated:
+            return Broadcaster::Outcome::Deactivated;
+        case TgException::Reason::ChatMigrated:
+            return Broadcaster::Outcome::Migrated;
+        default:
+            return Broadcaster::Outcome::Failed;
+    }
+}
+
+// Hands out send slots so that the global rate and the per-chat intervals are
+// respected across all workers.
+class Pacer {
+   public:
+    explicit Pacer(const Broadcaster::Options& options)
+        : _globalInterval(std::chrono::duration_cast<Clock::duration>(
+              std::chrono::duration<double>(
+                  options.globalRate > 0 ? 1.0 / options.globalRate : 0.0))),
+          _privateInterval(options.privateChatInterval),
+          _groupInterval(options.groupChatInterval) {}
+
+    // Returns the time at which a message to chatId may be sent.
+    Clock::time_point reserve(std::int64_t chatId) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto now = Clock::now();
+        forgetBefore(now);
+
+        auto slot = std::max(now, _nextGlobal);
+        if (auto it = _nextPerChat.find(chatId); it != _nextPerChat.end()) {
+            slot = std::max(slot, it->second);
+        }
+        _nextGlobal = slot + _globalInterval;
+
+        const auto next =
+            slot + (chatId < 0 ? _groupInterval : _privateInterval);
+        _nextPerChat[chatId] = next;
+        _expiry.emplace_back(next, chatId);
+        return slot;
+    }
+
+   private:
+    // Only chats with a pending interval are remembered, so a job over
+    // millions of distinct recipients does not grow this table.
+    void forgetBefore(Clock::time_point now) {
+        while (!_expiry.empty() && _expiry.front().first <= now) {
+            const auto& [time, chatId] = _expiry.front();
+            if (auto it = _nextPerChat.find(chatId);
+                it != _nextPerChat.end() && it->second == time) {
+                _nextPerChat.erase(it);
+            }
+            _expiry.pop_front();
+        }
+    }
+
+    const Clock::duration _globalInterval;
+    const Clock::duration _privateInterval;
+    const Clock::duration _groupInterval;
+    std::mutex _mutex;
+    Clock::time_point _nextGlobal{};
+    std::unordered_map<std::int64_t, Clock::time_point> _nextPerChat;
+    std::deque<std::pair<Clock::time_point, std::int64_t>> _expiry;
+};
+
+}  // namespace
+
+double Broadcaster::Stats::throughput() const {
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0 ? static_cast<double>(processed) / seconds : 0.0;
+}
+
+std::optional<std::chrono::seconds> Broadcaster::Stats::eta(
+    std::uint64_t total) const {
+    const double rate = throughput();
+    if (rate <= 0) {
+        return std::nullopt;
+    }
+    const std::uint64_t remaining = total > checkpoint ? total - checkpoint : 0;
+    return std::chrono::seconds(
+        static_cast<std::int64_t>(static_cast<double>(remaining) / rate));
+}
+
+Broadcaster::Broadcaster(const Api& api) : Broadcaster(api, Options()) {}
+
+Broadcaster::Broadcaster(const Api& api, Options options)
+    : _api(api), _options(options) {}
+
+Broadcaster::Stats Broadcaster::run(const RecipientSource& recipients,
+                                    const Sender& sender,
+                                    std::uint64_t resumeFrom) {
+    const auto started = Clock::now();
+    Pacer pacer(_options);
+
+    // Everything below is guarded by mutex.
+    std::mutex mutex;
+    Stats stats;
+    stats.checkpoint = resumeFrom;
+    std::uint64_t nextIndex = resumeFrom;
+    // Indices finished out of order, waiting for the checkpoint to catch up.
+    std::set<std::uint64_t> finishedAhead;
+    bool exhausted = false;
+    // The first exception that escaped a worker; it stops the job.
+    std::exception_ptr error;
+    auto lastProgress = started;
+
+    for (std::uint64_t i = 0; i < resumeFrom; ++i) {
+        if (!recipients()) {
+            exhausted = true;
+            break;
+        }
+    }
+
+    const auto send = [&] {
+        while (true) {
+            std::int64_t chatId = 0;
+            std::uint64_t index = 0;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (exhausted || error || _cancelled) {
+                    return;
+                }
+                auto next = recipients();
+                if (!next) {
+                    exhausted = true;
+                    return;
+                }
+                chatId = *next;
+                index = nextIndex++;
+            }
+
+            std::this_thread::sleep_until(pacer.reserve(chatId));
+
+            Result result{};
+            result.chatId = chatId;
+            try {
+                // A broadcast must not hold up the bot's replies.
+                RequestOptions bulk;
+                bulk.priority = RequestPriority::Bulk;
+                RequestOptionsScope scope(bulk);
+                sender(_api, chatId);
+            } catch (const TgException& e) {
+                result.outcome = classify(e);
+                result.description = e.what();
+                result.migrateToChatId = e.migrateToChatId();
+            } catch (const std::exception& e) {
+                result.outcome = Outcome::Failed;
+                result.description = e.what();
+            }
+            if (_onResult) {
+                _onResult(result);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            ++stats.processed;
+            switch (result.outcome) {
+                case Outcome::Delivered:
+                    ++stats.delivered;
+                    break;
+                case Outcome::Blocked:
+                    ++stats.blocked;
+                    break;
+                case Outcome::Deactivated:
+                    ++stats.deactivated;
+                    break;
+                case Outcome::Migrated:
+                    ++stats.migrated;
+                    break;
+                case Outcome::Failed:
+                    ++stats.failed;
+                    break;
+            }
+            finishedAhead.insert(index);
+            while (!finishedAhead.empty() &&
+                   *finishedAhead.begin() == stats.checkpoint) {
+                finishedAhead.erase(finishedAhead.begin());
+                ++stats.checkpoint;
+            }
+
+            const auto now = Clock::now();
+            if (_onProgress && now - lastProgress >= _options.progressInterval) {
+                lastProgress = now;
+                stats.elapsed = now - started;
+                _onProgress(stats);
+            }
+        }
+    };
+
+    const auto worker = [&] {
+        try {
+            send();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const std::size_t workers = std::max<std::size_t>(_options.workers, 1);
+    threads.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // A cancel() is for one run, whether it came before or during it.
+    _cancelled = false;
+    stats.elapsed = Clock::now() - started;
+    if (error) {
+        // Stopped nests the exception being handled, so rethrow it first.
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            throw Stopped(e.what(), stats);
+        } catch (...) {
+            throw Stopped("Broadcast stopped", stats);
+        }
+    }
+
+    if (detail::enabled(LogLevel::Info)) {
+        detail::log(LogLevel::Info, "Broadcast finished",
+                    {{"delivered", std::to_string(stats.delivered)},
+                     {"blocked", std::to_string(stats.blocked)},
+                     {"deactivated", std::to_string(stats.deactivated)},
+                     {"migrated", std::to_string(stats.migrated)},
+                     {"failed", std::to_string(stats.failed)}});
+    }
+    if (_onProgress) {
+        _onProgress(stats);
+    }
+    return stats;
+}
+
+Broadcaster::Sender Broadcaster::textMessage(std::string text,
+                                             Api::ParseMode parseMode) {
+    return [text = std::move(text), parseMode](const Api& api,
+                                               std::int64_t chatId) {
+        std::optional<Api::ParseMode> mode;
+        if (parseMode != Api::ParseMode::None) {
+            mode = parseMode;
+        }
+        api.sendMessage(chatId, text, nullptr, nullptr, nullptr, mode);
+    };
+}
+
+}  // namespace TgBot
@@ -1,74 +1,141 @@
 #include "tgbot/EventHandler.h"
+#include "tgbot/Metrics.h"
+#include "tgbot/Tracing.h"
 #include "tgbot/tools/StringTools.h"
 
+#include <chrono>
+#include <string>
+
 namespace TgBot {
 
+namespace {
+
+// Runs the listeners of one event, timing them if metrics are enabled.
+template <typename Fn>
+void timed(const char* event, Fn&& dispatch) {
+    const auto metrics = detail::metrics();
+    if (!metrics) {
+        dispatch();
+        return;
+    }
+    const auto started = std::chrono::steady_clock::now();
+    dispatch();
+    metrics
+        ->histogram("tgbot_listener_duration_seconds",
+                    detail::scopedLabels({{"event", event}}))
+        .record(std::chrono::steady_clock::now() - started);
+}
+
+}  // namespace
+
 void EventHandler::handleUpdate(const Update::Ptr& update) const {
+    Span span("tgbot.handle_update");
+    if (span.recording()) {
+        span.setAttribute("tgbot.update_id", std::to_string(update->updateId));
+    }
     if (update->message) {
-        handleMessage(*update->message);
+        timed("message", [&] { handleMessage(*update->message); });
     }
     if (update->editedMessage) {
-        _broadcaster->broadcastEditedMessage(*update->editedMessage);
+        timed("edited_message", [&] {
+            _broadcaster->broadcastEditedMessage(*update->editedMessage);
+        });
     }
     if (update->channelPost) {
-        handleMessage(*update->channelPost);
+        timed("channel_post", [&] { handleMessage(*update->channelPost); });
     }
     if (update->editedChannelPost) {
-        _broadcaster->broadcastEditedMessage(*update->editedChannelPost);
+        timed("edited_channel_post", [&] {
+            _broadcaster->broadcastEditedMessage(*update->editedChannelPost);
+        });
     }
     if (update->businessConnection) {
-        _broadcaster->broadcastBusinessConnection(*update->businessConnection);
+        timed("business_connection", [&] {
+            _broadcaster->broadcastBusinessConnection(*update->businessConnection);
+        });
     }
     if (update->businessMessage) {
-        _broadcaster->broadcastBusinessMessage(*update->businessMessage);
+        timed("business_message", [&] {
+            _broadcaster->broadcastBusinessMessage(*update->businessMessage);
+        });
     }
     if (update->editedBusinessMessage) {
-        _broadcaster->broadcastEditedBusinessMessage(*update->editedBusinessMessage);
+        timed("edited_business_message", [&] {
+            _broadcaster->broadcastEditedBusinessMessage(*update->editedBusinessMessage);
+        });
     }
     if (update->deletedBusinessMessages) {
-        _broadcaster->broadcastDeletedBusinessMessages(*update->deletedBusinessMessages);
+        timed("deleted_business_messages", [&] {
+            _broadcaster->broadcastDeletedBusinessMessages(*update->deletedBusinessMessages);
+        });
     }
     if (update->messageReaction) {
-        _broadcaster->broadcastMessageReactionUpdated(*update->messageReaction);
+        timed("message_reaction", [&] {
+            _broadcaster->broadcastMessageReactionUpdated(*update->messageReaction);
+        });
     }
     if (update->messageReactionCount) {
-        _broadcaster->broadcastMessageReactionCountUpdated(*update->messageReactionCount);
+        timed("message_reaction_count", [&] {
+            _broadcaster->broadcastMessageReactionCountUpdated(*update->messageReactionCount);
+        });
     }
     if (update->inlineQuery) {
-        _broadcaster->broadcastInlineQuery(*update->inlineQuery);
+        timed("inline_query", [&] {
+            _broadcaster->broadcastInlineQuery(*update->inlineQuery);
+        });
     }
     if (update->chosenInlineResult) {
-        _broadcaster->broadcastChosenInlineResult(*update->chosenInlineResult);
+        timed("chosen_inline_result", [&] {
+            _broadcaster->broadcastChosenInlineResult(*update->chosenInlineResult);
+        });
     }
     if (update->callbackQuery) {
-        _broadcaster->broadcastCallbackQuery(*update->callbackQuery);
+        timed("callback_query", [&] {
+            _broadcaster->broadcastCallbackQuery(*update->callbackQuery);
+        });
     }
     if (update->shippingQuery) {
-        _broadcaster->broadcastShippingQuery(*update->shippingQuery);
+        timed("shipping_query", [&] {
+            _broadcaster->broadcastShippingQuery(*update->shippingQuery);
+        });
     }
     if (update->preCheckoutQuery) {
-        _broadcaster->broadcastPreCheckoutQuery(*update->preCheckoutQuery);
+        timed("pre_checkout_query", [&] {
+            _broadcaster->broadcastPreCheckoutQuery(*update->preCheckoutQuery);
+        });
     }
     if (update->poll) {
-        _broadcaster->broadcastPoll(*update->poll);
+        timed("poll", [&] { _broadcaster->broadcastPoll(*update->poll); });
     }
     if (update->pollAnswer) {
-        _broadcaster->broadcastPollAnswer(*update->pollAnswer);
+        timed("poll_answer", [&] {
+            _broadcaster->broadcastPollAnswer(*update->pollAnswer);
+        });
     }
     if (update->myChatMember) {
-        _broadcaster->broadcastMyChatMember(*update->myChatMember);
+        timed("my_chat_member", [&] {
+            _broadcaster->broadcastMyChatMember(*update->myChatMember);
+        });
     }
     if (update->chatMember) {
-        _broadcaster->broadcastChatMember(*update->chatMember);
+        timed("chat_member", [&] {
+            _broadcaster->broadcastChatMember(*update->chatMember);
+        });
     }
     if (update->chatJoinRequest) {
-        _broadcaster->broadcastChatJoinRequest(*update->chatJoinRequest);
+        timed("chat_join_request", [&] {
+            _broadcaster->broadcastChatJoinRequest(*update->chatJoinRequest);
+        });
     }
     if (update->chatBoost) {
-        _broadcaster->broadcastChatBoostUpdated(*update->chatBoost);
+        timed("chat_boost", [&] {
+            _broadcaster->broadcastChatBoostUpdated(*update->chatBoost);
+        });
     }
     if (update->removedChatBoost) {
-        _broadcaster->broadcastRemovedChatBoost(*update->removedChatBoost);
+        timed("removed_chat_boost", [&] {
+            _broadcaster->broadcastRemovedChatBoost(*update->removedChatBoost);
+        });
     }
 }
 
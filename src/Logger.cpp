@@ -1,22 +1,33 @@
 #include "tgbot/Logger.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <iostream>
 #include <mutex>
 #include <string_view>
+#include <thread>
 #include <utility>
 
+#include "tools/MpscRing.h"
+
 namespace TgBot {
 
 namespace {
 
-std::mutex& loggerMutex() {
-    static std::mutex mutex;
-    return mutex;
-}
+// The registered logger. detail::log() takes its own reference with
+// std::atomic_load(), so a logger that setLogger() replaces lives on until
+// the calls still running on it return, and setLogger() never waits for
+// them, not even when called from inside Logger::log().
+struct Registry {
+    std::mutex mutex;  // serializes setLogger()
+    // Only accessed with std::atomic_load() and std::atomic_exchange().
+    std::shared_ptr<Logger> owner = std::make_shared<DefaultLogger>();
+    std::atomic<int> threshold{static_cast<int>(owner->minLevel())};
+};
 
-std::shared_ptr<Logger>& loggerStorage() {
-    static std::shared_ptr<Logger> logger = std::make_shared<DefaultLogger>();
-    return logger;
+Registry& registry() {
+    static Registry instance;
+    return instance;
 }
 
 constexpr std::string_view levelName(LogLevel level) {
@@ -48,21 +59,151 @@ void DefaultLogger::log(LogLevel level, const std::string& message) {
     std::clog << "[tgbot-cpp] [" << levelName(level) << "] " << message << '\n';
 }
 
+std::string LogRecord::format() const {
+    std::string text = message;
+    for (const auto& [key, value] : fields) {
+        text += ' ';
+        text += key;
+        text += '=';
+        if (value.empty() || value.find(' ') != std::string::npos) {
+            text += '"';
+            text += value;
+            text += '"';
+        } else {
+            text += value;
+        }
+    }
+    return text;
+}
+
+struct AsyncLogger::Impl {
+    Impl(std::shared_ptr<Logger> sink, std::size_t capacity)
+        : sink(std::move(sink)),
+          minLevel(this->sink->minLevel()),
+          ring(capacity),
+          thread([this] { run(); }) {}
+
+    void push(LogRecord&& record) {
+        if (!ring.push(std::move(record))) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        pushed.fetch_add(1, std::memory_order_release);
+        if (idle.load(std::memory_order_acquire)) {
+            wakeup.notify_one();
+        }
+    }
+
+    void run() {
+        while (true) {
+            while (auto record = ring.pop()) {
+                try {
+                    sink->log(*record);
+                } catch (...) {
+                    // A failing sink must not take the logging thread down.
+                }
+                delivered.fetch_add(1, std::memory_order_release);
+            }
+            if (stopping.load(std::memory_order_acquire) &&
+                delivered.load(std::memory_order_relaxed) ==
+                    pushed.load(std::memory_order_acquire)) {
+                return;
+            }
+            // Producers never take the mutex, so a wakeup can be missed; the
+            // timeout bounds the delay in that case.
+            std::unique_lock<std::mutex> lock(mutex);
+            idle.store(true, std::memory_order_release);
+            wakeup.wait_for(lock, std::chrono::milliseconds(50));
+            idle.store(false, std::memory_order_release);
+        }
+    }
+
+    std::shared_ptr<Logger> sink;
+    const LogLevel minLevel;
+    detail::MpscRing<LogRecord> ring;
+    std::atomic<std::uint64_t> pushed{0};
+    std::atomic<std::uint64_t> delivered{0};
+    std::atomic<std::uint64_t> dropped{0};
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> idle{false};
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::thread thread;  // last, so it starts after everything above
+};
+
+AsyncLogger::AsyncLogger(std::shared_ptr<Logger> sink, std::size_t capacity)
+    : _impl(std::make_unique<Impl>(
+          sink ? std::move(sink) : std::make_shared<DefaultLogger>(),
+          capacity)) {}
+
+AsyncLogger::~AsyncLogger() {
+    _impl->stopping.store(true, std::memory_order_release);
+    _impl->wakeup.notify_one();
+    _impl->thread.join();
+}
+
+void AsyncLogger::log(LogLevel level, const std::string& message) {
+    LogRecord record;
+    record.level = level;
+    record.time = std::chrono::system_clock::now();
+    record.message = message;
+    _impl->push(std::move(record));
+}
+
+void AsyncLogger::log(const LogRecord& record) {
+    _impl->push(LogRecord(record));
+}
+
+LogLevel AsyncLogger::minLevel() const { return _impl->minLevel; }
+
+void AsyncLogger::flush() {
+    const std::uint64_t target = _impl->pushed.load(std::memory_order_acquire);
+    while (_impl->delivered.load(std::memory_order_acquire) < target) {
+        _impl->wakeup.notify_one();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+std::uint64_t AsyncLogger::dropped() const {
+    return _impl->dropped.load(std::memory_order_relaxed);
+}
+
 void setLogger(std::shared_ptr<Logger> logger) {
-    std::lock_guard<std::mutex> lock(loggerMutex());
-    loggerStorage() =
-        logger ? std::move(logger) : std::make_shared<DefaultLogger>();
+    if (!logger) {
+        logger = std::make_shared<DefaultLogger>();
+    }
+    Registry& reg = registry();
+    // Released after the lock, as its destructor may log.
+    std::shared_ptr<Logger> previous;
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.threshold.store(static_cast<int>(logger->minLevel()),
+                        std::memory_order_relaxed);
+    previous = std::atomic_exchange(&reg.owner, std::move(logger));
 }
 
 std::shared_ptr<Logger> getLogger() {
-    std::lock_guard<std::mutex> lock(loggerMutex());
-    return loggerStorage();
+    return std::atomic_load(&registry().owner);
 }
 
 namespace detail {
 
-void log(LogLevel level, const std::string& message) {
-    getLogger()->log(level, message);
+bool enabled(LogLevel level) noexcept {
+    const int threshold =
+        registry().threshold.load(std::memory_order_relaxed);
+    return level != LogLevel::Off && static_cast<int>(level) >= threshold;
+}
+
+void log(LogLevel level, std::string message, std::vector<LogField> fields) {
+    if (!enabled(level)) {
+        return;
+    }
+    LogRecord record;
+    record.level = level;
+    record.time = std::chrono::system_clock::now();
+    record.message = std::move(message);
+    record.fields = std::move(fields);
+
+    std::atomic_load(&registry().owner)->log(record);
 }
 
 }  // namespace detail
@@ -0,0 +1,319 @@
+#include "tgbot/Metrics.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+
+namespace TgBot {
+
+namespace {
+
+// Bucket bounds reported to Prometheus, in seconds. The fine HDR buckets are
+// folded into these on export, each into the first bound at or above its
+// largest value, so a reported count never includes records above its le.
+constexpr std::array<std::pair<const char*, std::uint64_t>, 16> kExportBounds{{
+    {"0.0005", 500},
+    {"0.001", 1000},
+    {"0.0025", 2500},
+    {"0.005", 5000},
+    {"0.01", 10000},
+    {"0.025", 25000},
+    {"0.05", 50000},
+    {"0.1", 100000},
+    {"0.25", 250000},
+    {"0.5", 500000},
+    {"1", 1000000},
+    {"2.5", 2500000},
+    {"5", 5000000},
+    {"10", 10000000},
+    {"30", 30000000},
+    {"60", 60000000},
+}};
+
+int highestBit(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+void appendEscaped(std::string& out, std::string_view value) {
+    for (char c : value) {
+        switch (c) {
+            case '\\':
+                out += "\\\\";
+                break;
+            case '"':
+                out += "\\\"";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            default:
+                out += c;
+        }
+    }
+}
+
+std::string labelKey(const MetricLabels& labels) {
+    std::string key;
+    for (const auto& [name, value] : labels) {
+        if (!key.empty()) {
+            key += ',';
+        }
+        key += name;
+        key += "=\"";
+        appendEscaped(key, value);
+        key += '"';
+    }
+    return key;
+}
+
+std::string seconds(std::uint64_t micros) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.6f",
+                  static_cast<double>(micros) / 1e6);
+    return buffer;
+}
+
+void appendSeries(std::string& out, const std::string& name,
+                  const std::string& labels, const std::string& extraLabel,
+                  const std::string& value) {
+    out += name;
+    if (!labels.empty() || !extraLabel.empty()) {
+        out += '{';
+        out += labels;
+        if (!labels.empty() && !extraLabel.empty()) {
+            out += ',';
+        }
+        out += extraLabel;
+        out += '}';
+    }
+    out += ' ';
+    out += value;
+    out += '\n';
+}
+
+}  // namespace
+
+std::size_t Histogram::bucketOf(std::uint64_t micros) noexcept {
+    if (micros < 8) {
+        return static_cast<std::size_t>(micros);
+    }
+    const int exponent = highestBit(micros);
+    const std::size_t bucket = 8 + static_cast<std::size_t>(exponent - 3) * 8 +
+                               ((micros >> (exponent - 3)) & 7);
+    return bucket < kBucketCount ? bucket : kBucketCount - 1;
+}
+
+std::uint64_t Histogram::bucketUpperBound(std::size_t bucket) noexcept {
+    if (bucket < 8) {
+        return bucket + 1;
+    }
+    const std::size_t exponent = (bucket - 8) / 8 + 3;
+    const std::uint64_t step = std::uint64_t{1} << (exponent - 3);
+    return (8 + (bucket - 8) % 8) * step + step;
+}
+
+void Histogram::record(std::chrono::nanoseconds value) noexcept {
+    const auto micros = static_cast<std::uint64_t>(
+        std::max<std::int64_t>(value.count() / 1000, 0));
+    _buckets[bucketOf(micros)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(micros, std::memory_order_relaxed);
+    std::uint64_t max = _max.load(std::memory_order_relaxed);
+    while (micros > max &&
+           !_max.compare_exchange_weak(max, micros, std::memory_order_relaxed)) {
+    }
+}
+
+std::chrono::microseconds Histogram::quantile(double q) const noexcept {
+    const std::uint64_t total = count();
+    if (total == 0) {
+        return std::chrono::microseconds(0);
+    }
+    const auto rank = static_cast<std::uint64_t>(
+        q <= 0 ? 1 : q >= 1 ? total : q * static_cast<double>(total) + 0.5);
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        seen += _buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank && seen > 0) {
+            return std::chrono::microseconds(std::min<std::uint64_t>(
+                bucketUpperBound(i) - 1, max().count()));
+        }
+    }
+    return max();
+}
+
+std::uint64_t Histogram::countAtOrBelow(
+    std::chrono::microseconds bound) const noexcept {
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        // The largest value the bucket holds; bounds are inclusive.
+        if (bucketUpperBound(i) - 1 >
+            static_cast<std::uint64_t>(bound.count())) {
+            break;
+        }
+        result += _buckets[i].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+Metrics::Family& Metrics::family(std::string_view name) {
+    auto it = _families.find(name);
+    if (it == _families.end()) {
+        it = _families.emplace(std::string(name), Family()).first;
+    }
+    return it->second;
+}
+
+Counter& Metrics::counter(std::string_view name, const MetricLabels& labels) {
+    const std::string key = labelKey(labels);
+    {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+        auto it = _families.find(name);
+        if (it != _families.end()) {
+            auto series = it->second.counters.find(key);
+            if (series != it->second.counters.end()) {
+                return *series->second;
+            }
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    auto& slot = family(name).counters[key];
+    if (!slot) {
+        slot = std::make_unique<Counter>();
+    }
+    return *slot;
+}
+
+Histogram& Metrics::histogram(std::string_view name,
+                              const MetricLabels& labels) {
+    const std::string key = labelKey(labels);
+    {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+        auto it = _families.find(name);
+        if (it != _families.end()) {
+            auto series = it->second.histograms.find(key);
+            if (series != it->second.histograms.end()) {
+                return *series->second;
+            }
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    auto& slot = family(name).histograms[key];
+    if (!slot) {
+        slot = std::make_unique<Histogram>();
+    }
+    return *slot;
+}
+
+void Metrics::describe(std::string_view name, std::string help) {
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    family(name).help = std::move(help);
+}
+
+std::string Metrics::toPrometheus() const {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    std::string out;
+    for (const auto& [name, family] : _families) {
+        const bool isHistogram = !family.histograms.empty();
+        if (!isHistogram && family.counters.empty()) {
+            continue;
+        }
+        if (!family.help.empty()) {
+            out += "# HELP " + name + ' ' + family.help + '\n';
+        }
+        out += "# TYPE " + name + (isHistogram ? " histogram\n" : " counter\n");
+
+        for (const auto& [labels, counter] : family.counters) {
+            appendSeries(out, name, labels, {},
+                         std::to_string(counter->value()));
+        }
+        for (const auto& [labels, histogram] : family.histograms) {
+            for (const auto& [le, bound] : kExportBounds) {
+                appendSeries(out, name + "_bucket", labels,
+                             std::string("le=\"") + le + '"',
+                             std::to_string(histogram->countAtOrBelow(
+                                 std::chrono::microseconds(bound))));
+            }
+            appendSeries(out, name + "_bucket", labels, "le=\"+Inf\"",
+                         std::to_string(histogram->count()));
+            appendSeries(out, name + "_sum", labels, {},
+                         seconds(histogram->sum().count()));
+            appendSeries(out, name + "_count", labels, {},
+                         std::to_string(histogram->count()));
+        }
+    }
+    return out;
+}
+
+namespace {
+
+// The registered registry. detail::metrics() takes its own reference with
+// std::atomic_load(), so a registry that setMetrics() replaces lives on until
+// the recordings still running on it are done, and no longer.
+struct Registry {
+    std::mutex mutex;  // serializes setMetrics()
+    // Only accessed with std::atomic_load() and std::atomic_exchange().
+    std::shared_ptr<Metrics> current;
+    // current.get(), checked first so that metrics cost a single atomic load
+    // while they are off.
+    std::atomic<Metrics*> active{nullptr};
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+}  // namespace
+
+void setMetrics(std::shared_ptr<Metrics> metrics) {
+    Registry& reg = registry();
+    // Released after the lock, possibly as the last reference.
+    std::shared_ptr<Metrics> previous;
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.active.store(metrics.get(), std::memory_order_release);
+    previous = std::atomic_exchange(&reg.current, std::move(metrics));
+}
+
+std::shared_ptr<Metrics> getMetrics() {
+    return std::atomic_load(&registry().current);
+}
+
+namespace {
+
+thread_local MetricLabels threadLabels;
+
+}  // namespace
+
+MetricsLabelScope::MetricsLabelScope(std::string name, std::string value) {
+    threadLabels.emplace_back(std::move(name), std::move(value));
+}
+
+MetricsLabelScope::~MetricsLabelScope() { threadLabels.pop_back(); }
+
+namespace detail {
+
+MetricLabels scopedLabels(MetricLabels labels) {
+    labels.insert(labels.end(), threadLabels.begin(), threadLabels.end());
+    return labels;
+}
+
+std::shared_ptr<Metrics> metrics() noexcept {
+    Registry& reg = registry();
+    if (!reg.active.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    return std::atomic_load(&reg.current);
+}
+
+}  // namespace detail
+
+}  // namespace TgBot
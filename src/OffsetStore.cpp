@@ -0,0 +1,154 @@
+#include "tgbot/OffsetStore.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#include <filesystem>
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace TgBot {
+
+namespace {
+
+// Local I/O failures are not API errors, so they are std::system_error.
+[[noreturn]] void fail(const std::string& what, const std::string& path,
+                       int error = errno) {
+    throw std::system_error(error, std::generic_category(), what + " " + path);
+}
+
+void writeDurably(const std::string& path, const std::string& content) {
+#ifdef _WIN32
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        fail("Could not create", path);
+    }
+    const bool written =
+        std::fwrite(content.data(), 1, content.size(), file) ==
+            content.size() &&
+        std::fflush(file) == 0 && _commit(_fileno(file)) == 0;
+    const int error = errno;
+    std::fclose(file);
+#else
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        fail("Could not create", path);
+    }
+    std::size_t done = 0;
+    while (done < content.size()) {
+        const ssize_t n =
+            ::write(fd, content.data() + done, content.size() - done);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        done += static_cast<std::size_t>(n);
+    }
+    const bool written = done == content.size() && ::fsync(fd) == 0;
+    const int error = errno;
+    ::close(fd);
+#endif
+    if (!written) {
+        fail("Could not write", path, error);
+    }
+}
+
+// Makes a rename into the directory of @p path durable; until then a crash
+// may bring the previous file back.
+void syncDirectory(const std::string& path) {
+#ifndef _WIN32
+    const std::string::size_type slash = path.rfind('/');
+    const std::string directory =
+        slash == std::string::npos ? "."
+        : slash == 0               ? "/"
+                                   : path.substr(0, slash);
+    const int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        fail("Could not open", directory);
+    }
+    const bool synced = ::fsync(fd) == 0;
+    const int error = errno;
+    ::close(fd);
+    if (!synced) {
+        fail("Could not sync", directory, error);
+    }
+#else
+    (void)path;  // MOVEFILE_WRITE_THROUGH already flushed the move
+#endif
+}
+
+[[noreturn]] void corrupt(const std::string& path) {
+    throw std::runtime_error("Corrupt offset file " + path);
+}
+
+}  // namespace
+
+FileOffsetStore::FileOffsetStore(std::string path) : _path(std::move(path)) {}
+
+OffsetState FileOffsetStore::load() {
+    OffsetState state;
+    std::ifstream in(_path);
+    if (!in) {
+        return state;
+    }
+    // First the offset, then the handled update ids. Anything else means
+    // the file was damaged, and starting over from offset 0 would handle
+    // every pending update again.
+    if (!(in >> state.offset)) {
+        corrupt(_path);
+    }
+    std::int32_t id;
+    while (in >> id) {
+        state.handled.push_back(id);
+    }
+    if (!in.eof()) {
+        corrupt(_path);
+    }
+    return state;
+}
+
+void FileOffsetStore::save(const OffsetState& state) {
+    std::string content = std::to_string(state.offset);
+    content += '\n';
+    for (std::int32_t id : state.handled) {
+        content += std::to_string(id);
+        content += ' ';
+    }
+    content += '\n';
+
+    const std::string temporary = _path + ".tmp";
+    writeDurably(temporary, content);
+#ifdef _WIN32
+    // rename() does not replace an existing file on Windows; MoveFileEx does
+    // so atomically, and only returns once the move is on disk.
+    if (!MoveFileExW(std::filesystem::path(temporary).c_str(),
+                     std::filesystem::path(_path).c_str(),
+                     MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        throw std::system_error(static_cast<int>(GetLastError()),
+                                std::system_category(),
+                                "Could not replace " + _path);
+    }
+#else
+    if (std::rename(temporary.c_str(), _path.c_str()) != 0) {
+        fail("Could not replace", _path);
+    }
+#endif
+    syncDirectory(_path);
+}
+
+}  // namespace TgBot
@@ -0,0 +1,193 @@
+#include "tgbot/ParseCache.h"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace TgBot {
+
+namespace {
+
+// A power of two; Cache::shard() picks one with the top bits of a hash.
+constexpr int kShardBits = 4;
+constexpr std::size_t kShardCount = std::size_t{1} << kShardBits;
+
+struct Id {
+    detail::CachedType type;
+    std::uint64_t value;
+
+    bool operator==(const Id& other) const noexcept {
+        return type == other.type && value == other.value;
+    }
+};
+
+struct IdHash {
+    std::size_t operator()(const Id& id) const noexcept {
+        return std::hash<std::uint64_t>{}(
+            id.value * 4 + static_cast<std::uint64_t>(id.type));
+    }
+};
+
+// Least recently used objects of a slice of the ids. Each id keeps one
+// object, the latest version seen, which a changed hash replaces.
+class Shard {
+   public:
+    std::shared_ptr<void> find(const detail::CacheKey& key) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto it = _index.find(Id{key.type, key.id});
+        if (it == _index.end() || it->second->hash != key.hash) {
+            return nullptr;
+        }
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return it->second->object;
+    }
+
+    void store(const detail::CacheKey& key, std::shared_ptr<void> object,
+               std::size_t capacity) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const Id id{key.type, key.id};
+        const auto [it, inserted] = _index.try_emplace(id);
+        if (!inserted) {
+            it->second->hash = key.hash;
+            it->second->object = std::move(object);
+            _entries.splice(_entries.begin(), _entries, it->second);
+            return;
+        }
+        _entries.push_front(Entry{id, key.hash, std::move(object)});
+        it->second = _entries.begin();
+        while (_entries.size() > capacity) {
+            _index.erase(_entries.back().id);
+            _entries.pop_back();
+        }
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _index.clear();
+        _entries.clear();
+    }
+
+    std::size_t size() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _entries.size();
+    }
+
+   private:
+    struct Entry {
+        Id id;
+        std::size_t hash;
+        std::shared_ptr<void> object;
+    };
+
+    std::mutex _mutex;
+    // Most recently used first.
+    std::list<Entry> _entries;
+    std::unordered_map<Id, std::list<Entry>::iterator, IdHash> _index;
+};
+
+struct Cache {
+    std::atomic<bool> enabled{false};
+    std::atomic<std::size_t> shardCapacity{0};
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+    std::array<Shard, kShardCount> shards;
+
+    Shard& shard(const detail::CacheKey& key) {
+        // Fibonacci hashing; the top bits spread consecutive ids evenly.
+        const std::uint64_t mixed =
+            (key.id + static_cast<std::uint64_t>(key.type)) *
+            0x9E3779B97F4A7C15ULL;
+        return shards[mixed >> (64 - kShardBits)];
+    }
+};
+
+Cache& cache() {
+    static Cache instance;
+    return instance;
+}
+
+}  // namespace
+
+void ParseCache::enable(std::size_t capacity) {
+    Cache& state = cache();
+    const std::size_t perShard = (capacity + kShardCount - 1) / kShardCount;
+    state.shardCapacity.store(perShard > 0 ? perShard : 1,
+                              std::memory_order_relaxed);
+    state.enabled.store(true, std::memory_order_release);
+}
+
+void ParseCache::disable() {
+    Cache& state = cache();
+    state.enabled.store(false, std::memory_order_release);
+    for (Shard& shard : state.shards) {
+        shard.clear();
+    }
+    state.hits.store(0, std::memory_order_relaxed);
+    state.misses.store(0, std::memory_order_relaxed);
+}
+
+bool ParseCache::enabled() noexcept {
+    return cache().enabled.load(std::memory_order_acquire);
+}
+
+ParseCache::Stats ParseCache::stats() {
+    Cache& state = cache();
+    Stats stats;
+    stats.hits = state.hits.load(std::memory_order_relaxed);
+    stats.misses = state.misses.load(std::memory_order_relaxed);
+    for (Shard& shard : state.shards) {
+        stats.size += shard.size();
+    }
+    return stats;
+}
+
+namespace detail {
+
+std::optional<CacheKey> cacheKey(CachedType type, const nlohmann::json& data) {
+    if (!ParseCache::enabled() || !data.is_object()) {
+        return std::nullopt;
+    }
+    std::uint64_t id = 0;
+    if (type == CachedType::Sticker) {
+        // Stickers are sent by file, so their unique file id names them.
+        const auto it = data.find("file_unique_id");
+        if (it == data.end() || !it->is_string()) {
+            return std::nullopt;
+        }
+        id = std::hash<std::string_view>{}(it->get_ref<const std::string&>());
+    } else {
+        const auto it = data.find("id");
+        if (it == data.end() || !it->is_number_integer()) {
+            return std::nullopt;
+        }
+        id = static_cast<std::uint64_t>(it->get<std::int64_t>());
+    }
+    return CacheKey{type, id, std::hash<nlohmann::json>{}(data)};
+}
+
+std::shared_ptr<void> findCached(const CacheKey& key) {
+    Cache& state = cache();
+    auto object = state.shard(key).find(key);
+    (object ? state.hits : state.misses)
+        .fetch_add(1, std::memory_order_relaxed);
+    return object;
+}
+
+void storeCached(const CacheKey& key, std::shared_ptr<void> object) {
+    Cache& state = cache();
+    if (!state.enabled.load(std::memory_order_acquire)) {
+        return;
+    }
+    state.shard(key).store(key, std::move(object),
+                           state.shardCapacity.load(std::memory_order_relaxed));
+}
+
+}  // namespace detail
+
+}  // namespace TgBot
@@ -0,0 +1,306 @@
+#include "tgbot/Tracing.h"
+
+#include <atomic>
+#include <functional>
+#include <random>
+#include <thread>
+
+namespace TgBot {
+
+namespace {
+
+thread_local const SpanContext* currentContext = nullptr;
+
+// The registered exporter. A Span takes its own reference with
+// std::atomic_load(), so an exporter that setSpanExporter() replaces lives on
+// until the spans started on it have ended, and no longer.
+struct Registry {
+    std::mutex mutex;  // serializes setSpanExporter()
+    // Only accessed with std::atomic_load() and std::atomic_exchange().
+    std::shared_ptr<SpanExporter> current;
+    // current.get(), checked first so that spans cost a single atomic load
+    // while tracing is off.
+    std::atomic<SpanExporter*> active{nullptr};
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+template <std::size_t N>
+void randomBytes(std::array<std::uint8_t, N>& bytes) {
+    thread_local std::mt19937_64 engine(
+        std::random_device{}() ^
+        std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    for (std::size_t i = 0; i < N; i += 8) {
+        std::uint64_t value = engine();
+        for (std::size_t j = i; j < N && j < i + 8; ++j) {
+            bytes[j] = static_cast<std::uint8_t>(value);
+            value >>= 8;
+        }
+    }
+}
+
+template <std::size_t N>
+bool allZero(const std::array<std::uint8_t, N>& bytes) {
+    for (std::uint8_t byte : bytes) {
+        if (byte != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <std::size_t N>
+std::string toHex(const std::array<std::uint8_t, N>& bytes) {
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string hex(N * 2, '0');
+    for (std::size_t i = 0; i < N; ++i) {
+        hex[2 * i] = digits[bytes[i] >> 4];
+        hex[2 * i + 1] = digits[bytes[i] & 0xf];
+    }
+    return hex;
+}
+
+// Lowercase hex, as traceparent requires.
+template <std::size_t N>
+bool fromHex(std::string_view hex, std::array<std::uint8_t, N>& bytes) {
+    if (hex.size() != N * 2) {
+        return false;
+    }
+    const auto nibble = [](char c) -> int {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        }
+        return -1;
+    };
+    for (std::size_t i = 0; i < N; ++i) {
+        const int high = nibble(hex[2 * i]);
+        const int low = nibble(hex[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        bytes[i] = static_cast<std::uint8_t>(high << 4 | low);
+    }
+    return true;
+}
+
+void appendJsonString(std::string& out, std::string_view value) {
+    out += '"';
+    for (char c : value) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    static constexpr char digits[] = "0123456789abcdef";
+                    out += "\\u00";
+                    out += digits[(c >> 4) & 0xf];
+                    out += digits[c & 0xf];
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+std::string unixNanos(std::chrono::system_clock::time_point time) {
+    return std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              time.time_since_epoch())
+                              .count());
+}
+
+}  // namespace
+
+bool SpanContext::valid() const noexcept {
+    return !allZero(traceId) && !allZero(spanId);
+}
+
+std::string SpanContext::traceIdHex() const { return toHex(traceId); }
+
+std::string SpanContext::spanIdHex() const { return toHex(spanId); }
+
+std::string SpanContext::toTraceparent() const {
+    return "00-" + traceIdHex() + '-' + spanIdHex() + "-01";
+}
+
+std::optional<SpanContext> SpanContext::fromTraceparent(
+    std::string_view header) {
+    // version "-" trace-id "-" parent-id "-" flags, where a later version
+    // may append "-" and fields of its own.
+    if (header.size() < 55 || header[2] != '-' || header[35] != '-' ||
+        header[52] != '-') {
+        return std::nullopt;
+    }
+    std::array<std::uint8_t, 1> version;
+    std::array<std::uint8_t, 1> flags;
+    if (!fromHex(header.substr(0, 2), version) || version[0] == 0xff ||
+        !fromHex(header.substr(53, 2), flags)) {
+        return std::nullopt;
+    }
+    if (version[0] == 0 ? header.size() != 55
+                        : header.size() > 55 && header[55] != '-') {
+        return std::nullopt;
+    }
+    SpanContext context;
+    if (!fromHex(header.substr(3, 32), context.traceId) ||
+        !fromHex(header.substr(36, 16), context.spanId) || !context.valid()) {
+        return std::nullopt;
+    }
+    return context;
+}
+
+FileSpanExporter::FileSpanExporter(const std::string& path)
+    : _out(path, std::ios::app) {}
+
+void FileSpanExporter::exportSpan(const SpanData& span) {
+    std::string line = "{\"traceId\":\"" + span.context.traceIdHex() +
+                       "\",\"spanId\":\"" + span.context.spanIdHex() + '"';
+    if (!allZero(span.parentSpanId)) {
+        line += ",\"parentSpanId\":\"" + toHex(span.parentSpanId) + '"';
+    }
+    line += ",\"name\":";
+    appendJsonString(line, span.name);
+    line += ",\"startTimeUnixNano\":\"" + unixNanos(span.start) +
+            "\",\"endTimeUnixNano\":\"" + unixNanos(span.end) +
+            "\",\"attributes\":[";
+    for (std::size_t i = 0; i < span.attributes.size(); ++i) {
+        if (i > 0) {
+            line += ',';
+        }
+        line += "{\"key\":";
+        appendJsonString(line, span.attributes[i].first);
+        line += ",\"value\":{\"stringValue\":";
+        appendJsonString(line, span.attributes[i].second);
+        line += "}}";
+    }
+    // OTLP status codes: 1 = OK, 2 = ERROR.
+    line += "],\"status\":{\"code\":";
+    line += span.error ? '2' : '1';
+    if (!span.statusMessage.empty()) {
+        line += ",\"message\":";
+        appendJsonString(line, span.statusMessage);
+    }
+    line += "}}\n";
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _out << line;
+    _out.flush();
+}
+
+void setSpanExporter(std::shared_ptr<SpanExporter> exporter) {
+    Registry& reg = registry();
+    // Released after the lock, possibly as the last reference.
+    std::shared_ptr<SpanExporter> previous;
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.active.store(exporter.get(), std::memory_order_release);
+    previous = std::atomic_exchange(&reg.current, std::move(exporter));
+}
+
+Span::Span(std::string_view name) { begin(name, currentContext, true); }
+
+Span::Span(std::string_view name, const SpanContext& parent) {
+    begin(name, &parent, true);
+}
+
+Span::Span(std::string_view name, Detached) {
+    begin(name, currentContext, false);
+}
+
+void Span::begin(std::string_view name, const SpanContext* parent,
+                 bool makeCurrent) {
+    Registry& reg = registry();
+    if (!reg.active.load(std::memory_order_acquire)) {
+        return;
+    }
+    _exporter = std::atomic_load(&reg.current);
+    if (!_exporter) {
+        return;
+    }
+    _data = std::make_unique<SpanData>();
+    _data->name = name;
+    if (parent && parent->valid()) {
+        _data->context.traceId = parent->traceId;
+        _data->parentSpanId = parent->spanId;
+    } else {
+        randomBytes(_data->context.traceId);
+    }
+    randomBytes(_data->context.spanId);
+    _data->start = std::chrono::system_clock::now();
+    if (makeCurrent) {
+        _previous = currentContext;
+        currentContext = &_data->context;
+        _current = true;
+    }
+}
+
+Span::~Span() {
+    if (!_data) {
+        return;
+    }
+    if (_current) {
+        currentContext = _previous;
+    }
+    _data->end = std::chrono::system_clock::now();
+    try {
+        _exporter->exportSpan(*_data);
+    } catch (...) {
+        // Tracing must never break the traced code.
+    }
+}
+
+void Span::setAttribute(std::string_view key, std::string value) {
+    if (_data) {
+        _data->attributes.emplace_back(std::string(key), std::move(value));
+    }
+}
+
+void Span::setError(std::string message) {
+    if (_data) {
+        _data->error = true;
+        _data->statusMessage = std::move(message);
+    }
+}
+
+SpanContext Span::context() const noexcept {
+    return _data ? _data->context : SpanContext();
+}
+
+SpanContext Span::current() noexcept {
+    return currentContext ? *currentContext : SpanContext();
+}
+
+ContextScope::ContextScope(const SpanContext& context)
+    : _context(context), _previous(currentContext) {
+    currentContext = &_context;
+}
+
+ContextScope::~ContextScope() { currentContext = _previous; }
+
+namespace detail {
+
+bool tracingEnabled() noexcept {
+    return registry().active.load(std::memory_order_relaxed) != nullptr;
+}
+
+}  // namespace detail
+
+}  // namespace TgBot
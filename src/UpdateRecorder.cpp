@@ -0,0 +1,193 @@
+#include "tgbot/UpdateRecorder.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <string>
+#include <nlohmann/json.hpp>
+#include <system_error>
+#include <thread>
+
+#include "tgbot/EventHandler.h"
+#include "tgbot/Logger.h"
+#include "tools/Instrumentation.h"
+
+namespace TgBot {
+
+namespace {
+
+// Starts every record. 0xF5 never occurs in UTF-8, so neither in a JSON
+// payload, which lets a reader find the next record after a damaged one.
+constexpr char kMagic[4] = {'\xF5', 'T', 'G', 'U'};
+constexpr std::size_t kMagicSize = sizeof(kMagic);
+// Magic, receive time, payload length and CRC-32.
+constexpr std::size_t kHeaderSize = kMagicSize + 8 + 4 + 4;
+// Far above any update Telegram sends; a larger length means a damaged
+// header and must not be allocated.
+constexpr std::size_t kMaxPayloadSize = 16 * 1024 * 1024;
+
+void putLittleEndian(char* out, std::uint64_t value, std::size_t bytes) {
+    for (std::size_t i = 0; i < bytes; ++i) {
+        out[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+}
+
+std::uint64_t getLittleEndian(const char* in, std::size_t bytes) {
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < bytes; ++i) {
+        value |= std::uint64_t{static_cast<unsigned char>(in[i])} << (8 * i);
+    }
+    return value;
+}
+
+// CRC-32 (IEEE 802.3) of @p data, continuing from @p crc.
+std::uint32_t crc32(std::string_view data, std::uint32_t crc = 0) {
+    crc = ~crc;
+    for (const char c : data) {
+        crc ^= static_cast<unsigned char>(c);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+// Checksum of a record: its time and length fields, and its payload.
+std::uint32_t recordChecksum(const char* header, std::string_view payload) {
+    return crc32(payload, crc32({header + kMagicSize, 12}));
+}
+
+}  // namespace
+
+UpdateRecorder::UpdateRecorder(const std::string& path)
+    : _out(path, std::ios::out | std::ios::binary | std::ios::app) {
+    if (!_out) {
+        throw std::system_error(errno, std::generic_category(),
+                                "Could not open capture file " + path);
+    }
+}
+
+UpdateRecorder::~UpdateRecorder() = default;
+
+void UpdateRecorder::record(std::string_view payload,
+                            std::chrono::system_clock::time_point time) {
+    const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                            time.time_since_epoch())
+                            .count();
+    if (payload.size() > kMaxPayloadSize) {
+        detail::log(LogLevel::Error, "Update too large to record",
+                    {{"size", std::to_string(payload.size())}});
+        return;
+    }
+    char header[kHeaderSize];
+    std::copy(kMagic, kMagic + kMagicSize, header);
+    putLittleEndian(header + kMagicSize, static_cast<std::uint64_t>(micros),
+                    8);
+    putLittleEndian(header + kMagicSize + 8, payload.size(), 4);
+    putLittleEndian(header + kMagicSize + 12,
+                    recordChecksum(header, payload), 4);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _out.write(header, kHeaderSize);
+    _out.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+}
+
+void UpdateRecorder::flush() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _out.flush();
+}
+
+UpdateReplayer::UpdateReplayer(const std::string& path)
+    : _in(path, std::ios::in | std::ios::binary) {
+    if (!_in) {
+        throw std::system_error(errno, std::generic_category(),
+                                "Could not open capture file " + path);
+    }
+}
+
+std::optional<UpdateRecord> UpdateReplayer::next() {
+    while (true) {
+        const std::streampos start = _in.tellg();
+        char header[kHeaderSize];
+        if (!_in.read(header, kHeaderSize)) {
+            // The end, or a header cut short by a crash while recording.
+            return std::nullopt;
+        }
+        const std::size_t size = getLittleEndian(header + kMagicSize + 8, 4);
+        if (std::equal(kMagic, kMagic + kMagicSize, header) &&
+            size <= kMaxPayloadSize) {
+            UpdateRecord record;
+            record.payload.resize(size);
+            if (_in.read(record.payload.data(),
+                         static_cast<std::streamsize>(size)) &&
+                getLittleEndian(header + kMagicSize + 12, 4) ==
+                    recordChecksum(header, record.payload)) {
+                record.time = std::chrono::system_clock::time_point(
+                    std::chrono::duration_cast<
+                        std::chrono::system_clock::duration>(
+                        std::chrono::microseconds(static_cast<std::int64_t>(
+                            getLittleEndian(header + kMagicSize, 8)))));
+                return record;
+            }
+        }
+
+        // A record torn by a crash, with later runs appended after it, or
+        // otherwise damaged: go on with the next record that starts after it.
+        detail::log(LogLevel::Warning, "Skipping damaged capture record",
+                    {{"offset", std::to_string(static_cast<long long>(start))}});
+        _in.clear();
+        _in.seekg(start + std::streamoff(1));
+        if (!seekMagic()) {
+            return std::nullopt;
+        }
+    }
+}
+
+bool UpdateReplayer::seekMagic() {
+    std::size_t matched = 0;
+    char c;
+    while (_in.get(c)) {
+        if (c == kMagic[matched]) {
+            if (++matched == kMagicSize) {
+                _in.seekg(-static_cast<std::streamoff>(kMagicSize),
+                          std::ios::cur);
+                return true;
+            }
+        } else {
+            // The magic's first byte occurs in it only once.
+            matched = c == kMagic[0] ? 1 : 0;
+        }
+    }
+    return false;
+}
+
+std::size_t UpdateReplayer::replay(const EventHandler& handler, double speed) {
+    std::size_t count = 0;
+    std::optional<std::chrono::system_clock::time_point> firstTime;
+    const auto started = std::chrono::steady_clock::now();
+    while (auto record = next()) {
+        if (!firstTime) {
+            firstTime = record->time;
+        }
+        if (speed > 0) {
+            const std::chrono::duration<double> offset =
+                (record->time - *firstTime) / speed;
+            std::this_thread::sleep_until(
+                started +
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    offset));
+        }
+        try {
+            handler.handleUpdate(
+                detail::parseUpdate(nlohmann::json::parse(record->payload)));
+        } catch (const std::exception& e) {
+            // Same policy as the webhook: one bad update does not stop the run.
+            detail::log(LogLevel::Error, "Replayed update handler error",
+                        {{"error", e.what()}});
+        }
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace TgBot
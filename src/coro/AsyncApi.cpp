@@ -0,0 +1,285 @@
+#include "tgbot/coro/AsyncApi.h"
+
+#include <algorithm>
+#include <coroutine>
+#include <exception>
+#include <variant>
+
+#include "tgbot/TgException.h"
+#include "tgbot/net/HttpClient.h"
+#include "tgbot/net/Url.h"
+#include "tools/ApiCall.h"
+
+namespace TgBot::coro {
+
+namespace {
+
+// Time the server may take beyond the long poll timeout to answer.
+constexpr std::chrono::seconds kLongPollMargin{5};
+
+struct Response {
+    std::string body;
+    std::exception_ptr error;
+};
+
+// Suspends until the client answered a request, on its event loop thread.
+class ResponseAwaiter {
+   public:
+    ResponseAwaiter(const EpollHttpClient& client, const std::string& url,
+                    const HttpReqArg::Vec& args, RequestOptions options = {})
+        : _client(client),
+          _url(url),
+          _args(args),
+          _options(std::move(options)) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        // The callback may resume the coroutine, and so destroy this awaiter,
+        // before makeRequestAsync() returns; nothing is touched afterwards.
+        _client.makeRequestAsync(
+            _url, _args,
+            [this, handle](std::string body, std::exception_ptr error) {
+                _response = {std::move(body), std::move(error)};
+                handle.resume();
+            },
+            _options);
+    }
+
+    Response await_resume() { return std::move(_response); }
+
+   private:
+    const EpollHttpClient& _client;
+    Url _url;
+    const HttpReqArg::Vec& _args;
+    RequestOptions _options;
+    Response _response;
+};
+
+class SleepAwaiter {
+   public:
+    SleepAwaiter(const EpollHttpClient& client, std::chrono::milliseconds delay)
+        : _client(client), _delay(delay) {}
+
+    bool await_ready() const noexcept { return _delay.count() <= 0; }
+
+    void await_suspend(std::coroutine_handle<> handle) const {
+        _client.schedule(_delay, [handle] { handle.resume(); });
+    }
+
+    void await_resume() const noexcept {}
+
+   private:
+    const EpollHttpClient& _client;
+    std::chrono::milliseconds _delay;
+};
+
+std::string parseModeName(AsyncApi::ParseMode parseMode) {
+    switch (parseMode) {
+        case AsyncApi::ParseMode::Markdown:
+            return "Markdown";
+        case AsyncApi::ParseMode::MarkdownV2:
+            return "MarkdownV2";
+        case AsyncApi::ParseMode::HTML:
+            return "HTML";
+        case AsyncApi::ParseMode::None:
+            break;
+    }
+    return {};
+}
+
+void addChatId(HttpReqArg::Vec& args, const AsyncApi::ChatIdType& chatId) {
+    std::visit(
+        [&args](const auto& id) {
+            args.push_back(std::make_unique<HttpReqArg>("chat_id", id));
+        },
+        chatId);
+}
+
+void addFile(HttpReqArg::Vec& args, std::string name,
+             const AsyncApi::FileHandleType& file) {
+    if (const auto* upload = std::get_if<InputFile::Ptr>(&file)) {
+        args.push_back(
+            std::make_unique<HttpReqArgFile>(std::move(name), *upload));
+    } else {
+        args.push_back(std::make_unique<HttpReqArg>(
+            std::move(name), std::get<std::string>(file)));
+    }
+}
+
+void addCaption(HttpReqArg::Vec& args, const std::string& caption,
+                std::optional<AsyncApi::ParseMode> parseMode,
+                const GenericReply::Ptr& replyMarkup) {
+    if (!caption.empty()) {
+        args.push_back(std::make_unique<HttpReqArg>("caption", caption));
+    }
+    if (parseMode) {
+        args.push_back(std::make_unique<HttpReqArg>(
+            "parse_mode", parseModeName(*parseMode)));
+    }
+    if (replyMarkup) {
+        args.push_back(std::make_unique<HttpReqArg>("reply_markup",
+                                                    putJSON(replyMarkup)));
+    }
+}
+
+}  // namespace
+
+AsyncApi::AsyncApi(std::string token,
+                   std::shared_ptr<EpollHttpClient> httpClient,
+                   std::string url)
+    : _url(std::move(url)),
+      _token(std::move(token)),
+      _methodUrl(_url + "/bot" + _token + "/"),
+      _httpClient(std::move(httpClient)),
+      _ctx(std::make_shared<TgBot::detail::ApiContext>(_methodUrl,
+                                                       _httpClient.get())),
+      _nextUpdateId(std::make_shared<std::atomic<std::int32_t>>(0)) {}
+
+Task<nlohmann::json> AsyncApi::call(std::string method,
+                                    HttpReqArg::Vec args) const {
+    co_return co_await perform(std::move(method), std::move(args), {});
+}
+
+Task<nlohmann::json> AsyncApi::perform(std::string method,
+                                       HttpReqArg::Vec args,
+                                       RequestOptions defaults) const {
+    TgBot::detail::ApiCall call(*_ctx, method, args, std::move(defaults));
+    while (true) {
+        const RequestOptions options = call.attempt();
+        Response response =
+            co_await ResponseAwaiter(*_httpClient, call.url(), args, options);
+        TgBot::detail::ApiCall::Step step =
+            call.complete(std::move(response.body), std::move(response.error));
+        if (step.result) {
+            co_return std::move(*step.result);
+        }
+        co_await SleepAwaiter(*_httpClient, step.delay);
+    }
+}
+
+Task<User::Ptr> AsyncApi::getMe() const {
+    co_return co_await request<User::Ptr>("getMe");
+}
+
+Task<std::vector<Update::Ptr>> AsyncApi::getUpdates(
+    std::optional<std::int32_t> offset, std::int32_t limit,
+    std::int32_t timeout) const {
+    HttpReqArg::Vec args;
+    if (offset) {
+        args.push_back(std::make_unique<HttpReqArg>("offset", *offset));
+    }
+    args.push_back(std::make_unique<HttpReqArg>(
+        "limit", std::clamp<std::int32_t>(limit, 1, 100)));
+    args.push_back(std::make_unique<HttpReqArg>("timeout", timeout));
+    // The server answers after [timeout] at the latest.
+    RequestOptions defaults;
+    defaults.timeout = std::chrono::seconds(timeout) + kLongPollMargin;
+    co_return convert<std::vector<Update::Ptr>>(co_await perform(
+        "getUpdates", std::move(args), std::move(defaults)));
+}
+
+Task<Message::Ptr> AsyncApi::sendMessage(
+    ChatIdType chatId, std::string text, std::optional<ParseMode> parseMode,
+    ReplyParameters::Ptr replyParameters,
+    GenericReply::Ptr replyMarkup) const {
+    HttpReqArg::Vec args;
+    addChatId(args, chatId);
+    args.push_back(std::make_unique<HttpReqArg>("text", text));
+    if (parseMode) {
+        args.push_back(std::make_unique<HttpReqArg>(
+            "parse_mode", parseModeName(*parseMode)));
+    }
+    if (replyParameters) {
+        args.push_back(std::make_unique<HttpReqArg>("reply_parameters",
+                                                    putJSON(replyParameters)));
+    }
+    if (replyMarkup) {
+        args.push_back(std::make_unique<HttpReqArg>("reply_markup",
+                                                    putJSON(replyMarkup)));
+    }
+    co_return co_await request<Message::Ptr>("sendMessage", std::move(args));
+}
+
+Task<Message::Ptr> AsyncApi::sendPhoto(ChatIdType chatId, FileHandleType photo,
+                                       std::string caption,
+                                       std::optional<ParseMode> parseMode,
+                                       GenericReply::Ptr replyMarkup) const {
+    HttpReqArg::Vec args;
+    addChatId(args, chatId);
+    addFile(args, "photo", photo);
+    addCaption(args, caption, parseMode, replyMarkup);
+    co_return co_await request<Message::Ptr>("sendPhoto", std::move(args));
+}
+
+Task<Message::Ptr> AsyncApi::sendDocument(
+    ChatIdType chatId, FileHandleType document, std::string caption,
+    std::optional<ParseMode> parseMode, GenericReply::Ptr replyMarkup) const {
+    HttpReqArg::Vec args;
+    addChatId(args, chatId);
+    addFile(args, "document", document);
+    addCaption(args, caption, parseMode, replyMarkup);
+    co_return co_await request<Message::Ptr>("sendDocument", std::move(args));
+}
+
+Task<bool> AsyncApi::answerCallbackQuery(std::string callbackQueryId,
+                                         std::string text,
+                                         bool showAlert) const {
+    HttpReqArg::Vec args;
+    args.push_back(
+        std::make_unique<HttpReqArg>("callback_query_id", callbackQueryId));
+    if (!text.empty()) {
+        args.push_back(std::make_unique<HttpReqArg>("text", text));
+    }
+    if (showAlert) {
+        args.push_back(std::make_unique<HttpReqArg>("show_alert", "true"));
+    }
+    co_return co_await request<bool>("answerCallbackQuery", std::move(args));
+}
+
+Task<bool> AsyncApi::deleteMessage(ChatIdType chatId,
+                                   std::int32_t messageId) const {
+    HttpReqArg::Vec args;
+    addChatId(args, chatId);
+    args.push_back(std::make_unique<HttpReqArg>("message_id", messageId));
+    co_return co_await request<bool>("deleteMessage", std::move(args));
+}
+
+Task<File::Ptr> AsyncApi::getFile(std::string fileId) const {
+    HttpReqArg::Vec args;
+    args.push_back(std::make_unique<HttpReqArg>("file_id", fileId));
+    co_return co_await request<File::Ptr>("getFile", std::move(args));
+}
+
+Task<std::string> AsyncApi::downloadFile(std::string filePath) const {
+    const std::string url = _url + "/file/bot" + _token + "/" + filePath;
+    const HttpReqArg::Vec args;
+    Response response = co_await ResponseAwaiter(*_httpClient, url, args);
+    if (response.error) {
+        std::rethrow_exception(response.error);
+    }
+    co_return std::move(response.body);
+}
+
+AsyncGenerator<Update::Ptr> AsyncApi::updates(std::int32_t limit,
+                                              std::int32_t timeout) const {
+    while (true) {
+        std::vector<Update::Ptr> batch =
+            co_await getUpdates(_nextUpdateId->load(), limit, timeout);
+        for (auto& update : batch) {
+            const std::int32_t next = update->updateId + 1;
+            co_yield std::move(update);
+            // Resumed: the consumer is done with the update.
+            std::int32_t current = _nextUpdateId->load();
+            while (current < next &&
+                   !_nextUpdateId->compare_exchange_weak(current, next)) {
+            }
+        }
+    }
+}
+
+Task<void> AsyncApi::sleep(std::chrono::milliseconds delay) const {
+    co_await SleepAwaiter(*_httpClient, delay);
+}
+
+}  // namespace TgBot::coro
@@ -0,0 +1,29 @@
+#include "tgbot/coro/Task.h"
+
+#include <exception>
+
+#include "tgbot/Logger.h"
+
+namespace TgBot::coro {
+
+namespace {
+
+detail::Detached run(Task<void> task) {
+    try {
+        co_await std::move(task);
+    } catch (const std::exception& e) {
+        TgBot::detail::log(LogLevel::Error, "Spawned task failed",
+                           {{"error", e.what()}});
+    } catch (...) {
+        TgBot::detail::log(LogLevel::Error, "Spawned task failed",
+                           {{"error", "unknown exception"}});
+    }
+}
+
+}  // namespace
+
+void spawn(Task<void> task) {
+    run(std::move(task));
+}
+
+}  // namespace TgBot::coro
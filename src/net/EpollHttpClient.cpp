@@ -0,0 +1,1513 @@
+#ifdef __linux__
+
+#include "tgbot/net/EpollHttpClient.h"
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "tgbot/TgException.h"
+#include "tgbot/tools/StringTools.h"
+
+namespace TgBot {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Callback = EpollHttpClient::Callback;
+
+// Where the requests to one "protocol://host[:port]" go.
+struct Endpoint {
+    std::string host;
+    std::string port;
+    bool tls = false;
+};
+
+// The resolver's and the address cache's key for an endpoint.
+std::string nameOf(const Endpoint& endpoint) {
+    return endpoint.host + ":" + endpoint.port;
+}
+
+Endpoint endpointOf(const Url& url) {
+    Endpoint endpoint;
+    endpoint.tls = url.protocol == "https";
+    const auto colon = url.host.rfind(':');
+    if (colon != std::string::npos &&
+        url.host.find(']', colon) == std::string::npos) {
+        endpoint.host = url.host.substr(0, colon);
+        endpoint.port = url.host.substr(colon + 1);
+    } else {
+        endpoint.host = url.host;
+        endpoint.port = endpoint.tls ? "443" : "80";
+    }
+    // IPv6 literal, e.g. [::1]:8080.
+    if (endpoint.host.size() > 2 && endpoint.host.front() == '[' &&
+        endpoint.host.back() == ']') {
+        endpoint.host = endpoint.host.substr(1, endpoint.host.size() - 2);
+    }
+    return endpoint;
+}
+
+std::string boundaryToken() {
+    thread_local std::mt19937_64 random{std::random_device{}()};
+    static constexpr char kHex[] = "0123456789abcdef";
+    std::string token(24, '0');
+    for (char& c : token) {
+        c = kHex[random() % 16];
+    }
+    return token;
+}
+
+// The complete HTTP/1.1 request, headers and body, for makeRequest()'s url
+// and args.
+std::string serialize(const Url& url, const HttpReqArg::Vec& args) {
+    std::string target = url.path.empty() ? "/" : url.path;
+    std::string contentType;
+    std::string body;
+    if (args.empty()) {
+        if (!url.query.empty()) {
+            target += "?" + url.query;
+        }
+    } else if (std::any_of(args.begin(), args.end(),
+                           [](const auto& arg) { return arg->isFile(); })) {
+        const std::string boundary = "tgbot-" + boundaryToken();
+        for (const auto& arg : args) {
+            body += "--" + boundary +
+                    "\r\nContent-Disposition: form-data; name=\"" +
+                    arg->name + "\"";
+            if (arg->isFile()) {
+                const auto* file = static_cast<const HttpReqArgFile*>(arg.get());
+                body += "; filename=\"" + file->fileName +
+                        "\"\r\nContent-Type: " +
+                        (file->mimeType.empty() ? "application/octet-stream"
+                                                : file->mimeType);
+            }
+            body += "\r\n\r\n";
+            body += arg->value;
+            body += "\r\n";
+        }
+        body += "--" + boundary + "--\r\n";
+        contentType = "multipart/form-data; boundary=" + boundary;
+    } else {
+        for (const auto& arg : args) {
+            if (!body.empty()) {
+                body += '&';
+            }
+            body += StringTools::urlEncode(arg->name);
+            body += '=';
+            body += StringTools::urlEncode(arg->value);
+        }
+        contentType = "application/x-www-form-urlencoded";
+    }
+
+    std::string request;
+    request.reserve(256 + body.size());
+    request += args.empty() ? "GET " : "POST ";
+    request += target;
+    request += " HTTP/1.1\r\nHost: ";
+    request += url.host;
+    request += "\r\nAccept: */*\r\nConnection: keep-alive\r\n";
+    if (!args.empty()) {
+        request += "Content-Type: " + contentType + "\r\n";
+        request += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+    }
+    request += "\r\n";
+    request += body;
+    return request;
+}
+
+// Incremental HTTP/1.1 response parser: Content-Length, chunked and
+// close-delimited bodies.
+class ResponseParser {
+   public:
+    int status = 0;
+    bool keepAlive = true;
+    std::string body;
+
+    // Consumes @p size bytes; returns true once the response is complete.
+    bool feed(const char* data, std::size_t size) {
+        _received = true;
+        _buffer.append(data, size);
+        while (_stage != Stage::Done) {
+            if (!step()) {
+                break;
+            }
+        }
+        if (_pos > 0 && _pos == _buffer.size()) {
+            _buffer.clear();
+            _pos = 0;
+        }
+        return _stage == Stage::Done;
+    }
+
+    // The peer closed the connection; returns whether that ends the response.
+    bool finishOnClose() {
+        if (_stage == Stage::UntilClose) {
+            _stage = Stage::Done;
+        }
+        return _stage == Stage::Done;
+    }
+
+    // Whether any byte of the response arrived.
+    [[nodiscard]] bool started() const { return _received; }
+
+   private:
+    enum class Stage {
+        Head,
+        Body,
+        UntilClose,
+        ChunkSize,
+        ChunkData,
+        ChunkEnd,
+        Trailer,
+        Done
+    };
+
+    // Advances by one stage; returns false when more input is needed.
+    bool step() {
+        switch (_stage) {
+            case Stage::Head:
+                return parseHead();
+            case Stage::Body:
+            case Stage::ChunkData: {
+                const std::size_t n =
+                    std::min(_remaining, _buffer.size() - _pos);
+                body.append(_buffer, _pos, n);
+                _pos += n;
+                _remaining -= n;
+                if (_remaining > 0) {
+                    return false;
+                }
+                _stage =
+                    _stage == Stage::Body ? Stage::Done : Stage::ChunkEnd;
+                return true;
+            }
+            case Stage::UntilClose:
+                body.append(_buffer, _pos, std::string::npos);
+                _pos = _buffer.size();
+                return false;
+            case Stage::ChunkSize: {
+                const auto end = _buffer.find("\r\n", _pos);
+                if (end == std::string::npos) {
+                    return false;
+                }
+                _remaining = std::strtoull(_buffer.c_str() + _pos, nullptr, 16);
+                _pos = end + 2;
+                _stage = _remaining == 0 ? Stage::Trailer : Stage::ChunkData;
+                return true;
+            }
+            case Stage::ChunkEnd:
+                if (_buffer.size() - _pos < 2) {
+                    return false;
+                }
+                _pos += 2;
+                _stage = Stage::ChunkSize;
+                return true;
+            case Stage::Trailer: {
+                const auto end = _buffer.find("\r\n", _pos);
+                if (end == std::string::npos) {
+                    return false;
+                }
+                if (end == _pos) {
+                    _stage = Stage::Done;
+                }
+                _pos = end + 2;
+                return true;
+            }
+            case Stage::Done:
+                return false;
+        }
+        return false;
+    }
+
+    bool parseHead() {
+        const auto end = _buffer.find("\r\n\r\n", _pos);
+        if (end == std::string::npos) {
+            return false;
+        }
+        const std::string head = _buffer.substr(_pos, end - _pos);
+        _pos = end + 4;
+
+        const auto lineEnd = head.find("\r\n");
+        const std::string statusLine = head.substr(0, lineEnd);
+        const auto space = statusLine.find(' ');
+        if (space == std::string::npos) {
+            throw NetworkException(NetworkException::State::Read,
+                                   "Malformed HTTP status line");
+        }
+        const std::string version = statusLine.substr(0, space);
+        status = std::atoi(statusLine.c_str() + space + 1);
+
+        std::string connection;
+        std::string transferEncoding;
+        std::optional<std::size_t> contentLength;
+        std::size_t lineStart =
+            lineEnd == std::string::npos ? head.size() : lineEnd + 2;
+        while (lineStart < head.size()) {
+            auto next = head.find("\r\n", lineStart);
+            if (next == std::string::npos) {
+                next = head.size();
+            }
+            const std::string line = head.substr(lineStart, next - lineStart);
+            lineStart = next + 2;
+            const auto colon = line.find(':');
+            if (colon == std::string::npos) {
+                continue;
+            }
+            std::string name = line.substr(0, colon);
+            std::transform(name.begin(), name.end(), name.begin(),
+                           [](unsigned char c) {
+                               return static_cast<char>(std::tolower(c));
+                           });
+            std::string value = line.substr(colon + 1);
+            value.erase(0, value.find_first_not_of(" \t"));
+            std::transform(value.begin(), value.end(), value.begin(),
+                           [](unsigned char c) {
+                               return static_cast<char>(std::tolower(c));
+                           });
+            if (name == "content-length") {
+                contentLength = std::strtoull(value.c_str(), nullptr, 10);
+            } else if (name == "transfer-encoding") {
+                transferEncoding = value;
+            } else if (name == "connection") {
+                connection = value;
+            }
+        }
+
+        keepAlive = version == "HTTP/1.1" ? connection != "close"
+                                          : connection == "keep-alive";
+        if (status >= 100 && status < 200) {
+            // Interim response; the real one follows.
+            status = 0;
+            return true;
+        }
+        if (transferEncoding.find("chunked") != std::string::npos) {
+            _stage = Stage::ChunkSize;
+        } else if (contentLength) {
+            _remaining = *contentLength;
+            _stage = Stage::Body;
+        } else if (status == 204 || status == 304) {
+            _stage = Stage::Done;
+        } else {
+            keepAlive = false;
+            _stage = Stage::UntilClose;
+        }
+        return true;
+    }
+
+    Stage _stage = Stage::Head;
+    bool _received = false;
+    std::string _buffer;
+    std::size_t _pos = 0;
+    std::size_t _remaining = 0;
+};
+
+// One address a host name resolved to.
+struct Address {
+    int family = AF_UNSPEC;
+    sockaddr_storage storage{};
+    socklen_t length = 0;
+};
+using Addresses = std::vector<Address>;
+
+// How long resolved addresses are used before the name is looked up again,
+// so that DNS changes are picked up by long-running clients.
+constexpr std::chrono::seconds kAddressTtl{60};
+
+// Kept-alive connections idle for longer are closed, rather than held open
+// until the server drops them.
+constexpr std::chrono::seconds kIdleTimeout{30};
+
+// Looks host names up with getaddrinfo(), which blocks, on a thread of its
+// own so that a slow DNS server does not hold up an event loop. The thread
+// is detached: destroying the Resolver never waits for a lookup, whose
+// result is then dropped.
+class Resolver {
+   public:
+    using Done = std::function<void(std::shared_ptr<const Addresses>,
+                                    std::exception_ptr)>;
+
+    Resolver() = default;
+    Resolver(const Resolver&) = delete;
+    Resolver& operator=(const Resolver&) = delete;
+
+    ~Resolver() {
+        {
+            std::lock_guard<std::mutex> lock(_state->mutex);
+            _state->stopping = true;
+        }
+        _state->wake.notify_one();
+    }
+
+    // Calls @p done on the resolver thread with the addresses of
+    // @p endpoint, or the exception the lookup failed with.
+    void resolve(Endpoint endpoint, Done done) {
+        {
+            std::lock_guard<std::mutex> lock(_state->mutex);
+            if (!_state->started) {
+                std::thread([state = _state] { run(*state); }).detach();
+                _state->started = true;
+            }
+            _state->queue.emplace_back(std::move(endpoint), std::move(done));
+        }
+        _state->wake.notify_one();
+    }
+
+   private:
+    struct State {
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::deque<std::pair<Endpoint, Done>> queue;
+        bool started = false;
+        bool stopping = false;
+    };
+
+    static void run(State& state) {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        while (true) {
+            state.wake.wait(lock, [&state] {
+                return state.stopping || !state.queue.empty();
+            });
+            if (state.stopping) {
+                return;
+            }
+            auto [endpoint, done] = std::move(state.queue.front());
+            state.queue.pop_front();
+            lock.unlock();
+
+            std::shared_ptr<const Addresses> addresses;
+            std::exception_ptr error;
+            try {
+                addresses = lookup(endpoint);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            // Handed over under the lock, so that nothing reaches the loops
+            // once ~Resolver() returned.
+            lock.lock();
+            if (state.stopping) {
+                return;
+            }
+            done(std::move(addresses), std::move(error));
+        }
+    }
+
+    static std::shared_ptr<const Addresses> lookup(const Endpoint& endpoint) {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* result = nullptr;
+        const int rc = ::getaddrinfo(endpoint.host.c_str(),
+                                     endpoint.port.c_str(), &hints, &result);
+        if (rc != 0) {
+            throw NetworkException(NetworkException::State::Connect,
+                                   "Resolving " + endpoint.host + ": " +
+                                       ::gai_strerror(rc));
+        }
+        auto addresses = std::make_shared<Addresses>();
+        for (const addrinfo* it = result; it; it = it->ai_next) {
+            if (it->ai_addrlen > sizeof(sockaddr_storage)) {
+                continue;
+            }
+            Address address;
+            address.family = it->ai_family;
+            std::memcpy(&address.storage, it->ai_addr, it->ai_addrlen);
+            address.length = it->ai_addrlen;
+            addresses->push_back(address);
+        }
+        ::freeaddrinfo(result);
+        if (addresses->empty()) {
+            throw NetworkException(NetworkException::State::Connect,
+                                   "Resolving " + endpoint.host +
+                                       ": no addresses");
+        }
+        return addresses;
+    }
+
+    std::shared_ptr<State> _state = std::make_shared<State>();
+};
+
+// A request waiting for or using a connection.
+struct Pending {
+    std::uint64_t id = 0;
+    Endpoint endpoint;
+    std::string key;
+    std::string payload;
+    Callback callback;
+    Clock::time_point deadline;
+    // The deadline is the caller's whole budget (RequestOptions::timeout),
+    // so running out of it is final.
+    bool budgeted = false;
+    std::optional<Clock::duration> connectTimeout;
+    CancellationToken cancellation;
+    CancellationToken::Registration onCancel;
+    RequestPriority priority = RequestPriority::Normal;
+    // Already retried once after a kept-alive connection turned out closed.
+    bool retried = false;
+};
+
+struct Connection {
+    enum class State {
+        Resolving,
+        Connecting,
+        Handshaking,
+        Writing,
+        Reading,
+        Idle
+    };
+
+    // Identifies the connection in epoll events; unlike the fd, it is never
+    // reused, so a stale event cannot reach a newer connection.
+    std::uint64_t id = 0;
+    int fd = -1;
+    SSL* ssl = nullptr;
+    std::string key;
+    State state = State::Resolving;
+    // Set while connecting when the request has a connect timeout.
+    std::optional<Clock::time_point> connectDeadline;
+    // Where the host resolved to; connecting goes through them in order.
+    std::shared_ptr<const Addresses> addresses;
+    std::size_t nextAddress = 0;
+    // When the connection last became idle.
+    Clock::time_point idleSince;
+    std::unique_ptr<Pending> request;
+    std::size_t written = 0;
+    ResponseParser parser;
+    // Served an earlier request, so the peer may have closed it meanwhile.
+    bool reused = false;
+
+    Connection() = default;
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    ~Connection() {
+        if (ssl) {
+            SSL_free(ssl);
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+};
+
+// The loop running on this thread, if any.
+thread_local const void* currentLoop = nullptr;
+
+std::string sslError() {
+    const unsigned long code = ERR_get_error();
+    if (code == 0) {
+        return std::strerror(errno);
+    }
+    char buffer[256];
+    ERR_error_string_n(code, buffer, sizeof(buffer));
+    ERR_clear_error();
+    return buffer;
+}
+
+}  // namespace
+
+struct EpollHttpClient::Impl {
+    class Loop;
+
+    Impl(const EpollHttpClient& owner, std::size_t maxConnectionsPerHost,
+         std::size_t interactiveConnectionsPerHost, std::size_t loopThreads);
+    ~Impl();
+
+    // Created on first use, so that HttpClient::setServerCert() may be
+    // called after construction.
+    SSL_CTX* sslContext() {
+        std::call_once(sslOnce, [this] {
+            sslCtx = SSL_CTX_new(TLS_client_method());
+            if (!sslCtx) {
+                throw NetworkException(NetworkException::State::Handshake,
+                                       "SSL_CTX_new: " + sslError());
+            }
+            SSL_CTX_set_verify(sslCtx, SSL_VERIFY_PEER, nullptr);
+            SSL_CTX_set_mode(sslCtx, SSL_MODE_ENABLE_PARTIAL_WRITE |
+                                         SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+            const auto cert = owner.getServerCert();
+            const bool loaded =
+                cert ? SSL_CTX_load_verify_locations(
+                           sslCtx, cert->string().c_str(), nullptr) == 1
+                     : SSL_CTX_set_default_verify_paths(sslCtx) == 1;
+            if (!loaded) {
+                throw NetworkException(NetworkException::State::Handshake,
+                                       "Loading CA certificates: " +
+                                           sslError());
+            }
+        });
+        return sslCtx;
+    }
+
+    const EpollHttpClient& owner;
+    const std::size_t maxConnectionsPerHost;
+    const std::size_t interactiveConnectionsPerHost;
+    std::once_flag sslOnce;
+    SSL_CTX* sslCtx = nullptr;
+    // Reset before the loops go, so that no lookup reaches them after.
+    std::unique_ptr<Resolver> resolver = std::make_unique<Resolver>();
+    std::vector<std::unique_ptr<Loop>> loops;
+    std::atomic<std::size_t> nextLoop{0};
+    std::atomic<std::uint64_t> nextRequestId{1};
+};
+
+class EpollHttpClient::Impl::Loop {
+   public:
+    explicit Loop(Impl& impl) : _impl(impl) {
+        _epoll = ::epoll_create1(EPOLL_CLOEXEC);
+        _wake = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (_epoll < 0 || _wake < 0) {
+            const std::string error = std::strerror(errno);
+            closeFds();
+            throw std::runtime_error("EpollHttpClient: " + error);
+        }
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = kWakeId;
+        ::epoll_ctl(_epoll, EPOLL_CTL_ADD, _wake, &event);
+        _thread = std::thread([this] { run(); });
+    }
+
+    ~Loop() {
+        {
+            std::lock_guard<std::mutex> lock(_inboxMutex);
+            _stopping = true;
+        }
+        wake();
+        _thread.join();
+        closeFds();
+    }
+
+    Loop(const Loop&) = delete;
+    Loop& operator=(const Loop&) = delete;
+
+    void submit(std::unique_ptr<Pending> pending) {
+        {
+            std::lock_guard<std::mutex> lock(_inboxMutex);
+            _inbox.push_back(std::move(pending));
+        }
+        wake();
+    }
+
+    // Aborts request @p id wherever it is; does nothing once it completed.
+    void cancel(std::uint64_t id) {
+        {
+            std::lock_guard<std::mutex> lock(_inboxMutex);
+            _cancelInbox.push_back(id);
+        }
+        wake();
+    }
+
+    void schedule(Clock::time_point due, std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(_inboxMutex);
+            _timerInbox.emplace_back(due, std::move(task));
+        }
+        wake();
+    }
+
+   private:
+    static constexpr std::uint64_t kWakeId = 0;
+
+    // Connections of one host. Requests holding one are busy; those outside
+    // the interactive lane may only use the first maxConnectionsPerHost.
+    struct Host {
+        std::vector<Connection*> idle;
+        std::size_t busy = 0;
+        std::size_t sharedBusy = 0;
+        // Waiting requests by RequestPriority.
+        std::array<std::deque<std::unique_ptr<Pending>>, 3> queued;
+    };
+
+    void closeFds() {
+        if (_wake >= 0) {
+            ::close(_wake);
+        }
+        if (_epoll >= 0) {
+            ::close(_epoll);
+        }
+    }
+
+    void wake() const {
+        const std::uint64_t one = 1;
+        [[maybe_unused]] const auto n = ::write(_wake, &one, sizeof(one));
+    }
+
+    void run() {
+        currentLoop = this;
+        // A peer closing a TLS connection must not kill the process with
+        // SIGPIPE; plain sockets use MSG_NOSIGNAL instead.
+        sigset_t pipe;
+        sigemptyset(&pipe);
+        sigaddset(&pipe, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &pipe, nullptr);
+
+        std::vector<epoll_event> events(64);
+        while (true) {
+            const int ready = ::epoll_wait(_epoll, events.data(),
+                                           static_cast<int>(events.size()),
+                                           waitTimeout());
+            for (int i = 0; i < ready; ++i) {
+                const std::uint64_t id = events[i].data.u64;
+                if (id == kWakeId) {
+                    std::uint64_t count;
+                    [[maybe_unused]] const auto n =
+                        ::read(_wake, &count, sizeof(count));
+                    continue;
+                }
+                // An earlier event of this batch may have closed it.
+                const auto it = _connections.find(id);
+                if (it != _connections.end()) {
+                    advance(*it->second);
+                }
+            }
+            if (!drainInbox()) {
+                break;
+            }
+            expire();
+            runTimers();
+        }
+        abandonAll();
+    }
+
+    // Dispatches newly submitted requests; returns false once stopping.
+    bool drainInbox() {
+        std::deque<std::unique_ptr<Pending>> inbox;
+        std::vector<std::pair<Clock::time_point, std::function<void()>>> timers;
+        std::vector<std::uint64_t> cancels;
+        {
+            std::lock_guard<std::mutex> lock(_inboxMutex);
+            if (_stopping) {
+                return false;
+            }
+            inbox.swap(_inbox);
+            timers.swap(_timerInbox);
+            cancels.swap(_cancelInbox);
+        }
+        for (auto& pending : inbox) {
+            dispatch(std::move(pending));
+        }
+        for (const std::uint64_t id : cancels) {
+            abort(id);
+        }
+        for (auto& timer : timers) {
+            _timers.emplace(timer.first, std::move(timer.second));
+        }
+        return true;
+    }
+
+    void dispatch(std::unique_ptr<Pending> pending) {
+        // Cancelled before its cancel() could find it here.
+        if (pending->cancellation.cancelled()) {
+            complete(std::move(pending), {}, cancelled());
+            return;
+        }
+        Host& host = _hosts[pending->key];
+        const auto lane = static_cast<std::size_t>(pending->priority);
+        bool ahead = false;
+        for (std::size_t higher = 0; higher <= lane; ++higher) {
+            ahead = ahead || !host.queued[higher].empty();
+        }
+        if (ahead || !hasRoom(host, pending->priority)) {
+            host.queued[lane].push_back(std::move(pending));
+            return;
+        }
+        start(host, std::move(pending));
+    }
+
+    void start(Host& host, std::unique_ptr<Pending> pending) {
+        ++host.busy;
+        if (pending->priority != RequestPriority::Interactive) {
+            ++host.sharedBusy;
+        }
+        if (!host.idle.empty()) {
+            Connection* connection = host.idle.back();
+            host.idle.pop_back();
+            begin(*connection, std::move(pending));
+        } else {
+            open(std::move(pending));
+        }
+    }
+
+    bool hasRoom(const Host& host, RequestPriority priority) const {
+        return host.busy < _impl.maxConnectionsPerHost +
+                               _impl.interactiveConnectionsPerHost &&
+               (priority == RequestPriority::Interactive ||
+                host.sharedBusy < _impl.maxConnectionsPerHost);
+    }
+
+    // Takes the request off @p connection and frees its place on the host.
+    std::unique_ptr<Pending> detach(Connection& connection) {
+        auto pending = std::move(connection.request);
+        if (pending) {
+            vacate(_hosts[connection.key], *pending);
+        }
+        return pending;
+    }
+
+    static void vacate(Host& host, const Pending& pending) {
+        --host.busy;
+        if (pending.priority != RequestPriority::Interactive) {
+            --host.sharedBusy;
+        }
+    }
+
+    // Starts queued requests of @p key, highest priority first, while there
+    // is room.
+    void pump(const std::string& key) {
+        const auto it = _hosts.find(key);
+        if (it == _hosts.end()) {
+            return;
+        }
+        Host& host = it->second;
+        for (auto& queue : host.queued) {
+            while (!queue.empty() && hasRoom(host, queue.front()->priority)) {
+                auto pending = std::move(queue.front());
+                queue.pop_front();
+                if (pending->cancellation.cancelled()) {
+                    complete(std::move(pending), {}, cancelled());
+                } else {
+                    start(host, std::move(pending));
+                }
+            }
+            if (!queue.empty()) {
+                break;
+            }
+        }
+    }
+
+    // Opens a connection for @p pending, resolving its host first unless
+    // the addresses are cached.
+    void open(std::unique_ptr<Pending> pending) {
+        auto owned = std::make_unique<Connection>();
+        Connection& connection = *owned;
+        connection.id = _nextId++;
+        connection.key = pending->key;
+        if (pending->connectTimeout) {
+            connection.connectDeadline =
+                Clock::now() + *pending->connectTimeout;
+        }
+        connection.request = std::move(pending);
+        _connections.emplace(connection.id, std::move(owned));
+
+        const Endpoint& endpoint = connection.request->endpoint;
+        const std::string name = nameOf(endpoint);
+        if (const auto it = _addresses.find(name);
+            it != _addresses.end() && it->second.expires > Clock::now()) {
+            connection.addresses = it->second.addresses;
+            return connectNext(connection, {});
+        }
+        auto& waiting = _resolving[name];
+        waiting.push_back(connection.id);
+        if (waiting.size() > 1) {
+            return;  // the lookup is under way
+        }
+        _impl.resolver->resolve(
+            endpoint, [this, name](std::shared_ptr<const Addresses> addresses,
+                                   std::exception_ptr error) {
+                schedule(Clock::now(), [this, name, addresses, error] {
+                    resolved(name, addresses, error);
+                });
+            });
+    }
+
+    // Goes on with the connections that waited for @p name to resolve.
+    void resolved(const std::string& name,
+                  const std::shared_ptr<const Addresses>& addresses,
+                  const std::exception_ptr& error) {
+        const auto it = _resolving.find(name);
+        if (it == _resolving.end()) {
+            return;
+        }
+        const std::vector<std::uint64_t> waiting = std::move(it->second);
+        _resolving.erase(it);
+        if (addresses) {
+            _addresses[name] = {addresses, Clock::now() + kAddressTtl};
+        }
+        for (const std::uint64_t id : waiting) {
+            // Timed out or cancelled meanwhile.
+            const auto connection = _connections.find(id);
+            if (connection == _connections.end() ||
+                connection->second->state != Connection::State::Resolving) {
+                continue;
+            }
+            if (!error) {
+                connection->second->addresses = addresses;
+                connectNext(*connection->second, {});
+                continue;
+            }
+            try {
+                std::rethrow_exception(error);
+            } catch (const NetworkException& e) {
+                fail(*connection->second, e.state, e.what());
+            }
+        }
+    }
+
+    // Connects to the next address of the host, skipping those that fail at
+    // once, and fails the request with @p lastError once none is left.
+    void connectNext(Connection& connection, std::string lastError) {
+        const Endpoint& endpoint = connection.request->endpoint;
+        const Addresses& addresses = *connection.addresses;
+        while (connection.nextAddress < addresses.size()) {
+            const Address& address = addresses[connection.nextAddress++];
+            closeSocket(connection);
+            connection.fd = ::socket(
+                address.family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if (connection.fd < 0) {
+                lastError = std::string("socket: ") + std::strerror(errno);
+                continue;
+            }
+            const int yes = 1;
+            ::setsockopt(connection.fd, IPPROTO_TCP, TCP_NODELAY, &yes,
+                         sizeof(yes));
+            if (::connect(connection.fd,
+                          reinterpret_cast<const sockaddr*>(&address.storage),
+                          address.length) != 0 &&
+                errno != EINPROGRESS) {
+                lastError = "Connecting to " + endpoint.host + ": " +
+                            std::strerror(errno);
+                continue;
+            }
+            connection.state = Connection::State::Connecting;
+            epoll_event event{};
+            event.events = EPOLLOUT;
+            event.data.u64 = connection.id;
+            ::epoll_ctl(_epoll, EPOLL_CTL_ADD, connection.fd, &event);
+            if (connection.request->connectTimeout) {
+                connection.connectDeadline =
+                    Clock::now() + *connection.request->connectTimeout;
+            }
+            return;
+        }
+        // The host may have moved: look it up again next time.
+        _addresses.erase(nameOf(endpoint));
+        fail(connection, NetworkException::State::Connect,
+             lastError.empty() ? "Connecting to " + endpoint.host + " failed"
+                               : lastError);
+    }
+
+    [[nodiscard]] static bool hasNextAddress(const Connection& connection) {
+        return connection.addresses &&
+               connection.nextAddress < connection.addresses->size();
+    }
+
+    void closeSocket(Connection& connection) {
+        if (connection.fd >= 0) {
+            ::epoll_ctl(_epoll, EPOLL_CTL_DEL, connection.fd, nullptr);
+            ::close(connection.fd);
+            connection.fd = -1;
+        }
+    }
+
+    void begin(Connection& connection, std::unique_ptr<Pending> pending) {
+        connection.request = std::move(pending);
+        connection.state = Connection::State::Writing;
+        connection.written = 0;
+        connection.parser = ResponseParser();
+        advance(connection);
+    }
+
+    void watch(Connection& connection, std::uint32_t events) {
+        epoll_event event{};
+        event.events = events;
+        event.data.u64 = connection.id;
+        ::epoll_ctl(_epoll, EPOLL_CTL_MOD, connection.fd, &event);
+    }
+
+    // Waits for the socket to become readable or writable as the last SSL
+    // call asked, or fails the request.
+    void sslWait(Connection& connection, int result,
+                 NetworkException::State state) {
+        switch (SSL_get_error(connection.ssl, result)) {
+            case SSL_ERROR_WANT_READ:
+                watch(connection, EPOLLIN);
+                return;
+            case SSL_ERROR_WANT_WRITE:
+                watch(connection, EPOLLOUT);
+                return;
+            default:
+                fail(connection, state, "TLS: " + sslError());
+        }
+    }
+
+    // Moves the connection's state machine as far as the socket allows.
+    void advance(Connection& connection) {
+        using State = Connection::State;
+        try {
+            while (true) {
+                switch (connection.state) {
+                    case State::Resolving:
+                        // No socket yet; resolved() goes on from here.
+                        return;
+                    case State::Connecting: {
+                        int error = 0;
+                        socklen_t length = sizeof(error);
+                        ::getsockopt(connection.fd, SOL_SOCKET, SO_ERROR,
+                                     &error, &length);
+                        if (error != 0) {
+                            return connectNext(
+                                connection,
+                                "Connecting to " +
+                                    connection.request->endpoint.host + ": " +
+                                    std::strerror(error));
+                        }
+                        if (connection.request->endpoint.tls) {
+                            startTls(connection);
+                            connection.state = State::Handshaking;
+                        } else {
+                            connection.state = State::Writing;
+                            connection.connectDeadline.reset();
+                        }
+                        break;
+                    }
+                    case State::Handshaking: {
+                        const int result = SSL_do_handshake(connection.ssl);
+                        if (result != 1) {
+                            return sslWait(connection, result,
+                                           NetworkException::State::Handshake);
+                        }
+                        connection.state = State::Writing;
+                        connection.connectDeadline.reset();
+                        break;
+                    }
+                    case State::Writing:
+                        if (!write(connection)) {
+                            return;
+                        }
+                        connection.state = State::Reading;
+                        break;
+                    case State::Reading:
+                        read(connection);
+                        return;
+                    case State::Idle:
+                        // The peer closed the kept-alive connection or sent
+                        // something unasked.
+                        return close(connection);
+                }
+            }
+        } catch (const NetworkException& e) {
+            fail(connection, e.state, e.what());
+        }
+    }
+
+    void startTls(Connection& connection) {
+        const Endpoint& endpoint = connection.request->endpoint;
+        connection.ssl = SSL_new(_impl.sslContext());
+        if (!connection.ssl) {
+            throw NetworkException(NetworkException::State::Handshake,
+                                   "SSL_new: " + sslError());
+        }
+        SSL_set_fd(connection.ssl, connection.fd);
+        SSL_set_connect_state(connection.ssl);
+        in6_addr ip;
+        if (::inet_pton(AF_INET, endpoint.host.c_str(), &ip) == 1 ||
+            ::inet_pton(AF_INET6, endpoint.host.c_str(), &ip) == 1) {
+            X509_VERIFY_PARAM_set1_ip_asc(SSL_get0_param(connection.ssl),
+                                          endpoint.host.c_str());
+        } else {
+            SSL_set_tlsext_host_name(connection.ssl, endpoint.host.c_str());
+            SSL_set1_host(connection.ssl, endpoint.host.c_str());
+        }
+    }
+
+    // Returns true once the whole request is written.
+    bool write(Connection& connection) {
+        const std::string& payload = connection.request->payload;
+        while (connection.written < payload.size()) {
+            const char* data = payload.data() + connection.written;
+            const std::size_t size = payload.size() - connection.written;
+            if (connection.ssl) {
+                const int n = SSL_write(
+                    connection.ssl, data,
+                    static_cast<int>(std::min<std::size_t>(size, 1 << 30)));
+                if (n <= 0) {
+                    sslWait(connection, n, NetworkException::State::Write);
+                    return false;
+                }
+                connection.written += static_cast<std::size_t>(n);
+            } else {
+                const ssize_t n =
+                    ::send(connection.fd, data, size, MSG_NOSIGNAL);
+                if (n < 0) {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                        watch(connection, EPOLLOUT);
+                    } else if (errno != EINTR) {
+                        fail(connection, NetworkException::State::Write,
+                             std::string("send: ") + std::strerror(errno));
+                    }
+                    if (errno != EINTR) {
+                        return false;
+                    }
+                    continue;
+                }
+                connection.written += static_cast<std::size_t>(n);
+            }
+        }
+        return true;
+    }
+
+    void read(Connection& connection) {
+        char buffer[16384];
+        while (true) {
+            ssize_t n;
+            if (connection.ssl) {
+                n = SSL_read(connection.ssl, buffer, sizeof(buffer));
+                if (n <= 0) {
+                    const int error = SSL_get_error(connection.ssl, n);
+                    if (error != SSL_ERROR_ZERO_RETURN &&
+                        error != SSL_ERROR_SYSCALL) {
+                        return sslWait(connection, static_cast<int>(n),
+                                       NetworkException::State::Read);
+                    }
+                    n = 0;
+                }
+            } else {
+                n = ::recv(connection.fd, buffer, sizeof(buffer), 0);
+                if (n < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                        return watch(connection, EPOLLIN);
+                    }
+                    return fail(connection, NetworkException::State::Read,
+                                std::string("recv: ") + std::strerror(errno));
+                }
+            }
+            if (n == 0) {
+                if (connection.parser.finishOnClose()) {
+                    connection.parser.keepAlive = false;
+                    return respond(connection);
+                }
+                return fail(connection, NetworkException::State::Read,
+                            "Connection closed by " +
+                                connection.request->endpoint.host);
+            }
+            if (connection.parser.feed(buffer, static_cast<std::size_t>(n))) {
+                return respond(connection);
+            }
+        }
+    }
+
+    // The response is complete: hands the connection back and the body to
+    // the caller. Like HttplibClient, error statuses with a body (Telegram's
+    // JSON errors) are returned for the Api layer to parse.
+    void respond(Connection& connection) {
+        auto pending = detach(connection);
+        ResponseParser parser = std::move(connection.parser);
+        connection.parser = ResponseParser();
+        const std::string key = connection.key;
+        if (parser.keepAlive) {
+            connection.state = Connection::State::Idle;
+            connection.reused = true;
+            connection.idleSince = Clock::now();
+            watch(connection, EPOLLIN | EPOLLRDHUP);
+            _hosts[key].idle.push_back(&connection);
+        } else {
+            close(connection);
+        }
+
+        if ((parser.status >= 200 && parser.status < 300) ||
+            !parser.body.empty()) {
+            complete(std::move(pending), std::move(parser.body), nullptr);
+        } else {
+            auto error = std::make_exception_ptr(NetworkException(
+                NetworkException::State::Read,
+                "HTTP status " + std::to_string(parser.status) + " from " +
+                    pending->endpoint.host));
+            complete(std::move(pending), {}, std::move(error));
+        }
+        pump(key);
+    }
+
+    void fail(Connection& connection, NetworkException::State state,
+              const std::string& message) {
+        auto pending = detach(connection);
+        // A kept-alive connection the peer closed before it saw the request
+        // is not an error of the request: send it once more on a new one.
+        const bool retry = pending && connection.reused && !pending->retried &&
+                           !connection.parser.started() &&
+                           (state == NetworkException::State::Write ||
+                            state == NetworkException::State::Read);
+        const std::string key = connection.key;
+        close(connection);
+        if (pending) {
+            if (retry) {
+                pending->retried = true;
+                dispatch(std::move(pending));
+            } else {
+                complete(std::move(pending), {},
+                         std::make_exception_ptr(
+                             NetworkException(state, message)));
+            }
+        }
+        pump(key);
+    }
+
+    void close(Connection& connection) {
+        Host& host = _hosts[connection.key];
+        host.idle.erase(
+            std::remove(host.idle.begin(), host.idle.end(), &connection),
+            host.idle.end());
+        if (connection.fd >= 0) {
+            ::epoll_ctl(_epoll, EPOLL_CTL_DEL, connection.fd, nullptr);
+        }
+        _connections.erase(connection.id);
+    }
+
+    static std::exception_ptr cancelled() {
+        return std::make_exception_ptr(NetworkException(
+            NetworkException::State::Cancelled, "Request cancelled"));
+    }
+
+    void abort(std::uint64_t id) {
+        for (auto& [connectionId, connection] : _connections) {
+            if (connection->request && connection->request->id == id) {
+                connection->request->retried = true;
+                return fail(*connection, NetworkException::State::Cancelled,
+                            "Request cancelled");
+            }
+        }
+        for (auto& [key, host] : _hosts) {
+            for (auto& queue : host.queued) {
+                for (auto it = queue.begin(); it != queue.end(); ++it) {
+                    if ((*it)->id == id) {
+                        auto pending = std::move(*it);
+                        queue.erase(it);
+                        complete(std::move(pending), {}, cancelled());
+                        // Lower lanes may have waited behind it.
+                        return pump(key);
+                    }
+                }
+            }
+        }
+    }
+
+    static void complete(std::unique_ptr<Pending> pending, std::string body,
+                         std::exception_ptr error) {
+        try {
+            pending->callback(std::move(body), std::move(error));
+        } catch (...) {
+            // A throwing callback must not take the loop down with it.
+        }
+    }
+
+    // Fails the requests whose deadline has passed, and closes connections
+    // that were idle for too long.
+    void expire() {
+        const auto now = Clock::now();
+        std::vector<std::uint64_t> late;
+        std::vector<std::uint64_t> stale;
+        for (const auto& [id, connection] : _connections) {
+            if (connection->request &&
+                (connection->request->deadline <= now ||
+                 (connection->connectDeadline &&
+                  *connection->connectDeadline <= now))) {
+                late.push_back(id);
+            } else if (connection->state == Connection::State::Idle &&
+                       connection->idleSince + kIdleTimeout <= now) {
+                stale.push_back(id);
+            }
+        }
+        for (const std::uint64_t id : stale) {
+            close(*_connections.at(id));
+        }
+        for (const std::uint64_t id : late) {
+            const auto it = _connections.find(id);
+            if (it == _connections.end() || !it->second->request) {
+                continue;
+            }
+            Connection& connection = *it->second;
+            const bool outOfBudget = connection.request->deadline <= now;
+            // An address that does not answer in time is given up for the
+            // next one while the request has time left.
+            if (!outOfBudget &&
+                connection.state == Connection::State::Connecting &&
+                hasNextAddress(connection)) {
+                connectNext(connection, {});
+                continue;
+            }
+            // Not retried: the time is up.
+            connection.request->retried = true;
+            const auto state =
+                outOfBudget && connection.request->budgeted
+                    ? NetworkException::State::Timeout
+                : connection.state == Connection::State::Resolving ||
+                      connection.state == Connection::State::Connecting
+                    ? NetworkException::State::Connect
+                : connection.state == Connection::State::Handshaking
+                    ? NetworkException::State::Handshake
+                    : NetworkException::State::Read;
+            fail(connection, state,
+                 "Request to " + connection.request->endpoint.host +
+                     " timed out");
+        }
+        std::vector<std::string> expiredQueues;
+        for (auto& [key, host] : _hosts) {
+            for (auto& queue : host.queued) {
+                while (!queue.empty() && queue.front()->deadline <= now) {
+                    auto pending = std::move(queue.front());
+                    queue.pop_front();
+                    const std::string hostName = pending->endpoint.host;
+                    const auto state = pending->budgeted
+                                           ? NetworkException::State::Timeout
+                                           : NetworkException::State::Connect;
+                    complete(std::move(pending), {},
+                             std::make_exception_ptr(NetworkException(
+                                 state, "Request to " + hostName +
+                                            " timed out waiting for a "
+                                            "connection")));
+                    expiredQueues.push_back(key);
+                }
+            }
+        }
+        for (const std::string& key : expiredQueues) {
+            pump(key);
+        }
+    }
+
+    // Runs the scheduled tasks that are due.
+    void runTimers() {
+        const auto now = Clock::now();
+        while (!_timers.empty() && _timers.begin()->first <= now) {
+            auto task = std::move(_timers.begin()->second);
+            _timers.erase(_timers.begin());
+            try {
+                task();
+            } catch (...) {
+                // Same as a throwing callback.
+            }
+        }
+    }
+
+    // Milliseconds until the next deadline or timer, or -1 for none.
+    int waitTimeout() const {
+        std::optional<Clock::time_point> next;
+        const auto consider = [&next](Clock::time_point deadline) {
+            if (!next || deadline < *next) {
+                next = deadline;
+            }
+        };
+        for (const auto& [id, connection] : _connections) {
+            if (connection->request) {
+                consider(connection->request->deadline);
+            }
+            if (connection->connectDeadline) {
+                consider(*connection->connectDeadline);
+            }
+            if (connection->state == Connection::State::Idle) {
+                consider(connection->idleSince + kIdleTimeout);
+            }
+        }
+        for (const auto& [key, host] : _hosts) {
+            for (const auto& queue : host.queued) {
+                if (!queue.empty()) {
+                    consider(queue.front()->deadline);
+                }
+            }
+        }
+        if (!_timers.empty()) {
+            consider(_timers.begin()->first);
+        }
+        if (!next) {
+            return -1;
+        }
+        const auto wait = std::chrono::ceil<std::chrono::milliseconds>(
+            *next - Clock::now());
+        return static_cast<int>(std::max<std::int64_t>(wait.count(), 0));
+    }
+
+    void abandonAll() {
+        const auto abandoned = [] {
+            return std::make_exception_ptr(
+                NetworkException(NetworkException::State::Unknown,
+                                 "EpollHttpClient destroyed"));
+        };
+        for (auto& [id, connection] : _connections) {
+            if (connection->request) {
+                complete(std::move(connection->request), {}, abandoned());
+            }
+        }
+        _connections.clear();
+        for (auto& [key, host] : _hosts) {
+            for (auto& queue : host.queued) {
+                for (auto& pending : queue) {
+                    complete(std::move(pending), {}, abandoned());
+                }
+            }
+        }
+        _hosts.clear();
+        _timers.clear();
+        // Completed outside the lock: dropping a request's cancellation
+        // registration may wait for a cancel() that wants the lock.
+        std::deque<std::unique_ptr<Pending>> inbox;
+        {
+            std::lock_guard<std::mutex> lock(_inboxMutex);
+            _timerInbox.clear();
+            _cancelInbox.clear();
+            inbox.swap(_inbox);
+        }
+        for (auto& pending : inbox) {
+            complete(std::move(pending), {}, abandoned());
+        }
+    }
+
+    Impl& _impl;
+    int _epoll = -1;
+    int _wake = -1;
+    std::thread _thread;
+
+    std::mutex _inboxMutex;
+    std::deque<std::unique_ptr<Pending>> _inbox;
+    std::vector<std::pair<Clock::time_point, std::function<void()>>>
+        _timerInbox;
+    std::vector<std::uint64_t> _cancelInbox;
+    bool _stopping = false;
+
+    // Owned by the loop thread.
+    std::uint64_t _nextId = kWakeId + 1;
+    std::unordered_map<std::uint64_t, std::unique_ptr<Connection>>
+        _connections;
+    std::unordered_map<std::string, Host> _hosts;
+    std::multimap<Clock::time_point, std::function<void()>> _timers;
+    // Resolved names, and the connections waiting for a name's lookup.
+    struct Resolved {
+        std::shared_ptr<const Addresses> addresses;
+        Clock::time_point expires;
+    };
+    std::unordered_map<std::string, Resolved> _addresses;
+    std::unordered_map<std::string, std::vector<std::uint64_t>> _resolving;
+};
+
+EpollHttpClient::Impl::Impl(const EpollHttpClient& owner_,
+                            std::size_t maxConnectionsPerHost_,
+                            std::size_t interactiveConnectionsPerHost_,
+                            std::size_t loopThreads)
+    : owner(owner_),
+      maxConnectionsPerHost(std::max<std::size_t>(maxConnectionsPerHost_, 1)),
+      interactiveConnectionsPerHost(interactiveConnectionsPerHost_) {
+    for (std::size_t i = 0; i < std::max<std::size_t>(loopThreads, 1); ++i) {
+        loops.push_back(std::make_unique<Loop>(*this));
+    }
+}
+
+EpollHttpClient::Impl::~Impl() {
+    resolver.reset();
+    loops.clear();
+    if (sslCtx) {
+        SSL_CTX_free(sslCtx);
+    }
+}
+
+EpollHttpClient::EpollHttpClient(std::chrono::seconds timeout,
+                                 std::size_t maxConnectionsPerHost,
+                                 std::size_t loopThreads,
+                                 std::size_t interactiveConnectionsPerHost)
+    : HttpClient(timeout),
+      _impl(std::make_unique<Impl>(*this, maxConnectionsPerHost,
+                                   interactiveConnectionsPerHost,
+                                   loopThreads)) {}
+
+EpollHttpClient::~EpollHttpClient() = default;
+
+void EpollHttpClient::makeRequestAsync(const Url& url,
+                                       const HttpReqArg::Vec& args,
+                                       Callback callback,
+                                       const RequestOptions& options) const {
+    auto pending = std::make_unique<Pending>();
+    pending->id = _impl->nextRequestId.fetch_add(1, std::memory_order_relaxed);
+    pending->endpoint = endpointOf(url);
+    pending->key = url.protocol + "://" + url.host;
+    pending->payload = serialize(url, args);
+    pending->callback = std::move(callback);
+    pending->budgeted = options.timeout.has_value();
+    pending->deadline =
+        Clock::now() + (options.timeout ? Clock::duration(*options.timeout)
+                                        : Clock::duration(timeout()));
+    if (options.connectTimeout) {
+        pending->connectTimeout = *options.connectTimeout;
+    }
+    pending->priority = options.priority.value_or(RequestPriority::Normal);
+    const std::size_t index =
+        _impl->nextLoop.fetch_add(1, std::memory_order_relaxed) %
+        _impl->loops.size();
+    Impl::Loop& loop = *_impl->loops[index];
+    if (options.cancellation.cancellable()) {
+        pending->cancellation = options.cancellation;
+        pending->onCancel = options.cancellation.onCancel(
+            [&loop, id = pending->id] { loop.cancel(id); });
+    }
+    loop.submit(std::move(pending));
+}
+
+void EpollHttpClient::schedule(std::chrono::milliseconds delay,
+                               std::function<void()> task) const {
+    const std::size_t loop =
+        _impl->nextLoop.fetch_add(1, std::memory_order_relaxed) %
+        _impl->loops.size();
+    _impl->loops[loop]->schedule(Clock::now() + delay, std::move(task));
+}
+
+std::string EpollHttpClient::makeRequest(const Url& url,
+                                         const HttpReqArg::Vec& args) const {
+    return makeRequest(url, args, RequestOptions());
+}
+
+std::string EpollHttpClient::makeRequest(const Url& url,
+                                         const HttpReqArg::Vec& args,
+                                         const RequestOptions& options) const {
+    if (currentLoop) {
+        throw std::logic_error(
+            "EpollHttpClient::makeRequest called on an event loop thread");
+    }
+    std::promise<std::string> response;
+    auto future = response.get_future();
+    makeRequestAsync(url, args,
+                     [&response](std::string body, std::exception_ptr error) {
+                         if (error) {
+                             response.set_exception(std::move(error));
+                         } else {
+                             response.set_value(std::move(body));
+                         }
+                     },
+                     options);
+    return future.get();
+}
+
+}  // namespace TgBot
+
+#endif  // __linux__
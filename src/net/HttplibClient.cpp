@@ -1,22 +1,131 @@
 #include "httplib_wrapper.h"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "tgbot/TgException.h"
 #include "tgbot/net/HttplibClient.h"
 
 namespace TgBot {
 
+namespace {
+
+struct Connection {
+    std::unique_ptr<httplib::Client> client;
+    std::string base;
+};
+
+}  // namespace
+
 struct HttplibClient::Impl {
+    Impl(std::size_t maxConnections, std::size_t interactiveConnections)
+        : maxConnections(std::max<std::size_t>(maxConnections, 1)),
+          interactiveConnections(interactiveConnections) {}
+
+    // httplib::Client keeps a single connection and is not safe for concurrent
+    // use, so every in-flight request checks out a Connection of its own.
+    // Interactive requests may also take the connections reserved for them,
+    // and waiting requests are served by priority. A request gives up waiting
+    // at @p deadline or when @p cancellation is cancelled.
+    std::unique_ptr<Connection> acquire(
+        RequestPriority priority,
+        std::optional<std::chrono::steady_clock::time_point> deadline,
+        const CancellationToken& cancellation) {
+        const auto lane = static_cast<std::size_t>(priority);
+        // Registered before locking: a token that is already cancelled runs
+        // the callback right away, and the callback takes the lock.
+        const auto registration = cancellation.onCancel([this] {
+            std::lock_guard<std::mutex> lock(mutex);
+            released.notify_all();
+        });
+        std::unique_lock<std::mutex> lock(mutex);
+        ++waiting[lane];
+        const auto free = [this, lane, priority] {
+            for (std::size_t higher = 0; higher < lane; ++higher) {
+                if (waiting[higher] > 0) {
+                    return false;
+                }
+            }
+            return busy < maxConnections + interactiveConnections &&
+                   (priority == RequestPriority::Interactive ||
+                    sharedBusy < maxConnections);
+        };
+        const auto ready = [&free, &cancellation] {
+            return cancellation.cancelled() || free();
+        };
+        const bool acquired =
+            (deadline ? released.wait_until(lock, *deadline, ready)
+                      : (released.wait(lock, ready), true)) &&
+            !cancellation.cancelled();
+        --waiting[lane];
+        if (!acquired) {
+            // Lower lanes may have been held back by this request alone.
+            released.notify_all();
+            const bool cancelled = cancellation.cancelled();
+            lock.unlock();
+            throw NetworkException(cancelled
+                                       ? NetworkException::State::Cancelled
+                                       : NetworkException::State::Timeout,
+                                   cancelled ? "Request cancelled"
+                                             : "Request timed out waiting "
+                                               "for a connection");
+        }
+        ++busy;
+        if (priority != RequestPriority::Interactive) {
+            ++sharedBusy;
+        }
+        // Lower lanes may have been held back only by this request waiting.
+        for (std::size_t lower = lane + 1; lower < waiting.size(); ++lower) {
+            if (waiting[lower] > 0) {
+                released.notify_all();
+                break;
+            }
+        }
+        if (!idle.empty()) {
+            auto connection = std::move(idle.back());
+            idle.pop_back();
+            return connection;
+        }
+        return std::make_unique<Connection>();
+    }
+
+    void release(std::unique_ptr<Connection> connection,
+                 RequestPriority priority) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            idle.push_back(std::move(connection));
+            --busy;
+            if (priority != RequestPriority::Interactive) {
+                --sharedBusy;
+            }
+        }
+        released.notify_all();
+    }
+
+    const std::size_t maxConnections;
+    const std::size_t interactiveConnections;
     std::mutex mutex;
-    std::unique_ptr<httplib::Client> client;
-    std::string clientBase;
+    std::condition_variable released;
+    std::vector<std::unique_ptr<Connection>> idle;
+    // Requests holding a connection, and those of them outside the
+    // interactive lane, which may only use the first maxConnections.
+    std::size_t busy = 0;
+    std::size_t sharedBusy = 0;
+    std::array<std::size_t, 3> waiting{};
 };
 
-HttplibClient::HttplibClient(std::chrono::seconds timeout)
-    : HttpClient(timeout), _impl(std::make_unique<Impl>()) {}
+HttplibClient::HttplibClient(std::chrono::seconds timeout,
+                             std::size_t maxConnections,
+                             std::size_t interactiveConnections)
+    : HttpClient(timeout),
+      _impl(std::make_unique<Impl>(maxConnections, interactiveConnections)) {}
 
 HttplibClient::~HttplibClient() = default;
 
@@ -39,25 +148,66 @@ namespace {
 
 std::string HttplibClient::makeRequest(const Url& url,
                                        const HttpReqArg::Vec& args) const {
+    return makeRequest(url, args, RequestOptions());
+}
+
+std::string HttplibClient::makeRequest(const Url& url,
+                                       const HttpReqArg::Vec& args,
+                                       const RequestOptions& options) const {
+    if (options.cancellation.cancelled()) {
+        throw NetworkException(NetworkException::State::Cancelled,
+                               "Request cancelled");
+    }
+    const auto started = std::chrono::steady_clock::now();
     const std::string base = url.protocol + "://" + url.host;
 
-    // httplib::Client keeps a single connection and is not safe for concurrent
-    // use, so serialize requests and reuse the client across calls.
-    std::lock_guard<std::mutex> lock(_impl->mutex);
-    if (!_impl->client || _impl->clientBase != base) {
-        _impl->client = std::make_unique<httplib::Client>(base);
-        _impl->clientBase = base;
-        _impl->client->set_follow_location(true);
-        _impl->client->set_keep_alive(true);
+    // Hand the connection back even if the request throws.
+    const RequestPriority priority =
+        options.priority.value_or(RequestPriority::Normal);
+    struct Lease {
+        Impl& impl;
+        RequestPriority priority;
+        std::unique_ptr<Connection> connection;
+        ~Lease() { impl.release(std::move(connection), priority); }
+    } lease{*_impl, priority,
+            _impl->acquire(priority,
+                           options.timeout
+                               ? std::optional(started + *options.timeout)
+                               : std::nullopt,
+                           options.cancellation)};
+
+    Connection& connection = *lease.connection;
+    if (!connection.client || connection.base != base) {
+        connection.client = std::make_unique<httplib::Client>(base);
+        connection.base = base;
+        connection.client->set_follow_location(true);
+        connection.client->set_keep_alive(true);
+        // Requests are written as headers followed by the body; with Nagle
+        // the body waits for the peer's delayed ACK (~40ms on Linux).
+        connection.client->set_tcp_nodelay(true);
     }
-    httplib::Client& client = *_impl->client;
+    httplib::Client& client = *connection.client;
 
-    // The timeout may change between calls (e.g. long polling), so apply it
-    // every time.
-    const auto timeoutSecs = timeout().count();
-    client.set_connection_timeout(timeoutSecs);
-    client.set_read_timeout(timeoutSecs);
-    client.set_write_timeout(timeoutSecs);
+    // Timeouts differ between calls (e.g. long polling), so apply them every
+    // time. A per-call budget also caps the request as a whole.
+    // The time spent waiting for the connection counts against the budget;
+    // rounded down, so that the attempt does not end before the deadline.
+    std::chrono::milliseconds attempt = timeout();
+    if (options.timeout) {
+        attempt = *options.timeout -
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - started);
+        if (attempt.count() <= 0) {
+            throw NetworkException(NetworkException::State::Timeout,
+                                   "Request to " + url.host + " timed out");
+        }
+    }
+    client.set_connection_timeout(
+        std::min(options.connectTimeout.value_or(attempt), attempt));
+    client.set_read_timeout(attempt);
+    client.set_write_timeout(attempt);
+    client.set_max_timeout(options.timeout ? attempt
+                                           : std::chrono::milliseconds(0));
 
     // HTTPS certificate verification: httplib falls back to the system's
     // default verify paths when no explicit CA certificate is configured.
@@ -66,6 +216,18 @@ std::string HttplibClient::makeRequest(const Url& url,
     }
     client.enable_server_certificate_verification(true);
 
+    // Cancelling shuts the socket down under the request, which then fails.
+    // A connect in progress still runs into its connect timeout.
+    const auto cancellation =
+        options.cancellation.onCancel([&client] { client.stop(); });
+    // Cancelled before the request started, e.g. while it waited for the
+    // connection: stop() had nothing to shut down, and Get()/Post() would
+    // open a connection and send it all the same.
+    if (options.cancellation.cancelled()) {
+        throw NetworkException(NetworkException::State::Cancelled,
+                               "Request cancelled");
+    }
+
     httplib::Result res;
     if (args.empty()) {
         std::string path = url.path;
@@ -113,6 +275,15 @@ std::string HttplibClient::makeRequest(const Url& url,
         if (res && !res->body.empty()) {
             return res->body;
         }
+        if (options.cancellation.cancelled()) {
+            throw NetworkException(NetworkException::State::Cancelled,
+                                   "Request cancelled");
+        }
+        if (!res && options.timeout &&
+            std::chrono::steady_clock::now() - started >= *options.timeout) {
+            throw NetworkException(NetworkException::State::Timeout,
+                                   "Request to " + url.host + " timed out");
+        }
         throwNetworkError(res, url.host);
     }
 
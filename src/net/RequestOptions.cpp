@@ -0,0 +1,153 @@
+#include "tgbot/net/RequestOptions.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace TgBot {
+
+namespace detail {
+
+struct CancellationState {
+    std::atomic<bool> cancelled{false};
+
+    // Held while callbacks run, so that unregistering waits for them.
+    std::recursive_mutex mutex;
+    std::map<std::uint64_t, std::function<void()>> callbacks;
+    std::uint64_t nextId = 1;
+
+    std::mutex waitMutex;
+    std::condition_variable woken;
+};
+
+}  // namespace detail
+
+CancellationToken::Registration::Registration(Registration&& other) noexcept
+    : _state(std::move(other._state)), _id(std::exchange(other._id, 0)) {}
+
+CancellationToken::Registration& CancellationToken::Registration::operator=(
+    Registration&& other) noexcept {
+    if (this != &other) {
+        Registration old(std::move(*this));
+        _state = std::move(other._state);
+        _id = std::exchange(other._id, 0);
+    }
+    return *this;
+}
+
+CancellationToken::Registration::~Registration() {
+    if (_state && _id != 0) {
+        std::lock_guard<std::recursive_mutex> lock(_state->mutex);
+        _state->callbacks.erase(_id);
+    }
+}
+
+bool CancellationToken::cancelled() const noexcept {
+    return _state && _state->cancelled.load(std::memory_order_acquire);
+}
+
+CancellationToken::Registration CancellationToken::onCancel(
+    std::function<void()> callback) const {
+    if (!_state) {
+        return {};
+    }
+    std::unique_lock<std::recursive_mutex> lock(_state->mutex);
+    if (_state->cancelled.load(std::memory_order_acquire)) {
+        lock.unlock();
+        callback();
+        return {};
+    }
+    const std::uint64_t id = _state->nextId++;
+    _state->callbacks.emplace(id, std::move(callback));
+    return Registration(_state, id);
+}
+
+bool CancellationToken::waitFor(
+    std::chrono::steady_clock::duration duration) const {
+    if (!_state) {
+        if (duration.count() > 0) {
+            std::this_thread::sleep_for(duration);
+        }
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(_state->waitMutex);
+    return !_state->woken.wait_for(lock, duration, [this] {
+        return _state->cancelled.load(std::memory_order_acquire);
+    });
+}
+
+CancellationSource::CancellationSource()
+    : _state(std::make_shared<detail::CancellationState>()) {}
+
+CancellationToken CancellationSource::token() const {
+    return CancellationToken(_state);
+}
+
+void CancellationSource::cancel() {
+    {
+        std::lock_guard<std::mutex> lock(_state->waitMutex);
+        if (_state->cancelled.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+    _state->woken.notify_all();
+
+    std::lock_guard<std::recursive_mutex> lock(_state->mutex);
+    for (auto& [id, callback] : _state->callbacks) {
+        try {
+            callback();
+        } catch (...) {
+            // One failing callback must not keep the others from running.
+        }
+    }
+    _state->callbacks.clear();
+}
+
+bool CancellationSource::cancelled() const noexcept {
+    return _state->cancelled.load(std::memory_order_acquire);
+}
+
+namespace {
+
+thread_local RequestOptions* threadOptions = nullptr;
+thread_local RequestOptions threadOptionsStorage;
+
+}  // namespace
+
+RequestOptionsScope::RequestOptionsScope(const RequestOptions& options)
+    : _previous(threadOptionsStorage), _hadPrevious(threadOptions != nullptr) {
+    RequestOptions merged = _hadPrevious ? _previous : RequestOptions{};
+    if (options.connectTimeout) {
+        merged.connectTimeout = options.connectTimeout;
+    }
+    if (options.timeout) {
+        merged.timeout = options.timeout;
+    }
+    if (options.maxRetries) {
+        merged.maxRetries = options.maxRetries;
+    }
+    if (options.cancellation.cancellable()) {
+        merged.cancellation = options.cancellation;
+    }
+    if (options.priority) {
+        merged.priority = options.priority;
+    }
+    threadOptionsStorage = std::move(merged);
+    threadOptions = &threadOptionsStorage;
+}
+
+RequestOptionsScope::~RequestOptionsScope() {
+    threadOptionsStorage = std::move(_previous);
+    threadOptions = _hadPrevious ? &threadOptionsStorage : nullptr;
+}
+
+namespace detail {
+
+const RequestOptions* requestOptions() noexcept { return threadOptions; }
+
+}  // namespace detail
+
+}  // namespace TgBot
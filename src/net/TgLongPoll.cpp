@@ -1,42 +1,138 @@
 #include "tgbot/net/TgLongPoll.h"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "tgbot/Api.h"
 #include "tgbot/Bot.h"
 #include "tgbot/EventHandler.h"
+#include "tgbot/Tracing.h"
+#include "tgbot/net/RequestOptions.h"
 #include "tgbot/types/Update.h"
 
 namespace TgBot {
 
+namespace {
+
+// Time the server may take beyond the long poll timeout to answer.
+constexpr std::chrono::seconds kMargin{5};
+
+}  // namespace
+
 TgLongPoll::TgLongPoll(Bot* bot, timeout_t timeout, limit_t limit,
                        Update::Types allowedUpdates)
     : _bot(bot),
       _limit(limit),
       _timeout(timeout),
       _allowedUpdates(allowedUpdates) {
-
-    // If we ask the Telegram bot server to timeout at [timeout]
-    // HTTP Clients must timeout after this time
-    // Hence define an offset, if the current value is fine, use as is
-    constexpr static std::chrono::seconds offset{5};
-    _bot->_httpClient->timeout(std::max(_bot->_httpClient->timeout(), std::chrono::seconds(*timeout) + offset));
+    // Clients that ignore RequestOptions::timeout still bound the long poll
+    // by their own timeout, so it must cover [timeout] plus the margin.
+    if (!_bot->_httpClient->honoursRequestTimeout()) {
+        _bot->_httpClient->timeout(
+            std::max(_bot->_httpClient->timeout(),
+                     std::chrono::seconds(*timeout) + kMargin));
+    }
 }
 
 void TgLongPoll::start() {
+    if (_offsetStore && !_offsetLoaded) {
+        restoreOffset();
+    }
+
     // handle updates
-    for (Update::Ptr& item : _updates) {
-        if (item->updateId >= _lastUpdateId) {
-            _lastUpdateId = item->updateId + 1;
+    bool unsaved = false;
+    {
+        // Handling belongs to the trace of the poll that fetched the updates.
+        ContextScope scope(_pollContext);
+        for (; _nextUpdate < _updates.size(); ++_nextUpdate) {
+            const Update::Ptr& item = _updates[_nextUpdate];
+            bool handled = false;
+            if (!_handledIds.count(item->updateId)) {
+                _bot->_eventHandler->handleUpdate(item);
+                markHandled(item->updateId);
+                handled = true;
+            }
+            // Only advance once the listeners returned.
+            if (item->updateId >= _lastUpdateId) {
+                _lastUpdateId = item->updateId + 1;
+            }
+            // The dedup window only helps if it is durable before the next
+            // listener can fail, so it is saved after every handled update.
+            if (_offsetStore && handled && _dedupWindow > 0) {
+                saveOffset();
+                unsaved = false;
+            } else {
+                unsaved = true;
+            }
         }
-        _bot->_eventHandler->handleUpdate(item);
+    }
+
+    // Without a window the offset is saved once per batch, before the batch
+    // is confirmed.
+    if (_offsetStore && unsaved) {
+        saveOffset();
     }
 
     // confirm handled updates
+    Span span("tgbot.long_poll");
+    // The server answers after [timeout] at the latest, so the long poll gets
+    // that plus a margin as its own budget; the client's timeout, which
+    // every other call uses, stays as it is.
+    RequestOptions options;
+    options.timeout = std::chrono::seconds(*_timeout) + kMargin;
+    RequestOptionsScope scope(options);
+    // record() may swap the recorder from another thread meanwhile.
+    const std::shared_ptr<UpdateRecorder> recorder =
+        std::atomic_load(&_recorder);
     _updates = _bot->_api->getUpdates(_lastUpdateId, _limit, _timeout,
-                                      _allowedUpdates);
+                                      _allowedUpdates, recorder.get());
+    _nextUpdate = 0;
+    if (span.recording()) {
+        span.setAttribute("tgbot.update_count",
+                          std::to_string(_updates.size()));
+    }
+    _pollContext = span.context();
+}
+
+void TgLongPoll::record(std::shared_ptr<UpdateRecorder> recorder) {
+    std::atomic_store(&_recorder, std::move(recorder));
+}
+
+void TgLongPoll::setOffsetStore(std::shared_ptr<OffsetStore> store,
+                                std::size_t dedupWindow) {
+    _offsetStore = std::move(store);
+    _offsetLoaded = false;
+    _dedupWindow = dedupWindow;
+}
+
+void TgLongPoll::restoreOffset() {
+    const OffsetState state = _offsetStore->load();
+    _lastUpdateId = std::max(_lastUpdateId, state.offset);
+    for (std::int32_t id : state.handled) {
+        markHandled(id);
+    }
+    _offsetLoaded = true;
+}
+
+void TgLongPoll::saveOffset() {
+    _offsetStore->save({_lastUpdateId, {_handled.begin(), _handled.end()}});
+}
+
+void TgLongPoll::markHandled(std::int32_t updateId) {
+    if (_dedupWindow == 0) {
+        return;
+    }
+    if (_handledIds.insert(updateId).second) {
+        _handled.push_back(updateId);
+    }
+    while (_handled.size() > _dedupWindow) {
+        _handledIds.erase(_handled.front());
+        _handled.pop_front();
+    }
 }
 
 }  // namespace TgBot
@@ -1,15 +1,31 @@
 #include "httplib_wrapper.h"
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <exception>
+#include <functional>
+#include <mutex>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "tgbot/EventHandler.h"
 #include "tgbot/Logger.h"
+#include "tgbot/Metrics.h"
+#include "tgbot/Tracing.h"
 #include "tgbot/TgTypeParser.h"
+#include "tgbot/UpdateRecorder.h"
 #include "tgbot/net/TgWebhookServer.h"
+#include "tgbot/tools/StringTools.h"
 #include "tgbot/types/Update.h"
+#include "tools/Instrumentation.h"
 
 namespace TgBot {
 
@@ -31,49 +47,294 @@ std::string escapeRegex(const std::string& path) {
     return escaped;
 }
 
+// Whether a Content-Type header value names JSON, ignoring parameters such as
+// charset and letter case.
+bool isJson(const std::string& contentType) {
+    std::string mediaType = contentType.substr(0, contentType.find(';'));
+    mediaType.erase(std::remove_if(mediaType.begin(), mediaType.end(),
+                                   [](unsigned char c) {
+                                       return std::isspace(c) != 0;
+                                   }),
+                    mediaType.end());
+    std::transform(mediaType.begin(), mediaType.end(), mediaType.begin(),
+                   [](unsigned char c) {
+                       return static_cast<char>(std::tolower(c));
+                   });
+    return mediaType == "application/json";
+}
+
+// The server whose request handler runs on this thread, if any; stop() must
+// not wait for the drain from there.
+thread_local const void* servingServer = nullptr;
+
+class ServingScope {
+   public:
+    explicit ServingScope(const void* server) { servingServer = server; }
+    ~ServingScope() { servingServer = nullptr; }
+};
+
 }  // namespace
 
 struct TgWebhookServer::Impl {
+    using HandlerResponse = httplib::Server::HandlerResponse;
+
     Bind bind;
-    std::string path;
-    EventHandler* eventHandler;
-    httplib::Server server;
-
-    Impl(Bind bind_, std::string path_, EventHandler* eventHandler_)
-        : bind(std::move(bind_)),
-          path(std::move(path_)),
-          eventHandler(eventHandler_) {
-        server.Post(escapeRegex(path), [this](const httplib::Request& req,
-                                               httplib::Response& res) {
-            try {
-                nlohmann::json update = nlohmann::json::parse(req.body);
-                eventHandler->handleUpdate(parse<Update>(update));
-            } catch (const std::exception& e) {
-                // Log but always answer 200 so Telegram does not keep retrying
-                // the delivery of a payload the handler cannot process.
-                detail::log(LogLevel::Error,
-                            std::string("Webhook handler error: ") + e.what());
-            }
-            res.set_content("", "text/plain");
+    std::shared_ptr<UpdateRecorder> recorder;
+    std::string secretToken;
+    std::size_t maxBodySize = kDefaultMaxBodySize;
+    // Metric labels of every webhook path, also used to tell webhook paths
+    // apart from others before routing.
+    std::unordered_map<std::string, MetricLabels> paths;
+    // Registers the routes on each acceptor's server.
+    std::vector<std::function<void(httplib::Server&)>> routes;
+
+    std::size_t acceptors = 1;
+    std::size_t workerThreads = 0;
+    std::optional<std::size_t> keepAliveMaxCount;
+    std::optional<std::chrono::seconds> keepAliveTimeout;
+    std::optional<std::chrono::milliseconds> readTimeout;
+    std::chrono::milliseconds drainTimeout{30000};
+
+    std::mutex mutex;
+    std::condition_variable drained;
+    bool stopping = false;
+    std::size_t listening = 0;
+    struct Acceptor {
+        std::unique_ptr<httplib::Server> server;
+        // stop() reached the server while it was listening.
+        bool halted = false;
+    };
+    std::vector<Acceptor> acceptorServers;
+
+    Impl(Bind bind_, const std::string& path, EventHandler* eventHandler)
+        : bind(std::move(bind_)) {
+        if (eventHandler) {
+            addPath(path, eventHandler, {});
+        }
+    }
+
+    std::unique_ptr<httplib::Server> makeServer(std::size_t threads) {
+        auto server = std::make_unique<httplib::Server>();
+        if (threads > 0) {
+            server->new_task_queue = [threads] {
+                return new httplib::ThreadPool(threads);
+            };
+        }
+        if (keepAliveMaxCount) {
+            server->set_keep_alive_max_count(*keepAliveMaxCount);
+        }
+        if (keepAliveTimeout) {
+            server->set_keep_alive_timeout(*keepAliveTimeout);
+        }
+        if (readTimeout) {
+            server->set_read_timeout(*readTimeout);
+        }
+        server->set_payload_max_length(maxBodySize);
+        server->set_pre_routing_handler(
+            [this](const httplib::Request& req, httplib::Response& res) {
+                return screen(req, res);
+            });
+        for (const auto& route : routes) {
+            route(*server);
+        }
+        return server;
+    }
+
+    // Runs once the headers of a request are read, before its body: rejects
+    // webhook requests that are not worth reading, let alone parsing.
+    HandlerResponse screen(const httplib::Request& req,
+                           httplib::Response& res) const {
+        if (req.method != "POST") {
+            return HandlerResponse::Unhandled;
+        }
+        const auto route = paths.find(req.path);
+        if (route == paths.end()) {
+            return reject(res, 404, "path", {});
+        }
+        const MetricLabels& labels = route->second;
+        if (!secretToken.empty() &&
+            !StringTools::constantTimeEquals(
+                req.get_header_value("X-Telegram-Bot-Api-Secret-Token"),
+                secretToken)) {
+            return reject(res, 403, "secret_token", labels);
+        }
+        if (!isJson(req.get_header_value("Content-Type"))) {
+            return reject(res, 415, "content_type", labels);
+        }
+        if (!req.has_header("Content-Length")) {
+            return reject(res, 411, "body_size", labels);
+        }
+        if (req.get_header_value_u64("Content-Length") > maxBodySize) {
+            return reject(res, 413, "body_size", labels);
+        }
+        return HandlerResponse::Unhandled;
+    }
+
+    static HandlerResponse reject(httplib::Response& res, int status,
+                                  const char* reason,
+                                  const MetricLabels& labels) {
+        if (const auto metrics = detail::metrics()) {
+            MetricLabels series = labels;
+            series.emplace_back("reason", reason);
+            metrics->counter("tgbot_webhook_rejections_total", series).add();
+        }
+        res.status = status;
+        // Do not spend a keep-alive connection on a client that sends junk.
+        res.set_header("Connection", "close");
+        return HandlerResponse::Handled;
+    }
+
+    void addPath(const std::string& path, EventHandler* eventHandler,
+                 MetricLabels labels) {
+        paths[path] = labels;
+        routes.push_back([this, pattern = escapeRegex(path), eventHandler,
+                          labels = std::move(labels)](
+                             httplib::Server& server) {
+            server.Post(pattern, [this, eventHandler, labels](
+                                     const httplib::Request& req,
+                                     httplib::Response& res) {
+                handle(req, res, *eventHandler, labels);
+            });
         });
     }
 
+    void handle(const httplib::Request& req, httplib::Response& res,
+                EventHandler& eventHandler, const MetricLabels& labels) {
+        ServingScope serving(this);
+        std::vector<std::unique_ptr<MetricsLabelScope>> scopes;
+        scopes.reserve(labels.size());
+        for (const auto& [name, value] : labels) {
+            scopes.push_back(std::make_unique<MetricsLabelScope>(name, value));
+        }
+        try {
+            // Continue the caller's trace if it sent one.
+            std::optional<SpanContext> remote;
+            if (req.has_header("traceparent")) {
+                remote = SpanContext::fromTraceparent(
+                    req.get_header_value("traceparent"));
+            }
+            Span span = remote ? Span("tgbot.webhook", *remote)
+                               : Span("tgbot.webhook");
+            if (recorder) {
+                recorder->record(req.body);
+            }
+            nlohmann::json update =
+                nlohmann::json::parse(req.body, nullptr, false);
+            if (update.is_discarded()) {
+                reject(res, 400, "malformed", labels);
+                return;
+            }
+            eventHandler.handleUpdate(detail::parseUpdate(update));
+        } catch (const std::exception& e) {
+            // Log but always answer 200 so Telegram does not keep retrying
+            // the delivery of a payload the handler cannot process.
+            detail::log(LogLevel::Error, "Webhook handler error",
+                        {{"error", e.what()}});
+        }
+        res.set_content("", "text/plain");
+    }
+
     void start() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (stopping || !acceptorServers.empty()) {
+                return;
+            }
+            // Several listeners on one port need SO_REUSEPORT, which
+            // httplib sets by default where it exists; the kernel then
+            // spreads incoming connections across them.
+            std::size_t count = std::max<std::size_t>(acceptors, 1);
+#ifndef SO_REUSEPORT
+            count = 1;
+#endif
+            if (bind.unixSocket) {
+                count = 1;
+            }
+            const std::size_t threads =
+                workerThreads == 0 ? 0 : (workerThreads + count - 1) / count;
+            for (std::size_t i = 0; i < count; ++i) {
+                acceptorServers.push_back({makeServer(threads)});
+            }
+            listening = count;
+        }
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < acceptorServers.size(); ++i) {
+            threads.emplace_back(
+                [this, i] { listen(*acceptorServers[i].server); });
+        }
+        listen(*acceptorServers.front().server);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    // Returns once the server is stopped and its in-flight requests are done.
+    void listen(httplib::Server& server) {
         if (bind.unixSocket) {
             server.set_address_family(AF_UNIX);
             server.listen(bind.socketPath, 80);
         } else {
             server.listen(bind.host, bind.port);
         }
+        std::lock_guard<std::mutex> lock(mutex);
+        --listening;
+        drained.notify_all();
+    }
+
+    void stop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        stopping = true;
+        haltAcceptors();
+        // A handler stopping its own server would wait for itself.
+        if (servingServer == this) {
+            return;
+        }
+        const auto deadline = std::chrono::steady_clock::now() + drainTimeout;
+        while (!drained.wait_for(lock, std::chrono::milliseconds(10),
+                                 [this] { return listening == 0; }) &&
+               std::chrono::steady_clock::now() < deadline) {
+            haltAcceptors();
+        }
+    }
+
+    // httplib::Server::stop() does nothing before listen() runs and must be
+    // called once only, so acceptors still starting up are decommissioned
+    // instead and stopped by a later call if they got going regardless.
+    void haltAcceptors() {
+        for (auto& acceptor : acceptorServers) {
+            if (acceptor.halted) {
+                continue;
+            }
+            if (acceptor.server->is_running()) {
+                acceptor.server->stop();
+                acceptor.halted = true;
+            } else {
+                acceptor.server->decommission();
+            }
+        }
     }
 
-    void stop() { server.stop(); }
+    void exposeMetrics(const std::string& metricsPath) {
+        routes.push_back([pattern = escapeRegex(metricsPath)](
+                             httplib::Server& server) {
+            server.Get(pattern, [](const httplib::Request&,
+                                   httplib::Response& res) {
+                const auto metrics = detail::metrics();
+                if (!metrics) {
+                    res.status = 404;
+                    return;
+                }
+                res.set_content(metrics->toPrometheus(),
+                                "text/plain; version=0.0.4");
+            });
+        });
+    }
 };
 
 TgWebhookServer::TgWebhookServer(Bind bind, std::string path,
                                  EventHandler* eventHandler)
-    : _impl(std::make_unique<Impl>(std::move(bind), std::move(path),
-                                   eventHandler)) {}
+    : _impl(std::make_unique<Impl>(std::move(bind), path, eventHandler)) {}
 
 TgWebhookServer::~TgWebhookServer() = default;
 
@@ -81,4 +342,48 @@ void TgWebhookServer::start() { _impl->start(); }
 
 void TgWebhookServer::stop() { _impl->stop(); }
 
+void TgWebhookServer::exposeMetrics(const std::string& path) {
+    _impl->exposeMetrics(path);
+}
+
+void TgWebhookServer::addPath(const std::string& path,
+                              EventHandler* eventHandler,
+                              MetricLabels labels) {
+    _impl->addPath(path, eventHandler, std::move(labels));
+}
+
+void TgWebhookServer::setSecretToken(std::string secretToken) {
+    _impl->secretToken = std::move(secretToken);
+}
+
+void TgWebhookServer::setMaxBodySize(std::size_t bytes) {
+    _impl->maxBodySize = bytes;
+}
+
+void TgWebhookServer::setAcceptors(std::size_t acceptors) {
+    _impl->acceptors = acceptors;
+}
+
+void TgWebhookServer::setWorkerThreads(std::size_t threads) {
+    _impl->workerThreads = threads;
+}
+
+void TgWebhookServer::setKeepAlive(std::size_t maxRequests,
+                                   std::chrono::seconds timeout) {
+    _impl->keepAliveMaxCount = std::max<std::size_t>(maxRequests, 1);
+    _impl->keepAliveTimeout = timeout;
+}
+
+void TgWebhookServer::setReadTimeout(std::chrono::milliseconds timeout) {
+    _impl->readTimeout = timeout;
+}
+
+void TgWebhookServer::setDrainTimeout(std::chrono::milliseconds timeout) {
+    _impl->drainTimeout = timeout;
+}
+
+void TgWebhookServer::record(std::shared_ptr<UpdateRecorder> recorder) {
+    _impl->recorder = std::move(recorder);
+}
+
 }  // namespace TgBot
@@ -0,0 +1,305 @@
+#include "tools/ApiCall.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include "tgbot/Logger.h"
+#include "tgbot/TgTypeParser.h"
+#include "tgbot/types/ResponseParameters.h"
+
+namespace TgBot::detail {
+
+namespace {
+
+// Numeric chat_id argument of a request, if any (not "@channelusername").
+std::optional<std::int64_t> chatIdArg(const HttpReqArg::Vec& vec) {
+    for (const auto& arg : vec) {
+        if (arg->name == "chat_id") {
+            char* end = nullptr;
+            const long long id = std::strtoll(arg->value.c_str(), &end, 10);
+            if (end != arg->value.c_str() && *end == '\0') {
+                return id;
+            }
+            return std::nullopt;
+        }
+    }
+    return std::nullopt;
+}
+
+bool hasArg(const HttpReqArg::Vec& vec, std::string_view name) {
+    for (const auto& arg : vec) {
+        if (arg->name == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Points chat_id and from_chat_id of a request at the supergroups their
+// groups were migrated to.
+void applyMigrations(const ApiContext& ctx, const HttpReqArg::Vec& vec) {
+    if (!ctx.hasMigrations.load(std::memory_order_acquire)) {
+        return;
+    }
+    for (const auto& arg : vec) {
+        if (arg->name != "chat_id" && arg->name != "from_chat_id") {
+            continue;
+        }
+        char* end = nullptr;
+        const long long id = std::strtoll(arg->value.c_str(), &end, 10);
+        if (end == arg->value.c_str() || *end != '\0') {
+            continue;
+        }
+        const std::int64_t resolved = ctx.resolve(id);
+        if (resolved != id) {
+            arg->value = std::to_string(resolved);
+        }
+    }
+}
+
+MethodClass classify(std::string_view method, const HttpReqArg::Vec& vec) {
+    for (const auto& arg : vec) {
+        if (arg->isFile()) {
+            return MethodClass::Upload;
+        }
+    }
+    return method.compare(0, 3, "get") == 0 ? MethodClass::Read
+                                            : MethodClass::Send;
+}
+
+// answer* methods reply to a user who is waiting on the other side; uploads
+// and everything a broadcast sends can wait.
+RequestPriority priorityOf(std::string_view method, MethodClass methodClass) {
+    if (method.compare(0, 6, "answer") == 0) {
+        return RequestPriority::Interactive;
+    }
+    return methodClass == MethodClass::Upload ? RequestPriority::Bulk
+                                              : RequestPriority::Normal;
+}
+
+void logRequest(std::string_view method, const HttpReqArg::Vec& vec) {
+    std::vector<LogField> fields;
+    fields.reserve(vec.size() + 1);
+    fields.push_back({"method", std::string(method)});
+    for (const auto& arg : vec) {
+        // File contents can be megabytes; only their size is logged.
+        if (arg->isFile()) {
+            fields.push_back(
+                {arg->name,
+                 "<" + std::to_string(arg->value.size()) + " bytes>"});
+        } else {
+            fields.push_back({arg->name, arg->value});
+        }
+    }
+    log(LogLevel::Trace, "Sending request", std::move(fields));
+}
+
+}  // namespace
+
+ApiCall::ApiCall(ApiContext& ctx, std::string_view method,
+                 const HttpReqArg::Vec& args, RequestOptions defaults)
+    : _ctx(ctx),
+      _method(method),
+      _url(ctx.baseUrl + _method),
+      _args(args),
+      _span(method, Span::Detached{}),
+      _metrics(method),
+      _control(ctx.retryControl(classify(method, args))),
+      _policy(_control.currentPolicy()),
+      _guarded(method != "getUpdates"),
+      _limits(priorityOf(method, classify(method, args)), std::move(defaults)),
+      _maxRetries(_limits.maxRetries(_policy.maxRetries)) {
+    if (_span.recording()) {
+        _span.setAttribute("tgbot.method", _method);
+    }
+    applyMigrations(_ctx, _args);
+    if (enabled(LogLevel::Trace)) {
+        logRequest(_method, _args);
+    }
+}
+
+RequestOptions ApiCall::attempt() {
+    RequestOptions options;
+    try {
+        options = _limits.attempt();
+    } catch (const NetworkException& ex) {
+        end(ex);
+        throw;
+    }
+    if (_guarded) {
+        _permit = _control.breaker.allow(_policy);
+        if (!_permit) {
+            _metrics.response("circuit_open");
+            _span.setError("circuit open");
+            throw NetworkException(
+                NetworkException::State::CircuitOpen,
+                "Circuit breaker open, " + _method + " not sent");
+        }
+    }
+    return options;
+}
+
+void ApiCall::sleep(std::chrono::milliseconds delay) {
+    try {
+        _limits.sleep(delay);
+    } catch (const NetworkException& ex) {
+        end(ex);
+        throw;
+    }
+}
+
+ApiCall::Step ApiCall::complete(std::string body, std::exception_ptr error) {
+    if (error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const NetworkException& ex) {
+            return handleNetworkError(ex);
+        }
+    }
+
+    const auto succeeded = [this] {
+        if (_permit) {
+            _permit->success();
+        }
+    };
+    const auto failed = [this] {
+        if (_permit) {
+            _permit->failure(_policy);
+        }
+    };
+
+    if (!body.compare(0, 6, "<html>")) {
+        // Typically an error page of a proxy in front of the API.
+        failed();
+        throw TgException(
+            "tgbot-cpp library have got html page instead of json "
+            "response. Maybe you entered wrong bot token.",
+            TgException::ErrorCode::HtmlResponse);
+    }
+
+    nlohmann::json result = nlohmann::json::parse(body, nullptr, false);
+    if (result.is_discarded()) {
+        failed();
+        log(LogLevel::Error, "Failed to parse json response: " + body);
+        throw TgException("tgbot-cpp library can't parse json response.",
+                          TgException::ErrorCode::InvalidJson);
+    }
+
+    if (result.value("ok", false)) {
+        succeeded();
+        _metrics.response("200");
+        if (_method.compare(0, 4, "send") == 0) {
+            if (auto chatId = chatIdArg(_args)) {
+                _ctx.recordAudience(*chatId, TgException::Reason::Unknown);
+            }
+        }
+        return {std::move(result["result"]), {}};
+    }
+
+    const std::string message = result.value("description", "Unknown error");
+    const int errorCode = result.value("error_code", 0);
+    if (errorCode >= 500) {
+        failed();
+    } else {
+        succeeded();
+    }
+    _metrics.response(std::to_string(errorCode));
+    _span.setError(message);
+    ResponseParameters::Ptr parameters;
+    if (result.contains("parameters")) {
+        parameters = parse<ResponseParameters>(result["parameters"]);
+    }
+    TgException apiError(message,
+                         static_cast<TgException::ErrorCode>(errorCode),
+                         std::move(parameters));
+
+    // Honour Telegram rate limiting (HTTP 429): the request never reached
+    // the bot logic, so wait the suggested time and retry. A wait that would
+    // outlast the call's deadline is not started.
+    const std::chrono::seconds delay =
+        apiError.retryAfter().value_or(HttpClient::kRequestBackoff);
+    if (errorCode == 429 && (_maxRetries < 0 || _retries < _maxRetries) &&
+        _limits.fits(delay)) {
+        log(LogLevel::Warning, "Rate limited by Telegram",
+            {{"method", _method},
+             {"retry_after", std::to_string(delay.count()) + "s"}});
+        _metrics.retry("rate_limit");
+        _metrics.rateLimitWait(delay);
+        ++_retries;
+        return {std::nullopt, delay};
+    }
+
+    // The group became a supergroup: nothing was sent, so remember the new
+    // id and resend there once. For forwards and copies the error does not
+    // tell whether chat_id or from_chat_id migrated, so those propagate.
+    if (apiError.reason == TgException::Reason::ChatMigrated &&
+        apiError.migrateToChatId() && !_resentToSupergroup &&
+        !hasArg(_args, "from_chat_id")) {
+        if (auto chatId = chatIdArg(_args)) {
+            const std::int64_t newChatId = *apiError.migrateToChatId();
+            _ctx.recordMigration(*chatId, newChatId);
+            log(LogLevel::Info, "Chat migrated to a supergroup, resending",
+                {{"method", _method},
+                 {"chat_id", std::to_string(*chatId)},
+                 {"migrate_to_chat_id", std::to_string(newChatId)}});
+            applyMigrations(_ctx, _args);
+            _resentToSupergroup = true;
+            return {};
+        }
+    }
+
+    if (apiError.isRecipientUnreachable()) {
+        if (auto chatId = chatIdArg(_args)) {
+            _ctx.recordAudience(*chatId, apiError.reason);
+        }
+    }
+    throw apiError;
+}
+
+// Called while @p ex is being handled, which it rethrows if the call is over.
+ApiCall::Step ApiCall::handleNetworkError(const NetworkException& ex) {
+    // Only transient network failures are retried; API errors are
+    // deterministic and must propagate (retrying could duplicate
+    // non-idempotent requests such as sendMessage). A call that ran out of
+    // time or was cancelled is over.
+    if (ex.state == NetworkException::State::Timeout ||
+        ex.state == NetworkException::State::Cancelled) {
+        end(ex);
+        throw;
+    }
+    _span.setError(ex.what());
+    if (_permit) {
+        _permit->failure(_policy);
+    }
+    _metrics.response("network");
+    _backoff = nextBackoff(_policy, _backoff);
+    const bool mayRetry =
+        (_maxRetries < 0 || _retries < _maxRetries) && _limits.fits(_backoff);
+    // The budget is only drawn from by retries that would happen.
+    const bool willRetry = mayRetry && _control.budget.tryAcquire(_policy);
+    log(willRetry ? LogLevel::Warning : LogLevel::Error,
+        willRetry  ? "Network error, retrying"
+        : mayRetry ? "Network error, retry budget exhausted"
+                   : "Network error, giving up",
+        {{"method", _method},
+         {"error", ex.what()},
+         {"backoff", std::to_string(_backoff.count()) + "ms"}});
+    if (!willRetry) {
+        throw;
+    }
+    _metrics.retry("network");
+    ++_retries;
+    return {std::nullopt, _backoff};
+}
+
+void ApiCall::end(const NetworkException& ex) {
+    _span.setError(ex.what());
+    if (_permit) {
+        _permit->abandon();
+    }
+    _metrics.response(ex.state == NetworkException::State::Timeout
+                          ? "timeout"
+                          : "cancelled");
+}
+
+}  // namespace TgBot::detail
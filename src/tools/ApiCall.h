@@ -0,0 +1,368 @@
+#ifndef TGBOT_INTERNAL_APICALL_H
+#define TGBOT_INTERNAL_APICALL_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <list>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "tgbot/Api.h"
+#include "tgbot/Metrics.h"
+#include "tgbot/TgException.h"
+#include "tgbot/Tracing.h"
+#include "tgbot/net/HttpClient.h"
+#include "tgbot/net/HttpReqArg.h"
+#include "tgbot/net/RequestOptions.h"
+#include "tgbot/net/RetryPolicy.h"
+#include "tools/RetryControl.h"
+#include "tools/SingleFlight.h"
+
+namespace TgBot::detail {
+
+// Per-Api state shared by every request issued through it.
+struct ApiContext {
+    ApiContext(std::string baseUrl, HttpClient* httpClient)
+        : baseUrl(std::move(baseUrl)), httpClient(httpClient) {
+        for (MethodClass methodClass :
+             {MethodClass::Read, MethodClass::Send, MethodClass::Upload}) {
+            retryControl(methodClass).policy =
+                RetryPolicy::defaults(methodClass);
+        }
+    }
+
+    std::string baseUrl;
+    HttpClient* httpClient;
+    SingleFlight<std::string, nlohmann::json> readFlights;
+
+    // Retry policy, budget and circuit breaker of each MethodClass.
+    std::array<RetryControl, 3> retry;
+
+    RetryControl& retryControl(MethodClass methodClass) {
+        return retry[static_cast<std::size_t>(methodClass)];
+    }
+
+    // What sends have revealed about each chat: Reason::Unknown if the last
+    // send went through, otherwise why the chat is unreachable. The most
+    // recently used chats are kept, each for a limited time, since users
+    // unblock bots and chats come back.
+    struct AudienceEntry {
+        std::int64_t chatId;
+        TgException::Reason reason;
+        std::chrono::steady_clock::time_point recordedAt;
+    };
+    std::mutex audienceMutex;
+    std::list<AudienceEntry> audienceOrder;
+    std::unordered_map<std::int64_t, std::list<AudienceEntry>::iterator>
+        audience;
+    std::size_t audienceCapacity = Api::kDefaultAudienceCapacity;
+    std::chrono::milliseconds audienceTtl = Api::kDefaultAudienceTtl;
+
+    void recordAudience(std::int64_t chatId, TgException::Reason reason) {
+        std::lock_guard<std::mutex> lock(audienceMutex);
+        const auto now = std::chrono::steady_clock::now();
+        if (auto it = audience.find(chatId); it != audience.end()) {
+            it->second->reason = reason;
+            it->second->recordedAt = now;
+            audienceOrder.splice(audienceOrder.begin(), audienceOrder,
+                                 it->second);
+            return;
+        }
+        audienceOrder.push_front({chatId, reason, now});
+        audience.emplace(chatId, audienceOrder.begin());
+        trimAudience();
+    }
+
+    // What is still known about @p chatId. Callers hold audienceMutex.
+    std::optional<TgException::Reason> knownAudience(std::int64_t chatId) {
+        auto it = audience.find(chatId);
+        if (it == audience.end()) {
+            return std::nullopt;
+        }
+        if (std::chrono::steady_clock::now() - it->second->recordedAt >=
+            audienceTtl) {
+            audienceOrder.erase(it->second);
+            audience.erase(it);
+            return std::nullopt;
+        }
+        audienceOrder.splice(audienceOrder.begin(), audienceOrder, it->second);
+        return it->second->reason;
+    }
+
+    // Drops the least recently used chats beyond the capacity. Callers hold
+    // audienceMutex.
+    void trimAudience() {
+        while (audience.size() > audienceCapacity) {
+            audience.erase(audienceOrder.back().chatId);
+            audienceOrder.pop_back();
+        }
+    }
+
+    // Groups upgraded to supergroups, old id to new id. Read on every
+    // request, written only when a migration is seen.
+    mutable std::shared_mutex migrationMutex;
+    std::unordered_map<std::int64_t, std::int64_t> migrations;
+    std::atomic<bool> hasMigrations{false};
+
+    void recordMigration(std::int64_t from, std::int64_t to) {
+        if (from == to) {
+            return;
+        }
+        std::unique_lock<std::shared_mutex> lock(migrationMutex);
+        migrations[from] = to;
+        hasMigrations.store(true, std::memory_order_release);
+    }
+
+    std::int64_t resolve(std::int64_t chatId) const {
+        if (!hasMigrations.load(std::memory_order_acquire)) {
+            return chatId;
+        }
+        std::shared_lock<std::shared_mutex> lock(migrationMutex);
+        // A supergroup never migrates again, but guard against cycles in
+        // mappings restored by the application.
+        for (std::size_t hops = 0; hops < migrations.size(); ++hops) {
+            auto it = migrations.find(chatId);
+            if (it == migrations.end()) {
+                break;
+            }
+            chatId = it->second;
+        }
+        return chatId;
+    }
+};
+
+// Records latency, responses and retries of one Api call into the registered
+// Metrics; does nothing when metrics are off. The labels of the thread's
+// MetricsLabelScopes are taken when the call starts, as it may finish on
+// another thread.
+class RequestMetrics {
+   public:
+    explicit RequestMetrics(std::string_view method)
+        : _metrics(detail::metrics()), _method(method) {
+        if (_metrics) {
+            _started = std::chrono::steady_clock::now();
+            _scoped = scopedLabels({});
+        }
+    }
+
+    ~RequestMetrics() {
+        if (_metrics) {
+            _metrics
+                ->histogram("tgbot_api_request_duration_seconds",
+                            labels({{"method", _method}}))
+                .record(std::chrono::steady_clock::now() - _started);
+        }
+    }
+
+    RequestMetrics(const RequestMetrics&) = delete;
+    RequestMetrics& operator=(const RequestMetrics&) = delete;
+
+    void response(std::string status) {
+        if (_metrics) {
+            _metrics
+                ->counter("tgbot_api_responses_total",
+                          labels({{"method", _method},
+                                  {"status", std::move(status)}}))
+                .add();
+        }
+    }
+
+    void retry(const char* cause) {
+        if (_metrics) {
+            _metrics
+                ->counter("tgbot_api_retries_total",
+                          labels({{"method", _method}, {"cause", cause}}))
+                .add();
+        }
+    }
+
+    void rateLimitWait(std::chrono::seconds delay) {
+        if (_metrics) {
+            _metrics
+                ->histogram("tgbot_api_rate_limit_wait_seconds",
+                            labels({{"method", _method}}))
+                .record(delay);
+        }
+    }
+
+   private:
+    MetricLabels labels(MetricLabels own) const {
+        own.insert(own.end(), _scoped.begin(), _scoped.end());
+        return own;
+    }
+
+    std::shared_ptr<Metrics> _metrics;
+    std::string _method;
+    MetricLabels _scoped;
+    std::chrono::steady_clock::time_point _started;
+};
+
+// The RequestOptions of one call: the thread's scoped options over
+// @p defaults, with their timeout turned into a deadline for all attempts
+// together and @p priority as the lane unless the options picked one.
+class CallLimits {
+   public:
+    explicit CallLimits(std::optional<RequestPriority> priority = std::nullopt,
+                        RequestOptions defaults = {})
+        : _options(std::move(defaults)) {
+        if (const auto* scoped = requestOptions()) {
+            if (scoped->connectTimeout) {
+                _options.connectTimeout = scoped->connectTimeout;
+            }
+            if (scoped->timeout) {
+                _options.timeout = scoped->timeout;
+            }
+            if (scoped->maxRetries) {
+                _options.maxRetries = scoped->maxRetries;
+            }
+            if (scoped->cancellation.cancellable()) {
+                _options.cancellation = scoped->cancellation;
+            }
+            if (scoped->priority) {
+                _options.priority = scoped->priority;
+            }
+        }
+        if (!_options.priority) {
+            _options.priority = priority;
+        }
+        if (_options.timeout) {
+            _deadline = std::chrono::steady_clock::now() + *_options.timeout;
+        }
+    }
+
+    // Scoped maxRetries, or @p fallback from the RetryPolicy.
+    [[nodiscard]] int maxRetries(int fallback) const {
+        return _options.maxRetries.value_or(fallback);
+    }
+
+    // Options of the next attempt, which gets whatever time is left.
+    RequestOptions attempt() const {
+        if (_options.cancellation.cancelled()) {
+            throw NetworkException(NetworkException::State::Cancelled,
+                                   "Request cancelled");
+        }
+        RequestOptions options = _options;
+        if (_deadline) {
+            const auto left = std::chrono::ceil<std::chrono::milliseconds>(
+                *_deadline - std::chrono::steady_clock::now());
+            if (left.count() <= 0) {
+                throw NetworkException(NetworkException::State::Timeout,
+                                       "Request timed out");
+            }
+            options.timeout = left;
+        }
+        return options;
+    }
+
+    // Whether waiting @p delay before a retry still ends before the deadline.
+    [[nodiscard]] bool fits(std::chrono::steady_clock::duration delay) const {
+        return !_deadline ||
+               std::chrono::steady_clock::now() + delay < *_deadline;
+    }
+
+    [[nodiscard]] std::optional<std::chrono::steady_clock::time_point>
+    deadline() const {
+        return _deadline;
+    }
+
+    [[nodiscard]] const CancellationToken& cancellation() const {
+        return _options.cancellation;
+    }
+
+    // Waits before a retry; throws if the call is cancelled meanwhile.
+    void sleep(std::chrono::steady_clock::duration delay) const {
+        if (!_options.cancellation.waitFor(delay)) {
+            throw NetworkException(NetworkException::State::Cancelled,
+                                   "Request cancelled");
+        }
+    }
+
+   private:
+    RequestOptions _options;
+    std::optional<std::chrono::steady_clock::time_point> _deadline;
+};
+
+// One Bot API call on its way through the request pipeline: chat migrations,
+// the RetryPolicy with its budget and circuit breaker, rate limits,
+// RequestOptions, audience tracking, logging, metrics and tracing. It does
+// no I/O itself, so that Api can drive it with blocking requests and
+// AsyncApi and BotHost with asynchronous ones:
+//
+//     ApiCall call(ctx, method, args);
+//     while (true) {
+//         const RequestOptions options = call.attempt();
+//         ... send args to call.url() within options ...
+//         ApiCall::Step step = call.complete(body, error);
+//         if (step.result) return *step.result;
+//         ... wait step.delay ...
+//     }
+//
+// @p args must outlive the call.
+class ApiCall {
+   public:
+    // What follows an attempt: the call's result, or a retry after delay.
+    struct Step {
+        std::optional<nlohmann::json> result;
+        std::chrono::milliseconds delay{0};
+    };
+
+    ApiCall(ApiContext& ctx, std::string_view method,
+            const HttpReqArg::Vec& args, RequestOptions defaults = {});
+
+    ApiCall(const ApiCall&) = delete;
+    ApiCall& operator=(const ApiCall&) = delete;
+
+    [[nodiscard]] const std::string& url() const { return _url; }
+    [[nodiscard]] const CallLimits& limits() const { return _limits; }
+
+    // Options of the next attempt. Throws NetworkException if there must be
+    // none: the circuit is open, the deadline passed or the call was
+    // cancelled.
+    RequestOptions attempt();
+
+    // Handles the outcome of the last attempt: the response body, or the
+    // exception the client failed with. Throws the call's final error.
+    Step complete(std::string body, std::exception_ptr error = nullptr);
+
+    // Blocks for a Step's delay; throws if the call is cancelled meanwhile.
+    void sleep(std::chrono::milliseconds delay);
+
+   private:
+    Step handleNetworkError(const NetworkException& ex);
+
+    // Records the end of a call that timed out or was cancelled.
+    void end(const NetworkException& ex);
+
+    ApiContext& _ctx;
+    std::string _method;
+    std::string _url;
+    const HttpReqArg::Vec& _args;
+    // Detached: AsyncApi and BotHost end calls on another thread.
+    Span _span;
+    RequestMetrics _metrics;
+    RetryControl& _control;
+    RetryPolicy _policy;
+    // Long polling paces itself; failing it fast would only make it spin,
+    // and its long waits say nothing about the health of other reads.
+    bool _guarded;
+    CallLimits _limits;
+    int _maxRetries;
+    int _retries = 0;
+    bool _resentToSupergroup = false;
+    std::chrono::milliseconds _backoff{0};
+    // Reports the current attempt to the breaker; empty for unguarded calls.
+    std::optional<CircuitBreaker::Permit> _permit;
+};
+
+}  // namespace TgBot::detail
+
+#endif  // TGBOT_INTERNAL_APICALL_H
@@ -0,0 +1,58 @@
+#ifndef TGBOT_INTERNAL_INSTRUMENTATION_H
+#define TGBOT_INTERNAL_INSTRUMENTATION_H
+
+#include <chrono>
+#include <nlohmann/json.hpp>
+#include <string>
+
+#include "tgbot/Metrics.h"
+#include "tgbot/TgTypeParser.h"
+#include "tgbot/Tracing.h"
+#include "tgbot/types/Update.h"
+
+namespace TgBot::detail {
+
+// Type of a raw update, i.e. the name of its field besides update_id
+// ("message", "callback_query", ...).
+inline std::string updateType(const nlohmann::json& update) {
+    if (update.is_object()) {
+        for (auto it = update.begin(); it != update.end(); ++it) {
+            if (it.key() != "update_id") {
+                return it.key();
+            }
+        }
+    }
+    return "unknown";
+}
+
+inline void recordUpdateParse(Metrics& metrics, const nlohmann::json& update,
+                              std::chrono::nanoseconds elapsed) {
+    metrics
+        .histogram("tgbot_update_parse_duration_seconds",
+                   scopedLabels({{"type", updateType(update)}}))
+        .record(elapsed);
+}
+
+// parse<Update> with a tracing span and the parse time recorded per update
+// type.
+inline Update::Ptr parseUpdate(const nlohmann::json& update) {
+    const auto metrics = detail::metrics();
+    if (!metrics && !tracingEnabled()) {
+        return parse<Update>(update);
+    }
+    Span span("tgbot.parse_update");
+    const auto started = std::chrono::steady_clock::now();
+    Update::Ptr parsed = parse<Update>(update);
+    if (metrics) {
+        recordUpdateParse(*metrics, update,
+                          std::chrono::steady_clock::now() - started);
+    }
+    if (span.recording()) {
+        span.setAttribute("tgbot.update_type", updateType(update));
+    }
+    return parsed;
+}
+
+}  // namespace TgBot::detail
+
+#endif  // TGBOT_INTERNAL_INSTRUMENTATION_H
@@ -0,0 +1,298 @@
+#include "tgbot/tools/MessageBuilder.h"
+
+#include "tgbot/tools/Utf16.h"
+#include "tools/Utf8.h"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+namespace TgBot {
+
+namespace {
+
+// Characters that MarkdownV2 shows as they are only after a backslash.
+constexpr std::array<bool, 256> kMarkdownV2Special = [] {
+    std::array<bool, 256> special{};
+    for (const char c : std::string_view("_*[]()~`>#+-=|{}.!\\")) {
+        special[static_cast<unsigned char>(c)] = true;
+    }
+    return special;
+}();
+
+// What HTML shows each character as; empty for the ones that stay.
+constexpr std::array<std::string_view, 256> kHtmlEntities = [] {
+    std::array<std::string_view, 256> entities{};
+    entities['<'] = "&lt;";
+    entities['>'] = "&gt;";
+    entities['&'] = "&amp;";
+    entities['"'] = "&quot;";
+    return entities;
+}();
+
+// Whether @p text is only whitespace, which Telegram rejects as an empty
+// message.
+bool blank(std::string_view text) noexcept {
+    return std::all_of(text.begin(), text.end(), [](char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+    });
+}
+
+}  // namespace
+
+std::string escapeMarkdownV2(std::string_view text) {
+    std::size_t special = 0;
+    for (const char c : text) {
+        special += kMarkdownV2Special[static_cast<unsigned char>(c)];
+    }
+    if (special == 0) {
+        return std::string(text);
+    }
+    std::string result;
+    result.reserve(text.size() + special);
+    std::size_t copied = 0;
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (kMarkdownV2Special[static_cast<unsigned char>(text[i])]) {
+            result.append(text.data() + copied, i - copied);
+            result += '\\';
+            copied = i;
+        }
+    }
+    result.append(text.data() + copied, text.size() - copied);
+    return result;
+}
+
+std::string escapeHtml(std::string_view text) {
+    std::size_t size = text.size();
+    for (const char c : text) {
+        const std::string_view entity = kHtmlEntities[static_cast<unsigned char>(c)];
+        if (!entity.empty()) {
+            size += entity.size() - 1;
+        }
+    }
+    if (size == text.size()) {
+        return std::string(text);
+    }
+    std::string result;
+    result.reserve(size);
+    std::size_t copied = 0;
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        const std::string_view entity =
+            kHtmlEntities[static_cast<unsigned char>(text[i])];
+        if (!entity.empty()) {
+            result.append(text.data() + copied, i - copied);
+            result += entity;
+            copied = i + 1;
+        }
+    }
+    result.append(text.data() + copied, text.size() - copied);
+    return result;
+}
+
+MessageBuilder& MessageBuilder::text(std::string_view text) {
+    _text += text;
+    _length += TgBot::utf16Length(text);
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::styled(MessageEntity::Type type,
+                                       std::string_view text) {
+    const std::size_t span = open(type);
+    this->text(text);
+    close(span);
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::pre(std::string_view text,
+                                    std::string_view language) {
+    const std::size_t span = open(MessageEntity::Type::Pre);
+    if (!language.empty()) {
+        _spans[span].entity->language = std::string(language);
+    }
+    this->text(text);
+    close(span);
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::link(std::string_view text,
+                                     std::string_view url) {
+    const std::size_t span = open(MessageEntity::Type::TextLink);
+    _spans[span].entity->url = std::string(url);
+    this->text(text);
+    close(span);
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::mention(std::string_view text, User::Ptr user) {
+    const std::size_t span = open(MessageEntity::Type::TextMention);
+    _spans[span].entity->user = std::move(user);
+    this->text(text);
+    close(span);
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::customEmoji(std::string_view emoji,
+                                            std::string_view customEmojiId) {
+    const std::size_t span = open(MessageEntity::Type::CustomEmoji);
+    _spans[span].entity->customEmojiId = std::string(customEmojiId);
+    text(emoji);
+    close(span);
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::begin(MessageEntity::Type type) {
+    _open.push_back(open(type));
+    return *this;
+}
+
+MessageBuilder& MessageBuilder::end() {
+    if (_open.empty()) {
+        throw std::logic_error("MessageBuilder::end() without begin()");
+    }
+    close(_open.back());
+    _open.pop_back();
+    return *this;
+}
+
+std::vector<MessageEntity::Ptr> MessageBuilder::entities() const {
+    std::vector<MessageEntity::Ptr> result;
+    for (std::size_t i = 0; i < _spans.size(); ++i) {
+        const bool isOpen =
+            std::find(_open.begin(), _open.end(), i) != _open.end();
+        const std::size_t end16 = isOpen ? _length : _spans[i].end16;
+        if (end16 == _spans[i].begin16) {
+            continue;
+        }
+        auto entity = std::make_shared<MessageEntity>(*_spans[i].entity);
+        entity->length = static_cast<std::int32_t>(end16 - _spans[i].begin16);
+        result.push_back(std::move(entity));
+    }
+    return result;
+}
+
+std::vector<MessageBuilder::Part> MessageBuilder::build(
+    std::size_t limit) const {
+    // A character takes up to two units, so fewer could never fit one.
+    limit = std::max<std::size_t>(limit, 2);
+
+    std::vector<Span> spans = _spans;
+    for (const std::size_t index : _open) {
+        spans[index].end = _text.size();
+        spans[index].end16 = _length;
+    }
+
+    std::vector<Part> parts;
+    std::size_t start = 0;
+    std::size_t start16 = 0;
+    while (start < _text.size()) {
+        // Take characters while they fit, noting the last line break and the
+        // last space to end at.
+        std::size_t pos = start;
+        std::size_t pos16 = start16;
+        std::size_t breakAt = std::string::npos;
+        std::size_t break16 = 0;
+        bool breakIsNewline = false;
+        while (pos < _text.size()) {
+            const auto lead = static_cast<unsigned char>(_text[pos]);
+            const std::size_t units = detail::unitsOf(lead);
+            if (pos16 + units - start16 > limit) {
+                break;
+            }
+            if (pos > start && (lead == '\n' || (lead == ' ' && !breakIsNewline))) {
+                breakAt = pos;
+                break16 = pos16;
+                breakIsNewline = lead == '\n';
+            }
+            pos16 += units;
+            ++pos;
+            while (pos < _text.size() &&
+                   detail::isContinuation(
+                       static_cast<unsigned char>(_text[pos]))) {
+                ++pos;
+            }
+        }
+
+        std::size_t end = pos;
+        std::size_t end16 = pos16;
+        std::size_t next = pos;
+        std::size_t next16 = pos16;
+        if (pos < _text.size()) {
+            if (breakAt != std::string::npos) {
+                // The line break or space itself is dropped.
+                end = breakAt;
+                end16 = break16;
+                next = breakAt + 1;
+                next16 = break16 + 1;
+            } else {
+                // Cutting a word; keep custom emoji whole if they fit at all.
+                for (const Span& span : spans) {
+                    if (span.entity->type == MessageEntity::Type::CustomEmoji &&
+                        span.begin > start && span.begin < end &&
+                        span.end > end) {
+                        end = span.begin;
+                        end16 = span.begin16;
+                    }
+                }
+                next = end;
+                next16 = end16;
+            }
+        }
+
+        const std::string_view chunk =
+            std::string_view(_text).substr(start, end - start);
+        const std::size_t partStart16 = start16;
+        start = next;
+        start16 = next16;
+        // Runs of line breaks or spaces longer than a message would give
+        // messages of nothing else.
+        if (blank(chunk)) {
+            continue;
+        }
+
+        Part part;
+        part.text = std::string(chunk);
+        for (const Span& span : spans) {
+            const std::size_t from16 = std::max(span.begin16, partStart16);
+            const std::size_t to16 = std::min(span.end16, end16);
+            if (to16 <= from16) {
+                continue;
+            }
+            auto entity = std::make_shared<MessageEntity>(*span.entity);
+            entity->offset = static_cast<std::int32_t>(from16 - partStart16);
+            entity->length = static_cast<std::int32_t>(to16 - from16);
+            part.entities.push_back(std::move(entity));
+        }
+        parts.push_back(std::move(part));
+    }
+    return parts;
+}
+
+std::vector<Message::Ptr> MessageBuilder::send(const Api& api,
+                                               Api::ChatIdType chatId) const {
+    std::vector<Message::Ptr> sent;
+    for (const Part& part : build()) {
+        sent.push_back(api.sendMessage(chatId, part.text, nullptr, nullptr,
+                                       nullptr, {}, {}, part.entities));
+    }
+    return sent;
+}
+
+std::size_t MessageBuilder::open(MessageEntity::Type type) {
+    auto entity = std::make_shared<MessageEntity>();
+    entity->type = type;
+    entity->offset = static_cast<std::int32_t>(_length);
+    entity->length = 0;
+    _spans.push_back(Span{std::move(entity), _text.size(), _text.size(),
+                          _length, _length});
+    return _spans.size() - 1;
+}
+
+void MessageBuilder::close(std::size_t index) {
+    Span& span = _spans[index];
+    span.end = _text.size();
+    span.end16 = _length;
+    span.entity->length = static_cast<std::int32_t>(span.end16 - span.begin16);
+}
+
+}  // namespace TgBot
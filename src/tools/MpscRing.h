@@ -0,0 +1,88 @@
+#ifndef TGBOT_INTERNAL_MPSCRING_H
+#define TGBOT_INTERNAL_MPSCRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace TgBot::detail {
+
+// Bounded lock-free queue for many producers and a single consumer.
+//
+// Each slot carries a sequence number telling producers and the consumer whose
+// turn it is (Vyukov's bounded queue): a producer claims a position with one
+// CAS on the tail, fills the slot and publishes it by bumping the sequence;
+// the consumer only ever touches the head. push() fails instead of waiting
+// when the ring is full.
+template <typename T>
+class MpscRing {
+   public:
+    explicit MpscRing(std::size_t capacity)
+        : _mask(roundUp(capacity) - 1),
+          _slots(std::make_unique<Slot[]>(_mask + 1)) {
+        for (std::size_t i = 0; i <= _mask; ++i) {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(T&& value) {
+        std::size_t pos = _tail.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = _slots[pos & _mask];
+            const std::size_t sequence =
+                slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                              static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Only called from the consumer thread.
+    std::optional<T> pop() {
+        Slot& slot = _slots[_head & _mask];
+        if (slot.sequence.load(std::memory_order_acquire) != _head + 1) {
+            return std::nullopt;
+        }
+        std::optional<T> value(std::move(slot.value));
+        slot.value = T();
+        slot.sequence.store(_head + _mask + 1, std::memory_order_release);
+        ++_head;
+        return value;
+    }
+
+   private:
+    struct Slot {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    static std::size_t roundUp(std::size_t n) {
+        std::size_t size = 2;
+        while (size < n) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    const std::size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+    alignas(64) std::atomic<std::size_t> _tail{0};
+    alignas(64) std::size_t _head = 0;
+};
+
+}  // namespace TgBot::detail
+
+#endif  // TGBOT_INTERNAL_MPSCRING_H
@@ -0,0 +1,183 @@
+#ifndef TGBOT_INTERNAL_RETRYCONTROL_H
+#define TGBOT_INTERNAL_RETRYCONTROL_H
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <utility>
+
+#include "tgbot/net/RetryPolicy.h"
+
+namespace TgBot::detail {
+
+// Next backoff with decorrelated jitter: uniform in [base, previous * 3],
+// capped. Pass a zero previous delay for the first retry of a call.
+inline std::chrono::milliseconds nextBackoff(
+    const RetryPolicy& policy, std::chrono::milliseconds previous) {
+    thread_local std::mt19937_64 random{std::random_device{}()};
+    const auto base = std::max<std::int64_t>(policy.baseDelay.count(), 0);
+    const auto cap = std::max<std::int64_t>(policy.maxDelay.count(), base);
+    const auto upper =
+        std::clamp<std::int64_t>(std::max(previous.count(), base) * 3, base, cap);
+    std::uniform_int_distribution<std::int64_t> pick(base, upper);
+    return std::chrono::milliseconds(pick(random));
+}
+
+// Token bucket holding the retries a method class may still make; refills
+// continuously at policy.retryBudget per policy.budgetWindow.
+class RetryBudget {
+   public:
+    bool tryAcquire(const RetryPolicy& policy) {
+        if (policy.retryBudget < 0) {
+            return true;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(_mutex);
+        const double capacity = policy.retryBudget;
+        if (!_started) {
+            _tokens = capacity;
+            _started = true;
+        } else if (policy.budgetWindow.count() > 0) {
+            const std::chrono::duration<double> elapsed = now - _refilled;
+            const std::chrono::duration<double> window = policy.budgetWindow;
+            _tokens = std::min(
+                capacity, _tokens + capacity * (elapsed / window));
+        }
+        _refilled = now;
+        if (_tokens < 1.0) {
+            return false;
+        }
+        _tokens -= 1.0;
+        return true;
+    }
+
+   private:
+    std::mutex _mutex;
+    bool _started = false;
+    double _tokens = 0;
+    std::chrono::steady_clock::time_point _refilled;
+};
+
+// Closed, open or half-open breaker over the calls of one method class.
+// While half-open exactly one call, the probe, is let through.
+class CircuitBreaker {
+   public:
+    // One call that allow() let through. Its outcome is reported with
+    // success(), failure() or abandon(); a permit destroyed without one, e.g.
+    // when the call threw something unexpected, abandons the call, so that a
+    // probe can never stay in flight forever.
+    class Permit {
+       public:
+        Permit(Permit&& other) noexcept
+            : _breaker(std::exchange(other._breaker, nullptr)),
+              _probe(other._probe) {}
+        Permit& operator=(Permit&& other) noexcept {
+            if (this != &other) {
+                abandon();
+                _breaker = std::exchange(other._breaker, nullptr);
+                _probe = other._probe;
+            }
+            return *this;
+        }
+        ~Permit() { abandon(); }
+
+        Permit(const Permit&) = delete;
+        Permit& operator=(const Permit&) = delete;
+
+        void success() {
+            if (auto* breaker = std::exchange(_breaker, nullptr)) {
+                breaker->success();
+            }
+        }
+
+        void failure(const RetryPolicy& policy) {
+            if (auto* breaker = std::exchange(_breaker, nullptr)) {
+                breaker->failure(policy);
+            }
+        }
+
+        // The call ended without telling anything about the API's health,
+        // e.g. it was cancelled.
+        void abandon() {
+            if (auto* breaker = std::exchange(_breaker, nullptr)) {
+                breaker->abandon(_probe);
+            }
+        }
+
+       private:
+        friend class CircuitBreaker;
+        Permit(CircuitBreaker& breaker, bool probe)
+            : _breaker(&breaker), _probe(probe) {}
+
+        CircuitBreaker* _breaker;
+        bool _probe;
+    };
+
+    // A permit for a call that may go out now, or nothing while the breaker
+    // is open.
+    std::optional<Permit> allow(const RetryPolicy& policy) {
+        if (policy.breakerThreshold <= 0) {
+            return Permit(*this, false);
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_failures < policy.breakerThreshold) {
+            return Permit(*this, false);
+        }
+        if (_probing ||
+            std::chrono::steady_clock::now() < _openedAt +
+                                                   policy.breakerCooldown) {
+            return std::nullopt;
+        }
+        _probing = true;
+        return Permit(*this, true);
+    }
+
+   private:
+    void success() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _failures = 0;
+        _probing = false;
+    }
+
+    void failure(const RetryPolicy& policy) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _probing = false;
+        if (++_failures >= policy.breakerThreshold) {
+            // A failed probe, or the failure that trips the breaker, starts
+            // a new cooldown.
+            _openedAt = std::chrono::steady_clock::now();
+        }
+    }
+
+    // Only the probe itself may end the half-open state without a verdict.
+    void abandon(bool probe) {
+        if (probe) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _probing = false;
+        }
+    }
+
+    std::mutex _mutex;
+    int _failures = 0;
+    bool _probing = false;
+    std::chrono::steady_clock::time_point _openedAt;
+};
+
+// Policy and shared retry state of one method class of an Api.
+struct RetryControl {
+    std::mutex policyMutex;
+    RetryPolicy policy;
+    RetryBudget budget;
+    CircuitBreaker breaker;
+
+    RetryPolicy currentPolicy() {
+        std::lock_guard<std::mutex> lock(policyMutex);
+        return policy;
+    }
+};
+
+}  // namespace TgBot::detail
+
+#endif  // TGBOT_INTERNAL_RETRYCONTROL_H
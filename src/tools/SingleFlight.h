@@ -0,0 +1,160 @@
+#ifndef TGBOT_INTERNAL_SINGLEFLIGHT_H
+#define TGBOT_INTERNAL_SINGLEFLIGHT_H
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "tgbot/TgException.h"
+#include "tgbot/net/RequestOptions.h"
+
+namespace TgBot::detail {
+
+// Collapses concurrent calls that share a key into a single execution.
+//
+// The first caller for a key (the leader) runs the work; callers arriving while
+// it is still in flight wait for the leader's result instead of repeating the
+// work, and receive the same value (or the same exception). Nothing is cached:
+// once the leader finishes, the key is forgotten and the next call runs again.
+//
+// Every caller waits within its own limits: a follower whose deadline passes
+// or whose token is cancelled gives up on its own, while the leader carries
+// on. A leader that timed out or was cancelled only failed for itself, so its
+// followers run the work again instead of sharing that outcome.
+//
+// Only use this for idempotent work. Coalescing a non-idempotent call would
+// silently drop the duplicates' side effects.
+template <typename Key, typename Value>
+class SingleFlight {
+   public:
+    // How long one caller is willing to wait for a leader.
+    struct Wait {
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+        CancellationToken cancellation;
+    };
+
+    template <typename Fn>
+    Value run(const Key& key, const Wait& wait, Fn&& fn) {
+        while (true) {
+            std::shared_ptr<Call> call;
+            bool leader = false;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = _calls.find(key);
+                if (it == _calls.end()) {
+                    call = std::make_shared<Call>();
+                    _calls.emplace(key, call);
+                    leader = true;
+                } else {
+                    call = it->second;
+                }
+            }
+
+            if (leader) {
+                return lead(key, *call, fn);
+            }
+            if (auto value = follow(*call, wait)) {
+                return std::move(*value);
+            }
+        }
+    }
+
+   private:
+    struct Call {
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool done = false;
+        // The leader timed out or was cancelled: its followers retry.
+        bool abandoned = false;
+        std::optional<Value> value;
+        std::exception_ptr error;
+    };
+
+    static bool ownFailure(const std::exception_ptr& error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const NetworkException& e) {
+            return e.state == NetworkException::State::Timeout ||
+                   e.state == NetworkException::State::Cancelled;
+        } catch (...) {
+            return false;
+        }
+    }
+
+    template <typename Fn>
+    Value lead(const Key& key, Call& call, Fn& fn) {
+        std::optional<Value> value;
+        std::exception_ptr error;
+        try {
+            value.emplace(fn());
+        } catch (...) {
+            error = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _calls.erase(key);
+        }
+        {
+            std::lock_guard<std::mutex> lock(call.mutex);
+            call.done = true;
+            if (error && ownFailure(error)) {
+                call.abandoned = true;
+            } else {
+                call.value = value;
+                call.error = error;
+            }
+        }
+        call.finished.notify_all();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return std::move(*value);
+    }
+
+    // The leader's value, or nothing if the caller must run the work again.
+    static std::optional<Value> follow(Call& call, const Wait& wait) {
+        // Registered before locking: a token that is already cancelled runs
+        // the callback right away, and the callback takes the lock.
+        const auto registration = wait.cancellation.onCancel([&call] {
+            std::lock_guard<std::mutex> lock(call.mutex);
+            call.finished.notify_all();
+        });
+        std::unique_lock<std::mutex> lock(call.mutex);
+        const auto ready = [&call, &wait] {
+            return call.done || wait.cancellation.cancelled();
+        };
+        if (wait.deadline) {
+            call.finished.wait_until(lock, *wait.deadline, ready);
+        } else {
+            call.finished.wait(lock, ready);
+        }
+        if (!call.done) {
+            const bool cancelled = wait.cancellation.cancelled();
+            lock.unlock();
+            throw NetworkException(cancelled
+                                       ? NetworkException::State::Cancelled
+                                       : NetworkException::State::Timeout,
+                                   cancelled ? "Request cancelled"
+                                             : "Request timed out");
+        }
+        if (call.abandoned) {
+            return std::nullopt;
+        }
+        if (call.error) {
+            std::rethrow_exception(call.error);
+        }
+        return call.value;
+    }
+
+    std::mutex _mutex;
+    std::unordered_map<Key, std::shared_ptr<Call>> _calls;
+};
+
+}  // namespace TgBot::detail
+
+#endif  // TGBOT_INTERNAL_SINGLEFLIGHT_H
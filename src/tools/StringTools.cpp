@@ -74,4 +74,17 @@ std::string urlDecode(const std::string& value) {
     return result;
 }
 
+bool constantTimeEquals(const std::string& str1, const std::string& str2) {
+    // Scan the longer string completely and accumulate differences instead
+    // of returning at the first mismatch.
+    const std::size_t length = std::max(str1.size(), str2.size());
+    unsigned char diff = str1.size() == str2.size() ? 0 : 1;
+    for (std::size_t i = 0; i < length; ++i) {
+        const auto c1 = static_cast<unsigned char>(i < str1.size() ? str1[i] : 0);
+        const auto c2 = static_cast<unsigned char>(i < str2.size() ? str2[i] : 0);
+        diff |= static_cast<unsigned char>(c1 ^ c2);
+    }
+    return diff == 0;
+}
+
 }
@@ -0,0 +1,268 @@
+#include "tgbot/tools/Utf16.h"
+
+#include "tgbot/types/Message.h"
+#include "tools/Utf8.h"
+
+#include <algorithm>
+#include <limits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define TGBOT_UTF16_X86 1
+#endif
+
+namespace TgBot {
+
+namespace {
+
+using detail::isContinuation;
+using detail::unitsOf;
+
+// Advances over whole blocks of p[0, size) while the units they hold keep
+// units below limit. Returns the bytes skipped; the caller finishes byte by
+// byte.
+using SkipBlocks = std::size_t (*)(const unsigned char* p, std::size_t size,
+                                   std::size_t& units, std::size_t limit);
+
+std::size_t skipBlocksScalar(const unsigned char* p, std::size_t size,
+                             std::size_t& units, std::size_t limit) {
+    constexpr std::size_t kBlock = 8;
+    std::size_t pos = 0;
+    for (; pos + kBlock <= size; pos += kBlock) {
+        std::size_t blockUnits = 0;
+        for (std::size_t i = 0; i < kBlock; ++i) {
+            blockUnits += unitsOf(p[pos + i]);
+        }
+        if (units + blockUnits >= limit) {
+            break;
+        }
+        units += blockUnits;
+    }
+    return pos;
+}
+
+#ifdef TGBOT_UTF16_X86
+
+// In signed bytes, continuation bytes are [-128, -65] and four byte leaders
+// [-16, -1].
+__attribute__((target("sse2"))) std::size_t skipBlocksSse2(
+    const unsigned char* p, std::size_t size, std::size_t& units,
+    std::size_t limit) {
+    const __m128i lastContinuation = _mm_set1_epi8(-65);
+    const __m128i belowFourByte = _mm_set1_epi8(-17);
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t pos = 0;
+    for (; pos + 16 <= size; pos += 16) {
+        const __m128i bytes =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + pos));
+        const auto leading = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_cmpgt_epi8(bytes, lastContinuation)));
+        const auto fourByte = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpgt_epi8(bytes, belowFourByte),
+                          _mm_cmplt_epi8(bytes, zero))));
+        const auto blockUnits = static_cast<std::size_t>(
+            __builtin_popcount(leading) + __builtin_popcount(fourByte));
+        if (units + blockUnits >= limit) {
+            break;
+        }
+        units += blockUnits;
+    }
+    return pos;
+}
+
+__attribute__((target("avx2,popcnt"))) std::size_t skipBlocksAvx2(
+    const unsigned char* p, std::size_t size, std::size_t& units,
+    std::size_t limit) {
+    const __m256i lastContinuation = _mm256_set1_epi8(-65);
+    const __m256i belowFourByte = _mm256_set1_epi8(-17);
+    const __m256i zero = _mm256_setzero_si256();
+    std::size_t pos = 0;
+    for (; pos + 32 <= size; pos += 32) {
+        const __m256i bytes =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + pos));
+        const auto leading = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_cmpgt_epi8(bytes, lastContinuation)));
+        const auto fourByte = static_cast<unsigned>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpgt_epi8(bytes, belowFourByte),
+                             _mm256_cmpgt_epi8(zero, bytes))));
+        const auto blockUnits = static_cast<std::size_t>(
+            __builtin_popcount(leading) + __builtin_popcount(fourByte));
+        if (units + blockUnits >= limit) {
+            break;
+        }
+        units += blockUnits;
+    }
+    // A 16 byte block may still fit where a 32 byte one did not.
+    return pos + skipBlocksSse2(p + pos, size - pos, units, limit);
+}
+
+#endif
+
+SkipBlocks pickSkipBlocks() noexcept {
+#ifdef TGBOT_UTF16_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return skipBlocksAvx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return skipBlocksSse2;
+    }
+#endif
+    return skipBlocksScalar;
+}
+
+// Picked on first use rather than during static initialization, so that it is
+// also ready for callers in other static initializers.
+SkipBlocks skipBlocks() noexcept {
+    static const SkipBlocks skip = pickSkipBlocks();
+    return skip;
+}
+
+// Walks a UTF-8 string forward, keeping its byte and UTF-16 positions in step.
+class Cursor {
+   public:
+    explicit Cursor(std::string_view text)
+        : _skipBlocks(skipBlocks()),
+          _p(reinterpret_cast<const unsigned char*>(text.data())),
+          _size(text.size()) {}
+
+    // Moves to the first character that starts at or after UTF-16 offset
+    // units, or to the end of the text.
+    std::size_t seekUnits(std::size_t units) {
+        if (_units < units) {
+            _pos += _skipBlocks(_p + _pos, _size - _pos, _units, units);
+        }
+        while (_pos < _size && (_units < units || isContinuation(_p[_pos]))) {
+            _units += unitsOf(_p[_pos++]);
+        }
+        return _pos;
+    }
+
+    // Moves to byte offset pos, clamped to the text, and returns the UTF-16
+    // units before it.
+    std::size_t seekByte(std::size_t pos) {
+        pos = std::min(pos, _size);
+        if (_pos < pos) {
+            _pos += _skipBlocks(_p + _pos, pos - _pos, _units,
+                               std::numeric_limits<std::size_t>::max());
+        }
+        while (_pos < pos) {
+            _units += unitsOf(_p[_pos++]);
+        }
+        return _units;
+    }
+
+   private:
+    SkipBlocks _skipBlocks;
+    const unsigned char* _p;
+    std::size_t _size;
+    std::size_t _pos = 0;
+    std::size_t _units = 0;
+};
+
+// A start or end of one of the ranges; visited in increasing position so
+// that the text is walked once.
+struct Boundary {
+    std::size_t position;
+    std::size_t index;
+    bool end;
+};
+
+// Starts go before ends at the same position, so that empty ranges come out
+// empty.
+void sortBoundaries(std::vector<Boundary>& boundaries) {
+    std::sort(boundaries.begin(), boundaries.end(),
+              [](const Boundary& a, const Boundary& b) {
+                  return a.position != b.position ? a.position < b.position
+                                                  : a.end < b.end;
+              });
+}
+
+std::size_t nonNegative(std::int32_t value) {
+    return value > 0 ? static_cast<std::size_t>(value) : 0;
+}
+
+}  // namespace
+
+std::size_t utf16Length(std::string_view text) noexcept {
+    Cursor cursor(text);
+    return cursor.seekByte(text.size());
+}
+
+std::vector<Utf8Range> utf8Ranges(
+    std::string_view text, const std::vector<MessageEntity::Ptr>& entities) {
+    std::vector<Boundary> boundaries;
+    boundaries.reserve(entities.size() * 2);
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        if (!entities[i]) {
+            continue;
+        }
+        const std::size_t offset = nonNegative(entities[i]->offset);
+        boundaries.push_back({offset, i, false});
+        boundaries.push_back(
+            {offset + nonNegative(entities[i]->length), i, true});
+    }
+    sortBoundaries(boundaries);
+
+    std::vector<Utf8Range> result(entities.size());
+    Cursor cursor(text);
+    for (const Boundary& boundary : boundaries) {
+        const std::size_t pos = cursor.seekUnits(boundary.position);
+        Utf8Range& range = result[boundary.index];
+        if (boundary.end) {
+            range.length = pos - range.offset;
+        } else {
+            range.offset = pos;
+        }
+    }
+    return result;
+}
+
+std::vector<Utf8Range> utf8Ranges(const Message& message) {
+    if (message.text) {
+        return message.entities ? utf8Ranges(*message.text, *message.entities)
+                                : std::vector<Utf8Range>();
+    }
+    if (message.caption && message.captionEntities) {
+        return utf8Ranges(*message.caption, *message.captionEntities);
+    }
+    return {};
+}
+
+std::vector<Utf16Range> utf16Ranges(std::string_view text,
+                                    const std::vector<Utf8Range>& ranges) {
+    std::vector<Boundary> boundaries;
+    boundaries.reserve(ranges.size() * 2);
+    for (std::size_t i = 0; i < ranges.size(); ++i) {
+        boundaries.push_back({ranges[i].offset, i, false});
+        boundaries.push_back({ranges[i].offset + ranges[i].length, i, true});
+    }
+    sortBoundaries(boundaries);
+
+    std::vector<Utf16Range> result(ranges.size());
+    Cursor cursor(text);
+    for (const Boundary& boundary : boundaries) {
+        const auto units = static_cast<std::int32_t>(
+            cursor.seekByte(boundary.position));
+        Utf16Range& range = result[boundary.index];
+        if (boundary.end) {
+            range.length = units - range.offset;
+        } else {
+            range.offset = units;
+        }
+    }
+    return result;
+}
+
+MessageEntity::Ptr makeEntity(std::string_view text, const Utf8Range& range,
+                              MessageEntity::Type type) {
+    const Utf16Range units = utf16Ranges(text, {range}).front();
+    auto entity = std::make_shared<MessageEntity>();
+    entity->type = type;
+    entity->offset = units.offset;
+    entity->length = units.length;
+    return entity;
+}
+
+}  // namespace TgBot
@@ -0,0 +1,22 @@
+#ifndef TGBOT_INTERNAL_UTF8_H
+#define TGBOT_INTERNAL_UTF8_H
+
+#include <cstddef>
+
+namespace TgBot::detail {
+
+// UTF-16 code units that a UTF-8 byte starts: one for every byte but the
+// continuation bytes 10xxxxxx, and one more for the leading byte of a four
+// byte sequence, which becomes a surrogate pair.
+inline std::size_t unitsOf(unsigned char byte) noexcept {
+    return static_cast<std::size_t>((byte & 0xC0) != 0x80) +
+           static_cast<std::size_t>(byte >= 0xF0);
+}
+
+inline bool isContinuation(unsigned char byte) noexcept {
+    return (byte & 0xC0) == 0x80;
+}
+
+}  // namespace TgBot::detail
+
+#endif  // TGBOT_INTERNAL_UTF8_H
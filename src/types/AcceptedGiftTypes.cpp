@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    unlimitedGifts,
+    limitedGifts,
+    uniqueGifts,
+    premiumSubscription,
+    giftsFromChannels,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"unlimited_gifts", Field::unlimitedGifts},
+    {"limited_gifts", Field::limitedGifts},
+    {"unique_gifts", Field::uniqueGifts},
+    {"premium_subscription", Field::premiumSubscription},
+    {"gifts_from_channels", Field::giftsFromChannels},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<AcceptedGiftTypes> parse(const nlohmann::json &data) {
     auto result = std::make_shared<AcceptedGiftTypes>();
-    parse(data, "unlimited_gifts", &result->unlimitedGifts);
-    parse(data, "limited_gifts", &result->limitedGifts);
-    parse(data, "unique_gifts", &result->uniqueGifts);
-    parse(data, "premium_subscription", &result->premiumSubscription);
-    parse(data, "gifts_from_channels", &result->giftsFromChannels);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::unlimitedGifts:
+                detail::parseValue(value, &result->unlimitedGifts);
+                break;
+            case Field::limitedGifts:
+                detail::parseValue(value, &result->limitedGifts);
+                break;
+            case Field::uniqueGifts:
+                detail::parseValue(value, &result->uniqueGifts);
+                break;
+            case Field::premiumSubscription:
+                detail::parseValue(value, &result->premiumSubscription);
+                break;
+            case Field::giftsFromChannels:
+                detail::parseValue(value, &result->giftsFromChannels);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<AcceptedGiftTypes> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("unlimited_gifts", object->unlimitedGifts);
+        json.put("gifts_from_channels", object->giftsFromChannels);
         json.put("limited_gifts", object->limitedGifts);
-        json.put("unique_gifts", object->uniqueGifts);
         json.put("premium_subscription", object->premiumSubscription);
-        json.put("gifts_from_channels", object->giftsFromChannels);
+        json.put("unique_gifts", object->uniqueGifts);
+        json.put("unlimited_gifts", object->unlimitedGifts);
     }
     return json;
 }
@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    affiliateUser,
+    affiliateChat,
+    commissionPerMille,
+    amount,
+    nanostarAmount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"affiliate_user", Field::affiliateUser},
+    {"affiliate_chat", Field::affiliateChat},
+    {"commission_per_mille", Field::commissionPerMille},
+    {"amount", Field::amount},
+    {"nanostar_amount", Field::nanostarAmount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<AffiliateInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<AffiliateInfo>();
-    result->affiliateUser = parse<User>(data, "affiliate_user");
-    result->affiliateChat = parse<Chat>(data, "affiliate_chat");
-    parse(data, "commission_per_mille", &result->commissionPerMille);
-    parse(data, "amount", &result->amount);
-    parse(data, "nanostar_amount", &result->nanostarAmount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::affiliateUser:
+                result->affiliateUser = parse<User>(value);
+                break;
+            case Field::affiliateChat:
+                result->affiliateChat = parse<Chat>(value);
+                break;
+            case Field::commissionPerMille:
+                detail::parseValue(value, &result->commissionPerMille);
+                break;
+            case Field::amount:
+                detail::parseValue(value, &result->amount);
+                break;
+            case Field::nanostarAmount:
+                detail::parseValue(value, &result->nanostarAmount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,10 +53,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<AffiliateInfo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("affiliate_user", object->affiliateUser);
         json.put("affiliate_chat", object->affiliateChat);
-        json.put("commission_per_mille", object->commissionPerMille);
+        json.put("affiliate_user", object->affiliateUser);
         json.put("amount", object->amount);
+        json.put("commission_per_mille", object->commissionPerMille);
         json.put("nanostar_amount", object->nanostarAmount);
     }
     return json;
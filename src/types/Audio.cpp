@@ -4,18 +4,68 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    fileId,
+    fileUniqueId,
+    duration,
+    performer,
+    title,
+    fileName,
+    mimeType,
+    fileSize,
+    thumbnail,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"file_id", Field::fileId},
+    {"file_unique_id", Field::fileUniqueId},
+    {"duration", Field::duration},
+    {"performer", Field::performer},
+    {"title", Field::title},
+    {"file_name", Field::fileName},
+    {"mime_type", Field::mimeType},
+    {"file_size", Field::fileSize},
+    {"thumbnail", Field::thumbnail},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Audio> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Audio>();
-    parse(data, "file_id", &result->fileId);
-    parse(data, "file_unique_id", &result->fileUniqueId);
-    parse(data, "duration", &result->duration);
-    parse(data, "performer", &result->performer);
-    parse(data, "title", &result->title);
-    parse(data, "file_name", &result->fileName);
-    parse(data, "mime_type", &result->mimeType);
-    parse(data, "file_size", &result->fileSize);
-    result->thumbnail = parse<PhotoSize>(data, "thumbnail");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::fileId:
+                detail::parseValue(value, &result->fileId);
+                break;
+            case Field::fileUniqueId:
+                detail::parseValue(value, &result->fileUniqueId);
+                break;
+            case Field::duration:
+                detail::parseValue(value, &result->duration);
+                break;
+            case Field::performer:
+                detail::parseValue(value, &result->performer);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::fileName:
+                detail::parseValue(value, &result->fileName);
+                break;
+            case Field::mimeType:
+                detail::parseValue(value, &result->mimeType);
+                break;
+            case Field::fileSize:
+                detail::parseValue(value, &result->fileSize);
+                break;
+            case Field::thumbnail:
+                result->thumbnail = parse<PhotoSize>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -23,15 +73,15 @@ template <>
 nlohmann::json put(const std::shared_ptr<Audio> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("file_id", object->fileId);
-        json.put("file_unique_id", object->fileUniqueId);
         json.put("duration", object->duration);
-        json.put("performer", object->performer);
-        json.put("title", object->title);
+        json.put("file_id", object->fileId);
         json.put("file_name", object->fileName);
-        json.put("mime_type", object->mimeType);
         json.put("file_size", object->fileSize);
+        json.put("file_unique_id", object->fileUniqueId);
+        json.put("mime_type", object->mimeType);
+        json.put("performer", object->performer);
         json.put("thumbnail", object->thumbnail);
+        json.put("title", object->title);
     }
     return json;
 }
@@ -7,38 +7,26 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<BackgroundFill>>({
+    {"solid", detail::subtype<BackgroundFill, BackgroundFillSolid>()},
+    {"gradient", detail::subtype<BackgroundFill, BackgroundFillGradient>()},
+    {"freeform_gradient", detail::subtype<BackgroundFill, BackgroundFillFreeformGradient>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BackgroundFill> parse(const nlohmann::json &data) {
-    std::string type;
-    BackgroundFill::Ptr result;
-    parse(data, "type", &type);
-    if (type == "solid") {
-        result = parse<BackgroundFillSolid>(data);
-    } else if (type == "gradient") {
-        result = parse<BackgroundFillGradient>(data);
-    } else if (type == "freeform_gradient") {
-        result = parse<BackgroundFillFreeformGradient>(data);
-    } else {
-        throw invalidType("BackgroundFill", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "BackgroundFill");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<BackgroundFill> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "solid") {
-            json += put<BackgroundFillSolid>(object);
-        } else if (object->type == "gradient") {
-            json += put<BackgroundFillGradient>(object);
-        } else if (object->type == "freeform_gradient") {
-            json += put<BackgroundFillFreeformGradient>(object);
-        } else {
-            throw invalidType("BackgroundFill", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "BackgroundFill");
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    colors,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"colors", Field::colors},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BackgroundFillFreeformGradient> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BackgroundFillFreeformGradient>();
-    parse(data, "type", &result->type);
-    result->colors = parsePrimitiveRequiredArray<std::int64_t>(data, "colors");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::colors:
+                result->colors = parsePrimitiveArray<std::int64_t>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<BackgroundFillFreeformGradient> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("colors", object->colors);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    topColor,
+    bottomColor,
+    rotationAngle,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"top_color", Field::topColor},
+    {"bottom_color", Field::bottomColor},
+    {"rotation_angle", Field::rotationAngle},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BackgroundFillGradient> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BackgroundFillGradient>();
-    parse(data, "type", &result->type);
-    parse(data, "top_color", &result->topColor);
-    parse(data, "bottom_color", &result->bottomColor);
-    parse(data, "rotation_angle", &result->rotationAngle);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::topColor:
+                detail::parseValue(value, &result->topColor);
+                break;
+            case Field::bottomColor:
+                detail::parseValue(value, &result->bottomColor);
+                break;
+            case Field::rotationAngle:
+                detail::parseValue(value, &result->rotationAngle);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<BackgroundFillGradient> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("top_color", object->topColor);
         json.put("bottom_color", object->bottomColor);
         json.put("rotation_angle", object->rotationAngle);
+        json.put("top_color", object->topColor);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    color,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"color", Field::color},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BackgroundFillSolid> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BackgroundFillSolid>();
-    parse(data, "type", &result->type);
-    parse(data, "color", &result->color);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::color:
+                detail::parseValue(value, &result->color);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<BackgroundFillSolid> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("color", object->color);
+        json.put("type", object->type);
     }
     return json;
 }
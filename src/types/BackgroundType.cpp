@@ -8,42 +8,27 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<BackgroundType>>({
+    {"fill", detail::subtype<BackgroundType, BackgroundTypeFill>()},
+    {"wallpaper", detail::subtype<BackgroundType, BackgroundTypeWallpaper>()},
+    {"pattern", detail::subtype<BackgroundType, BackgroundTypePattern>()},
+    {"chat_theme", detail::subtype<BackgroundType, BackgroundTypeChatTheme>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BackgroundType> parse(const nlohmann::json &data) {
-    std::string type;
-    BackgroundType::Ptr result;
-    parse(data, "type", &type);
-    if (type == "fill") {
-        result = parse<BackgroundTypeFill>(data);
-    } else if (type == "wallpaper") {
-        result = parse<BackgroundTypeWallpaper>(data);
-    } else if (type == "pattern") {
-        result = parse<BackgroundTypePattern>(data);
-    } else if (type == "chat_theme") {
-        result = parse<BackgroundTypeChatTheme>(data);
-    } else {
-        throw invalidType("BackgroundType", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "BackgroundType");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<BackgroundType> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "fill") {
-            json += put<BackgroundTypeFill>(object);
-        } else if (object->type == "wallpaper") {
-            json += put<BackgroundTypeWallpaper>(object);
-        } else if (object->type == "pattern") {
-            json += put<BackgroundTypePattern>(object);
-        } else if (object->type == "chat_theme") {
-            json += put<BackgroundTypeChatTheme>(object);
-        } else {
-            throw invalidType("BackgroundType", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "BackgroundType");
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    themeName,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"theme_name", Field::themeName},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BackgroundTypeChatTheme> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BackgroundTypeChatTheme>();
-    parse(data, "type", &result->type);
-    parse(data, "theme_name", &result->themeName);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::themeName:
+                detail::parseValue(value, &result->themeName);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<BackgroundTypeChatTheme> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("theme_name", object->themeName);
+        json.put("type", object->type);
     }
     return json;
 }
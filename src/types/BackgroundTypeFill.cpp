@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    fill,
+    darkThemeDimming,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"fill", Field::fill},
+    {"dark_theme_dimming", Field::darkThemeDimming},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BackgroundTypeFill> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BackgroundTypeFill>();
-    parse(data, "type", &result->type);
-    result->fill = parseRequired<BackgroundFill>(data, "fill");
-    parse(data, "dark_theme_dimming", &result->darkThemeDimming);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::fill:
+                result->fill = parse<BackgroundFill>(value);
+                break;
+            case Field::darkThemeDimming:
+                detail::parseValue(value, &result->darkThemeDimming);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<BackgroundTypeFill> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("fill", object->fill);
         json.put("dark_theme_dimming", object->darkThemeDimming);
+        json.put("fill", object->fill);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    document,
+    fill,
+    intensity,
+    isInverted,
+    isMoving,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"document", Field::document},
+    {"fill", Field::fill},
+    {"intensity", Field::intensity},
+    {"is_inverted", Field::isInverted},
+    {"is_moving", Field::isMoving},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BackgroundTypePattern> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BackgroundTypePattern>();
-    parse(data, "type", &result->type);
-    result->document = parseRequired<Document>(data, "document");
-    result->fill = parseRequired<BackgroundFill>(data, "fill");
-    parse(data, "intensity", &result->intensity);
-    parse(data, "is_inverted", &result->isInverted);
-    parse(data, "is_moving", &result->isMoving);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::document:
+                result->document = parse<Document>(value);
+                break;
+            case Field::fill:
+                result->fill = parse<BackgroundFill>(value);
+                break;
+            case Field::intensity:
+                detail::parseValue(value, &result->intensity);
+                break;
+            case Field::isInverted:
+                detail::parseValue(value, &result->isInverted);
+                break;
+            case Field::isMoving:
+                detail::parseValue(value, &result->isMoving);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<BackgroundTypePattern> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("document", object->document);
         json.put("fill", object->fill);
         json.put("intensity", object->intensity);
         json.put("is_inverted", object->isInverted);
         json.put("is_moving", object->isMoving);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    document,
+    darkThemeDimming,
+    isBlurred,
+    isMoving,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"document", Field::document},
+    {"dark_theme_dimming", Field::darkThemeDimming},
+    {"is_blurred", Field::isBlurred},
+    {"is_moving", Field::isMoving},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BackgroundTypeWallpaper> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BackgroundTypeWallpaper>();
-    parse(data, "type", &result->type);
-    result->document = parseRequired<Document>(data, "document");
-    parse(data, "dark_theme_dimming", &result->darkThemeDimming);
-    parse(data, "is_blurred", &result->isBlurred);
-    parse(data, "is_moving", &result->isMoving);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::document:
+                result->document = parse<Document>(value);
+                break;
+            case Field::darkThemeDimming:
+                detail::parseValue(value, &result->darkThemeDimming);
+                break;
+            case Field::isBlurred:
+                detail::parseValue(value, &result->isBlurred);
+                break;
+            case Field::isMoving:
+                detail::parseValue(value, &result->isMoving);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<BackgroundTypeWallpaper> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("document", object->document);
         json.put("dark_theme_dimming", object->darkThemeDimming);
+        json.put("document", object->document);
         json.put("is_blurred", object->isBlurred);
         json.put("is_moving", object->isMoving);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    day,
+    month,
+    year,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"day", Field::day},
+    {"month", Field::month},
+    {"year", Field::year},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Birthdate> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Birthdate>();
-    parse(data, "day", &result->day);
-    parse(data, "month", &result->month);
-    parse(data, "year", &result->year);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::day:
+                detail::parseValue(value, &result->day);
+                break;
+            case Field::month:
+                detail::parseValue(value, &result->month);
+                break;
+            case Field::year:
+                detail::parseValue(value, &result->year);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    isAccessRestricted,
+    addedUsers,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"is_access_restricted", Field::isAccessRestricted},
+    {"added_users", Field::addedUsers},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotAccessSettings> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BotAccessSettings>();
-    parse(data, "is_access_restricted", &result->isAccessRestricted);
-    result->addedUsers = parseArray<User>(data, "added_users");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::isAccessRestricted:
+                detail::parseValue(value, &result->isAccessRestricted);
+                break;
+            case Field::addedUsers:
+                result->addedUsers = parseArray<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<BotAccessSettings> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("is_access_restricted", object->isAccessRestricted);
         json.put("added_users", object->addedUsers);
+        json.put("is_access_restricted", object->isAccessRestricted);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    command,
+    description,
+    isEphemeral,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"command", Field::command},
+    {"description", Field::description},
+    {"is_ephemeral", Field::isEphemeral},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotCommand> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BotCommand>();
-    parse(data, "command", &result->command);
-    parse(data, "description", &result->description);
-    parse(data, "is_ephemeral", &result->isEphemeral);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::command:
+                detail::parseValue(value, &result->command);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::isEphemeral:
+                detail::parseValue(value, &result->isEphemeral);
+                break;
+        }
+    });
     return result;
 }
 
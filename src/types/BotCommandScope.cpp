@@ -11,54 +11,30 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<BotCommandScope>>({
+    {"default", detail::subtype<BotCommandScope, BotCommandScopeDefault>()},
+    {"all_private_chats", detail::subtype<BotCommandScope, BotCommandScopeAllPrivateChats>()},
+    {"all_group_chats", detail::subtype<BotCommandScope, BotCommandScopeAllGroupChats>()},
+    {"all_chat_administrators", detail::subtype<BotCommandScope, BotCommandScopeAllChatAdministrators>()},
+    {"chat", detail::subtype<BotCommandScope, BotCommandScopeChat>()},
+    {"chat_administrators", detail::subtype<BotCommandScope, BotCommandScopeChatAdministrators>()},
+    {"chat_member", detail::subtype<BotCommandScope, BotCommandScopeChatMember>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotCommandScope> parse(const nlohmann::json &data) {
-    std::string type;
-    BotCommandScope::Ptr result;
-    parse(data, "type", &type);
-    if (type == "default") {
-        result = parse<BotCommandScopeDefault>(data);
-    } else if (type == "all_private_chats") {
-        result = parse<BotCommandScopeAllPrivateChats>(data);
-    } else if (type == "all_group_chats") {
-        result = parse<BotCommandScopeAllGroupChats>(data);
-    } else if (type == "all_chat_administrators") {
-        result = parse<BotCommandScopeAllChatAdministrators>(data);
-    } else if (type == "chat") {
-        result = parse<BotCommandScopeChat>(data);
-    } else if (type == "chat_administrators") {
-        result = parse<BotCommandScopeChatAdministrators>(data);
-    } else if (type == "chat_member") {
-        result = parse<BotCommandScopeChatMember>(data);
-    } else {
-        throw invalidType("BotCommandScope", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "BotCommandScope");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<BotCommandScope> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "default") {
-            json += put<BotCommandScopeDefault>(object);
-        } else if (object->type == "all_private_chats") {
-            json += put<BotCommandScopeAllPrivateChats>(object);
-        } else if (object->type == "all_group_chats") {
-            json += put<BotCommandScopeAllGroupChats>(object);
-        } else if (object->type == "all_chat_administrators") {
-            json += put<BotCommandScopeAllChatAdministrators>(object);
-        } else if (object->type == "chat") {
-            json += put<BotCommandScopeChat>(object);
-        } else if (object->type == "chat_administrators") {
-            json += put<BotCommandScopeChatAdministrators>(object);
-        } else if (object->type == "chat_member") {
-            json += put<BotCommandScopeChatMember>(object);
-        } else {
-            throw invalidType("BotCommandScope", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "BotCommandScope");
     }
     return json;
 }
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotCommandScopeAllGroupChats> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BotCommandScopeAllGroupChats>();
-    parse(data, "type", &result->type);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    chatId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"chat_id", Field::chatId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotCommandScopeChat> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BotCommandScopeChat>();
-    parse(data, "type", &result->type);
-    parse(data, "chat_id", &result->chatId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::chatId:
+                detail::parseValue(value, &result->chatId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<BotCommandScopeChat> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("chat_id", object->chatId);
+        json.put("type", object->type);
     }
     return json;
 }
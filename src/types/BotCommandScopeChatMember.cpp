@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    chatId,
+    userId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"chat_id", Field::chatId},
+    {"user_id", Field::userId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotCommandScopeChatMember> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BotCommandScopeChatMember>();
-    parse(data, "type", &result->type);
-    parse(data, "chat_id", &result->chatId);
-    parse(data, "user_id", &result->userId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::chatId:
+                detail::parseValue(value, &result->chatId);
+                break;
+            case Field::userId:
+                detail::parseValue(value, &result->userId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,8 +43,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<BotCommandScopeChatMember> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("chat_id", object->chatId);
+        json.put("type", object->type);
         json.put("user_id", object->userId);
     }
     return json;
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    description,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"description", Field::description},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotDescription> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BotDescription>();
-    parse(data, "description", &result->description);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    name,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"name", Field::name},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotName> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BotName>();
-    parse(data, "name", &result->name);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    shortDescription,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"short_description", Field::shortDescription},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotShortDescription> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BotShortDescription>();
-    parse(data, "short_description", &result->shortDescription);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::shortDescription:
+                detail::parseValue(value, &result->shortDescription);
+                break;
+        }
+    });
     return result;
 }
 
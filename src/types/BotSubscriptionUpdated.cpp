@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    user,
+    invoicePayload,
+    state,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"user", Field::user},
+    {"invoice_payload", Field::invoicePayload},
+    {"state", Field::state},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BotSubscriptionUpdated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BotSubscriptionUpdated>();
-    result->user = parseRequired<User>(data, "user");
-    parse(data, "invoice_payload", &result->invoicePayload);
-    parse(data, "state", &result->state);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::invoicePayload:
+                detail::parseValue(value, &result->invoicePayload);
+                break;
+            case Field::state:
+                detail::parseValue(value, &result->state);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<BotSubscriptionUpdated> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("user", object->user);
         json.put("invoice_payload", object->invoicePayload);
         json.put("state", object->state);
+        json.put("user", object->user);
     }
     return json;
 }
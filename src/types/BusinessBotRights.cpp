@@ -4,23 +4,93 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    canReply,
+    canReadMessages,
+    canDeleteSentMessages,
+    canDeleteAllMessages,
+    canEditName,
+    canEditBio,
+    canEditProfilePhoto,
+    canEditUsername,
+    canChangeGiftSettings,
+    canViewGiftsAndStars,
+    canConvertGiftsToStars,
+    canTransferAndUpgradeGifts,
+    canTransferStars,
+    canManageStories,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"can_reply", Field::canReply},
+    {"can_read_messages", Field::canReadMessages},
+    {"can_delete_sent_messages", Field::canDeleteSentMessages},
+    {"can_delete_all_messages", Field::canDeleteAllMessages},
+    {"can_edit_name", Field::canEditName},
+    {"can_edit_bio", Field::canEditBio},
+    {"can_edit_profile_photo", Field::canEditProfilePhoto},
+    {"can_edit_username", Field::canEditUsername},
+    {"can_change_gift_settings", Field::canChangeGiftSettings},
+    {"can_view_gifts_and_stars", Field::canViewGiftsAndStars},
+    {"can_convert_gifts_to_stars", Field::canConvertGiftsToStars},
+    {"can_transfer_and_upgrade_gifts", Field::canTransferAndUpgradeGifts},
+    {"can_transfer_stars", Field::canTransferStars},
+    {"can_manage_stories", Field::canManageStories},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BusinessBotRights> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BusinessBotRights>();
-    parse(data, "can_reply", &result->canReply);
-    parse(data, "can_read_messages", &result->canReadMessages);
-    parse(data, "can_delete_sent_messages", &result->canDeleteSentMessages);
-    parse(data, "can_delete_all_messages", &result->canDeleteAllMessages);
-    parse(data, "can_edit_name", &result->canEditName);
-    parse(data, "can_edit_bio", &result->canEditBio);
-    parse(data, "can_edit_profile_photo", &result->canEditProfilePhoto);
-    parse(data, "can_edit_username", &result->canEditUsername);
-    parse(data, "can_change_gift_settings", &result->canChangeGiftSettings);
-    parse(data, "can_view_gifts_and_stars", &result->canViewGiftsAndStars);
-    parse(data, "can_convert_gifts_to_stars", &result->canConvertGiftsToStars);
-    parse(data, "can_transfer_and_upgrade_gifts", &result->canTransferAndUpgradeGifts);
-    parse(data, "can_transfer_stars", &result->canTransferStars);
-    parse(data, "can_manage_stories", &result->canManageStories);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::canReply:
+                detail::parseValue(value, &result->canReply);
+                break;
+            case Field::canReadMessages:
+                detail::parseValue(value, &result->canReadMessages);
+                break;
+            case Field::canDeleteSentMessages:
+                detail::parseValue(value, &result->canDeleteSentMessages);
+                break;
+            case Field::canDeleteAllMessages:
+                detail::parseValue(value, &result->canDeleteAllMessages);
+                break;
+            case Field::canEditName:
+                detail::parseValue(value, &result->canEditName);
+                break;
+            case Field::canEditBio:
+                detail::parseValue(value, &result->canEditBio);
+                break;
+            case Field::canEditProfilePhoto:
+                detail::parseValue(value, &result->canEditProfilePhoto);
+                break;
+            case Field::canEditUsername:
+                detail::parseValue(value, &result->canEditUsername);
+                break;
+            case Field::canChangeGiftSettings:
+                detail::parseValue(value, &result->canChangeGiftSettings);
+                break;
+            case Field::canViewGiftsAndStars:
+                detail::parseValue(value, &result->canViewGiftsAndStars);
+                break;
+            case Field::canConvertGiftsToStars:
+                detail::parseValue(value, &result->canConvertGiftsToStars);
+                break;
+            case Field::canTransferAndUpgradeGifts:
+                detail::parseValue(value, &result->canTransferAndUpgradeGifts);
+                break;
+            case Field::canTransferStars:
+                detail::parseValue(value, &result->canTransferStars);
+                break;
+            case Field::canManageStories:
+                detail::parseValue(value, &result->canManageStories);
+                break;
+        }
+    });
     return result;
 }
 
@@ -28,20 +98,20 @@ template <>
 nlohmann::json put(const std::shared_ptr<BusinessBotRights> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("can_reply", object->canReply);
-        json.put("can_read_messages", object->canReadMessages);
-        json.put("can_delete_sent_messages", object->canDeleteSentMessages);
+        json.put("can_change_gift_settings", object->canChangeGiftSettings);
+        json.put("can_convert_gifts_to_stars", object->canConvertGiftsToStars);
         json.put("can_delete_all_messages", object->canDeleteAllMessages);
-        json.put("can_edit_name", object->canEditName);
+        json.put("can_delete_sent_messages", object->canDeleteSentMessages);
         json.put("can_edit_bio", object->canEditBio);
+        json.put("can_edit_name", object->canEditName);
         json.put("can_edit_profile_photo", object->canEditProfilePhoto);
         json.put("can_edit_username", object->canEditUsername);
-        json.put("can_change_gift_settings", object->canChangeGiftSettings);
-        json.put("can_view_gifts_and_stars", object->canViewGiftsAndStars);
-        json.put("can_convert_gifts_to_stars", object->canConvertGiftsToStars);
+        json.put("can_manage_stories", object->canManageStories);
+        json.put("can_read_messages", object->canReadMessages);
+        json.put("can_reply", object->canReply);
         json.put("can_transfer_and_upgrade_gifts", object->canTransferAndUpgradeGifts);
         json.put("can_transfer_stars", object->canTransferStars);
-        json.put("can_manage_stories", object->canManageStories);
+        json.put("can_view_gifts_and_stars", object->canViewGiftsAndStars);
     }
     return json;
 }
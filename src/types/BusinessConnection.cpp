@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    user,
+    userChatId,
+    date,
+    rights,
+    isEnabled,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"user", Field::user},
+    {"user_chat_id", Field::userChatId},
+    {"date", Field::date},
+    {"rights", Field::rights},
+    {"is_enabled", Field::isEnabled},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BusinessConnection> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BusinessConnection>();
-    parse(data, "id", &result->id);
-    result->user = parseRequired<User>(data, "user");
-    parse(data, "user_chat_id", &result->userChatId);
-    parse(data, "date", &result->date);
-    result->rights = parse<BusinessBotRights>(data, "rights");
-    parse(data, "is_enabled", &result->isEnabled);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::userChatId:
+                detail::parseValue(value, &result->userChatId);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::rights:
+                result->rights = parse<BusinessBotRights>(value);
+                break;
+            case Field::isEnabled:
+                detail::parseValue(value, &result->isEnabled);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<BusinessConnection> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("date", object->date);
         json.put("id", object->id);
+        json.put("is_enabled", object->isEnabled);
+        json.put("rights", object->rights);
         json.put("user", object->user);
         json.put("user_chat_id", object->userChatId);
-        json.put("date", object->date);
-        json.put("rights", object->rights);
-        json.put("is_enabled", object->isEnabled);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    title,
+    message,
+    sticker,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"title", Field::title},
+    {"message", Field::message},
+    {"sticker", Field::sticker},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BusinessIntro> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BusinessIntro>();
-    parse(data, "title", &result->title);
-    parse(data, "message", &result->message);
-    result->sticker = parse<Sticker>(data, "sticker");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::message:
+                detail::parseValue(value, &result->message);
+                break;
+            case Field::sticker:
+                result->sticker = parse<Sticker>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<BusinessIntro> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("title", object->title);
         json.put("message", object->message);
         json.put("sticker", object->sticker);
+        json.put("title", object->title);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    address,
+    location,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"address", Field::address},
+    {"location", Field::location},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BusinessLocation> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BusinessLocation>();
-    parse(data, "address", &result->address);
-    result->location = parse<Location>(data, "location");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::address:
+                detail::parseValue(value, &result->address);
+                break;
+            case Field::location:
+                result->location = parse<Location>(value);
+                break;
+        }
+    });
     return result;
 }
 
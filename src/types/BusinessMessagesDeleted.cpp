@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    businessConnectionId,
+    chat,
+    messageIds,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"business_connection_id", Field::businessConnectionId},
+    {"chat", Field::chat},
+    {"message_ids", Field::messageIds},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BusinessMessagesDeleted> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BusinessMessagesDeleted>();
-    parse(data, "business_connection_id", &result->businessConnectionId);
-    result->chat = parseRequired<Chat>(data, "chat");
-    result->messageIds = parsePrimitiveRequiredArray<std::int32_t>(data, "message_ids");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::businessConnectionId:
+                detail::parseValue(value, &result->businessConnectionId);
+                break;
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::messageIds:
+                result->messageIds = parsePrimitiveArray<std::int32_t>(value);
+                break;
+        }
+    });
     return result;
 }
 
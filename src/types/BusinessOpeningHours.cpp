@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    timeZoneName,
+    openingHours,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"time_zone_name", Field::timeZoneName},
+    {"opening_hours", Field::openingHours},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BusinessOpeningHours> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BusinessOpeningHours>();
-    parse(data, "time_zone_name", &result->timeZoneName);
-    result->openingHours = parseRequiredArray<BusinessOpeningHoursInterval>(data, "opening_hours");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::timeZoneName:
+                detail::parseValue(value, &result->timeZoneName);
+                break;
+            case Field::openingHours:
+                result->openingHours = parseArray<BusinessOpeningHoursInterval>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<BusinessOpeningHours> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("time_zone_name", object->timeZoneName);
         json.put("opening_hours", object->openingHours);
+        json.put("time_zone_name", object->timeZoneName);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    openingMinute,
+    closingMinute,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"opening_minute", Field::openingMinute},
+    {"closing_minute", Field::closingMinute},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<BusinessOpeningHoursInterval> parse(const nlohmann::json &data) {
     auto result = std::make_shared<BusinessOpeningHoursInterval>();
-    parse(data, "opening_minute", &result->openingMinute);
-    parse(data, "closing_minute", &result->closingMinute);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::openingMinute:
+                detail::parseValue(value, &result->openingMinute);
+                break;
+            case Field::closingMinute:
+                detail::parseValue(value, &result->closingMinute);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<BusinessOpeningHoursInterval> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("opening_minute", object->openingMinute);
         json.put("closing_minute", object->closingMinute);
+        json.put("opening_minute", object->openingMinute);
     }
     return json;
 }
@@ -1,3 +1,4 @@
+#include <tgbot/ParseCache.h>
 #include <tgbot/TgTypeParser.h>
 #include <tgbot/types/Chat.h>
 #include <nlohmann/json.hpp>
@@ -6,6 +7,10 @@ namespace TgBot {
 
 template <>
 std::shared_ptr<Chat> parse(const nlohmann::json &data) {
+    const auto key = detail::cacheKey(detail::CachedType::Chat, data);
+    if (auto cached = detail::findCached<Chat>(key)) {
+        return cached;
+    }
     auto result = std::make_shared<Chat>();
     parse(data, "id", &result->id);
     std::string type;
@@ -26,6 +31,7 @@ std::shared_ptr<Chat> parse(const nlohmann::json &data) {
     parse(data, "last_name", &result->lastName);
     parse(data, "is_forum", &result->isForum);
     parse(data, "is_direct_messages", &result->isDirectMessages);
+    detail::storeCached(key, result);
     return result;
 }
 
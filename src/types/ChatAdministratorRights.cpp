@@ -4,26 +4,108 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    isAnonymous,
+    canManageChat,
+    canDeleteMessages,
+    canManageVideoChats,
+    canRestrictMembers,
+    canPromoteMembers,
+    canChangeInfo,
+    canInviteUsers,
+    canPostStories,
+    canEditStories,
+    canDeleteStories,
+    canPostMessages,
+    canEditMessages,
+    canPinMessages,
+    canManageTopics,
+    canManageDirectMessages,
+    canManageTags,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"is_anonymous", Field::isAnonymous},
+    {"can_manage_chat", Field::canManageChat},
+    {"can_delete_messages", Field::canDeleteMessages},
+    {"can_manage_video_chats", Field::canManageVideoChats},
+    {"can_restrict_members", Field::canRestrictMembers},
+    {"can_promote_members", Field::canPromoteMembers},
+    {"can_change_info", Field::canChangeInfo},
+    {"can_invite_users", Field::canInviteUsers},
+    {"can_post_stories", Field::canPostStories},
+    {"can_edit_stories", Field::canEditStories},
+    {"can_delete_stories", Field::canDeleteStories},
+    {"can_post_messages", Field::canPostMessages},
+    {"can_edit_messages", Field::canEditMessages},
+    {"can_pin_messages", Field::canPinMessages},
+    {"can_manage_topics", Field::canManageTopics},
+    {"can_manage_direct_messages", Field::canManageDirectMessages},
+    {"can_manage_tags", Field::canManageTags},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatAdministratorRights> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatAdministratorRights>();
-    parse(data, "is_anonymous", &result->isAnonymous);
-    parse(data, "can_manage_chat", &result->canManageChat);
-    parse(data, "can_delete_messages", &result->canDeleteMessages);
-    parse(data, "can_manage_video_chats", &result->canManageVideoChats);
-    parse(data, "can_restrict_members", &result->canRestrictMembers);
-    parse(data, "can_promote_members", &result->canPromoteMembers);
-    parse(data, "can_change_info", &result->canChangeInfo);
-    parse(data, "can_invite_users", &result->canInviteUsers);
-    parse(data, "can_post_stories", &result->canPostStories);
-    parse(data, "can_edit_stories", &result->canEditStories);
-    parse(data, "can_delete_stories", &result->canDeleteStories);
-    parse(data, "can_post_messages", &result->canPostMessages);
-    parse(data, "can_edit_messages", &result->canEditMessages);
-    parse(data, "can_pin_messages", &result->canPinMessages);
-    parse(data, "can_manage_topics", &result->canManageTopics);
-    parse(data, "can_manage_direct_messages", &result->canManageDirectMessages);
-    parse(data, "can_manage_tags", &result->canManageTags);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::isAnonymous:
+                detail::parseValue(value, &result->isAnonymous);
+                break;
+            case Field::canManageChat:
+                detail::parseValue(value, &result->canManageChat);
+                break;
+            case Field::canDeleteMessages:
+                detail::parseValue(value, &result->canDeleteMessages);
+                break;
+            case Field::canManageVideoChats:
+                detail::parseValue(value, &result->canManageVideoChats);
+                break;
+            case Field::canRestrictMembers:
+                detail::parseValue(value, &result->canRestrictMembers);
+                break;
+            case Field::canPromoteMembers:
+                detail::parseValue(value, &result->canPromoteMembers);
+                break;
+            case Field::canChangeInfo:
+                detail::parseValue(value, &result->canChangeInfo);
+                break;
+            case Field::canInviteUsers:
+                detail::parseValue(value, &result->canInviteUsers);
+                break;
+            case Field::canPostStories:
+                detail::parseValue(value, &result->canPostStories);
+                break;
+            case Field::canEditStories:
+                detail::parseValue(value, &result->canEditStories);
+                break;
+            case Field::canDeleteStories:
+                detail::parseValue(value, &result->canDeleteStories);
+                break;
+            case Field::canPostMessages:
+                detail::parseValue(value, &result->canPostMessages);
+                break;
+            case Field::canEditMessages:
+                detail::parseValue(value, &result->canEditMessages);
+                break;
+            case Field::canPinMessages:
+                detail::parseValue(value, &result->canPinMessages);
+                break;
+            case Field::canManageTopics:
+                detail::parseValue(value, &result->canManageTopics);
+                break;
+            case Field::canManageDirectMessages:
+                detail::parseValue(value, &result->canManageDirectMessages);
+                break;
+            case Field::canManageTags:
+                detail::parseValue(value, &result->canManageTags);
+                break;
+        }
+    });
     return result;
 }
 
@@ -31,23 +113,23 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatAdministratorRights> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("is_anonymous", object->isAnonymous);
-        json.put("can_manage_chat", object->canManageChat);
-        json.put("can_delete_messages", object->canDeleteMessages);
-        json.put("can_manage_video_chats", object->canManageVideoChats);
-        json.put("can_restrict_members", object->canRestrictMembers);
-        json.put("can_promote_members", object->canPromoteMembers);
         json.put("can_change_info", object->canChangeInfo);
-        json.put("can_invite_users", object->canInviteUsers);
-        json.put("can_post_stories", object->canPostStories);
-        json.put("can_edit_stories", object->canEditStories);
+        json.put("can_delete_messages", object->canDeleteMessages);
         json.put("can_delete_stories", object->canDeleteStories);
-        json.put("can_post_messages", object->canPostMessages);
         json.put("can_edit_messages", object->canEditMessages);
-        json.put("can_pin_messages", object->canPinMessages);
-        json.put("can_manage_topics", object->canManageTopics);
+        json.put("can_edit_stories", object->canEditStories);
+        json.put("can_invite_users", object->canInviteUsers);
+        json.put("can_manage_chat", object->canManageChat);
         json.put("can_manage_direct_messages", object->canManageDirectMessages);
         json.put("can_manage_tags", object->canManageTags);
+        json.put("can_manage_topics", object->canManageTopics);
+        json.put("can_manage_video_chats", object->canManageVideoChats);
+        json.put("can_pin_messages", object->canPinMessages);
+        json.put("can_post_messages", object->canPostMessages);
+        json.put("can_post_stories", object->canPostStories);
+        json.put("can_promote_members", object->canPromoteMembers);
+        json.put("can_restrict_members", object->canRestrictMembers);
+        json.put("is_anonymous", object->isAnonymous);
     }
     return json;
 }
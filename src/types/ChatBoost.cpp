@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    boostId,
+    addDate,
+    expirationDate,
+    source,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"boost_id", Field::boostId},
+    {"add_date", Field::addDate},
+    {"expiration_date", Field::expirationDate},
+    {"source", Field::source},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatBoost> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatBoost>();
-    parse(data, "boost_id", &result->boostId);
-    parse(data, "add_date", &result->addDate);
-    parse(data, "expiration_date", &result->expirationDate);
-    result->source = parseRequired<ChatBoostSource>(data, "source");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::boostId:
+                detail::parseValue(value, &result->boostId);
+                break;
+            case Field::addDate:
+                detail::parseValue(value, &result->addDate);
+                break;
+            case Field::expirationDate:
+                detail::parseValue(value, &result->expirationDate);
+                break;
+            case Field::source:
+                result->source = parse<ChatBoostSource>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,8 +48,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatBoost> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("boost_id", object->boostId);
         json.put("add_date", object->addDate);
+        json.put("boost_id", object->boostId);
         json.put("expiration_date", object->expirationDate);
         json.put("source", object->source);
     }
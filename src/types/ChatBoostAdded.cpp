@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    boostCount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"boost_count", Field::boostCount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatBoostAdded> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatBoostAdded>();
-    parse(data, "boost_count", &result->boostCount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::boostCount:
+                detail::parseValue(value, &result->boostCount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chat,
+    boostId,
+    removeDate,
+    source,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chat", Field::chat},
+    {"boost_id", Field::boostId},
+    {"remove_date", Field::removeDate},
+    {"source", Field::source},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatBoostRemoved> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatBoostRemoved>();
-    result->chat = parseRequired<Chat>(data, "chat");
-    parse(data, "boost_id", &result->boostId);
-    parse(data, "remove_date", &result->removeDate);
-    result->source = parseRequired<ChatBoostSource>(data, "source");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::boostId:
+                detail::parseValue(value, &result->boostId);
+                break;
+            case Field::removeDate:
+                detail::parseValue(value, &result->removeDate);
+                break;
+            case Field::source:
+                result->source = parse<ChatBoostSource>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,8 +48,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatBoostRemoved> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("chat", object->chat);
         json.put("boost_id", object->boostId);
+        json.put("chat", object->chat);
         json.put("remove_date", object->removeDate);
         json.put("source", object->source);
     }
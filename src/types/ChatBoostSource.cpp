@@ -7,38 +7,26 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<ChatBoostSource>>({
+    {"premium", detail::subtype<ChatBoostSource, ChatBoostSourcePremium>()},
+    {"gift_code", detail::subtype<ChatBoostSource, ChatBoostSourceGiftCode>()},
+    {"giveaway", detail::subtype<ChatBoostSource, ChatBoostSourceGiveaway>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatBoostSource> parse(const nlohmann::json &data) {
-    std::string type;
-    ChatBoostSource::Ptr result;
-    parse(data, "source", &type);
-    if (type == "premium") {
-        result = parse<ChatBoostSourcePremium>(data);
-    } else if (type == "gift_code") {
-        result = parse<ChatBoostSourceGiftCode>(data);
-    } else if (type == "giveaway") {
-        result = parse<ChatBoostSourceGiveaway>(data);
-    } else {
-        throw invalidType("ChatBoostSource", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "source", subtypes, "ChatBoostSource");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<ChatBoostSource> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("source", object->source);
-        if (object->source == "premium") {
-            json += put<ChatBoostSourcePremium>(object);
-        } else if (object->source == "gift_code") {
-            json += put<ChatBoostSourceGiftCode>(object);
-        } else if (object->source == "giveaway") {
-            json += put<ChatBoostSourceGiveaway>(object);
-        } else {
-            throw invalidType("ChatBoostSource", object->source);
-        }
+        json = detail::putSubtype(object, object->source, subtypes, "ChatBoostSource");
     }
     return json;
 }
@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    source,
+    giveawayMessageId,
+    user,
+    prizeStarCount,
+    isUnclaimed,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"source", Field::source},
+    {"giveaway_message_id", Field::giveawayMessageId},
+    {"user", Field::user},
+    {"prize_star_count", Field::prizeStarCount},
+    {"is_unclaimed", Field::isUnclaimed},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatBoostSourceGiveaway> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatBoostSourceGiveaway>();
-    parse(data, "source", &result->source);
-    parse(data, "giveaway_message_id", &result->giveawayMessageId);
-    result->user = parseRequired<User>(data, "user");
-    parse(data, "prize_star_count", &result->prizeStarCount);
-    parse(data, "is_unclaimed", &result->isUnclaimed);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::source:
+                detail::parseValue(value, &result->source);
+                break;
+            case Field::giveawayMessageId:
+                detail::parseValue(value, &result->giveawayMessageId);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::prizeStarCount:
+                detail::parseValue(value, &result->prizeStarCount);
+                break;
+            case Field::isUnclaimed:
+                detail::parseValue(value, &result->isUnclaimed);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatBoostSourceGiveaway> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("source", object->source);
         json.put("giveaway_message_id", object->giveawayMessageId);
-        json.put("user", object->user);
-        json.put("prize_star_count", object->prizeStarCount);
         json.put("is_unclaimed", object->isUnclaimed);
+        json.put("prize_star_count", object->prizeStarCount);
+        json.put("source", object->source);
+        json.put("user", object->user);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    source,
+    user,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"source", Field::source},
+    {"user", Field::user},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatBoostSourcePremium> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatBoostSourcePremium>();
-    parse(data, "source", &result->source);
-    result->user = parseRequired<User>(data, "user");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::source:
+                detail::parseValue(value, &result->source);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
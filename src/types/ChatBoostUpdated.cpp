@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chat,
+    boost,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chat", Field::chat},
+    {"boost", Field::boost},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatBoostUpdated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatBoostUpdated>();
-    result->chat = parseRequired<Chat>(data, "chat");
-    result->boost = parseRequired<ChatBoost>(data, "boost");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::boost:
+                result->boost = parse<ChatBoost>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatBoostUpdated> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("chat", object->chat);
         json.put("boost", object->boost);
+        json.put("chat", object->chat);
     }
     return json;
 }
@@ -4,62 +4,288 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    type,
+    title,
+    username,
+    firstName,
+    lastName,
+    isForum,
+    isDirectMessages,
+    accentColorId,
+    maxReactionCount,
+    photo,
+    activeUsernames,
+    birthdate,
+    businessIntro,
+    businessLocation,
+    businessOpeningHours,
+    personalChat,
+    parentChat,
+    availableReactions,
+    backgroundCustomEmojiId,
+    profileAccentColorId,
+    profileBackgroundCustomEmojiId,
+    emojiStatusCustomEmojiId,
+    emojiStatusExpirationDate,
+    bio,
+    hasPrivateForwards,
+    hasRestrictedVoiceAndVideoMessages,
+    joinToSendMessages,
+    joinByRequest,
+    description,
+    inviteLink,
+    pinnedMessage,
+    permissions,
+    acceptedGiftTypes,
+    canSendPaidMedia,
+    slowModeDelay,
+    unrestrictBoostCount,
+    messageAutoDeleteTime,
+    hasAggressiveAntiSpamEnabled,
+    hasHiddenMembers,
+    hasProtectedContent,
+    hasVisibleHistory,
+    stickerSetName,
+    canSetStickerSet,
+    customEmojiStickerSetName,
+    linkedChatId,
+    location,
+    rating,
+    firstProfileAudio,
+    uniqueGiftColors,
+    paidMessageStarCount,
+    guardBot,
+    community,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"type", Field::type},
+    {"title", Field::title},
+    {"username", Field::username},
+    {"first_name", Field::firstName},
+    {"last_name", Field::lastName},
+    {"is_forum", Field::isForum},
+    {"is_direct_messages", Field::isDirectMessages},
+    {"accent_color_id", Field::accentColorId},
+    {"max_reaction_count", Field::maxReactionCount},
+    {"photo", Field::photo},
+    {"active_usernames", Field::activeUsernames},
+    {"birthdate", Field::birthdate},
+    {"business_intro", Field::businessIntro},
+    {"business_location", Field::businessLocation},
+    {"business_opening_hours", Field::businessOpeningHours},
+    {"personal_chat", Field::personalChat},
+    {"parent_chat", Field::parentChat},
+    {"available_reactions", Field::availableReactions},
+    {"background_custom_emoji_id", Field::backgroundCustomEmojiId},
+    {"profile_accent_color_id", Field::profileAccentColorId},
+    {"profile_background_custom_emoji_id", Field::profileBackgroundCustomEmojiId},
+    {"emoji_status_custom_emoji_id", Field::emojiStatusCustomEmojiId},
+    {"emoji_status_expiration_date", Field::emojiStatusExpirationDate},
+    {"bio", Field::bio},
+    {"has_private_forwards", Field::hasPrivateForwards},
+    {"has_restricted_voice_and_video_messages", Field::hasRestrictedVoiceAndVideoMessages},
+    {"join_to_send_messages", Field::joinToSendMessages},
+    {"join_by_request", Field::joinByRequest},
+    {"description", Field::description},
+    {"invite_link", Field::inviteLink},
+    {"pinned_message", Field::pinnedMessage},
+    {"permissions", Field::permissions},
+    {"accepted_gift_types", Field::acceptedGiftTypes},
+    {"can_send_paid_media", Field::canSendPaidMedia},
+    {"slow_mode_delay", Field::slowModeDelay},
+    {"unrestrict_boost_count", Field::unrestrictBoostCount},
+    {"message_auto_delete_time", Field::messageAutoDeleteTime},
+    {"has_aggressive_anti_spam_enabled", Field::hasAggressiveAntiSpamEnabled},
+    {"has_hidden_members", Field::hasHiddenMembers},
+    {"has_protected_content", Field::hasProtectedContent},
+    {"has_visible_history", Field::hasVisibleHistory},
+    {"sticker_set_name", Field::stickerSetName},
+    {"can_set_sticker_set", Field::canSetStickerSet},
+    {"custom_emoji_sticker_set_name", Field::customEmojiStickerSetName},
+    {"linked_chat_id", Field::linkedChatId},
+    {"location", Field::location},
+    {"rating", Field::rating},
+    {"first_profile_audio", Field::firstProfileAudio},
+    {"unique_gift_colors", Field::uniqueGiftColors},
+    {"paid_message_star_count", Field::paidMessageStarCount},
+    {"guard_bot", Field::guardBot},
+    {"community", Field::community},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatFullInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatFullInfo>();
-    parse(data, "id", &result->id);
-    parse(data, "type", &result->type);
-    parse(data, "title", &result->title);
-    parse(data, "username", &result->username);
-    parse(data, "first_name", &result->firstName);
-    parse(data, "last_name", &result->lastName);
-    parse(data, "is_forum", &result->isForum);
-    parse(data, "is_direct_messages", &result->isDirectMessages);
-    parse(data, "accent_color_id", &result->accentColorId);
-    parse(data, "max_reaction_count", &result->maxReactionCount);
-    result->photo = parse<ChatPhoto>(data, "photo");
-    result->activeUsernames = parsePrimitiveArray<std::string>(data, "active_usernames");
-    result->birthdate = parse<Birthdate>(data, "birthdate");
-    result->businessIntro = parse<BusinessIntro>(data, "business_intro");
-    result->businessLocation = parse<BusinessLocation>(data, "business_location");
-    result->businessOpeningHours = parse<BusinessOpeningHours>(data, "business_opening_hours");
-    result->personalChat = parse<Chat>(data, "personal_chat");
-    result->parentChat = parse<Chat>(data, "parent_chat");
-    result->availableReactions = parseArray<ReactionType>(data, "available_reactions");
-    parse(data, "background_custom_emoji_id", &result->backgroundCustomEmojiId);
-    parse(data, "profile_accent_color_id", &result->profileAccentColorId);
-    parse(data, "profile_background_custom_emoji_id", &result->profileBackgroundCustomEmojiId);
-    parse(data, "emoji_status_custom_emoji_id", &result->emojiStatusCustomEmojiId);
-    parse(data, "emoji_status_expiration_date", &result->emojiStatusExpirationDate);
-    parse(data, "bio", &result->bio);
-    parse(data, "has_private_forwards", &result->hasPrivateForwards);
-    parse(data, "has_restricted_voice_and_video_messages", &result->hasRestrictedVoiceAndVideoMessages);
-    parse(data, "join_to_send_messages", &result->joinToSendMessages);
-    parse(data, "join_by_request", &result->joinByRequest);
-    parse(data, "description", &result->description);
-    parse(data, "invite_link", &result->inviteLink);
-    result->pinnedMessage = parse<Message>(data, "pinned_message");
-    result->permissions = parse<ChatPermissions>(data, "permissions");
-    result->acceptedGiftTypes = parseRequired<AcceptedGiftTypes>(data, "accepted_gift_types");
-    parse(data, "can_send_paid_media", &result->canSendPaidMedia);
-    parse(data, "slow_mode_delay", &result->slowModeDelay);
-    parse(data, "unrestrict_boost_count", &result->unrestrictBoostCount);
-    parse(data, "message_auto_delete_time", &result->messageAutoDeleteTime);
-    parse(data, "has_aggressive_anti_spam_enabled", &result->hasAggressiveAntiSpamEnabled);
-    parse(data, "has_hidden_members", &result->hasHiddenMembers);
-    parse(data, "has_protected_content", &result->hasProtectedContent);
-    parse(data, "has_visible_history", &result->hasVisibleHistory);
-    parse(data, "sticker_set_name", &result->stickerSetName);
-    parse(data, "can_set_sticker_set", &result->canSetStickerSet);
-    parse(data, "custom_emoji_sticker_set_name", &result->customEmojiStickerSetName);
-    parse(data, "linked_chat_id", &result->linkedChatId);
-    result->location = parse<ChatLocation>(data, "location");
-    result->rating = parse<UserRating>(data, "rating");
-    result->firstProfileAudio = parse<Audio>(data, "first_profile_audio");
-    result->uniqueGiftColors = parse<UniqueGiftColors>(data, "unique_gift_colors");
-    parse(data, "paid_message_star_count", &result->paidMessageStarCount);
-    result->guardBot = parse<User>(data, "guard_bot");
-    result->community = parse<Community>(data, "community");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::username:
+                detail::parseValue(value, &result->username);
+                break;
+            case Field::firstName:
+                detail::parseValue(value, &result->firstName);
+                break;
+            case Field::lastName:
+                detail::parseValue(value, &result->lastName);
+                break;
+            case Field::isForum:
+                detail::parseValue(value, &result->isForum);
+                break;
+            case Field::isDirectMessages:
+                detail::parseValue(value, &result->isDirectMessages);
+                break;
+            case Field::accentColorId:
+                detail::parseValue(value, &result->accentColorId);
+                break;
+            case Field::maxReactionCount:
+                detail::parseValue(value, &result->maxReactionCount);
+                break;
+            case Field::photo:
+                result->photo = parse<ChatPhoto>(value);
+                break;
+            case Field::activeUsernames:
+                result->activeUsernames = parsePrimitiveArray<std::string>(value);
+                break;
+            case Field::birthdate:
+                result->birthdate = parse<Birthdate>(value);
+                break;
+            case Field::businessIntro:
+                result->businessIntro = parse<BusinessIntro>(value);
+                break;
+            case Field::businessLocation:
+                result->businessLocation = parse<BusinessLocation>(value);
+                break;
+            case Field::businessOpeningHours:
+                result->businessOpeningHours = parse<BusinessOpeningHours>(value);
+                break;
+            case Field::personalChat:
+                result->personalChat = parse<Chat>(value);
+                break;
+            case Field::parentChat:
+                result->parentChat = parse<Chat>(value);
+                break;
+            case Field::availableReactions:
+                result->availableReactions = parseArray<ReactionType>(value);
+                break;
+            case Field::backgroundCustomEmojiId:
+                detail::parseValue(value, &result->backgroundCustomEmojiId);
+                break;
+            case Field::profileAccentColorId:
+                detail::parseValue(value, &result->profileAccentColorId);
+                break;
+            case Field::profileBackgroundCustomEmojiId:
+                detail::parseValue(value, &result->profileBackgroundCustomEmojiId);
+                break;
+            case Field::emojiStatusCustomEmojiId:
+                detail::parseValue(value, &result->emojiStatusCustomEmojiId);
+                break;
+            case Field::emojiStatusExpirationDate:
+                detail::parseValue(value, &result->emojiStatusExpirationDate);
+                break;
+            case Field::bio:
+                detail::parseValue(value, &result->bio);
+                break;
+            case Field::hasPrivateForwards:
+                detail::parseValue(value, &result->hasPrivateForwards);
+                break;
+            case Field::hasRestrictedVoiceAndVideoMessages:
+                detail::parseValue(value, &result->hasRestrictedVoiceAndVideoMessages);
+                break;
+            case Field::joinToSendMessages:
+                detail::parseValue(value, &result->joinToSendMessages);
+                break;
+            case Field::joinByRequest:
+                detail::parseValue(value, &result->joinByRequest);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::inviteLink:
+                detail::parseValue(value, &result->inviteLink);
+                break;
+            case Field::pinnedMessage:
+                result->pinnedMessage = parse<Message>(value);
+                break;
+            case Field::permissions:
+                result->permissions = parse<ChatPermissions>(value);
+                break;
+            case Field::acceptedGiftTypes:
+                result->acceptedGiftTypes = parse<AcceptedGiftTypes>(value);
+                break;
+            case Field::canSendPaidMedia:
+                detail::parseValue(value, &result->canSendPaidMedia);
+                break;
+            case Field::slowModeDelay:
+                detail::parseValue(value, &result->slowModeDelay);
+                break;
+            case Field::unrestrictBoostCount:
+                detail::parseValue(value, &result->unrestrictBoostCount);
+                break;
+            case Field::messageAutoDeleteTime:
+                detail::parseValue(value, &result->messageAutoDeleteTime);
+                break;
+            case Field::hasAggressiveAntiSpamEnabled:
+                detail::parseValue(value, &result->hasAggressiveAntiSpamEnabled);
+                break;
+            case Field::hasHiddenMembers:
+                detail::parseValue(value, &result->hasHiddenMembers);
+                break;
+            case Field::hasProtectedContent:
+                detail::parseValue(value, &result->hasProtectedContent);
+                break;
+            case Field::hasVisibleHistory:
+                detail::parseValue(value, &result->hasVisibleHistory);
+                break;
+            case Field::stickerSetName:
+                detail::parseValue(value, &result->stickerSetName);
+                break;
+            case Field::canSetStickerSet:
+                detail::parseValue(value, &result->canSetStickerSet);
+                break;
+            case Field::customEmojiStickerSetName:
+                detail::parseValue(value, &result->customEmojiStickerSetName);
+                break;
+            case Field::linkedChatId:
+                detail::parseValue(value, &result->linkedChatId);
+                break;
+            case Field::location:
+                result->location = parse<ChatLocation>(value);
+                break;
+            case Field::rating:
+                result->rating = parse<UserRating>(value);
+                break;
+            case Field::firstProfileAudio:
+                result->firstProfileAudio = parse<Audio>(value);
+                break;
+            case Field::uniqueGiftColors:
+                result->uniqueGiftColors = parse<UniqueGiftColors>(value);
+                break;
+            case Field::paidMessageStarCount:
+                detail::parseValue(value, &result->paidMessageStarCount);
+                break;
+            case Field::guardBot:
+                result->guardBot = parse<User>(value);
+                break;
+            case Field::community:
+                result->community = parse<Community>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -67,59 +293,59 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatFullInfo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("id", object->id);
-        json.put("type", object->type);
-        json.put("title", object->title);
-        json.put("username", object->username);
-        json.put("first_name", object->firstName);
-        json.put("last_name", object->lastName);
-        json.put("is_forum", object->isForum);
-        json.put("is_direct_messages", object->isDirectMessages);
         json.put("accent_color_id", object->accentColorId);
-        json.put("max_reaction_count", object->maxReactionCount);
-        json.put("photo", object->photo);
+        json.put("accepted_gift_types", object->acceptedGiftTypes);
         json.put("active_usernames", object->activeUsernames);
+        json.put("available_reactions", object->availableReactions);
+        json.put("background_custom_emoji_id", object->backgroundCustomEmojiId);
+        json.put("bio", object->bio);
         json.put("birthdate", object->birthdate);
         json.put("business_intro", object->businessIntro);
         json.put("business_location", object->businessLocation);
         json.put("business_opening_hours", object->businessOpeningHours);
-        json.put("personal_chat", object->personalChat);
-        json.put("parent_chat", object->parentChat);
-        json.put("available_reactions", object->availableReactions);
-        json.put("background_custom_emoji_id", object->backgroundCustomEmojiId);
-        json.put("profile_accent_color_id", object->profileAccentColorId);
-        json.put("profile_background_custom_emoji_id", object->profileBackgroundCustomEmojiId);
+        json.put("can_send_paid_media", object->canSendPaidMedia);
+        json.put("can_set_sticker_set", object->canSetStickerSet);
+        json.put("community", object->community);
+        json.put("custom_emoji_sticker_set_name", object->customEmojiStickerSetName);
+        json.put("description", object->description);
         json.put("emoji_status_custom_emoji_id", object->emojiStatusCustomEmojiId);
         json.put("emoji_status_expiration_date", object->emojiStatusExpirationDate);
-        json.put("bio", object->bio);
-        json.put("has_private_forwards", object->hasPrivateForwards);
-        json.put("has_restricted_voice_and_video_messages", object->hasRestrictedVoiceAndVideoMessages);
-        json.put("join_to_send_messages", object->joinToSendMessages);
-        json.put("join_by_request", object->joinByRequest);
-        json.put("description", object->description);
-        json.put("invite_link", object->inviteLink);
-        json.put("pinned_message", object->pinnedMessage);
-        json.put("permissions", object->permissions);
-        json.put("accepted_gift_types", object->acceptedGiftTypes);
-        json.put("can_send_paid_media", object->canSendPaidMedia);
-        json.put("slow_mode_delay", object->slowModeDelay);
-        json.put("unrestrict_boost_count", object->unrestrictBoostCount);
-        json.put("message_auto_delete_time", object->messageAutoDeleteTime);
+        json.put("first_name", object->firstName);
+        json.put("first_profile_audio", object->firstProfileAudio);
+        json.put("guard_bot", object->guardBot);
         json.put("has_aggressive_anti_spam_enabled", object->hasAggressiveAntiSpamEnabled);
         json.put("has_hidden_members", object->hasHiddenMembers);
+        json.put("has_private_forwards", object->hasPrivateForwards);
         json.put("has_protected_content", object->hasProtectedContent);
+        json.put("has_restricted_voice_and_video_messages", object->hasRestrictedVoiceAndVideoMessages);
         json.put("has_visible_history", object->hasVisibleHistory);
-        json.put("sticker_set_name", object->stickerSetName);
-        json.put("can_set_sticker_set", object->canSetStickerSet);
-        json.put("custom_emoji_sticker_set_name", object->customEmojiStickerSetName);
+        json.put("id", object->id);
+        json.put("invite_link", object->inviteLink);
+        json.put("is_direct_messages", object->isDirectMessages);
+        json.put("is_forum", object->isForum);
+        json.put("join_by_request", object->joinByRequest);
+        json.put("join_to_send_messages", object->joinToSendMessages);
+        json.put("last_name", object->lastName);
         json.put("linked_chat_id", object->linkedChatId);
         json.put("location", object->location);
+        json.put("max_reaction_count", object->maxReactionCount);
+        json.put("message_auto_delete_time", object->messageAutoDeleteTime);
+        json.put("paid_message_star_count", object->paidMessageStarCount);
+        json.put("parent_chat", object->parentChat);
+        json.put("permissions", object->permissions);
+        json.put("personal_chat", object->personalChat);
+        json.put("photo", object->photo);
+        json.put("pinned_message", object->pinnedMessage);
+        json.put("profile_accent_color_id", object->profileAccentColorId);
+        json.put("profile_background_custom_emoji_id", object->profileBackgroundCustomEmojiId);
         json.put("rating", object->rating);
-        json.put("first_profile_audio", object->firstProfileAudio);
+        json.put("slow_mode_delay", object->slowModeDelay);
+        json.put("sticker_set_name", object->stickerSetName);
+        json.put("title", object->title);
+        json.put("type", object->type);
         json.put("unique_gift_colors", object->uniqueGiftColors);
-        json.put("paid_message_star_count", object->paidMessageStarCount);
-        json.put("guard_bot", object->guardBot);
-        json.put("community", object->community);
+        json.put("unrestrict_boost_count", object->unrestrictBoostCount);
+        json.put("username", object->username);
     }
     return json;
 }
@@ -4,20 +4,78 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    inviteLink,
+    creator,
+    createsJoinRequest,
+    isPrimary,
+    isRevoked,
+    name,
+    expireDate,
+    memberLimit,
+    pendingJoinRequestCount,
+    subscriptionPeriod,
+    subscriptionPrice,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"invite_link", Field::inviteLink},
+    {"creator", Field::creator},
+    {"creates_join_request", Field::createsJoinRequest},
+    {"is_primary", Field::isPrimary},
+    {"is_revoked", Field::isRevoked},
+    {"name", Field::name},
+    {"expire_date", Field::expireDate},
+    {"member_limit", Field::memberLimit},
+    {"pending_join_request_count", Field::pendingJoinRequestCount},
+    {"subscription_period", Field::subscriptionPeriod},
+    {"subscription_price", Field::subscriptionPrice},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatInviteLink> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatInviteLink>();
-    parse(data, "invite_link", &result->inviteLink);
-    result->creator = parseRequired<User>(data, "creator");
-    parse(data, "creates_join_request", &result->createsJoinRequest);
-    parse(data, "is_primary", &result->isPrimary);
-    parse(data, "is_revoked", &result->isRevoked);
-    parse(data, "name", &result->name);
-    parse(data, "expire_date", &result->expireDate);
-    parse(data, "member_limit", &result->memberLimit);
-    parse(data, "pending_join_request_count", &result->pendingJoinRequestCount);
-    parse(data, "subscription_period", &result->subscriptionPeriod);
-    parse(data, "subscription_price", &result->subscriptionPrice);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::inviteLink:
+                detail::parseValue(value, &result->inviteLink);
+                break;
+            case Field::creator:
+                result->creator = parse<User>(value);
+                break;
+            case Field::createsJoinRequest:
+                detail::parseValue(value, &result->createsJoinRequest);
+                break;
+            case Field::isPrimary:
+                detail::parseValue(value, &result->isPrimary);
+                break;
+            case Field::isRevoked:
+                detail::parseValue(value, &result->isRevoked);
+                break;
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+            case Field::expireDate:
+                detail::parseValue(value, &result->expireDate);
+                break;
+            case Field::memberLimit:
+                detail::parseValue(value, &result->memberLimit);
+                break;
+            case Field::pendingJoinRequestCount:
+                detail::parseValue(value, &result->pendingJoinRequestCount);
+                break;
+            case Field::subscriptionPeriod:
+                detail::parseValue(value, &result->subscriptionPeriod);
+                break;
+            case Field::subscriptionPrice:
+                detail::parseValue(value, &result->subscriptionPrice);
+                break;
+        }
+    });
     return result;
 }
 
@@ -25,14 +83,14 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatInviteLink> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("invite_link", object->inviteLink);
-        json.put("creator", object->creator);
         json.put("creates_join_request", object->createsJoinRequest);
+        json.put("creator", object->creator);
+        json.put("expire_date", object->expireDate);
+        json.put("invite_link", object->inviteLink);
         json.put("is_primary", object->isPrimary);
         json.put("is_revoked", object->isRevoked);
-        json.put("name", object->name);
-        json.put("expire_date", object->expireDate);
         json.put("member_limit", object->memberLimit);
+        json.put("name", object->name);
         json.put("pending_join_request_count", object->pendingJoinRequestCount);
         json.put("subscription_period", object->subscriptionPeriod);
         json.put("subscription_price", object->subscriptionPrice);
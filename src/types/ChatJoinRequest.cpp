@@ -4,16 +4,58 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chat,
+    from,
+    userChatId,
+    date,
+    bio,
+    inviteLink,
+    queryId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chat", Field::chat},
+    {"from", Field::from},
+    {"user_chat_id", Field::userChatId},
+    {"date", Field::date},
+    {"bio", Field::bio},
+    {"invite_link", Field::inviteLink},
+    {"query_id", Field::queryId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatJoinRequest> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatJoinRequest>();
-    result->chat = parseRequired<Chat>(data, "chat");
-    result->from = parseRequired<User>(data, "from");
-    parse(data, "user_chat_id", &result->userChatId);
-    parse(data, "date", &result->date);
-    parse(data, "bio", &result->bio);
-    result->inviteLink = parse<ChatInviteLink>(data, "invite_link");
-    parse(data, "query_id", &result->queryId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::from:
+                result->from = parse<User>(value);
+                break;
+            case Field::userChatId:
+                detail::parseValue(value, &result->userChatId);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::bio:
+                detail::parseValue(value, &result->bio);
+                break;
+            case Field::inviteLink:
+                result->inviteLink = parse<ChatInviteLink>(value);
+                break;
+            case Field::queryId:
+                detail::parseValue(value, &result->queryId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -21,13 +63,13 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatJoinRequest> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("bio", object->bio);
         json.put("chat", object->chat);
-        json.put("from", object->from);
-        json.put("user_chat_id", object->userChatId);
         json.put("date", object->date);
-        json.put("bio", object->bio);
+        json.put("from", object->from);
         json.put("invite_link", object->inviteLink);
         json.put("query_id", object->queryId);
+        json.put("user_chat_id", object->userChatId);
     }
     return json;
 }
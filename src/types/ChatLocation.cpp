@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    location,
+    address,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"location", Field::location},
+    {"address", Field::address},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatLocation> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatLocation>();
-    result->location = parseRequired<Location>(data, "location");
-    parse(data, "address", &result->address);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::location:
+                result->location = parse<Location>(value);
+                break;
+            case Field::address:
+                detail::parseValue(value, &result->address);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatLocation> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("location", object->location);
         json.put("address", object->address);
+        json.put("location", object->location);
     }
     return json;
 }
@@ -10,50 +10,29 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<ChatMember>>({
+    {"creator", detail::subtype<ChatMember, ChatMemberOwner>()},
+    {"administrator", detail::subtype<ChatMember, ChatMemberAdministrator>()},
+    {"member", detail::subtype<ChatMember, ChatMemberMember>()},
+    {"restricted", detail::subtype<ChatMember, ChatMemberRestricted>()},
+    {"left", detail::subtype<ChatMember, ChatMemberLeft>()},
+    {"kicked", detail::subtype<ChatMember, ChatMemberBanned>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatMember> parse(const nlohmann::json &data) {
-    std::string type;
-    ChatMember::Ptr result;
-    parse(data, "status", &type);
-    if (type == "creator") {
-        result = parse<ChatMemberOwner>(data);
-    } else if (type == "administrator") {
-        result = parse<ChatMemberAdministrator>(data);
-    } else if (type == "member") {
-        result = parse<ChatMemberMember>(data);
-    } else if (type == "restricted") {
-        result = parse<ChatMemberRestricted>(data);
-    } else if (type == "left") {
-        result = parse<ChatMemberLeft>(data);
-    } else if (type == "kicked") {
-        result = parse<ChatMemberBanned>(data);
-    } else {
-        throw invalidType("ChatMember", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "status", subtypes, "ChatMember");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<ChatMember> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("status", object->status);
-        if (object->status == "creator") {
-            json += put<ChatMemberOwner>(object);
-        } else if (object->status == "administrator") {
-            json += put<ChatMemberAdministrator>(object);
-        } else if (object->status == "member") {
-            json += put<ChatMemberMember>(object);
-        } else if (object->status == "restricted") {
-            json += put<ChatMemberRestricted>(object);
-        } else if (object->status == "left") {
-            json += put<ChatMemberLeft>(object);
-        } else if (object->status == "kicked") {
-            json += put<ChatMemberBanned>(object);
-        } else {
-            throw invalidType("ChatMember", object->status);
-        }
+        json = detail::putSubtype(object, object->status, subtypes, "ChatMember");
     }
     return json;
 }
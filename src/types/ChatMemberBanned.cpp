@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    status,
+    user,
+    untilDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"status", Field::status},
+    {"user", Field::user},
+    {"until_date", Field::untilDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatMemberBanned> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatMemberBanned>();
-    parse(data, "status", &result->status);
-    result->user = parseRequired<User>(data, "user");
-    parse(data, "until_date", &result->untilDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::status:
+                detail::parseValue(value, &result->status);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::untilDate:
+                detail::parseValue(value, &result->untilDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,8 +44,8 @@ nlohmann::json put(const std::shared_ptr<ChatMemberBanned> &object) {
     JsonWrapper json;
     if (object) {
         json.put("status", object->status);
-        json.put("user", object->user);
         json.put("until_date", object->untilDate);
+        json.put("user", object->user);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    status,
+    user,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"status", Field::status},
+    {"user", Field::user},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatMemberLeft> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatMemberLeft>();
-    parse(data, "status", &result->status);
-    result->user = parseRequired<User>(data, "user");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::status:
+                detail::parseValue(value, &result->status);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    status,
+    tag,
+    user,
+    untilDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"status", Field::status},
+    {"tag", Field::tag},
+    {"user", Field::user},
+    {"until_date", Field::untilDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatMemberMember> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatMemberMember>();
-    parse(data, "status", &result->status);
-    parse(data, "tag", &result->tag);
-    result->user = parseRequired<User>(data, "user");
-    parse(data, "until_date", &result->untilDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::status:
+                detail::parseValue(value, &result->status);
+                break;
+            case Field::tag:
+                detail::parseValue(value, &result->tag);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::untilDate:
+                detail::parseValue(value, &result->untilDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,8 +50,8 @@ nlohmann::json put(const std::shared_ptr<ChatMemberMember> &object) {
     if (object) {
         json.put("status", object->status);
         json.put("tag", object->tag);
-        json.put("user", object->user);
         json.put("until_date", object->untilDate);
+        json.put("user", object->user);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    status,
+    user,
+    isAnonymous,
+    customTitle,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"status", Field::status},
+    {"user", Field::user},
+    {"is_anonymous", Field::isAnonymous},
+    {"custom_title", Field::customTitle},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatMemberOwner> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatMemberOwner>();
-    parse(data, "status", &result->status);
-    result->user = parseRequired<User>(data, "user");
-    parse(data, "is_anonymous", &result->isAnonymous);
-    parse(data, "custom_title", &result->customTitle);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::status:
+                detail::parseValue(value, &result->status);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::isAnonymous:
+                detail::parseValue(value, &result->isAnonymous);
+                break;
+            case Field::customTitle:
+                detail::parseValue(value, &result->customTitle);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatMemberOwner> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("custom_title", object->customTitle);
+        json.put("is_anonymous", object->isAnonymous);
         json.put("status", object->status);
         json.put("user", object->user);
-        json.put("is_anonymous", object->isAnonymous);
-        json.put("custom_title", object->customTitle);
     }
     return json;
 }
@@ -4,30 +4,128 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    status,
+    tag,
+    user,
+    isMember,
+    canSendMessages,
+    canSendAudios,
+    canSendDocuments,
+    canSendPhotos,
+    canSendVideos,
+    canSendVideoNotes,
+    canSendVoiceNotes,
+    canSendPolls,
+    canSendOtherMessages,
+    canAddWebPagePreviews,
+    canReactToMessages,
+    canEditTag,
+    canChangeInfo,
+    canInviteUsers,
+    canPinMessages,
+    canManageTopics,
+    untilDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"status", Field::status},
+    {"tag", Field::tag},
+    {"user", Field::user},
+    {"is_member", Field::isMember},
+    {"can_send_messages", Field::canSendMessages},
+    {"can_send_audios", Field::canSendAudios},
+    {"can_send_documents", Field::canSendDocuments},
+    {"can_send_photos", Field::canSendPhotos},
+    {"can_send_videos", Field::canSendVideos},
+    {"can_send_video_notes", Field::canSendVideoNotes},
+    {"can_send_voice_notes", Field::canSendVoiceNotes},
+    {"can_send_polls", Field::canSendPolls},
+    {"can_send_other_messages", Field::canSendOtherMessages},
+    {"can_add_web_page_previews", Field::canAddWebPagePreviews},
+    {"can_react_to_messages", Field::canReactToMessages},
+    {"can_edit_tag", Field::canEditTag},
+    {"can_change_info", Field::canChangeInfo},
+    {"can_invite_users", Field::canInviteUsers},
+    {"can_pin_messages", Field::canPinMessages},
+    {"can_manage_topics", Field::canManageTopics},
+    {"until_date", Field::untilDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatMemberRestricted> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatMemberRestricted>();
-    parse(data, "status", &result->status);
-    parse(data, "tag", &result->tag);
-    result->user = parseRequired<User>(data, "user");
-    parse(data, "is_member", &result->isMember);
-    parse(data, "can_send_messages", &result->canSendMessages);
-    parse(data, "can_send_audios", &result->canSendAudios);
-    parse(data, "can_send_documents", &result->canSendDocuments);
-    parse(data, "can_send_photos", &result->canSendPhotos);
-    parse(data, "can_send_videos", &result->canSendVideos);
-    parse(data, "can_send_video_notes", &result->canSendVideoNotes);
-    parse(data, "can_send_voice_notes", &result->canSendVoiceNotes);
-    parse(data, "can_send_polls", &result->canSendPolls);
-    parse(data, "can_send_other_messages", &result->canSendOtherMessages);
-    parse(data, "can_add_web_page_previews", &result->canAddWebPagePreviews);
-    parse(data, "can_react_to_messages", &result->canReactToMessages);
-    parse(data, "can_edit_tag", &result->canEditTag);
-    parse(data, "can_change_info", &result->canChangeInfo);
-    parse(data, "can_invite_users", &result->canInviteUsers);
-    parse(data, "can_pin_messages", &result->canPinMessages);
-    parse(data, "can_manage_topics", &result->canManageTopics);
-    parse(data, "until_date", &result->untilDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::status:
+                detail::parseValue(value, &result->status);
+                break;
+            case Field::tag:
+                detail::parseValue(value, &result->tag);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::isMember:
+                detail::parseValue(value, &result->isMember);
+                break;
+            case Field::canSendMessages:
+                detail::parseValue(value, &result->canSendMessages);
+                break;
+            case Field::canSendAudios:
+                detail::parseValue(value, &result->canSendAudios);
+                break;
+            case Field::canSendDocuments:
+                detail::parseValue(value, &result->canSendDocuments);
+                break;
+            case Field::canSendPhotos:
+                detail::parseValue(value, &result->canSendPhotos);
+                break;
+            case Field::canSendVideos:
+                detail::parseValue(value, &result->canSendVideos);
+                break;
+            case Field::canSendVideoNotes:
+                detail::parseValue(value, &result->canSendVideoNotes);
+                break;
+            case Field::canSendVoiceNotes:
+                detail::parseValue(value, &result->canSendVoiceNotes);
+                break;
+            case Field::canSendPolls:
+                detail::parseValue(value, &result->canSendPolls);
+                break;
+            case Field::canSendOtherMessages:
+                detail::parseValue(value, &result->canSendOtherMessages);
+                break;
+            case Field::canAddWebPagePreviews:
+                detail::parseValue(value, &result->canAddWebPagePreviews);
+                break;
+            case Field::canReactToMessages:
+                detail::parseValue(value, &result->canReactToMessages);
+                break;
+            case Field::canEditTag:
+                detail::parseValue(value, &result->canEditTag);
+                break;
+            case Field::canChangeInfo:
+                detail::parseValue(value, &result->canChangeInfo);
+                break;
+            case Field::canInviteUsers:
+                detail::parseValue(value, &result->canInviteUsers);
+                break;
+            case Field::canPinMessages:
+                detail::parseValue(value, &result->canPinMessages);
+                break;
+            case Field::canManageTopics:
+                detail::parseValue(value, &result->canManageTopics);
+                break;
+            case Field::untilDate:
+                detail::parseValue(value, &result->untilDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -35,27 +133,27 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatMemberRestricted> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("status", object->status);
-        json.put("tag", object->tag);
-        json.put("user", object->user);
-        json.put("is_member", object->isMember);
-        json.put("can_send_messages", object->canSendMessages);
+        json.put("can_add_web_page_previews", object->canAddWebPagePreviews);
+        json.put("can_change_info", object->canChangeInfo);
+        json.put("can_edit_tag", object->canEditTag);
+        json.put("can_invite_users", object->canInviteUsers);
+        json.put("can_manage_topics", object->canManageTopics);
+        json.put("can_pin_messages", object->canPinMessages);
+        json.put("can_react_to_messages", object->canReactToMessages);
         json.put("can_send_audios", object->canSendAudios);
         json.put("can_send_documents", object->canSendDocuments);
+        json.put("can_send_messages", object->canSendMessages);
+        json.put("can_send_other_messages", object->canSendOtherMessages);
         json.put("can_send_photos", object->canSendPhotos);
-        json.put("can_send_videos", object->canSendVideos);
+        json.put("can_send_polls", object->canSendPolls);
         json.put("can_send_video_notes", object->canSendVideoNotes);
+        json.put("can_send_videos", object->canSendVideos);
         json.put("can_send_voice_notes", object->canSendVoiceNotes);
-        json.put("can_send_polls", object->canSendPolls);
-        json.put("can_send_other_messages", object->canSendOtherMessages);
-        json.put("can_add_web_page_previews", object->canAddWebPagePreviews);
-        json.put("can_react_to_messages", object->canReactToMessages);
-        json.put("can_edit_tag", object->canEditTag);
-        json.put("can_change_info", object->canChangeInfo);
-        json.put("can_invite_users", object->canInviteUsers);
-        json.put("can_pin_messages", object->canPinMessages);
-        json.put("can_manage_topics", object->canManageTopics);
+        json.put("is_member", object->isMember);
+        json.put("status", object->status);
+        json.put("tag", object->tag);
         json.put("until_date", object->untilDate);
+        json.put("user", object->user);
     }
     return json;
 }
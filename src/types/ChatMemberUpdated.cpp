@@ -4,17 +4,63 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chat,
+    from,
+    date,
+    oldChatMember,
+    newChatMember,
+    inviteLink,
+    viaJoinRequest,
+    viaChatFolderInviteLink,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chat", Field::chat},
+    {"from", Field::from},
+    {"date", Field::date},
+    {"old_chat_member", Field::oldChatMember},
+    {"new_chat_member", Field::newChatMember},
+    {"invite_link", Field::inviteLink},
+    {"via_join_request", Field::viaJoinRequest},
+    {"via_chat_folder_invite_link", Field::viaChatFolderInviteLink},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatMemberUpdated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatMemberUpdated>();
-    result->chat = parseRequired<Chat>(data, "chat");
-    result->from = parseRequired<User>(data, "from");
-    parse(data, "date", &result->date);
-    result->oldChatMember = parseRequired<ChatMember>(data, "old_chat_member");
-    result->newChatMember = parseRequired<ChatMember>(data, "new_chat_member");
-    result->inviteLink = parse<ChatInviteLink>(data, "invite_link");
-    parse(data, "via_join_request", &result->viaJoinRequest);
-    parse(data, "via_chat_folder_invite_link", &result->viaChatFolderInviteLink);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::from:
+                result->from = parse<User>(value);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::oldChatMember:
+                result->oldChatMember = parse<ChatMember>(value);
+                break;
+            case Field::newChatMember:
+                result->newChatMember = parse<ChatMember>(value);
+                break;
+            case Field::inviteLink:
+                result->inviteLink = parse<ChatInviteLink>(value);
+                break;
+            case Field::viaJoinRequest:
+                detail::parseValue(value, &result->viaJoinRequest);
+                break;
+            case Field::viaChatFolderInviteLink:
+                detail::parseValue(value, &result->viaChatFolderInviteLink);
+                break;
+        }
+    });
     return result;
 }
 
@@ -23,13 +69,13 @@ nlohmann::json put(const std::shared_ptr<ChatMemberUpdated> &object) {
     JsonWrapper json;
     if (object) {
         json.put("chat", object->chat);
-        json.put("from", object->from);
         json.put("date", object->date);
-        json.put("old_chat_member", object->oldChatMember);
-        json.put("new_chat_member", object->newChatMember);
+        json.put("from", object->from);
         json.put("invite_link", object->inviteLink);
-        json.put("via_join_request", object->viaJoinRequest);
+        json.put("new_chat_member", object->newChatMember);
+        json.put("old_chat_member", object->oldChatMember);
         json.put("via_chat_folder_invite_link", object->viaChatFolderInviteLink);
+        json.put("via_join_request", object->viaJoinRequest);
     }
     return json;
 }
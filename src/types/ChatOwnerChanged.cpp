@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    newOwner,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"new_owner", Field::newOwner},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatOwnerChanged> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatOwnerChanged>();
-    result->newOwner = parseRequired<User>(data, "new_owner");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::newOwner:
+                result->newOwner = parse<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
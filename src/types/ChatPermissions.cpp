@@ -4,25 +4,103 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    canSendMessages,
+    canSendAudios,
+    canSendDocuments,
+    canSendPhotos,
+    canSendVideos,
+    canSendVideoNotes,
+    canSendVoiceNotes,
+    canSendPolls,
+    canSendOtherMessages,
+    canAddWebPagePreviews,
+    canReactToMessages,
+    canEditTag,
+    canChangeInfo,
+    canInviteUsers,
+    canPinMessages,
+    canManageTopics,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"can_send_messages", Field::canSendMessages},
+    {"can_send_audios", Field::canSendAudios},
+    {"can_send_documents", Field::canSendDocuments},
+    {"can_send_photos", Field::canSendPhotos},
+    {"can_send_videos", Field::canSendVideos},
+    {"can_send_video_notes", Field::canSendVideoNotes},
+    {"can_send_voice_notes", Field::canSendVoiceNotes},
+    {"can_send_polls", Field::canSendPolls},
+    {"can_send_other_messages", Field::canSendOtherMessages},
+    {"can_add_web_page_previews", Field::canAddWebPagePreviews},
+    {"can_react_to_messages", Field::canReactToMessages},
+    {"can_edit_tag", Field::canEditTag},
+    {"can_change_info", Field::canChangeInfo},
+    {"can_invite_users", Field::canInviteUsers},
+    {"can_pin_messages", Field::canPinMessages},
+    {"can_manage_topics", Field::canManageTopics},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatPermissions> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatPermissions>();
-    parse(data, "can_send_messages", &result->canSendMessages);
-    parse(data, "can_send_audios", &result->canSendAudios);
-    parse(data, "can_send_documents", &result->canSendDocuments);
-    parse(data, "can_send_photos", &result->canSendPhotos);
-    parse(data, "can_send_videos", &result->canSendVideos);
-    parse(data, "can_send_video_notes", &result->canSendVideoNotes);
-    parse(data, "can_send_voice_notes", &result->canSendVoiceNotes);
-    parse(data, "can_send_polls", &result->canSendPolls);
-    parse(data, "can_send_other_messages", &result->canSendOtherMessages);
-    parse(data, "can_add_web_page_previews", &result->canAddWebPagePreviews);
-    parse(data, "can_react_to_messages", &result->canReactToMessages);
-    parse(data, "can_edit_tag", &result->canEditTag);
-    parse(data, "can_change_info", &result->canChangeInfo);
-    parse(data, "can_invite_users", &result->canInviteUsers);
-    parse(data, "can_pin_messages", &result->canPinMessages);
-    parse(data, "can_manage_topics", &result->canManageTopics);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::canSendMessages:
+                detail::parseValue(value, &result->canSendMessages);
+                break;
+            case Field::canSendAudios:
+                detail::parseValue(value, &result->canSendAudios);
+                break;
+            case Field::canSendDocuments:
+                detail::parseValue(value, &result->canSendDocuments);
+                break;
+            case Field::canSendPhotos:
+                detail::parseValue(value, &result->canSendPhotos);
+                break;
+            case Field::canSendVideos:
+                detail::parseValue(value, &result->canSendVideos);
+                break;
+            case Field::canSendVideoNotes:
+                detail::parseValue(value, &result->canSendVideoNotes);
+                break;
+            case Field::canSendVoiceNotes:
+                detail::parseValue(value, &result->canSendVoiceNotes);
+                break;
+            case Field::canSendPolls:
+                detail::parseValue(value, &result->canSendPolls);
+                break;
+            case Field::canSendOtherMessages:
+                detail::parseValue(value, &result->canSendOtherMessages);
+                break;
+            case Field::canAddWebPagePreviews:
+                detail::parseValue(value, &result->canAddWebPagePreviews);
+                break;
+            case Field::canReactToMessages:
+                detail::parseValue(value, &result->canReactToMessages);
+                break;
+            case Field::canEditTag:
+                detail::parseValue(value, &result->canEditTag);
+                break;
+            case Field::canChangeInfo:
+                detail::parseValue(value, &result->canChangeInfo);
+                break;
+            case Field::canInviteUsers:
+                detail::parseValue(value, &result->canInviteUsers);
+                break;
+            case Field::canPinMessages:
+                detail::parseValue(value, &result->canPinMessages);
+                break;
+            case Field::canManageTopics:
+                detail::parseValue(value, &result->canManageTopics);
+                break;
+        }
+    });
     return result;
 }
 
@@ -30,22 +108,22 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatPermissions> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("can_send_messages", object->canSendMessages);
+        json.put("can_add_web_page_previews", object->canAddWebPagePreviews);
+        json.put("can_change_info", object->canChangeInfo);
+        json.put("can_edit_tag", object->canEditTag);
+        json.put("can_invite_users", object->canInviteUsers);
+        json.put("can_manage_topics", object->canManageTopics);
+        json.put("can_pin_messages", object->canPinMessages);
+        json.put("can_react_to_messages", object->canReactToMessages);
         json.put("can_send_audios", object->canSendAudios);
         json.put("can_send_documents", object->canSendDocuments);
+        json.put("can_send_messages", object->canSendMessages);
+        json.put("can_send_other_messages", object->canSendOtherMessages);
         json.put("can_send_photos", object->canSendPhotos);
-        json.put("can_send_videos", object->canSendVideos);
+        json.put("can_send_polls", object->canSendPolls);
         json.put("can_send_video_notes", object->canSendVideoNotes);
+        json.put("can_send_videos", object->canSendVideos);
         json.put("can_send_voice_notes", object->canSendVoiceNotes);
-        json.put("can_send_polls", object->canSendPolls);
-        json.put("can_send_other_messages", object->canSendOtherMessages);
-        json.put("can_add_web_page_previews", object->canAddWebPagePreviews);
-        json.put("can_react_to_messages", object->canReactToMessages);
-        json.put("can_edit_tag", object->canEditTag);
-        json.put("can_change_info", object->canChangeInfo);
-        json.put("can_invite_users", object->canInviteUsers);
-        json.put("can_pin_messages", object->canPinMessages);
-        json.put("can_manage_topics", object->canManageTopics);
     }
     return json;
 }
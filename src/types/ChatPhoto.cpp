@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    smallFileId,
+    smallFileUniqueId,
+    bigFileId,
+    bigFileUniqueId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"small_file_id", Field::smallFileId},
+    {"small_file_unique_id", Field::smallFileUniqueId},
+    {"big_file_id", Field::bigFileId},
+    {"big_file_unique_id", Field::bigFileUniqueId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatPhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatPhoto>();
-    parse(data, "small_file_id", &result->smallFileId);
-    parse(data, "small_file_unique_id", &result->smallFileUniqueId);
-    parse(data, "big_file_id", &result->bigFileId);
-    parse(data, "big_file_unique_id", &result->bigFileUniqueId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::smallFileId:
+                detail::parseValue(value, &result->smallFileId);
+                break;
+            case Field::smallFileUniqueId:
+                detail::parseValue(value, &result->smallFileUniqueId);
+                break;
+            case Field::bigFileId:
+                detail::parseValue(value, &result->bigFileId);
+                break;
+            case Field::bigFileUniqueId:
+                detail::parseValue(value, &result->bigFileUniqueId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatPhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("small_file_id", object->smallFileId);
-        json.put("small_file_unique_id", object->smallFileUniqueId);
         json.put("big_file_id", object->bigFileId);
         json.put("big_file_unique_id", object->bigFileUniqueId);
+        json.put("small_file_id", object->smallFileId);
+        json.put("small_file_unique_id", object->smallFileUniqueId);
     }
     return json;
 }
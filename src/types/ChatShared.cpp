@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    requestId,
+    chatId,
+    title,
+    username,
+    photo,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"request_id", Field::requestId},
+    {"chat_id", Field::chatId},
+    {"title", Field::title},
+    {"username", Field::username},
+    {"photo", Field::photo},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChatShared> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChatShared>();
-    parse(data, "request_id", &result->requestId);
-    parse(data, "chat_id", &result->chatId);
-    parse(data, "title", &result->title);
-    parse(data, "username", &result->username);
-    result->photo = parseArray<PhotoSize>(data, "photo");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::requestId:
+                detail::parseValue(value, &result->requestId);
+                break;
+            case Field::chatId:
+                detail::parseValue(value, &result->chatId);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::username:
+                detail::parseValue(value, &result->username);
+                break;
+            case Field::photo:
+                result->photo = parseArray<PhotoSize>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChatShared> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("request_id", object->requestId);
         json.put("chat_id", object->chatId);
+        json.put("photo", object->photo);
+        json.put("request_id", object->requestId);
         json.put("title", object->title);
         json.put("username", object->username);
-        json.put("photo", object->photo);
     }
     return json;
 }
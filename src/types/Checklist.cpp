@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    title,
+    titleEntities,
+    tasks,
+    othersCanAddTasks,
+    othersCanMarkTasksAsDone,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"title", Field::title},
+    {"title_entities", Field::titleEntities},
+    {"tasks", Field::tasks},
+    {"others_can_add_tasks", Field::othersCanAddTasks},
+    {"others_can_mark_tasks_as_done", Field::othersCanMarkTasksAsDone},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Checklist> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Checklist>();
-    parse(data, "title", &result->title);
-    result->titleEntities = parseArray<MessageEntity>(data, "title_entities");
-    result->tasks = parseRequiredArray<ChecklistTask>(data, "tasks");
-    parse(data, "others_can_add_tasks", &result->othersCanAddTasks);
-    parse(data, "others_can_mark_tasks_as_done", &result->othersCanMarkTasksAsDone);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::titleEntities:
+                result->titleEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::tasks:
+                result->tasks = parseArray<ChecklistTask>(value);
+                break;
+            case Field::othersCanAddTasks:
+                detail::parseValue(value, &result->othersCanAddTasks);
+                break;
+            case Field::othersCanMarkTasksAsDone:
+                detail::parseValue(value, &result->othersCanMarkTasksAsDone);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<Checklist> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("title", object->title);
-        json.put("title_entities", object->titleEntities);
-        json.put("tasks", object->tasks);
         json.put("others_can_add_tasks", object->othersCanAddTasks);
         json.put("others_can_mark_tasks_as_done", object->othersCanMarkTasksAsDone);
+        json.put("tasks", object->tasks);
+        json.put("title", object->title);
+        json.put("title_entities", object->titleEntities);
     }
     return json;
 }
@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    text,
+    textEntities,
+    completedByUser,
+    completedByChat,
+    completionDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"text", Field::text},
+    {"text_entities", Field::textEntities},
+    {"completed_by_user", Field::completedByUser},
+    {"completed_by_chat", Field::completedByChat},
+    {"completion_date", Field::completionDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChecklistTask> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChecklistTask>();
-    parse(data, "id", &result->id);
-    parse(data, "text", &result->text);
-    result->textEntities = parseArray<MessageEntity>(data, "text_entities");
-    result->completedByUser = parse<User>(data, "completed_by_user");
-    result->completedByChat = parse<Chat>(data, "completed_by_chat");
-    parse(data, "completion_date", &result->completionDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::textEntities:
+                result->textEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::completedByUser:
+                result->completedByUser = parse<User>(value);
+                break;
+            case Field::completedByChat:
+                result->completedByChat = parse<Chat>(value);
+                break;
+            case Field::completionDate:
+                detail::parseValue(value, &result->completionDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChecklistTask> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("completed_by_chat", object->completedByChat);
+        json.put("completed_by_user", object->completedByUser);
+        json.put("completion_date", object->completionDate);
         json.put("id", object->id);
         json.put("text", object->text);
         json.put("text_entities", object->textEntities);
-        json.put("completed_by_user", object->completedByUser);
-        json.put("completed_by_chat", object->completedByChat);
-        json.put("completion_date", object->completionDate);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    checklistMessage,
+    tasks,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"checklist_message", Field::checklistMessage},
+    {"tasks", Field::tasks},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChecklistTasksAdded> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChecklistTasksAdded>();
-    result->checklistMessage = parse<Message>(data, "checklist_message");
-    result->tasks = parseRequiredArray<ChecklistTask>(data, "tasks");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::checklistMessage:
+                result->checklistMessage = parse<Message>(value);
+                break;
+            case Field::tasks:
+                result->tasks = parseArray<ChecklistTask>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    checklistMessage,
+    markedAsDoneTaskIds,
+    markedAsNotDoneTaskIds,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"checklist_message", Field::checklistMessage},
+    {"marked_as_done_task_ids", Field::markedAsDoneTaskIds},
+    {"marked_as_not_done_task_ids", Field::markedAsNotDoneTaskIds},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChecklistTasksDone> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChecklistTasksDone>();
-    result->checklistMessage = parse<Message>(data, "checklist_message");
-    result->markedAsDoneTaskIds = parsePrimitiveArray<std::int64_t>(data, "marked_as_done_task_ids");
-    result->markedAsNotDoneTaskIds = parsePrimitiveArray<std::int64_t>(data, "marked_as_not_done_task_ids");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::checklistMessage:
+                result->checklistMessage = parse<Message>(value);
+                break;
+            case Field::markedAsDoneTaskIds:
+                result->markedAsDoneTaskIds = parsePrimitiveArray<std::int64_t>(value);
+                break;
+            case Field::markedAsNotDoneTaskIds:
+                result->markedAsNotDoneTaskIds = parsePrimitiveArray<std::int64_t>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    resultId,
+    from,
+    location,
+    inlineMessageId,
+    query,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"result_id", Field::resultId},
+    {"from", Field::from},
+    {"location", Field::location},
+    {"inline_message_id", Field::inlineMessageId},
+    {"query", Field::query},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ChosenInlineResult> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ChosenInlineResult>();
-    parse(data, "result_id", &result->resultId);
-    result->from = parseRequired<User>(data, "from");
-    result->location = parse<Location>(data, "location");
-    parse(data, "inline_message_id", &result->inlineMessageId);
-    parse(data, "query", &result->query);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::resultId:
+                detail::parseValue(value, &result->resultId);
+                break;
+            case Field::from:
+                result->from = parse<User>(value);
+                break;
+            case Field::location:
+                result->location = parse<Location>(value);
+                break;
+            case Field::inlineMessageId:
+                detail::parseValue(value, &result->inlineMessageId);
+                break;
+            case Field::query:
+                detail::parseValue(value, &result->query);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<ChosenInlineResult> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("result_id", object->resultId);
         json.put("from", object->from);
-        json.put("location", object->location);
         json.put("inline_message_id", object->inlineMessageId);
+        json.put("location", object->location);
         json.put("query", object->query);
+        json.put("result_id", object->resultId);
     }
     return json;
 }
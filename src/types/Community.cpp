@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    name,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"name", Field::name},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Community> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Community>();
-    parse(data, "id", &result->id);
-    parse(data, "name", &result->name);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    community,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"community", Field::community},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<CommunityChatAdded> parse(const nlohmann::json &data) {
     auto result = std::make_shared<CommunityChatAdded>();
-    result->community = parseRequired<Community>(data, "community");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::community:
+                result->community = parse<Community>(value);
+                break;
+        }
+    });
     return result;
 }
 
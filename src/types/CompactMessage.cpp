@@ -0,0 +1,221 @@
+#include <tgbot/TgTypeParser.h>
+#include <tgbot/types/CompactMessage.h>
+#include <nlohmann/json.hpp>
+
+#include <bitset>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace TgBot {
+
+namespace {
+
+// Converts to any member type, so that Message{AnyField{}...} compiles for
+// exactly as many initializers as Message has fields.
+struct AnyField {
+    template <typename T>
+    operator T&() const&&;
+};
+
+template <typename T, typename Indices, typename = void>
+struct BraceConstructible : std::false_type {};
+
+template <typename T, std::size_t... I>
+struct BraceConstructible<T, std::index_sequence<I...>,
+                          std::void_t<decltype(T{(void(I), AnyField{})...})>>
+    : std::true_type {};
+
+template <typename T, std::size_t N = 0>
+constexpr std::size_t fieldCount() {
+    if constexpr (BraceConstructible<T, std::make_index_sequence<N + 1>>::value) {
+        return fieldCount<T, N + 1>();
+    } else {
+        return N;
+    }
+}
+
+// messageId, messageThreadId, from, senderChat, date, chat, replyToMessage,
+// editDate, text, entities, photo and caption.
+constexpr std::size_t kInlineFieldCount = 12;
+
+static_assert(std::is_aggregate_v<Message>);
+static_assert(fieldCount<Message>() ==
+                  kInlineFieldCount +
+                      static_cast<std::size_t>(detail::MessageSideField::Count),
+              "A field was added to Message: add it to "
+              "TGBOT_COMPACT_MESSAGE_SIDE_FIELDS or keep it inline");
+
+}  // namespace
+
+std::size_t CompactMessage::slot(std::size_t index) const noexcept {
+    const std::size_t word = index / 64;
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < word; ++i) {
+        result += std::bitset<64>(_present[i]).count();
+    }
+    const std::uint64_t below = (std::uint64_t{1} << (index % 64)) - 1;
+    return result + std::bitset<64>(_present[word] & below).count();
+}
+
+void CompactMessage::store(std::size_t index, std::shared_ptr<void> value) {
+    const auto position = _side.begin() + static_cast<std::ptrdiff_t>(slot(index));
+    if (test(index)) {
+        *position = std::move(value);
+        return;
+    }
+    _side.insert(position, std::move(value));
+    _present[index / 64] |= std::uint64_t{1} << (index % 64);
+}
+
+void CompactMessage::erase(std::size_t index) {
+    if (!test(index)) {
+        return;
+    }
+    _side.erase(_side.begin() + static_cast<std::ptrdiff_t>(slot(index)));
+    _present[index / 64] &= ~(std::uint64_t{1} << (index % 64));
+}
+
+Message::Ptr CompactMessage::expand() const {
+    auto result = std::make_shared<Message>();
+    result->messageId = messageId;
+    result->messageThreadId = messageThreadId;
+    result->from = from;
+    result->senderChat = senderChat;
+    result->date = date;
+    result->chat = chat;
+    result->replyToMessage = replyToMessage;
+    result->editDate = editDate;
+    result->text = text;
+    result->entities = entities;
+    result->photo = photo;
+    result->caption = caption;
+#define TGBOT_SIDE_FIELD(member, key) \
+    result->member = get<&Message::member>();
+    TGBOT_COMPACT_MESSAGE_SIDE_FIELDS(TGBOT_SIDE_FIELD)
+#undef TGBOT_SIDE_FIELD
+    return result;
+}
+
+CompactMessage::Ptr CompactMessage::compact(const Message& message) {
+    auto result = std::make_shared<CompactMessage>();
+    result->messageId = message.messageId;
+    result->messageThreadId = message.messageThreadId;
+    result->from = message.from;
+    result->senderChat = message.senderChat;
+    result->date = message.date;
+    result->chat = message.chat;
+    result->replyToMessage = message.replyToMessage;
+    result->editDate = message.editDate;
+    result->text = message.text;
+    result->entities = message.entities;
+    result->photo = message.photo;
+    result->caption = message.caption;
+#define TGBOT_SIDE_FIELD(member, key) \
+    if (message.member) {             \
+        result->set<&Message::member>(message.member); \
+    }
+    TGBOT_COMPACT_MESSAGE_SIDE_FIELDS(TGBOT_SIDE_FIELD)
+#undef TGBOT_SIDE_FIELD
+    return result;
+}
+
+namespace {
+
+// Parses one rare field from its JSON value, the way Message's parser does.
+template <typename Field>
+Field parseSideField(const nlohmann::json& value) {
+    using Value = typename Field::value_type;
+    if constexpr (detail::is_shared_ptr_v<Value>) {
+        return parse<typename Value::element_type>(value);
+    } else if constexpr (detail::is_vector_v<Value>) {
+        return parseArray<typename Value::value_type::element_type>(value);
+    } else if constexpr (std::is_same_v<Value, MaybeInaccessibleMessage>) {
+        // Message parses pinned_message as a Message as well.
+        return MaybeInaccessibleMessage(parse<Message>(value));
+    } else {
+        if (value.is_null()) {
+            return std::nullopt;
+        }
+        if constexpr (std::is_same_v<Value, bool> ||
+                      std::is_convertible_v<Value, std::string>) {
+            return value.get<Value>();
+        } else if constexpr (std::is_integral_v<Value>) {
+            return static_cast<Value>(value.get<std::int64_t>());
+        } else {
+            return static_cast<Value>(value.get<double>());
+        }
+    }
+}
+
+using SideFieldParser = void (*)(CompactMessage&, const nlohmann::json&);
+
+// JSON key to parser of every rare field, so that parsing looks up the keys
+// a message has instead of probing for all the keys it could have.
+const std::unordered_map<std::string_view, SideFieldParser>& sideFieldParsers() {
+    static const std::unordered_map<std::string_view, SideFieldParser> parsers = {
+#define TGBOT_SIDE_FIELD(member, key)                                         \
+    {key, [](CompactMessage& message, const nlohmann::json& value) {          \
+         message.set<&Message::member>(                                       \
+             parseSideField<detail::MessageFieldType<&Message::member>>(value)); \
+     }},
+        TGBOT_COMPACT_MESSAGE_SIDE_FIELDS(TGBOT_SIDE_FIELD)
+#undef TGBOT_SIDE_FIELD
+    };
+    return parsers;
+}
+
+}  // namespace
+
+template <>
+std::shared_ptr<CompactMessage> parse(const nlohmann::json &data) {
+    auto result = std::make_shared<CompactMessage>();
+    parse(data, "message_id", &result->messageId);
+    parse(data, "message_thread_id", &result->messageThreadId);
+    result->from = parse<User>(data, "from");
+    result->senderChat = parse<Chat>(data, "sender_chat");
+    parse(data, "date", &result->date);
+    result->chat = parseRequired<Chat>(data, "chat");
+    result->replyToMessage = parse<Message>(data, "reply_to_message");
+    parse(data, "edit_date", &result->editDate);
+    parse(data, "text", &result->text);
+    result->entities = parseArray<MessageEntity>(data, "entities");
+    result->photo = parseArray<PhotoSize>(data, "photo");
+    parse(data, "caption", &result->caption);
+
+    const auto& parsers = sideFieldParsers();
+    for (auto it = data.begin(); it != data.end(); ++it) {
+        const auto parser = parsers.find(it.key());
+        if (parser != parsers.end()) {
+            parser->second(*result, it.value());
+        }
+    }
+    return result;
+}
+
+template <>
+nlohmann::json put(const std::shared_ptr<CompactMessage> &object) {
+    JsonWrapper json;
+    if (object) {
+        json.put("message_id", object->messageId);
+        json.put("message_thread_id", object->messageThreadId);
+        json.put("from", object->from);
+        json.put("sender_chat", object->senderChat);
+        json.put("date", object->date);
+        json.put("chat", object->chat);
+        json.put("reply_to_message", object->replyToMessage);
+        json.put("edit_date", object->editDate);
+        json.put("text", object->text);
+        json.put("entities", object->entities);
+        json.put("photo", object->photo);
+        json.put("caption", object->caption);
+#define TGBOT_SIDE_FIELD(member, key) \
+        json.put(key, object->get<&Message::member>());
+        TGBOT_COMPACT_MESSAGE_SIDE_FIELDS(TGBOT_SIDE_FIELD)
+#undef TGBOT_SIDE_FIELD
+    }
+    return json;
+}
+
+} // namespace TgBot
@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    phoneNumber,
+    firstName,
+    lastName,
+    userId,
+    vcard,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"phone_number", Field::phoneNumber},
+    {"first_name", Field::firstName},
+    {"last_name", Field::lastName},
+    {"user_id", Field::userId},
+    {"vcard", Field::vcard},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Contact> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Contact>();
-    parse(data, "phone_number", &result->phoneNumber);
-    parse(data, "first_name", &result->firstName);
-    parse(data, "last_name", &result->lastName);
-    parse(data, "user_id", &result->userId);
-    parse(data, "vcard", &result->vcard);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::phoneNumber:
+                detail::parseValue(value, &result->phoneNumber);
+                break;
+            case Field::firstName:
+                detail::parseValue(value, &result->firstName);
+                break;
+            case Field::lastName:
+                detail::parseValue(value, &result->lastName);
+                break;
+            case Field::userId:
+                detail::parseValue(value, &result->userId);
+                break;
+            case Field::vcard:
+                detail::parseValue(value, &result->vcard);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,9 +53,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<Contact> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("phone_number", object->phoneNumber);
         json.put("first_name", object->firstName);
         json.put("last_name", object->lastName);
+        json.put("phone_number", object->phoneNumber);
         json.put("user_id", object->userId);
         json.put("vcard", object->vcard);
     }
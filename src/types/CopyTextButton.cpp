@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    text,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"text", Field::text},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<CopyTextButton> parse(const nlohmann::json &data) {
     auto result = std::make_shared<CopyTextButton>();
-    parse(data, "text", &result->text);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    emoji,
+    value,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"emoji", Field::emoji},
+    {"value", Field::value},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Dice> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Dice>();
-    parse(data, "emoji", &result->emoji);
-    parse(data, "value", &result->value);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::emoji:
+                detail::parseValue(value, &result->emoji);
+                break;
+            case Field::value:
+                detail::parseValue(value, &result->value);
+                break;
+        }
+    });
     return result;
 }
 
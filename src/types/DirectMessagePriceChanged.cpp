@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    areDirectMessagesEnabled,
+    directMessageStarCount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"are_direct_messages_enabled", Field::areDirectMessagesEnabled},
+    {"direct_message_star_count", Field::directMessageStarCount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<DirectMessagePriceChanged> parse(const nlohmann::json &data) {
     auto result = std::make_shared<DirectMessagePriceChanged>();
-    parse(data, "are_direct_messages_enabled", &result->areDirectMessagesEnabled);
-    parse(data, "direct_message_star_count", &result->directMessageStarCount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::areDirectMessagesEnabled:
+                detail::parseValue(value, &result->areDirectMessagesEnabled);
+                break;
+            case Field::directMessageStarCount:
+                detail::parseValue(value, &result->directMessageStarCount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    topicId,
+    user,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"topic_id", Field::topicId},
+    {"user", Field::user},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<DirectMessagesTopic> parse(const nlohmann::json &data) {
     auto result = std::make_shared<DirectMessagesTopic>();
-    parse(data, "topic_id", &result->topicId);
-    result->user = parse<User>(data, "user");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::topicId:
+                detail::parseValue(value, &result->topicId);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
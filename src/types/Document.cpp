@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    fileId,
+    fileUniqueId,
+    thumbnail,
+    fileName,
+    mimeType,
+    fileSize,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"file_id", Field::fileId},
+    {"file_unique_id", Field::fileUniqueId},
+    {"thumbnail", Field::thumbnail},
+    {"file_name", Field::fileName},
+    {"mime_type", Field::mimeType},
+    {"file_size", Field::fileSize},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Document> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Document>();
-    parse(data, "file_id", &result->fileId);
-    parse(data, "file_unique_id", &result->fileUniqueId);
-    result->thumbnail = parse<PhotoSize>(data, "thumbnail");
-    parse(data, "file_name", &result->fileName);
-    parse(data, "mime_type", &result->mimeType);
-    parse(data, "file_size", &result->fileSize);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::fileId:
+                detail::parseValue(value, &result->fileId);
+                break;
+            case Field::fileUniqueId:
+                detail::parseValue(value, &result->fileUniqueId);
+                break;
+            case Field::thumbnail:
+                result->thumbnail = parse<PhotoSize>(value);
+                break;
+            case Field::fileName:
+                detail::parseValue(value, &result->fileName);
+                break;
+            case Field::mimeType:
+                detail::parseValue(value, &result->mimeType);
+                break;
+            case Field::fileSize:
+                detail::parseValue(value, &result->fileSize);
+                break;
+        }
+    });
     return result;
 }
 
@@ -21,11 +59,11 @@ nlohmann::json put(const std::shared_ptr<Document> &object) {
     JsonWrapper json;
     if (object) {
         json.put("file_id", object->fileId);
-        json.put("file_unique_id", object->fileUniqueId);
-        json.put("thumbnail", object->thumbnail);
         json.put("file_name", object->fileName);
-        json.put("mime_type", object->mimeType);
         json.put("file_size", object->fileSize);
+        json.put("file_unique_id", object->fileUniqueId);
+        json.put("mime_type", object->mimeType);
+        json.put("thumbnail", object->thumbnail);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    data,
+    hash,
+    secret,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"data", Field::data},
+    {"hash", Field::hash},
+    {"secret", Field::secret},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<EncryptedCredentials> parse(const nlohmann::json &data) {
     auto result = std::make_shared<EncryptedCredentials>();
-    parse(data, "data", &result->data);
-    parse(data, "hash", &result->hash);
-    parse(data, "secret", &result->secret);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::data:
+                detail::parseValue(value, &result->data);
+                break;
+            case Field::hash:
+                detail::parseValue(value, &result->hash);
+                break;
+            case Field::secret:
+                detail::parseValue(value, &result->secret);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    data,
+    phoneNumber,
+    email,
+    files,
+    frontSide,
+    reverseSide,
+    selfie,
+    translation,
+    hash,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"data", Field::data},
+    {"phone_number", Field::phoneNumber},
+    {"email", Field::email},
+    {"files", Field::files},
+    {"front_side", Field::frontSide},
+    {"reverse_side", Field::reverseSide},
+    {"selfie", Field::selfie},
+    {"translation", Field::translation},
+    {"hash", Field::hash},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<EncryptedPassportElement> parse(const nlohmann::json &data) {
     auto result = std::make_shared<EncryptedPassportElement>();
-    parse(data, "type", &result->type);
-    parse(data, "data", &result->data);
-    parse(data, "phone_number", &result->phoneNumber);
-    parse(data, "email", &result->email);
-    result->files = parseArray<PassportFile>(data, "files");
-    result->frontSide = parse<PassportFile>(data, "front_side");
-    result->reverseSide = parse<PassportFile>(data, "reverse_side");
-    result->selfie = parse<PassportFile>(data, "selfie");
-    result->translation = parseArray<PassportFile>(data, "translation");
-    parse(data, "hash", &result->hash);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::data:
+                detail::parseValue(value, &result->data);
+                break;
+            case Field::phoneNumber:
+                detail::parseValue(value, &result->phoneNumber);
+                break;
+            case Field::email:
+                detail::parseValue(value, &result->email);
+                break;
+            case Field::files:
+                result->files = parseArray<PassportFile>(value);
+                break;
+            case Field::frontSide:
+                result->frontSide = parse<PassportFile>(value);
+                break;
+            case Field::reverseSide:
+                result->reverseSide = parse<PassportFile>(value);
+                break;
+            case Field::selfie:
+                result->selfie = parse<PassportFile>(value);
+                break;
+            case Field::translation:
+                result->translation = parseArray<PassportFile>(value);
+                break;
+            case Field::hash:
+                detail::parseValue(value, &result->hash);
+                break;
+        }
+    });
     return result;
 }
 
@@ -24,16 +78,16 @@ template <>
 nlohmann::json put(const std::shared_ptr<EncryptedPassportElement> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("data", object->data);
-        json.put("phone_number", object->phoneNumber);
         json.put("email", object->email);
         json.put("files", object->files);
         json.put("front_side", object->frontSide);
+        json.put("hash", object->hash);
+        json.put("phone_number", object->phoneNumber);
         json.put("reverse_side", object->reverseSide);
         json.put("selfie", object->selfie);
         json.put("translation", object->translation);
-        json.put("hash", object->hash);
+        json.put("type", object->type);
     }
     return json;
 }
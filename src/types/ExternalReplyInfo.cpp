@@ -4,35 +4,153 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    origin,
+    chat,
+    messageId,
+    linkPreviewOptions,
+    animation,
+    audio,
+    document,
+    livePhoto,
+    paidMedia,
+    photo,
+    sticker,
+    story,
+    video,
+    videoNote,
+    voice,
+    hasMediaSpoiler,
+    checklist,
+    contact,
+    dice,
+    game,
+    giveaway,
+    giveawayWinners,
+    invoice,
+    location,
+    poll,
+    venue,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"origin", Field::origin},
+    {"chat", Field::chat},
+    {"message_id", Field::messageId},
+    {"link_preview_options", Field::linkPreviewOptions},
+    {"animation", Field::animation},
+    {"audio", Field::audio},
+    {"document", Field::document},
+    {"live_photo", Field::livePhoto},
+    {"paid_media", Field::paidMedia},
+    {"photo", Field::photo},
+    {"sticker", Field::sticker},
+    {"story", Field::story},
+    {"video", Field::video},
+    {"video_note", Field::videoNote},
+    {"voice", Field::voice},
+    {"has_media_spoiler", Field::hasMediaSpoiler},
+    {"checklist", Field::checklist},
+    {"contact", Field::contact},
+    {"dice", Field::dice},
+    {"game", Field::game},
+    {"giveaway", Field::giveaway},
+    {"giveaway_winners", Field::giveawayWinners},
+    {"invoice", Field::invoice},
+    {"location", Field::location},
+    {"poll", Field::poll},
+    {"venue", Field::venue},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ExternalReplyInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ExternalReplyInfo>();
-    result->origin = parseRequired<MessageOrigin>(data, "origin");
-    result->chat = parse<Chat>(data, "chat");
-    parse(data, "message_id", &result->messageId);
-    result->linkPreviewOptions = parse<LinkPreviewOptions>(data, "link_preview_options");
-    result->animation = parse<Animation>(data, "animation");
-    result->audio = parse<Audio>(data, "audio");
-    result->document = parse<Document>(data, "document");
-    result->livePhoto = parse<LivePhoto>(data, "live_photo");
-    result->paidMedia = parse<PaidMediaInfo>(data, "paid_media");
-    result->photo = parseArray<PhotoSize>(data, "photo");
-    result->sticker = parse<Sticker>(data, "sticker");
-    result->story = parse<Story>(data, "story");
-    result->video = parse<Video>(data, "video");
-    result->videoNote = parse<VideoNote>(data, "video_note");
-    result->voice = parse<Voice>(data, "voice");
-    parse(data, "has_media_spoiler", &result->hasMediaSpoiler);
-    result->checklist = parse<Checklist>(data, "checklist");
-    result->contact = parse<Contact>(data, "contact");
-    result->dice = parse<Dice>(data, "dice");
-    result->game = parse<Game>(data, "game");
-    result->giveaway = parse<Giveaway>(data, "giveaway");
-    result->giveawayWinners = parse<GiveawayWinners>(data, "giveaway_winners");
-    result->invoice = parse<Invoice>(data, "invoice");
-    result->location = parse<Location>(data, "location");
-    result->poll = parse<Poll>(data, "poll");
-    result->venue = parse<Venue>(data, "venue");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::origin:
+                result->origin = parse<MessageOrigin>(value);
+                break;
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::messageId:
+                detail::parseValue(value, &result->messageId);
+                break;
+            case Field::linkPreviewOptions:
+                result->linkPreviewOptions = parse<LinkPreviewOptions>(value);
+                break;
+            case Field::animation:
+                result->animation = parse<Animation>(value);
+                break;
+            case Field::audio:
+                result->audio = parse<Audio>(value);
+                break;
+            case Field::document:
+                result->document = parse<Document>(value);
+                break;
+            case Field::livePhoto:
+                result->livePhoto = parse<LivePhoto>(value);
+                break;
+            case Field::paidMedia:
+                result->paidMedia = parse<PaidMediaInfo>(value);
+                break;
+            case Field::photo:
+                result->photo = parseArray<PhotoSize>(value);
+                break;
+            case Field::sticker:
+                result->sticker = parse<Sticker>(value);
+                break;
+            case Field::story:
+                result->story = parse<Story>(value);
+                break;
+            case Field::video:
+                result->video = parse<Video>(value);
+                break;
+            case Field::videoNote:
+                result->videoNote = parse<VideoNote>(value);
+                break;
+            case Field::voice:
+                result->voice = parse<Voice>(value);
+                break;
+            case Field::hasMediaSpoiler:
+                detail::parseValue(value, &result->hasMediaSpoiler);
+                break;
+            case Field::checklist:
+                result->checklist = parse<Checklist>(value);
+                break;
+            case Field::contact:
+                result->contact = parse<Contact>(value);
+                break;
+            case Field::dice:
+                result->dice = parse<Dice>(value);
+                break;
+            case Field::game:
+                result->game = parse<Game>(value);
+                break;
+            case Field::giveaway:
+                result->giveaway = parse<Giveaway>(value);
+                break;
+            case Field::giveawayWinners:
+                result->giveawayWinners = parse<GiveawayWinners>(value);
+                break;
+            case Field::invoice:
+                result->invoice = parse<Invoice>(value);
+                break;
+            case Field::location:
+                result->location = parse<Location>(value);
+                break;
+            case Field::poll:
+                result->poll = parse<Poll>(value);
+                break;
+            case Field::venue:
+                result->venue = parse<Venue>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -40,32 +158,32 @@ template <>
 nlohmann::json put(const std::shared_ptr<ExternalReplyInfo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("origin", object->origin);
-        json.put("chat", object->chat);
-        json.put("message_id", object->messageId);
-        json.put("link_preview_options", object->linkPreviewOptions);
         json.put("animation", object->animation);
         json.put("audio", object->audio);
-        json.put("document", object->document);
-        json.put("live_photo", object->livePhoto);
-        json.put("paid_media", object->paidMedia);
-        json.put("photo", object->photo);
-        json.put("sticker", object->sticker);
-        json.put("story", object->story);
-        json.put("video", object->video);
-        json.put("video_note", object->videoNote);
-        json.put("voice", object->voice);
-        json.put("has_media_spoiler", object->hasMediaSpoiler);
+        json.put("chat", object->chat);
         json.put("checklist", object->checklist);
         json.put("contact", object->contact);
         json.put("dice", object->dice);
+        json.put("document", object->document);
         json.put("game", object->game);
         json.put("giveaway", object->giveaway);
         json.put("giveaway_winners", object->giveawayWinners);
+        json.put("has_media_spoiler", object->hasMediaSpoiler);
         json.put("invoice", object->invoice);
+        json.put("link_preview_options", object->linkPreviewOptions);
+        json.put("live_photo", object->livePhoto);
         json.put("location", object->location);
+        json.put("message_id", object->messageId);
+        json.put("origin", object->origin);
+        json.put("paid_media", object->paidMedia);
+        json.put("photo", object->photo);
         json.put("poll", object->poll);
+        json.put("sticker", object->sticker);
+        json.put("story", object->story);
         json.put("venue", object->venue);
+        json.put("video", object->video);
+        json.put("video_note", object->videoNote);
+        json.put("voice", object->voice);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    fileId,
+    fileUniqueId,
+    fileSize,
+    filePath,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"file_id", Field::fileId},
+    {"file_unique_id", Field::fileUniqueId},
+    {"file_size", Field::fileSize},
+    {"file_path", Field::filePath},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<File> parse(const nlohmann::json &data) {
     auto result = std::make_shared<File>();
-    parse(data, "file_id", &result->fileId);
-    parse(data, "file_unique_id", &result->fileUniqueId);
-    parse(data, "file_size", &result->fileSize);
-    parse(data, "file_path", &result->filePath);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::fileId:
+                detail::parseValue(value, &result->fileId);
+                break;
+            case Field::fileUniqueId:
+                detail::parseValue(value, &result->fileUniqueId);
+                break;
+            case Field::fileSize:
+                detail::parseValue(value, &result->fileSize);
+                break;
+            case Field::filePath:
+                detail::parseValue(value, &result->filePath);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,9 +49,9 @@ nlohmann::json put(const std::shared_ptr<File> &object) {
     JsonWrapper json;
     if (object) {
         json.put("file_id", object->fileId);
-        json.put("file_unique_id", object->fileUniqueId);
-        json.put("file_size", object->fileSize);
         json.put("file_path", object->filePath);
+        json.put("file_size", object->fileSize);
+        json.put("file_unique_id", object->fileUniqueId);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    forceReply,
+    inputFieldPlaceholder,
+    selective,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"force_reply", Field::forceReply},
+    {"input_field_placeholder", Field::inputFieldPlaceholder},
+    {"selective", Field::selective},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ForceReply> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ForceReply>();
-    parse(data, "force_reply", &result->forceReply);
-    parse(data, "input_field_placeholder", &result->inputFieldPlaceholder);
-    parse(data, "selective", &result->selective);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::forceReply:
+                detail::parseValue(value, &result->forceReply);
+                break;
+            case Field::inputFieldPlaceholder:
+                detail::parseValue(value, &result->inputFieldPlaceholder);
+                break;
+            case Field::selective:
+                detail::parseValue(value, &result->selective);
+                break;
+        }
+    });
     return result;
 }
 
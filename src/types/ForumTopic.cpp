@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    messageThreadId,
+    name,
+    iconColor,
+    iconCustomEmojiId,
+    isNameImplicit,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"message_thread_id", Field::messageThreadId},
+    {"name", Field::name},
+    {"icon_color", Field::iconColor},
+    {"icon_custom_emoji_id", Field::iconCustomEmojiId},
+    {"is_name_implicit", Field::isNameImplicit},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ForumTopic> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ForumTopic>();
-    parse(data, "message_thread_id", &result->messageThreadId);
-    parse(data, "name", &result->name);
-    parse(data, "icon_color", &result->iconColor);
-    parse(data, "icon_custom_emoji_id", &result->iconCustomEmojiId);
-    parse(data, "is_name_implicit", &result->isNameImplicit);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::messageThreadId:
+                detail::parseValue(value, &result->messageThreadId);
+                break;
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+            case Field::iconColor:
+                detail::parseValue(value, &result->iconColor);
+                break;
+            case Field::iconCustomEmojiId:
+                detail::parseValue(value, &result->iconCustomEmojiId);
+                break;
+            case Field::isNameImplicit:
+                detail::parseValue(value, &result->isNameImplicit);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<ForumTopic> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("message_thread_id", object->messageThreadId);
-        json.put("name", object->name);
         json.put("icon_color", object->iconColor);
         json.put("icon_custom_emoji_id", object->iconCustomEmojiId);
         json.put("is_name_implicit", object->isNameImplicit);
+        json.put("message_thread_id", object->messageThreadId);
+        json.put("name", object->name);
     }
     return json;
 }
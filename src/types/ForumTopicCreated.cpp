@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    name,
+    iconColor,
+    iconCustomEmojiId,
+    isNameImplicit,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"name", Field::name},
+    {"icon_color", Field::iconColor},
+    {"icon_custom_emoji_id", Field::iconCustomEmojiId},
+    {"is_name_implicit", Field::isNameImplicit},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ForumTopicCreated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ForumTopicCreated>();
-    parse(data, "name", &result->name);
-    parse(data, "icon_color", &result->iconColor);
-    parse(data, "icon_custom_emoji_id", &result->iconCustomEmojiId);
-    parse(data, "is_name_implicit", &result->isNameImplicit);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+            case Field::iconColor:
+                detail::parseValue(value, &result->iconColor);
+                break;
+            case Field::iconCustomEmojiId:
+                detail::parseValue(value, &result->iconCustomEmojiId);
+                break;
+            case Field::isNameImplicit:
+                detail::parseValue(value, &result->isNameImplicit);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<ForumTopicCreated> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("name", object->name);
         json.put("icon_color", object->iconColor);
         json.put("icon_custom_emoji_id", object->iconCustomEmojiId);
         json.put("is_name_implicit", object->isNameImplicit);
+        json.put("name", object->name);
     }
     return json;
 }
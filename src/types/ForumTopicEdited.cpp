@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    name,
+    iconCustomEmojiId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"name", Field::name},
+    {"icon_custom_emoji_id", Field::iconCustomEmojiId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ForumTopicEdited> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ForumTopicEdited>();
-    parse(data, "name", &result->name);
-    parse(data, "icon_custom_emoji_id", &result->iconCustomEmojiId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+            case Field::iconCustomEmojiId:
+                detail::parseValue(value, &result->iconCustomEmojiId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ForumTopicEdited> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("name", object->name);
         json.put("icon_custom_emoji_id", object->iconCustomEmojiId);
+        json.put("name", object->name);
     }
     return json;
 }
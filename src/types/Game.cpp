@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    title,
+    description,
+    photo,
+    text,
+    textEntities,
+    animation,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"title", Field::title},
+    {"description", Field::description},
+    {"photo", Field::photo},
+    {"text", Field::text},
+    {"text_entities", Field::textEntities},
+    {"animation", Field::animation},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Game> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Game>();
-    parse(data, "title", &result->title);
-    parse(data, "description", &result->description);
-    result->photo = parseRequiredArray<PhotoSize>(data, "photo");
-    parse(data, "text", &result->text);
-    result->textEntities = parseArray<MessageEntity>(data, "text_entities");
-    result->animation = parse<Animation>(data, "animation");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::photo:
+                result->photo = parseArray<PhotoSize>(value);
+                break;
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::textEntities:
+                result->textEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::animation:
+                result->animation = parse<Animation>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<Game> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("title", object->title);
+        json.put("animation", object->animation);
         json.put("description", object->description);
         json.put("photo", object->photo);
         json.put("text", object->text);
         json.put("text_entities", object->textEntities);
-        json.put("animation", object->animation);
+        json.put("title", object->title);
     }
     return json;
 }
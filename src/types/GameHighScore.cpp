@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    position,
+    user,
+    score,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"position", Field::position},
+    {"user", Field::user},
+    {"score", Field::score},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<GameHighScore> parse(const nlohmann::json &data) {
     auto result = std::make_shared<GameHighScore>();
-    parse(data, "position", &result->position);
-    result->user = parseRequired<User>(data, "user");
-    parse(data, "score", &result->score);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::position:
+                detail::parseValue(value, &result->position);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::score:
+                detail::parseValue(value, &result->score);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,8 +44,8 @@ nlohmann::json put(const std::shared_ptr<GameHighScore> &object) {
     JsonWrapper json;
     if (object) {
         json.put("position", object->position);
-        json.put("user", object->user);
         json.put("score", object->score);
+        json.put("user", object->user);
     }
     return json;
 }
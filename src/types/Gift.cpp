@@ -4,22 +4,88 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    sticker,
+    starCount,
+    upgradeStarCount,
+    isPremium,
+    hasColors,
+    totalCount,
+    remainingCount,
+    personalTotalCount,
+    personalRemainingCount,
+    background,
+    uniqueGiftVariantCount,
+    publisherChat,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"sticker", Field::sticker},
+    {"star_count", Field::starCount},
+    {"upgrade_star_count", Field::upgradeStarCount},
+    {"is_premium", Field::isPremium},
+    {"has_colors", Field::hasColors},
+    {"total_count", Field::totalCount},
+    {"remaining_count", Field::remainingCount},
+    {"personal_total_count", Field::personalTotalCount},
+    {"personal_remaining_count", Field::personalRemainingCount},
+    {"background", Field::background},
+    {"unique_gift_variant_count", Field::uniqueGiftVariantCount},
+    {"publisher_chat", Field::publisherChat},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Gift> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Gift>();
-    parse(data, "id", &result->id);
-    result->sticker = parseRequired<Sticker>(data, "sticker");
-    parse(data, "star_count", &result->starCount);
-    parse(data, "upgrade_star_count", &result->upgradeStarCount);
-    parse(data, "is_premium", &result->isPremium);
-    parse(data, "has_colors", &result->hasColors);
-    parse(data, "total_count", &result->totalCount);
-    parse(data, "remaining_count", &result->remainingCount);
-    parse(data, "personal_total_count", &result->personalTotalCount);
-    parse(data, "personal_remaining_count", &result->personalRemainingCount);
-    result->background = parse<GiftBackground>(data, "background");
-    parse(data, "unique_gift_variant_count", &result->uniqueGiftVariantCount);
-    result->publisherChat = parse<Chat>(data, "publisher_chat");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::sticker:
+                result->sticker = parse<Sticker>(value);
+                break;
+            case Field::starCount:
+                detail::parseValue(value, &result->starCount);
+                break;
+            case Field::upgradeStarCount:
+                detail::parseValue(value, &result->upgradeStarCount);
+                break;
+            case Field::isPremium:
+                detail::parseValue(value, &result->isPremium);
+                break;
+            case Field::hasColors:
+                detail::parseValue(value, &result->hasColors);
+                break;
+            case Field::totalCount:
+                detail::parseValue(value, &result->totalCount);
+                break;
+            case Field::remainingCount:
+                detail::parseValue(value, &result->remainingCount);
+                break;
+            case Field::personalTotalCount:
+                detail::parseValue(value, &result->personalTotalCount);
+                break;
+            case Field::personalRemainingCount:
+                detail::parseValue(value, &result->personalRemainingCount);
+                break;
+            case Field::background:
+                result->background = parse<GiftBackground>(value);
+                break;
+            case Field::uniqueGiftVariantCount:
+                detail::parseValue(value, &result->uniqueGiftVariantCount);
+                break;
+            case Field::publisherChat:
+                result->publisherChat = parse<Chat>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -27,19 +93,19 @@ template <>
 nlohmann::json put(const std::shared_ptr<Gift> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("background", object->background);
+        json.put("has_colors", object->hasColors);
         json.put("id", object->id);
-        json.put("sticker", object->sticker);
-        json.put("star_count", object->starCount);
-        json.put("upgrade_star_count", object->upgradeStarCount);
         json.put("is_premium", object->isPremium);
-        json.put("has_colors", object->hasColors);
-        json.put("total_count", object->totalCount);
-        json.put("remaining_count", object->remainingCount);
-        json.put("personal_total_count", object->personalTotalCount);
         json.put("personal_remaining_count", object->personalRemainingCount);
-        json.put("background", object->background);
-        json.put("unique_gift_variant_count", object->uniqueGiftVariantCount);
+        json.put("personal_total_count", object->personalTotalCount);
         json.put("publisher_chat", object->publisherChat);
+        json.put("remaining_count", object->remainingCount);
+        json.put("star_count", object->starCount);
+        json.put("sticker", object->sticker);
+        json.put("total_count", object->totalCount);
+        json.put("unique_gift_variant_count", object->uniqueGiftVariantCount);
+        json.put("upgrade_star_count", object->upgradeStarCount);
     }
     return json;
 }
@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    gift,
+    ownedGiftId,
+    convertStarCount,
+    prepaidUpgradeStarCount,
+    isUpgradeSeparate,
+    canBeUpgraded,
+    text,
+    entities,
+    isPrivate,
+    uniqueGiftNumber,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"gift", Field::gift},
+    {"owned_gift_id", Field::ownedGiftId},
+    {"convert_star_count", Field::convertStarCount},
+    {"prepaid_upgrade_star_count", Field::prepaidUpgradeStarCount},
+    {"is_upgrade_separate", Field::isUpgradeSeparate},
+    {"can_be_upgraded", Field::canBeUpgraded},
+    {"text", Field::text},
+    {"entities", Field::entities},
+    {"is_private", Field::isPrivate},
+    {"unique_gift_number", Field::uniqueGiftNumber},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<GiftInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<GiftInfo>();
-    result->gift = parseRequired<Gift>(data, "gift");
-    parse(data, "owned_gift_id", &result->ownedGiftId);
-    parse(data, "convert_star_count", &result->convertStarCount);
-    parse(data, "prepaid_upgrade_star_count", &result->prepaidUpgradeStarCount);
-    parse(data, "is_upgrade_separate", &result->isUpgradeSeparate);
-    parse(data, "can_be_upgraded", &result->canBeUpgraded);
-    parse(data, "text", &result->text);
-    result->entities = parseArray<MessageEntity>(data, "entities");
-    parse(data, "is_private", &result->isPrivate);
-    parse(data, "unique_gift_number", &result->uniqueGiftNumber);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::gift:
+                result->gift = parse<Gift>(value);
+                break;
+            case Field::ownedGiftId:
+                detail::parseValue(value, &result->ownedGiftId);
+                break;
+            case Field::convertStarCount:
+                detail::parseValue(value, &result->convertStarCount);
+                break;
+            case Field::prepaidUpgradeStarCount:
+                detail::parseValue(value, &result->prepaidUpgradeStarCount);
+                break;
+            case Field::isUpgradeSeparate:
+                detail::parseValue(value, &result->isUpgradeSeparate);
+                break;
+            case Field::canBeUpgraded:
+                detail::parseValue(value, &result->canBeUpgraded);
+                break;
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::entities:
+                result->entities = parseArray<MessageEntity>(value);
+                break;
+            case Field::isPrivate:
+                detail::parseValue(value, &result->isPrivate);
+                break;
+            case Field::uniqueGiftNumber:
+                detail::parseValue(value, &result->uniqueGiftNumber);
+                break;
+        }
+    });
     return result;
 }
 
@@ -24,15 +78,15 @@ template <>
 nlohmann::json put(const std::shared_ptr<GiftInfo> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("can_be_upgraded", object->canBeUpgraded);
+        json.put("convert_star_count", object->convertStarCount);
+        json.put("entities", object->entities);
         json.put("gift", object->gift);
+        json.put("is_private", object->isPrivate);
+        json.put("is_upgrade_separate", object->isUpgradeSeparate);
         json.put("owned_gift_id", object->ownedGiftId);
-        json.put("convert_star_count", object->convertStarCount);
         json.put("prepaid_upgrade_star_count", object->prepaidUpgradeStarCount);
-        json.put("is_upgrade_separate", object->isUpgradeSeparate);
-        json.put("can_be_upgraded", object->canBeUpgraded);
         json.put("text", object->text);
-        json.put("entities", object->entities);
-        json.put("is_private", object->isPrivate);
         json.put("unique_gift_number", object->uniqueGiftNumber);
     }
     return json;
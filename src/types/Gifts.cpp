@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    gifts,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"gifts", Field::gifts},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Gifts> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Gifts>();
-    result->gifts = parseRequiredArray<Gift>(data, "gifts");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::gifts:
+                result->gifts = parseArray<Gift>(value);
+                break;
+        }
+    });
     return result;
 }
 
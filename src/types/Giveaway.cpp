@@ -4,18 +4,68 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chats,
+    winnersSelectionDate,
+    winnerCount,
+    onlyNewMembers,
+    hasPublicWinners,
+    prizeDescription,
+    countryCodes,
+    prizeStarCount,
+    premiumSubscriptionMonthCount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chats", Field::chats},
+    {"winners_selection_date", Field::winnersSelectionDate},
+    {"winner_count", Field::winnerCount},
+    {"only_new_members", Field::onlyNewMembers},
+    {"has_public_winners", Field::hasPublicWinners},
+    {"prize_description", Field::prizeDescription},
+    {"country_codes", Field::countryCodes},
+    {"prize_star_count", Field::prizeStarCount},
+    {"premium_subscription_month_count", Field::premiumSubscriptionMonthCount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Giveaway> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Giveaway>();
-    result->chats = parseRequiredArray<Chat>(data, "chats");
-    parse(data, "winners_selection_date", &result->winnersSelectionDate);
-    parse(data, "winner_count", &result->winnerCount);
-    parse(data, "only_new_members", &result->onlyNewMembers);
-    parse(data, "has_public_winners", &result->hasPublicWinners);
-    parse(data, "prize_description", &result->prizeDescription);
-    result->countryCodes = parsePrimitiveArray<std::string>(data, "country_codes");
-    parse(data, "prize_star_count", &result->prizeStarCount);
-    parse(data, "premium_subscription_month_count", &result->premiumSubscriptionMonthCount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chats:
+                result->chats = parseArray<Chat>(value);
+                break;
+            case Field::winnersSelectionDate:
+                detail::parseValue(value, &result->winnersSelectionDate);
+                break;
+            case Field::winnerCount:
+                detail::parseValue(value, &result->winnerCount);
+                break;
+            case Field::onlyNewMembers:
+                detail::parseValue(value, &result->onlyNewMembers);
+                break;
+            case Field::hasPublicWinners:
+                detail::parseValue(value, &result->hasPublicWinners);
+                break;
+            case Field::prizeDescription:
+                detail::parseValue(value, &result->prizeDescription);
+                break;
+            case Field::countryCodes:
+                result->countryCodes = parsePrimitiveArray<std::string>(value);
+                break;
+            case Field::prizeStarCount:
+                detail::parseValue(value, &result->prizeStarCount);
+                break;
+            case Field::premiumSubscriptionMonthCount:
+                detail::parseValue(value, &result->premiumSubscriptionMonthCount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -24,14 +74,14 @@ nlohmann::json put(const std::shared_ptr<Giveaway> &object) {
     JsonWrapper json;
     if (object) {
         json.put("chats", object->chats);
-        json.put("winners_selection_date", object->winnersSelectionDate);
-        json.put("winner_count", object->winnerCount);
-        json.put("only_new_members", object->onlyNewMembers);
+        json.put("country_codes", object->countryCodes);
         json.put("has_public_winners", object->hasPublicWinners);
+        json.put("only_new_members", object->onlyNewMembers);
+        json.put("premium_subscription_month_count", object->premiumSubscriptionMonthCount);
         json.put("prize_description", object->prizeDescription);
-        json.put("country_codes", object->countryCodes);
         json.put("prize_star_count", object->prizeStarCount);
-        json.put("premium_subscription_month_count", object->premiumSubscriptionMonthCount);
+        json.put("winner_count", object->winnerCount);
+        json.put("winners_selection_date", object->winnersSelectionDate);
     }
     return json;
 }
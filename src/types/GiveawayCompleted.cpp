@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    winnerCount,
+    unclaimedPrizeCount,
+    giveawayMessage,
+    isStarGiveaway,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"winner_count", Field::winnerCount},
+    {"unclaimed_prize_count", Field::unclaimedPrizeCount},
+    {"giveaway_message", Field::giveawayMessage},
+    {"is_star_giveaway", Field::isStarGiveaway},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<GiveawayCompleted> parse(const nlohmann::json &data) {
     auto result = std::make_shared<GiveawayCompleted>();
-    parse(data, "winner_count", &result->winnerCount);
-    parse(data, "unclaimed_prize_count", &result->unclaimedPrizeCount);
-    result->giveawayMessage = parse<Message>(data, "giveaway_message");
-    parse(data, "is_star_giveaway", &result->isStarGiveaway);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::winnerCount:
+                detail::parseValue(value, &result->winnerCount);
+                break;
+            case Field::unclaimedPrizeCount:
+                detail::parseValue(value, &result->unclaimedPrizeCount);
+                break;
+            case Field::giveawayMessage:
+                result->giveawayMessage = parse<Message>(value);
+                break;
+            case Field::isStarGiveaway:
+                detail::parseValue(value, &result->isStarGiveaway);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<GiveawayCompleted> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("winner_count", object->winnerCount);
-        json.put("unclaimed_prize_count", object->unclaimedPrizeCount);
         json.put("giveaway_message", object->giveawayMessage);
         json.put("is_star_giveaway", object->isStarGiveaway);
+        json.put("unclaimed_prize_count", object->unclaimedPrizeCount);
+        json.put("winner_count", object->winnerCount);
     }
     return json;
 }
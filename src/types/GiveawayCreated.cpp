@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    prizeStarCount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"prize_star_count", Field::prizeStarCount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<GiveawayCreated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<GiveawayCreated>();
-    parse(data, "prize_star_count", &result->prizeStarCount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::prizeStarCount:
+                detail::parseValue(value, &result->prizeStarCount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,21 +4,83 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chat,
+    giveawayMessageId,
+    winnersSelectionDate,
+    winnerCount,
+    winners,
+    additionalChatCount,
+    prizeStarCount,
+    premiumSubscriptionMonthCount,
+    unclaimedPrizeCount,
+    onlyNewMembers,
+    wasRefunded,
+    prizeDescription,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chat", Field::chat},
+    {"giveaway_message_id", Field::giveawayMessageId},
+    {"winners_selection_date", Field::winnersSelectionDate},
+    {"winner_count", Field::winnerCount},
+    {"winners", Field::winners},
+    {"additional_chat_count", Field::additionalChatCount},
+    {"prize_star_count", Field::prizeStarCount},
+    {"premium_subscription_month_count", Field::premiumSubscriptionMonthCount},
+    {"unclaimed_prize_count", Field::unclaimedPrizeCount},
+    {"only_new_members", Field::onlyNewMembers},
+    {"was_refunded", Field::wasRefunded},
+    {"prize_description", Field::prizeDescription},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<GiveawayWinners> parse(const nlohmann::json &data) {
     auto result = std::make_shared<GiveawayWinners>();
-    result->chat = parseRequired<Chat>(data, "chat");
-    parse(data, "giveaway_message_id", &result->giveawayMessageId);
-    parse(data, "winners_selection_date", &result->winnersSelectionDate);
-    parse(data, "winner_count", &result->winnerCount);
-    result->winners = parseRequiredArray<User>(data, "winners");
-    parse(data, "additional_chat_count", &result->additionalChatCount);
-    parse(data, "prize_star_count", &result->prizeStarCount);
-    parse(data, "premium_subscription_month_count", &result->premiumSubscriptionMonthCount);
-    parse(data, "unclaimed_prize_count", &result->unclaimedPrizeCount);
-    parse(data, "only_new_members", &result->onlyNewMembers);
-    parse(data, "was_refunded", &result->wasRefunded);
-    parse(data, "prize_description", &result->prizeDescription);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::giveawayMessageId:
+                detail::parseValue(value, &result->giveawayMessageId);
+                break;
+            case Field::winnersSelectionDate:
+                detail::parseValue(value, &result->winnersSelectionDate);
+                break;
+            case Field::winnerCount:
+                detail::parseValue(value, &result->winnerCount);
+                break;
+            case Field::winners:
+                result->winners = parseArray<User>(value);
+                break;
+            case Field::additionalChatCount:
+                detail::parseValue(value, &result->additionalChatCount);
+                break;
+            case Field::prizeStarCount:
+                detail::parseValue(value, &result->prizeStarCount);
+                break;
+            case Field::premiumSubscriptionMonthCount:
+                detail::parseValue(value, &result->premiumSubscriptionMonthCount);
+                break;
+            case Field::unclaimedPrizeCount:
+                detail::parseValue(value, &result->unclaimedPrizeCount);
+                break;
+            case Field::onlyNewMembers:
+                detail::parseValue(value, &result->onlyNewMembers);
+                break;
+            case Field::wasRefunded:
+                detail::parseValue(value, &result->wasRefunded);
+                break;
+            case Field::prizeDescription:
+                detail::parseValue(value, &result->prizeDescription);
+                break;
+        }
+    });
     return result;
 }
 
@@ -26,18 +88,18 @@ template <>
 nlohmann::json put(const std::shared_ptr<GiveawayWinners> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("additional_chat_count", object->additionalChatCount);
         json.put("chat", object->chat);
         json.put("giveaway_message_id", object->giveawayMessageId);
-        json.put("winners_selection_date", object->winnersSelectionDate);
-        json.put("winner_count", object->winnerCount);
-        json.put("winners", object->winners);
-        json.put("additional_chat_count", object->additionalChatCount);
-        json.put("prize_star_count", object->prizeStarCount);
+        json.put("only_new_members", object->onlyNewMembers);
         json.put("premium_subscription_month_count", object->premiumSubscriptionMonthCount);
+        json.put("prize_description", object->prizeDescription);
+        json.put("prize_star_count", object->prizeStarCount);
         json.put("unclaimed_prize_count", object->unclaimedPrizeCount);
-        json.put("only_new_members", object->onlyNewMembers);
         json.put("was_refunded", object->wasRefunded);
-        json.put("prize_description", object->prizeDescription);
+        json.put("winner_count", object->winnerCount);
+        json.put("winners", object->winners);
+        json.put("winners_selection_date", object->winnersSelectionDate);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chat,
+    messageId,
+    date,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chat", Field::chat},
+    {"message_id", Field::messageId},
+    {"date", Field::date},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InaccessibleMessage> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InaccessibleMessage>();
-    result->chat = parseRequired<Chat>(data, "chat");
-    parse(data, "message_id", &result->messageId);
-    parse(data, "date", &result->date);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::messageId:
+                detail::parseValue(value, &result->messageId);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,8 +44,8 @@ nlohmann::json put(const std::shared_ptr<InaccessibleMessage> &object) {
     JsonWrapper json;
     if (object) {
         json.put("chat", object->chat);
-        json.put("message_id", object->messageId);
         json.put("date", object->date);
+        json.put("message_id", object->messageId);
     }
     return json;
 }
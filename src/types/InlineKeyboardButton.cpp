@@ -4,22 +4,88 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    text,
+    iconCustomEmojiId,
+    style,
+    url,
+    callbackData,
+    webApp,
+    loginUrl,
+    switchInlineQuery,
+    switchInlineQueryCurrentChat,
+    switchInlineQueryChosenChat,
+    copyText,
+    callbackGame,
+    pay,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"text", Field::text},
+    {"icon_custom_emoji_id", Field::iconCustomEmojiId},
+    {"style", Field::style},
+    {"url", Field::url},
+    {"callback_data", Field::callbackData},
+    {"web_app", Field::webApp},
+    {"login_url", Field::loginUrl},
+    {"switch_inline_query", Field::switchInlineQuery},
+    {"switch_inline_query_current_chat", Field::switchInlineQueryCurrentChat},
+    {"switch_inline_query_chosen_chat", Field::switchInlineQueryChosenChat},
+    {"copy_text", Field::copyText},
+    {"callback_game", Field::callbackGame},
+    {"pay", Field::pay},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineKeyboardButton> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineKeyboardButton>();
-    parse(data, "text", &result->text);
-    parse(data, "icon_custom_emoji_id", &result->iconCustomEmojiId);
-    parse(data, "style", &result->style);
-    parse(data, "url", &result->url);
-    parse(data, "callback_data", &result->callbackData);
-    result->webApp = parse<WebAppInfo>(data, "web_app");
-    result->loginUrl = parse<LoginUrl>(data, "login_url");
-    parse(data, "switch_inline_query", &result->switchInlineQuery);
-    parse(data, "switch_inline_query_current_chat", &result->switchInlineQueryCurrentChat);
-    result->switchInlineQueryChosenChat = parse<SwitchInlineQueryChosenChat>(data, "switch_inline_query_chosen_chat");
-    result->copyText = parse<CopyTextButton>(data, "copy_text");
-    result->callbackGame = parse<CallbackGame>(data, "callback_game");
-    parse(data, "pay", &result->pay);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::iconCustomEmojiId:
+                detail::parseValue(value, &result->iconCustomEmojiId);
+                break;
+            case Field::style:
+                detail::parseValue(value, &result->style);
+                break;
+            case Field::url:
+                detail::parseValue(value, &result->url);
+                break;
+            case Field::callbackData:
+                detail::parseValue(value, &result->callbackData);
+                break;
+            case Field::webApp:
+                result->webApp = parse<WebAppInfo>(value);
+                break;
+            case Field::loginUrl:
+                result->loginUrl = parse<LoginUrl>(value);
+                break;
+            case Field::switchInlineQuery:
+                detail::parseValue(value, &result->switchInlineQuery);
+                break;
+            case Field::switchInlineQueryCurrentChat:
+                detail::parseValue(value, &result->switchInlineQueryCurrentChat);
+                break;
+            case Field::switchInlineQueryChosenChat:
+                result->switchInlineQueryChosenChat = parse<SwitchInlineQueryChosenChat>(value);
+                break;
+            case Field::copyText:
+                result->copyText = parse<CopyTextButton>(value);
+                break;
+            case Field::callbackGame:
+                result->callbackGame = parse<CallbackGame>(value);
+                break;
+            case Field::pay:
+                detail::parseValue(value, &result->pay);
+                break;
+        }
+    });
     return result;
 }
 
@@ -27,19 +93,19 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineKeyboardButton> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("text", object->text);
-        json.put("icon_custom_emoji_id", object->iconCustomEmojiId);
-        json.put("style", object->style);
-        json.put("url", object->url);
         json.put("callback_data", object->callbackData);
-        json.put("web_app", object->webApp);
+        json.put("callback_game", object->callbackGame);
+        json.put("copy_text", object->copyText);
+        json.put("icon_custom_emoji_id", object->iconCustomEmojiId);
         json.put("login_url", object->loginUrl);
+        json.put("pay", object->pay);
+        json.put("style", object->style);
         json.put("switch_inline_query", object->switchInlineQuery);
-        json.put("switch_inline_query_current_chat", object->switchInlineQueryCurrentChat);
         json.put("switch_inline_query_chosen_chat", object->switchInlineQueryChosenChat);
-        json.put("copy_text", object->copyText);
-        json.put("callback_game", object->callbackGame);
-        json.put("pay", object->pay);
+        json.put("switch_inline_query_current_chat", object->switchInlineQueryCurrentChat);
+        json.put("text", object->text);
+        json.put("url", object->url);
+        json.put("web_app", object->webApp);
     }
     return json;
 }
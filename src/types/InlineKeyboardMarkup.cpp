@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    inlineKeyboard,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"inline_keyboard", Field::inlineKeyboard},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineKeyboardMarkup> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineKeyboardMarkup>();
-    result->inlineKeyboard = parseMatrix<InlineKeyboardButton>(data, "inline_keyboard");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::inlineKeyboard:
+                result->inlineKeyboard = parseMatrix<InlineKeyboardButton>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    from,
+    query,
+    offset,
+    chatType,
+    location,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"from", Field::from},
+    {"query", Field::query},
+    {"offset", Field::offset},
+    {"chat_type", Field::chatType},
+    {"location", Field::location},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQuery> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQuery>();
-    parse(data, "id", &result->id);
-    result->from = parseRequired<User>(data, "from");
-    parse(data, "query", &result->query);
-    parse(data, "offset", &result->offset);
-    parse(data, "chat_type", &result->chatType);
-    result->location = parse<Location>(data, "location");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::from:
+                result->from = parse<User>(value);
+                break;
+            case Field::query:
+                detail::parseValue(value, &result->query);
+                break;
+            case Field::offset:
+                detail::parseValue(value, &result->offset);
+                break;
+            case Field::chatType:
+                detail::parseValue(value, &result->chatType);
+                break;
+            case Field::location:
+                result->location = parse<Location>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQuery> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("id", object->id);
-        json.put("from", object->from);
-        json.put("query", object->query);
-        json.put("offset", object->offset);
         json.put("chat_type", object->chatType);
+        json.put("from", object->from);
+        json.put("id", object->id);
         json.put("location", object->location);
+        json.put("offset", object->offset);
+        json.put("query", object->query);
     }
     return json;
 }
@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    title,
+    inputMessageContent,
+    replyMarkup,
+    url,
+    description,
+    thumbnailUrl,
+    thumbnailWidth,
+    thumbnailHeight,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"title", Field::title},
+    {"input_message_content", Field::inputMessageContent},
+    {"reply_markup", Field::replyMarkup},
+    {"url", Field::url},
+    {"description", Field::description},
+    {"thumbnail_url", Field::thumbnailUrl},
+    {"thumbnail_width", Field::thumbnailWidth},
+    {"thumbnail_height", Field::thumbnailHeight},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultArticle> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultArticle>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "title", &result->title);
-    result->inputMessageContent = parseRequired<InputMessageContent>(data, "input_message_content");
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    parse(data, "url", &result->url);
-    parse(data, "description", &result->description);
-    parse(data, "thumbnail_url", &result->thumbnailUrl);
-    parse(data, "thumbnail_width", &result->thumbnailWidth);
-    parse(data, "thumbnail_height", &result->thumbnailHeight);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::url:
+                detail::parseValue(value, &result->url);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::thumbnailUrl:
+                detail::parseValue(value, &result->thumbnailUrl);
+                break;
+            case Field::thumbnailWidth:
+                detail::parseValue(value, &result->thumbnailWidth);
+                break;
+            case Field::thumbnailHeight:
+                detail::parseValue(value, &result->thumbnailHeight);
+                break;
+        }
+    });
     return result;
 }
 
@@ -24,16 +78,16 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultArticle> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("description", object->description);
         json.put("id", object->id);
-        json.put("title", object->title);
         json.put("input_message_content", object->inputMessageContent);
         json.put("reply_markup", object->replyMarkup);
-        json.put("url", object->url);
-        json.put("description", object->description);
+        json.put("thumbnail_height", object->thumbnailHeight);
         json.put("thumbnail_url", object->thumbnailUrl);
         json.put("thumbnail_width", object->thumbnailWidth);
-        json.put("thumbnail_height", object->thumbnailHeight);
+        json.put("title", object->title);
+        json.put("type", object->type);
+        json.put("url", object->url);
     }
     return json;
 }
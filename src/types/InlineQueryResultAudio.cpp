@@ -4,20 +4,78 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    audioUrl,
+    title,
+    caption,
+    parseMode,
+    captionEntities,
+    performer,
+    audioDuration,
+    replyMarkup,
+    inputMessageContent,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"audio_url", Field::audioUrl},
+    {"title", Field::title},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"performer", Field::performer},
+    {"audio_duration", Field::audioDuration},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultAudio> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultAudio>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "audio_url", &result->audioUrl);
-    parse(data, "title", &result->title);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "performer", &result->performer);
-    parse(data, "audio_duration", &result->audioDuration);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::audioUrl:
+                detail::parseValue(value, &result->audioUrl);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::performer:
+                detail::parseValue(value, &result->performer);
+                break;
+            case Field::audioDuration:
+                detail::parseValue(value, &result->audioDuration);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -25,17 +83,17 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultAudio> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("id", object->id);
+        json.put("audio_duration", object->audioDuration);
         json.put("audio_url", object->audioUrl);
-        json.put("title", object->title);
         json.put("caption", object->caption);
-        json.put("parse_mode", object->parseMode);
         json.put("caption_entities", object->captionEntities);
+        json.put("id", object->id);
+        json.put("input_message_content", object->inputMessageContent);
+        json.put("parse_mode", object->parseMode);
         json.put("performer", object->performer);
-        json.put("audio_duration", object->audioDuration);
         json.put("reply_markup", object->replyMarkup);
-        json.put("input_message_content", object->inputMessageContent);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,17 +4,63 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    audioFileId,
+    caption,
+    parseMode,
+    captionEntities,
+    replyMarkup,
+    inputMessageContent,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"audio_file_id", Field::audioFileId},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultCachedAudio> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultCachedAudio>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "audio_file_id", &result->audioFileId);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::audioFileId:
+                detail::parseValue(value, &result->audioFileId);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -22,14 +68,14 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultCachedAudio> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("id", object->id);
         json.put("audio_file_id", object->audioFileId);
         json.put("caption", object->caption);
-        json.put("parse_mode", object->parseMode);
         json.put("caption_entities", object->captionEntities);
-        json.put("reply_markup", object->replyMarkup);
+        json.put("id", object->id);
         json.put("input_message_content", object->inputMessageContent);
+        json.put("parse_mode", object->parseMode);
+        json.put("reply_markup", object->replyMarkup);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    title,
+    documentFileId,
+    description,
+    caption,
+    parseMode,
+    captionEntities,
+    replyMarkup,
+    inputMessageContent,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"title", Field::title},
+    {"document_file_id", Field::documentFileId},
+    {"description", Field::description},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultCachedDocument> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultCachedDocument>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "title", &result->title);
-    parse(data, "document_file_id", &result->documentFileId);
-    parse(data, "description", &result->description);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::documentFileId:
+                detail::parseValue(value, &result->documentFileId);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -24,16 +78,16 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultCachedDocument> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("id", object->id);
-        json.put("title", object->title);
-        json.put("document_file_id", object->documentFileId);
-        json.put("description", object->description);
         json.put("caption", object->caption);
-        json.put("parse_mode", object->parseMode);
         json.put("caption_entities", object->captionEntities);
-        json.put("reply_markup", object->replyMarkup);
+        json.put("description", object->description);
+        json.put("document_file_id", object->documentFileId);
+        json.put("id", object->id);
         json.put("input_message_content", object->inputMessageContent);
+        json.put("parse_mode", object->parseMode);
+        json.put("reply_markup", object->replyMarkup);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
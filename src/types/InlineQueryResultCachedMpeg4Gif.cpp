@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    mpeg4FileId,
+    title,
+    caption,
+    parseMode,
+    captionEntities,
+    showCaptionAboveMedia,
+    replyMarkup,
+    inputMessageContent,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"mpeg4_file_id", Field::mpeg4FileId},
+    {"title", Field::title},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"show_caption_above_media", Field::showCaptionAboveMedia},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultCachedMpeg4Gif> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultCachedMpeg4Gif>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "mpeg4_file_id", &result->mpeg4FileId);
-    parse(data, "title", &result->title);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "show_caption_above_media", &result->showCaptionAboveMedia);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::mpeg4FileId:
+                detail::parseValue(value, &result->mpeg4FileId);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::showCaptionAboveMedia:
+                detail::parseValue(value, &result->showCaptionAboveMedia);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -24,16 +78,16 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultCachedMpeg4Gif> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("caption", object->caption);
+        json.put("caption_entities", object->captionEntities);
         json.put("id", object->id);
+        json.put("input_message_content", object->inputMessageContent);
         json.put("mpeg4_file_id", object->mpeg4FileId);
-        json.put("title", object->title);
-        json.put("caption", object->caption);
         json.put("parse_mode", object->parseMode);
-        json.put("caption_entities", object->captionEntities);
-        json.put("show_caption_above_media", object->showCaptionAboveMedia);
         json.put("reply_markup", object->replyMarkup);
-        json.put("input_message_content", object->inputMessageContent);
+        json.put("show_caption_above_media", object->showCaptionAboveMedia);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
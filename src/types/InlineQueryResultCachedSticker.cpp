@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    stickerFileId,
+    replyMarkup,
+    inputMessageContent,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"sticker_file_id", Field::stickerFileId},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultCachedSticker> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultCachedSticker>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "sticker_file_id", &result->stickerFileId);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::stickerFileId:
+                detail::parseValue(value, &result->stickerFileId);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultCachedSticker> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("id", object->id);
-        json.put("sticker_file_id", object->stickerFileId);
-        json.put("reply_markup", object->replyMarkup);
         json.put("input_message_content", object->inputMessageContent);
+        json.put("reply_markup", object->replyMarkup);
+        json.put("sticker_file_id", object->stickerFileId);
+        json.put("type", object->type);
     }
     return json;
 }
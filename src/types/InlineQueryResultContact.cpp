@@ -4,20 +4,78 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    phoneNumber,
+    firstName,
+    lastName,
+    vcard,
+    replyMarkup,
+    inputMessageContent,
+    thumbnailUrl,
+    thumbnailWidth,
+    thumbnailHeight,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"phone_number", Field::phoneNumber},
+    {"first_name", Field::firstName},
+    {"last_name", Field::lastName},
+    {"vcard", Field::vcard},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+    {"thumbnail_url", Field::thumbnailUrl},
+    {"thumbnail_width", Field::thumbnailWidth},
+    {"thumbnail_height", Field::thumbnailHeight},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultContact> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultContact>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "phone_number", &result->phoneNumber);
-    parse(data, "first_name", &result->firstName);
-    parse(data, "last_name", &result->lastName);
-    parse(data, "vcard", &result->vcard);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
-    parse(data, "thumbnail_url", &result->thumbnailUrl);
-    parse(data, "thumbnail_width", &result->thumbnailWidth);
-    parse(data, "thumbnail_height", &result->thumbnailHeight);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::phoneNumber:
+                detail::parseValue(value, &result->phoneNumber);
+                break;
+            case Field::firstName:
+                detail::parseValue(value, &result->firstName);
+                break;
+            case Field::lastName:
+                detail::parseValue(value, &result->lastName);
+                break;
+            case Field::vcard:
+                detail::parseValue(value, &result->vcard);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+            case Field::thumbnailUrl:
+                detail::parseValue(value, &result->thumbnailUrl);
+                break;
+            case Field::thumbnailWidth:
+                detail::parseValue(value, &result->thumbnailWidth);
+                break;
+            case Field::thumbnailHeight:
+                detail::parseValue(value, &result->thumbnailHeight);
+                break;
+        }
+    });
     return result;
 }
 
@@ -25,17 +83,17 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultContact> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("id", object->id);
-        json.put("phone_number", object->phoneNumber);
         json.put("first_name", object->firstName);
+        json.put("id", object->id);
+        json.put("input_message_content", object->inputMessageContent);
         json.put("last_name", object->lastName);
-        json.put("vcard", object->vcard);
+        json.put("phone_number", object->phoneNumber);
         json.put("reply_markup", object->replyMarkup);
-        json.put("input_message_content", object->inputMessageContent);
+        json.put("thumbnail_height", object->thumbnailHeight);
         json.put("thumbnail_url", object->thumbnailUrl);
         json.put("thumbnail_width", object->thumbnailWidth);
-        json.put("thumbnail_height", object->thumbnailHeight);
+        json.put("type", object->type);
+        json.put("vcard", object->vcard);
     }
     return json;
 }
@@ -4,23 +4,93 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    title,
+    caption,
+    parseMode,
+    captionEntities,
+    documentUrl,
+    mimeType,
+    description,
+    replyMarkup,
+    inputMessageContent,
+    thumbnailUrl,
+    thumbnailWidth,
+    thumbnailHeight,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"title", Field::title},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"document_url", Field::documentUrl},
+    {"mime_type", Field::mimeType},
+    {"description", Field::description},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+    {"thumbnail_url", Field::thumbnailUrl},
+    {"thumbnail_width", Field::thumbnailWidth},
+    {"thumbnail_height", Field::thumbnailHeight},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultDocument> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultDocument>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "title", &result->title);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "document_url", &result->documentUrl);
-    parse(data, "mime_type", &result->mimeType);
-    parse(data, "description", &result->description);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
-    parse(data, "thumbnail_url", &result->thumbnailUrl);
-    parse(data, "thumbnail_width", &result->thumbnailWidth);
-    parse(data, "thumbnail_height", &result->thumbnailHeight);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::documentUrl:
+                detail::parseValue(value, &result->documentUrl);
+                break;
+            case Field::mimeType:
+                detail::parseValue(value, &result->mimeType);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+            case Field::thumbnailUrl:
+                detail::parseValue(value, &result->thumbnailUrl);
+                break;
+            case Field::thumbnailWidth:
+                detail::parseValue(value, &result->thumbnailWidth);
+                break;
+            case Field::thumbnailHeight:
+                detail::parseValue(value, &result->thumbnailHeight);
+                break;
+        }
+    });
     return result;
 }
 
@@ -28,20 +98,20 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultDocument> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("id", object->id);
-        json.put("title", object->title);
         json.put("caption", object->caption);
-        json.put("parse_mode", object->parseMode);
         json.put("caption_entities", object->captionEntities);
+        json.put("description", object->description);
         json.put("document_url", object->documentUrl);
+        json.put("id", object->id);
+        json.put("input_message_content", object->inputMessageContent);
         json.put("mime_type", object->mimeType);
-        json.put("description", object->description);
+        json.put("parse_mode", object->parseMode);
         json.put("reply_markup", object->replyMarkup);
-        json.put("input_message_content", object->inputMessageContent);
+        json.put("thumbnail_height", object->thumbnailHeight);
         json.put("thumbnail_url", object->thumbnailUrl);
         json.put("thumbnail_width", object->thumbnailWidth);
-        json.put("thumbnail_height", object->thumbnailHeight);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    gameShortName,
+    replyMarkup,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"game_short_name", Field::gameShortName},
+    {"reply_markup", Field::replyMarkup},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultGame> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultGame>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "game_short_name", &result->gameShortName);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::gameShortName:
+                detail::parseValue(value, &result->gameShortName);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultGame> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("id", object->id);
         json.put("game_short_name", object->gameShortName);
+        json.put("id", object->id);
         json.put("reply_markup", object->replyMarkup);
+        json.put("type", object->type);
     }
     return json;
 }
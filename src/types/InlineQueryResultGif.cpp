@@ -4,24 +4,98 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    gifUrl,
+    gifWidth,
+    gifHeight,
+    gifDuration,
+    thumbnailUrl,
+    thumbnailMimeType,
+    title,
+    caption,
+    parseMode,
+    captionEntities,
+    showCaptionAboveMedia,
+    replyMarkup,
+    inputMessageContent,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"gif_url", Field::gifUrl},
+    {"gif_width", Field::gifWidth},
+    {"gif_height", Field::gifHeight},
+    {"gif_duration", Field::gifDuration},
+    {"thumbnail_url", Field::thumbnailUrl},
+    {"thumbnail_mime_type", Field::thumbnailMimeType},
+    {"title", Field::title},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"show_caption_above_media", Field::showCaptionAboveMedia},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultGif> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultGif>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "gif_url", &result->gifUrl);
-    parse(data, "gif_width", &result->gifWidth);
-    parse(data, "gif_height", &result->gifHeight);
-    parse(data, "gif_duration", &result->gifDuration);
-    parse(data, "thumbnail_url", &result->thumbnailUrl);
-    parse(data, "thumbnail_mime_type", &result->thumbnailMimeType);
-    parse(data, "title", &result->title);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "show_caption_above_media", &result->showCaptionAboveMedia);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::gifUrl:
+                detail::parseValue(value, &result->gifUrl);
+                break;
+            case Field::gifWidth:
+                detail::parseValue(value, &result->gifWidth);
+                break;
+            case Field::gifHeight:
+                detail::parseValue(value, &result->gifHeight);
+                break;
+            case Field::gifDuration:
+                detail::parseValue(value, &result->gifDuration);
+                break;
+            case Field::thumbnailUrl:
+                detail::parseValue(value, &result->thumbnailUrl);
+                break;
+            case Field::thumbnailMimeType:
+                detail::parseValue(value, &result->thumbnailMimeType);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::showCaptionAboveMedia:
+                detail::parseValue(value, &result->showCaptionAboveMedia);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -29,21 +103,21 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultGif> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("id", object->id);
+        json.put("caption", object->caption);
+        json.put("caption_entities", object->captionEntities);
+        json.put("gif_duration", object->gifDuration);
+        json.put("gif_height", object->gifHeight);
         json.put("gif_url", object->gifUrl);
         json.put("gif_width", object->gifWidth);
-        json.put("gif_height", object->gifHeight);
-        json.put("gif_duration", object->gifDuration);
-        json.put("thumbnail_url", object->thumbnailUrl);
-        json.put("thumbnail_mime_type", object->thumbnailMimeType);
-        json.put("title", object->title);
-        json.put("caption", object->caption);
+        json.put("id", object->id);
+        json.put("input_message_content", object->inputMessageContent);
         json.put("parse_mode", object->parseMode);
-        json.put("caption_entities", object->captionEntities);
-        json.put("show_caption_above_media", object->showCaptionAboveMedia);
         json.put("reply_markup", object->replyMarkup);
-        json.put("input_message_content", object->inputMessageContent);
+        json.put("show_caption_above_media", object->showCaptionAboveMedia);
+        json.put("thumbnail_mime_type", object->thumbnailMimeType);
+        json.put("thumbnail_url", object->thumbnailUrl);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
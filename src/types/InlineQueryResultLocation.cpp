@@ -4,23 +4,93 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    latitude,
+    longitude,
+    title,
+    horizontalAccuracy,
+    livePeriod,
+    heading,
+    proximityAlertRadius,
+    replyMarkup,
+    inputMessageContent,
+    thumbnailUrl,
+    thumbnailWidth,
+    thumbnailHeight,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"latitude", Field::latitude},
+    {"longitude", Field::longitude},
+    {"title", Field::title},
+    {"horizontal_accuracy", Field::horizontalAccuracy},
+    {"live_period", Field::livePeriod},
+    {"heading", Field::heading},
+    {"proximity_alert_radius", Field::proximityAlertRadius},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+    {"thumbnail_url", Field::thumbnailUrl},
+    {"thumbnail_width", Field::thumbnailWidth},
+    {"thumbnail_height", Field::thumbnailHeight},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultLocation> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultLocation>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "latitude", &result->latitude);
-    parse(data, "longitude", &result->longitude);
-    parse(data, "title", &result->title);
-    parse(data, "horizontal_accuracy", &result->horizontalAccuracy);
-    parse(data, "live_period", &result->livePeriod);
-    parse(data, "heading", &result->heading);
-    parse(data, "proximity_alert_radius", &result->proximityAlertRadius);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
-    parse(data, "thumbnail_url", &result->thumbnailUrl);
-    parse(data, "thumbnail_width", &result->thumbnailWidth);
-    parse(data, "thumbnail_height", &result->thumbnailHeight);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::latitude:
+                detail::parseValue(value, &result->latitude);
+                break;
+            case Field::longitude:
+                detail::parseValue(value, &result->longitude);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::horizontalAccuracy:
+                detail::parseValue(value, &result->horizontalAccuracy);
+                break;
+            case Field::livePeriod:
+                detail::parseValue(value, &result->livePeriod);
+                break;
+            case Field::heading:
+                detail::parseValue(value, &result->heading);
+                break;
+            case Field::proximityAlertRadius:
+                detail::parseValue(value, &result->proximityAlertRadius);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+            case Field::thumbnailUrl:
+                detail::parseValue(value, &result->thumbnailUrl);
+                break;
+            case Field::thumbnailWidth:
+                detail::parseValue(value, &result->thumbnailWidth);
+                break;
+            case Field::thumbnailHeight:
+                detail::parseValue(value, &result->thumbnailHeight);
+                break;
+        }
+    });
     return result;
 }
 
@@ -28,20 +98,20 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultLocation> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("heading", object->heading);
+        json.put("horizontal_accuracy", object->horizontalAccuracy);
         json.put("id", object->id);
+        json.put("input_message_content", object->inputMessageContent);
         json.put("latitude", object->latitude);
-        json.put("longitude", object->longitude);
-        json.put("title", object->title);
-        json.put("horizontal_accuracy", object->horizontalAccuracy);
         json.put("live_period", object->livePeriod);
-        json.put("heading", object->heading);
+        json.put("longitude", object->longitude);
         json.put("proximity_alert_radius", object->proximityAlertRadius);
         json.put("reply_markup", object->replyMarkup);
-        json.put("input_message_content", object->inputMessageContent);
+        json.put("thumbnail_height", object->thumbnailHeight);
         json.put("thumbnail_url", object->thumbnailUrl);
         json.put("thumbnail_width", object->thumbnailWidth);
-        json.put("thumbnail_height", object->thumbnailHeight);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,24 +4,98 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    mpeg4Url,
+    mpeg4Width,
+    mpeg4Height,
+    mpeg4Duration,
+    thumbnailUrl,
+    thumbnailMimeType,
+    title,
+    caption,
+    parseMode,
+    captionEntities,
+    showCaptionAboveMedia,
+    replyMarkup,
+    inputMessageContent,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"mpeg4_url", Field::mpeg4Url},
+    {"mpeg4_width", Field::mpeg4Width},
+    {"mpeg4_height", Field::mpeg4Height},
+    {"mpeg4_duration", Field::mpeg4Duration},
+    {"thumbnail_url", Field::thumbnailUrl},
+    {"thumbnail_mime_type", Field::thumbnailMimeType},
+    {"title", Field::title},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"show_caption_above_media", Field::showCaptionAboveMedia},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultMpeg4Gif> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultMpeg4Gif>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "mpeg4_url", &result->mpeg4Url);
-    parse(data, "mpeg4_width", &result->mpeg4Width);
-    parse(data, "mpeg4_height", &result->mpeg4Height);
-    parse(data, "mpeg4_duration", &result->mpeg4Duration);
-    parse(data, "thumbnail_url", &result->thumbnailUrl);
-    parse(data, "thumbnail_mime_type", &result->thumbnailMimeType);
-    parse(data, "title", &result->title);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "show_caption_above_media", &result->showCaptionAboveMedia);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::mpeg4Url:
+                detail::parseValue(value, &result->mpeg4Url);
+                break;
+            case Field::mpeg4Width:
+                detail::parseValue(value, &result->mpeg4Width);
+                break;
+            case Field::mpeg4Height:
+                detail::parseValue(value, &result->mpeg4Height);
+                break;
+            case Field::mpeg4Duration:
+                detail::parseValue(value, &result->mpeg4Duration);
+                break;
+            case Field::thumbnailUrl:
+                detail::parseValue(value, &result->thumbnailUrl);
+                break;
+            case Field::thumbnailMimeType:
+                detail::parseValue(value, &result->thumbnailMimeType);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::showCaptionAboveMedia:
+                detail::parseValue(value, &result->showCaptionAboveMedia);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -29,21 +103,21 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultMpeg4Gif> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("caption", object->caption);
+        json.put("caption_entities", object->captionEntities);
         json.put("id", object->id);
+        json.put("input_message_content", object->inputMessageContent);
+        json.put("mpeg4_duration", object->mpeg4Duration);
+        json.put("mpeg4_height", object->mpeg4Height);
         json.put("mpeg4_url", object->mpeg4Url);
         json.put("mpeg4_width", object->mpeg4Width);
-        json.put("mpeg4_height", object->mpeg4Height);
-        json.put("mpeg4_duration", object->mpeg4Duration);
-        json.put("thumbnail_url", object->thumbnailUrl);
-        json.put("thumbnail_mime_type", object->thumbnailMimeType);
-        json.put("title", object->title);
-        json.put("caption", object->caption);
         json.put("parse_mode", object->parseMode);
-        json.put("caption_entities", object->captionEntities);
-        json.put("show_caption_above_media", object->showCaptionAboveMedia);
         json.put("reply_markup", object->replyMarkup);
-        json.put("input_message_content", object->inputMessageContent);
+        json.put("show_caption_above_media", object->showCaptionAboveMedia);
+        json.put("thumbnail_mime_type", object->thumbnailMimeType);
+        json.put("thumbnail_url", object->thumbnailUrl);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
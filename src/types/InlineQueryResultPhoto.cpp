@@ -4,23 +4,93 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    photoUrl,
+    thumbnailUrl,
+    photoWidth,
+    photoHeight,
+    title,
+    description,
+    caption,
+    parseMode,
+    captionEntities,
+    showCaptionAboveMedia,
+    replyMarkup,
+    inputMessageContent,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"photo_url", Field::photoUrl},
+    {"thumbnail_url", Field::thumbnailUrl},
+    {"photo_width", Field::photoWidth},
+    {"photo_height", Field::photoHeight},
+    {"title", Field::title},
+    {"description", Field::description},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"show_caption_above_media", Field::showCaptionAboveMedia},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultPhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultPhoto>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "photo_url", &result->photoUrl);
-    parse(data, "thumbnail_url", &result->thumbnailUrl);
-    parse(data, "photo_width", &result->photoWidth);
-    parse(data, "photo_height", &result->photoHeight);
-    parse(data, "title", &result->title);
-    parse(data, "description", &result->description);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "show_caption_above_media", &result->showCaptionAboveMedia);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::photoUrl:
+                detail::parseValue(value, &result->photoUrl);
+                break;
+            case Field::thumbnailUrl:
+                detail::parseValue(value, &result->thumbnailUrl);
+                break;
+            case Field::photoWidth:
+                detail::parseValue(value, &result->photoWidth);
+                break;
+            case Field::photoHeight:
+                detail::parseValue(value, &result->photoHeight);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::showCaptionAboveMedia:
+                detail::parseValue(value, &result->showCaptionAboveMedia);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -28,20 +98,20 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultPhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("caption", object->caption);
+        json.put("caption_entities", object->captionEntities);
+        json.put("description", object->description);
         json.put("id", object->id);
+        json.put("input_message_content", object->inputMessageContent);
+        json.put("parse_mode", object->parseMode);
+        json.put("photo_height", object->photoHeight);
         json.put("photo_url", object->photoUrl);
-        json.put("thumbnail_url", object->thumbnailUrl);
         json.put("photo_width", object->photoWidth);
-        json.put("photo_height", object->photoHeight);
-        json.put("title", object->title);
-        json.put("description", object->description);
-        json.put("caption", object->caption);
-        json.put("parse_mode", object->parseMode);
-        json.put("caption_entities", object->captionEntities);
-        json.put("show_caption_above_media", object->showCaptionAboveMedia);
         json.put("reply_markup", object->replyMarkup);
-        json.put("input_message_content", object->inputMessageContent);
+        json.put("show_caption_above_media", object->showCaptionAboveMedia);
+        json.put("thumbnail_url", object->thumbnailUrl);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,24 +4,98 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    latitude,
+    longitude,
+    title,
+    address,
+    foursquareId,
+    foursquareType,
+    googlePlaceId,
+    googlePlaceType,
+    replyMarkup,
+    inputMessageContent,
+    thumbnailUrl,
+    thumbnailWidth,
+    thumbnailHeight,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"latitude", Field::latitude},
+    {"longitude", Field::longitude},
+    {"title", Field::title},
+    {"address", Field::address},
+    {"foursquare_id", Field::foursquareId},
+    {"foursquare_type", Field::foursquareType},
+    {"google_place_id", Field::googlePlaceId},
+    {"google_place_type", Field::googlePlaceType},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+    {"thumbnail_url", Field::thumbnailUrl},
+    {"thumbnail_width", Field::thumbnailWidth},
+    {"thumbnail_height", Field::thumbnailHeight},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultVenue> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultVenue>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "latitude", &result->latitude);
-    parse(data, "longitude", &result->longitude);
-    parse(data, "title", &result->title);
-    parse(data, "address", &result->address);
-    parse(data, "foursquare_id", &result->foursquareId);
-    parse(data, "foursquare_type", &result->foursquareType);
-    parse(data, "google_place_id", &result->googlePlaceId);
-    parse(data, "google_place_type", &result->googlePlaceType);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
-    parse(data, "thumbnail_url", &result->thumbnailUrl);
-    parse(data, "thumbnail_width", &result->thumbnailWidth);
-    parse(data, "thumbnail_height", &result->thumbnailHeight);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::latitude:
+                detail::parseValue(value, &result->latitude);
+                break;
+            case Field::longitude:
+                detail::parseValue(value, &result->longitude);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::address:
+                detail::parseValue(value, &result->address);
+                break;
+            case Field::foursquareId:
+                detail::parseValue(value, &result->foursquareId);
+                break;
+            case Field::foursquareType:
+                detail::parseValue(value, &result->foursquareType);
+                break;
+            case Field::googlePlaceId:
+                detail::parseValue(value, &result->googlePlaceId);
+                break;
+            case Field::googlePlaceType:
+                detail::parseValue(value, &result->googlePlaceType);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+            case Field::thumbnailUrl:
+                detail::parseValue(value, &result->thumbnailUrl);
+                break;
+            case Field::thumbnailWidth:
+                detail::parseValue(value, &result->thumbnailWidth);
+                break;
+            case Field::thumbnailHeight:
+                detail::parseValue(value, &result->thumbnailHeight);
+                break;
+        }
+    });
     return result;
 }
 
@@ -29,21 +103,21 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultVenue> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("id", object->id);
-        json.put("latitude", object->latitude);
-        json.put("longitude", object->longitude);
-        json.put("title", object->title);
         json.put("address", object->address);
         json.put("foursquare_id", object->foursquareId);
         json.put("foursquare_type", object->foursquareType);
         json.put("google_place_id", object->googlePlaceId);
         json.put("google_place_type", object->googlePlaceType);
-        json.put("reply_markup", object->replyMarkup);
+        json.put("id", object->id);
         json.put("input_message_content", object->inputMessageContent);
+        json.put("latitude", object->latitude);
+        json.put("longitude", object->longitude);
+        json.put("reply_markup", object->replyMarkup);
+        json.put("thumbnail_height", object->thumbnailHeight);
         json.put("thumbnail_url", object->thumbnailUrl);
         json.put("thumbnail_width", object->thumbnailWidth);
-        json.put("thumbnail_height", object->thumbnailHeight);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
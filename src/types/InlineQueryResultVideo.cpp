@@ -4,25 +4,103 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    id,
+    videoUrl,
+    mimeType,
+    thumbnailUrl,
+    title,
+    caption,
+    parseMode,
+    captionEntities,
+    showCaptionAboveMedia,
+    videoWidth,
+    videoHeight,
+    videoDuration,
+    description,
+    replyMarkup,
+    inputMessageContent,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"id", Field::id},
+    {"video_url", Field::videoUrl},
+    {"mime_type", Field::mimeType},
+    {"thumbnail_url", Field::thumbnailUrl},
+    {"title", Field::title},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"show_caption_above_media", Field::showCaptionAboveMedia},
+    {"video_width", Field::videoWidth},
+    {"video_height", Field::videoHeight},
+    {"video_duration", Field::videoDuration},
+    {"description", Field::description},
+    {"reply_markup", Field::replyMarkup},
+    {"input_message_content", Field::inputMessageContent},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultVideo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultVideo>();
-    parse(data, "type", &result->type);
-    parse(data, "id", &result->id);
-    parse(data, "video_url", &result->videoUrl);
-    parse(data, "mime_type", &result->mimeType);
-    parse(data, "thumbnail_url", &result->thumbnailUrl);
-    parse(data, "title", &result->title);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "show_caption_above_media", &result->showCaptionAboveMedia);
-    parse(data, "video_width", &result->videoWidth);
-    parse(data, "video_height", &result->videoHeight);
-    parse(data, "video_duration", &result->videoDuration);
-    parse(data, "description", &result->description);
-    result->replyMarkup = parse<InlineKeyboardMarkup>(data, "reply_markup");
-    result->inputMessageContent = parse<InputMessageContent>(data, "input_message_content");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::videoUrl:
+                detail::parseValue(value, &result->videoUrl);
+                break;
+            case Field::mimeType:
+                detail::parseValue(value, &result->mimeType);
+                break;
+            case Field::thumbnailUrl:
+                detail::parseValue(value, &result->thumbnailUrl);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::showCaptionAboveMedia:
+                detail::parseValue(value, &result->showCaptionAboveMedia);
+                break;
+            case Field::videoWidth:
+                detail::parseValue(value, &result->videoWidth);
+                break;
+            case Field::videoHeight:
+                detail::parseValue(value, &result->videoHeight);
+                break;
+            case Field::videoDuration:
+                detail::parseValue(value, &result->videoDuration);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::replyMarkup:
+                result->replyMarkup = parse<InlineKeyboardMarkup>(value);
+                break;
+            case Field::inputMessageContent:
+                result->inputMessageContent = parse<InputMessageContent>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -30,22 +108,22 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultVideo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("caption", object->caption);
+        json.put("caption_entities", object->captionEntities);
+        json.put("description", object->description);
         json.put("id", object->id);
-        json.put("video_url", object->videoUrl);
+        json.put("input_message_content", object->inputMessageContent);
         json.put("mime_type", object->mimeType);
-        json.put("thumbnail_url", object->thumbnailUrl);
-        json.put("title", object->title);
-        json.put("caption", object->caption);
         json.put("parse_mode", object->parseMode);
-        json.put("caption_entities", object->captionEntities);
+        json.put("reply_markup", object->replyMarkup);
         json.put("show_caption_above_media", object->showCaptionAboveMedia);
-        json.put("video_width", object->videoWidth);
-        json.put("video_height", object->videoHeight);
+        json.put("thumbnail_url", object->thumbnailUrl);
+        json.put("title", object->title);
+        json.put("type", object->type);
         json.put("video_duration", object->videoDuration);
-        json.put("description", object->description);
-        json.put("reply_markup", object->replyMarkup);
-        json.put("input_message_content", object->inputMessageContent);
+        json.put("video_height", object->videoHeight);
+        json.put("video_url", object->videoUrl);
+        json.put("video_width", object->videoWidth);
     }
     return json;
 }
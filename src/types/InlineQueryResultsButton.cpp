@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    text,
+    webApp,
+    startParameter,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"text", Field::text},
+    {"web_app", Field::webApp},
+    {"start_parameter", Field::startParameter},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InlineQueryResultsButton> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InlineQueryResultsButton>();
-    parse(data, "text", &result->text);
-    result->webApp = parse<WebAppInfo>(data, "web_app");
-    parse(data, "start_parameter", &result->startParameter);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::webApp:
+                result->webApp = parse<WebAppInfo>(value);
+                break;
+            case Field::startParameter:
+                detail::parseValue(value, &result->startParameter);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InlineQueryResultsButton> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("start_parameter", object->startParameter);
         json.put("text", object->text);
         json.put("web_app", object->webApp);
-        json.put("start_parameter", object->startParameter);
     }
     return json;
 }
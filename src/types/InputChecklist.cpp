@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    title,
+    parseMode,
+    titleEntities,
+    tasks,
+    othersCanAddTasks,
+    othersCanMarkTasksAsDone,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"title", Field::title},
+    {"parse_mode", Field::parseMode},
+    {"title_entities", Field::titleEntities},
+    {"tasks", Field::tasks},
+    {"others_can_add_tasks", Field::othersCanAddTasks},
+    {"others_can_mark_tasks_as_done", Field::othersCanMarkTasksAsDone},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputChecklist> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputChecklist>();
-    parse(data, "title", &result->title);
-    parse(data, "parse_mode", &result->parseMode);
-    result->titleEntities = parseArray<MessageEntity>(data, "title_entities");
-    result->tasks = parseRequiredArray<InputChecklistTask>(data, "tasks");
-    parse(data, "others_can_add_tasks", &result->othersCanAddTasks);
-    parse(data, "others_can_mark_tasks_as_done", &result->othersCanMarkTasksAsDone);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::titleEntities:
+                result->titleEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::tasks:
+                result->tasks = parseArray<InputChecklistTask>(value);
+                break;
+            case Field::othersCanAddTasks:
+                detail::parseValue(value, &result->othersCanAddTasks);
+                break;
+            case Field::othersCanMarkTasksAsDone:
+                detail::parseValue(value, &result->othersCanMarkTasksAsDone);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputChecklist> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("title", object->title);
-        json.put("parse_mode", object->parseMode);
-        json.put("title_entities", object->titleEntities);
-        json.put("tasks", object->tasks);
         json.put("others_can_add_tasks", object->othersCanAddTasks);
         json.put("others_can_mark_tasks_as_done", object->othersCanMarkTasksAsDone);
+        json.put("parse_mode", object->parseMode);
+        json.put("tasks", object->tasks);
+        json.put("title", object->title);
+        json.put("title_entities", object->titleEntities);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    text,
+    parseMode,
+    textEntities,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"text", Field::text},
+    {"parse_mode", Field::parseMode},
+    {"text_entities", Field::textEntities},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputChecklistTask> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputChecklistTask>();
-    parse(data, "id", &result->id);
-    parse(data, "text", &result->text);
-    parse(data, "parse_mode", &result->parseMode);
-    result->textEntities = parseArray<MessageEntity>(data, "text_entities");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::textEntities:
+                result->textEntities = parseArray<MessageEntity>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,8 +49,8 @@ nlohmann::json put(const std::shared_ptr<InputChecklistTask> &object) {
     JsonWrapper json;
     if (object) {
         json.put("id", object->id);
-        json.put("text", object->text);
         json.put("parse_mode", object->parseMode);
+        json.put("text", object->text);
         json.put("text_entities", object->textEntities);
     }
     return json;
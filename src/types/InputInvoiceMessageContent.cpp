@@ -4,29 +4,123 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    title,
+    description,
+    payload,
+    providerToken,
+    currency,
+    prices,
+    maxTipAmount,
+    suggestedTipAmounts,
+    providerData,
+    photoUrl,
+    photoSize,
+    photoWidth,
+    photoHeight,
+    needName,
+    needPhoneNumber,
+    needEmail,
+    needShippingAddress,
+    sendPhoneNumberToProvider,
+    sendEmailToProvider,
+    isFlexible,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"title", Field::title},
+    {"description", Field::description},
+    {"payload", Field::payload},
+    {"provider_token", Field::providerToken},
+    {"currency", Field::currency},
+    {"prices", Field::prices},
+    {"max_tip_amount", Field::maxTipAmount},
+    {"suggested_tip_amounts", Field::suggestedTipAmounts},
+    {"provider_data", Field::providerData},
+    {"photo_url", Field::photoUrl},
+    {"photo_size", Field::photoSize},
+    {"photo_width", Field::photoWidth},
+    {"photo_height", Field::photoHeight},
+    {"need_name", Field::needName},
+    {"need_phone_number", Field::needPhoneNumber},
+    {"need_email", Field::needEmail},
+    {"need_shipping_address", Field::needShippingAddress},
+    {"send_phone_number_to_provider", Field::sendPhoneNumberToProvider},
+    {"send_email_to_provider", Field::sendEmailToProvider},
+    {"is_flexible", Field::isFlexible},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputInvoiceMessageContent> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputInvoiceMessageContent>();
-    parse(data, "title", &result->title);
-    parse(data, "description", &result->description);
-    parse(data, "payload", &result->payload);
-    parse(data, "provider_token", &result->providerToken);
-    parse(data, "currency", &result->currency);
-    result->prices = parseRequiredArray<LabeledPrice>(data, "prices");
-    parse(data, "max_tip_amount", &result->maxTipAmount);
-    result->suggestedTipAmounts = parsePrimitiveArray<std::int32_t>(data, "suggested_tip_amounts");
-    parse(data, "provider_data", &result->providerData);
-    parse(data, "photo_url", &result->photoUrl);
-    parse(data, "photo_size", &result->photoSize);
-    parse(data, "photo_width", &result->photoWidth);
-    parse(data, "photo_height", &result->photoHeight);
-    parse(data, "need_name", &result->needName);
-    parse(data, "need_phone_number", &result->needPhoneNumber);
-    parse(data, "need_email", &result->needEmail);
-    parse(data, "need_shipping_address", &result->needShippingAddress);
-    parse(data, "send_phone_number_to_provider", &result->sendPhoneNumberToProvider);
-    parse(data, "send_email_to_provider", &result->sendEmailToProvider);
-    parse(data, "is_flexible", &result->isFlexible);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::payload:
+                detail::parseValue(value, &result->payload);
+                break;
+            case Field::providerToken:
+                detail::parseValue(value, &result->providerToken);
+                break;
+            case Field::currency:
+                detail::parseValue(value, &result->currency);
+                break;
+            case Field::prices:
+                result->prices = parseArray<LabeledPrice>(value);
+                break;
+            case Field::maxTipAmount:
+                detail::parseValue(value, &result->maxTipAmount);
+                break;
+            case Field::suggestedTipAmounts:
+                result->suggestedTipAmounts = parsePrimitiveArray<std::int32_t>(value);
+                break;
+            case Field::providerData:
+                detail::parseValue(value, &result->providerData);
+                break;
+            case Field::photoUrl:
+                detail::parseValue(value, &result->photoUrl);
+                break;
+            case Field::photoSize:
+                detail::parseValue(value, &result->photoSize);
+                break;
+            case Field::photoWidth:
+                detail::parseValue(value, &result->photoWidth);
+                break;
+            case Field::photoHeight:
+                detail::parseValue(value, &result->photoHeight);
+                break;
+            case Field::needName:
+                detail::parseValue(value, &result->needName);
+                break;
+            case Field::needPhoneNumber:
+                detail::parseValue(value, &result->needPhoneNumber);
+                break;
+            case Field::needEmail:
+                detail::parseValue(value, &result->needEmail);
+                break;
+            case Field::needShippingAddress:
+                detail::parseValue(value, &result->needShippingAddress);
+                break;
+            case Field::sendPhoneNumberToProvider:
+                detail::parseValue(value, &result->sendPhoneNumberToProvider);
+                break;
+            case Field::sendEmailToProvider:
+                detail::parseValue(value, &result->sendEmailToProvider);
+                break;
+            case Field::isFlexible:
+                detail::parseValue(value, &result->isFlexible);
+                break;
+        }
+    });
     return result;
 }
 
@@ -34,26 +128,26 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputInvoiceMessageContent> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("title", object->title);
-        json.put("description", object->description);
-        json.put("payload", object->payload);
-        json.put("provider_token", object->providerToken);
         json.put("currency", object->currency);
-        json.put("prices", object->prices);
+        json.put("description", object->description);
+        json.put("is_flexible", object->isFlexible);
         json.put("max_tip_amount", object->maxTipAmount);
-        json.put("suggested_tip_amounts", object->suggestedTipAmounts);
-        json.put("provider_data", object->providerData);
-        json.put("photo_url", object->photoUrl);
-        json.put("photo_size", object->photoSize);
-        json.put("photo_width", object->photoWidth);
-        json.put("photo_height", object->photoHeight);
+        json.put("need_email", object->needEmail);
         json.put("need_name", object->needName);
         json.put("need_phone_number", object->needPhoneNumber);
-        json.put("need_email", object->needEmail);
         json.put("need_shipping_address", object->needShippingAddress);
-        json.put("send_phone_number_to_provider", object->sendPhoneNumberToProvider);
+        json.put("payload", object->payload);
+        json.put("photo_height", object->photoHeight);
+        json.put("photo_size", object->photoSize);
+        json.put("photo_url", object->photoUrl);
+        json.put("photo_width", object->photoWidth);
+        json.put("prices", object->prices);
+        json.put("provider_data", object->providerData);
+        json.put("provider_token", object->providerToken);
         json.put("send_email_to_provider", object->sendEmailToProvider);
-        json.put("is_flexible", object->isFlexible);
+        json.put("send_phone_number_to_provider", object->sendPhoneNumberToProvider);
+        json.put("suggested_tip_amounts", object->suggestedTipAmounts);
+        json.put("title", object->title);
     }
     return json;
 }
@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    latitude,
+    longitude,
+    horizontalAccuracy,
+    livePeriod,
+    heading,
+    proximityAlertRadius,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"latitude", Field::latitude},
+    {"longitude", Field::longitude},
+    {"horizontal_accuracy", Field::horizontalAccuracy},
+    {"live_period", Field::livePeriod},
+    {"heading", Field::heading},
+    {"proximity_alert_radius", Field::proximityAlertRadius},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputLocationMessageContent> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputLocationMessageContent>();
-    parse(data, "latitude", &result->latitude);
-    parse(data, "longitude", &result->longitude);
-    parse(data, "horizontal_accuracy", &result->horizontalAccuracy);
-    parse(data, "live_period", &result->livePeriod);
-    parse(data, "heading", &result->heading);
-    parse(data, "proximity_alert_radius", &result->proximityAlertRadius);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::latitude:
+                detail::parseValue(value, &result->latitude);
+                break;
+            case Field::longitude:
+                detail::parseValue(value, &result->longitude);
+                break;
+            case Field::horizontalAccuracy:
+                detail::parseValue(value, &result->horizontalAccuracy);
+                break;
+            case Field::livePeriod:
+                detail::parseValue(value, &result->livePeriod);
+                break;
+            case Field::heading:
+                detail::parseValue(value, &result->heading);
+                break;
+            case Field::proximityAlertRadius:
+                detail::parseValue(value, &result->proximityAlertRadius);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,11 +58,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputLocationMessageContent> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("latitude", object->latitude);
-        json.put("longitude", object->longitude);
+        json.put("heading", object->heading);
         json.put("horizontal_accuracy", object->horizontalAccuracy);
+        json.put("latitude", object->latitude);
         json.put("live_period", object->livePeriod);
-        json.put("heading", object->heading);
+        json.put("longitude", object->longitude);
         json.put("proximity_alert_radius", object->proximityAlertRadius);
     }
     return json;
@@ -15,70 +15,34 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<InputMedia>>({
+    {"animation", detail::subtype<InputMedia, InputMediaAnimation>()},
+    {"audio", detail::subtype<InputMedia, InputMediaAudio>()},
+    {"document", detail::subtype<InputMedia, InputMediaDocument>()},
+    {"live_photo", detail::subtype<InputMedia, InputMediaLivePhoto>()},
+    {"photo", detail::subtype<InputMedia, InputMediaPhoto>()},
+    {"video", detail::subtype<InputMedia, InputMediaVideo>()},
+    {"location", detail::subtype<InputMedia, InputMediaLocation>()},
+    {"venue", detail::subtype<InputMedia, InputMediaVenue>()},
+    {"link", detail::subtype<InputMedia, InputMediaLink>()},
+    {"sticker", detail::subtype<InputMedia, InputMediaSticker>()},
+    {"voice_note", detail::subtype<InputMedia, InputMediaVoiceNote>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputMedia> parse(const nlohmann::json &data) {
-    std::string type;
-    InputMedia::Ptr result;
-    parse(data, "type", &type);
-    if (type == "animation") {
-        result = parse<InputMediaAnimation>(data);
-    } else if (type == "audio") {
-        result = parse<InputMediaAudio>(data);
-    } else if (type == "document") {
-        result = parse<InputMediaDocument>(data);
-    } else if (type == "live_photo") {
-        result = parse<InputMediaLivePhoto>(data);
-    } else if (type == "photo") {
-        result = parse<InputMediaPhoto>(data);
-    } else if (type == "video") {
-        result = parse<InputMediaVideo>(data);
-    } else if (type == "location") {
-        result = parse<InputMediaLocation>(data);
-    } else if (type == "venue") {
-        result = parse<InputMediaVenue>(data);
-    } else if (type == "link") {
-        result = parse<InputMediaLink>(data);
-    } else if (type == "sticker") {
-        result = parse<InputMediaSticker>(data);
-    } else if (type == "voice_note") {
-        result = parse<InputMediaVoiceNote>(data);
-    } else {
-        throw invalidType("InputMedia", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "InputMedia");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<InputMedia> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "animation") {
-            json += put<InputMediaAnimation>(object);
-        } else if (object->type == "audio") {
-            json += put<InputMediaAudio>(object);
-        } else if (object->type == "document") {
-            json += put<InputMediaDocument>(object);
-        } else if (object->type == "live_photo") {
-            json += put<InputMediaLivePhoto>(object);
-        } else if (object->type == "photo") {
-            json += put<InputMediaPhoto>(object);
-        } else if (object->type == "video") {
-            json += put<InputMediaVideo>(object);
-        } else if (object->type == "location") {
-            json += put<InputMediaLocation>(object);
-        } else if (object->type == "venue") {
-            json += put<InputMediaVenue>(object);
-        } else if (object->type == "link") {
-            json += put<InputMediaLink>(object);
-        } else if (object->type == "sticker") {
-            json += put<InputMediaSticker>(object);
-        } else if (object->type == "voice_note") {
-            json += put<InputMediaVoiceNote>(object);
-        } else {
-            throw invalidType("InputMedia", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "InputMedia");
     }
     return json;
 }
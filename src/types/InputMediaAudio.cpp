@@ -4,18 +4,68 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    media,
+    thumbnail,
+    caption,
+    parseMode,
+    captionEntities,
+    duration,
+    performer,
+    title,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"media", Field::media},
+    {"thumbnail", Field::thumbnail},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"duration", Field::duration},
+    {"performer", Field::performer},
+    {"title", Field::title},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputMediaAudio> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputMediaAudio>();
-    parse(data, "type", &result->type);
-    parse(data, "media", &result->media);
-    parse(data, "thumbnail", &result->thumbnail);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "duration", &result->duration);
-    parse(data, "performer", &result->performer);
-    parse(data, "title", &result->title);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::media:
+                detail::parseValue(value, &result->media);
+                break;
+            case Field::thumbnail:
+                detail::parseValue(value, &result->thumbnail);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::duration:
+                detail::parseValue(value, &result->duration);
+                break;
+            case Field::performer:
+                detail::parseValue(value, &result->performer);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+        }
+    });
     return result;
 }
 
@@ -23,15 +73,15 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputMediaAudio> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("media", object->media);
-        json.put("thumbnail", object->thumbnail);
         json.put("caption", object->caption);
-        json.put("parse_mode", object->parseMode);
         json.put("caption_entities", object->captionEntities);
         json.put("duration", object->duration);
+        json.put("media", object->media);
+        json.put("parse_mode", object->parseMode);
         json.put("performer", object->performer);
+        json.put("thumbnail", object->thumbnail);
         json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,16 +4,58 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    media,
+    thumbnail,
+    caption,
+    parseMode,
+    captionEntities,
+    disableContentTypeDetection,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"media", Field::media},
+    {"thumbnail", Field::thumbnail},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"disable_content_type_detection", Field::disableContentTypeDetection},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputMediaDocument> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputMediaDocument>();
-    parse(data, "type", &result->type);
-    parse(data, "media", &result->media);
-    parse(data, "thumbnail", &result->thumbnail);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "disable_content_type_detection", &result->disableContentTypeDetection);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::media:
+                detail::parseValue(value, &result->media);
+                break;
+            case Field::thumbnail:
+                detail::parseValue(value, &result->thumbnail);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::disableContentTypeDetection:
+                detail::parseValue(value, &result->disableContentTypeDetection);
+                break;
+        }
+    });
     return result;
 }
 
@@ -21,13 +63,13 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputMediaDocument> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("media", object->media);
-        json.put("thumbnail", object->thumbnail);
         json.put("caption", object->caption);
-        json.put("parse_mode", object->parseMode);
         json.put("caption_entities", object->captionEntities);
         json.put("disable_content_type_detection", object->disableContentTypeDetection);
+        json.put("media", object->media);
+        json.put("parse_mode", object->parseMode);
+        json.put("thumbnail", object->thumbnail);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    url,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"url", Field::url},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputMediaLink> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputMediaLink>();
-    parse(data, "type", &result->type);
-    parse(data, "url", &result->url);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::url:
+                detail::parseValue(value, &result->url);
+                break;
+        }
+    });
     return result;
 }
 
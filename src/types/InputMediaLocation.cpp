@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    latitude,
+    longitude,
+    horizontalAccuracy,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"latitude", Field::latitude},
+    {"longitude", Field::longitude},
+    {"horizontal_accuracy", Field::horizontalAccuracy},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputMediaLocation> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputMediaLocation>();
-    parse(data, "type", &result->type);
-    parse(data, "latitude", &result->latitude);
-    parse(data, "longitude", &result->longitude);
-    parse(data, "horizontal_accuracy", &result->horizontalAccuracy);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::latitude:
+                detail::parseValue(value, &result->latitude);
+                break;
+            case Field::longitude:
+                detail::parseValue(value, &result->longitude);
+                break;
+            case Field::horizontalAccuracy:
+                detail::parseValue(value, &result->horizontalAccuracy);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputMediaLocation> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("horizontal_accuracy", object->horizontalAccuracy);
         json.put("latitude", object->latitude);
         json.put("longitude", object->longitude);
-        json.put("horizontal_accuracy", object->horizontalAccuracy);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,16 +4,58 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    media,
+    caption,
+    parseMode,
+    captionEntities,
+    showCaptionAboveMedia,
+    hasSpoiler,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"media", Field::media},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"show_caption_above_media", Field::showCaptionAboveMedia},
+    {"has_spoiler", Field::hasSpoiler},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputMediaPhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputMediaPhoto>();
-    parse(data, "type", &result->type);
-    parse(data, "media", &result->media);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "show_caption_above_media", &result->showCaptionAboveMedia);
-    parse(data, "has_spoiler", &result->hasSpoiler);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::media:
+                detail::parseValue(value, &result->media);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::showCaptionAboveMedia:
+                detail::parseValue(value, &result->showCaptionAboveMedia);
+                break;
+            case Field::hasSpoiler:
+                detail::parseValue(value, &result->hasSpoiler);
+                break;
+        }
+    });
     return result;
 }
 
@@ -21,13 +63,13 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputMediaPhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("media", object->media);
         json.put("caption", object->caption);
-        json.put("parse_mode", object->parseMode);
         json.put("caption_entities", object->captionEntities);
-        json.put("show_caption_above_media", object->showCaptionAboveMedia);
         json.put("has_spoiler", object->hasSpoiler);
+        json.put("media", object->media);
+        json.put("parse_mode", object->parseMode);
+        json.put("show_caption_above_media", object->showCaptionAboveMedia);
+        json.put("type", object->type);
     }
     return json;
 }
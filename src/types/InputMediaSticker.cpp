@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    media,
+    emoji,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"media", Field::media},
+    {"emoji", Field::emoji},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputMediaSticker> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputMediaSticker>();
-    parse(data, "type", &result->type);
-    parse(data, "media", &result->media);
-    parse(data, "emoji", &result->emoji);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::media:
+                detail::parseValue(value, &result->media);
+                break;
+            case Field::emoji:
+                detail::parseValue(value, &result->emoji);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputMediaSticker> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("media", object->media);
         json.put("emoji", object->emoji);
+        json.put("media", object->media);
+        json.put("type", object->type);
     }
     return json;
 }
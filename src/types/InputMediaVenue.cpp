@@ -4,18 +4,68 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    latitude,
+    longitude,
+    title,
+    address,
+    foursquareId,
+    foursquareType,
+    googlePlaceId,
+    googlePlaceType,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"latitude", Field::latitude},
+    {"longitude", Field::longitude},
+    {"title", Field::title},
+    {"address", Field::address},
+    {"foursquare_id", Field::foursquareId},
+    {"foursquare_type", Field::foursquareType},
+    {"google_place_id", Field::googlePlaceId},
+    {"google_place_type", Field::googlePlaceType},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputMediaVenue> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputMediaVenue>();
-    parse(data, "type", &result->type);
-    parse(data, "latitude", &result->latitude);
-    parse(data, "longitude", &result->longitude);
-    parse(data, "title", &result->title);
-    parse(data, "address", &result->address);
-    parse(data, "foursquare_id", &result->foursquareId);
-    parse(data, "foursquare_type", &result->foursquareType);
-    parse(data, "google_place_id", &result->googlePlaceId);
-    parse(data, "google_place_type", &result->googlePlaceType);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::latitude:
+                detail::parseValue(value, &result->latitude);
+                break;
+            case Field::longitude:
+                detail::parseValue(value, &result->longitude);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::address:
+                detail::parseValue(value, &result->address);
+                break;
+            case Field::foursquareId:
+                detail::parseValue(value, &result->foursquareId);
+                break;
+            case Field::foursquareType:
+                detail::parseValue(value, &result->foursquareType);
+                break;
+            case Field::googlePlaceId:
+                detail::parseValue(value, &result->googlePlaceId);
+                break;
+            case Field::googlePlaceType:
+                detail::parseValue(value, &result->googlePlaceType);
+                break;
+        }
+    });
     return result;
 }
 
@@ -23,15 +73,15 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputMediaVenue> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("latitude", object->latitude);
-        json.put("longitude", object->longitude);
-        json.put("title", object->title);
         json.put("address", object->address);
         json.put("foursquare_id", object->foursquareId);
         json.put("foursquare_type", object->foursquareType);
         json.put("google_place_id", object->googlePlaceId);
         json.put("google_place_type", object->googlePlaceType);
+        json.put("latitude", object->latitude);
+        json.put("longitude", object->longitude);
+        json.put("title", object->title);
+        json.put("type", object->type);
     }
     return json;
 }
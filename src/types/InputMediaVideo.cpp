@@ -4,23 +4,93 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    media,
+    thumbnail,
+    cover,
+    startTimestamp,
+    caption,
+    parseMode,
+    captionEntities,
+    showCaptionAboveMedia,
+    width,
+    height,
+    duration,
+    supportsStreaming,
+    hasSpoiler,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"media", Field::media},
+    {"thumbnail", Field::thumbnail},
+    {"cover", Field::cover},
+    {"start_timestamp", Field::startTimestamp},
+    {"caption", Field::caption},
+    {"parse_mode", Field::parseMode},
+    {"caption_entities", Field::captionEntities},
+    {"show_caption_above_media", Field::showCaptionAboveMedia},
+    {"width", Field::width},
+    {"height", Field::height},
+    {"duration", Field::duration},
+    {"supports_streaming", Field::supportsStreaming},
+    {"has_spoiler", Field::hasSpoiler},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputMediaVideo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputMediaVideo>();
-    parse(data, "type", &result->type);
-    parse(data, "media", &result->media);
-    parse(data, "thumbnail", &result->thumbnail);
-    parse(data, "cover", &result->cover);
-    parse(data, "start_timestamp", &result->startTimestamp);
-    parse(data, "caption", &result->caption);
-    parse(data, "parse_mode", &result->parseMode);
-    result->captionEntities = parseArray<MessageEntity>(data, "caption_entities");
-    parse(data, "show_caption_above_media", &result->showCaptionAboveMedia);
-    parse(data, "width", &result->width);
-    parse(data, "height", &result->height);
-    parse(data, "duration", &result->duration);
-    parse(data, "supports_streaming", &result->supportsStreaming);
-    parse(data, "has_spoiler", &result->hasSpoiler);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::media:
+                detail::parseValue(value, &result->media);
+                break;
+            case Field::thumbnail:
+                detail::parseValue(value, &result->thumbnail);
+                break;
+            case Field::cover:
+                detail::parseValue(value, &result->cover);
+                break;
+            case Field::startTimestamp:
+                detail::parseValue(value, &result->startTimestamp);
+                break;
+            case Field::caption:
+                detail::parseValue(value, &result->caption);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::captionEntities:
+                result->captionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::showCaptionAboveMedia:
+                detail::parseValue(value, &result->showCaptionAboveMedia);
+                break;
+            case Field::width:
+                detail::parseValue(value, &result->width);
+                break;
+            case Field::height:
+                detail::parseValue(value, &result->height);
+                break;
+            case Field::duration:
+                detail::parseValue(value, &result->duration);
+                break;
+            case Field::supportsStreaming:
+                detail::parseValue(value, &result->supportsStreaming);
+                break;
+            case Field::hasSpoiler:
+                detail::parseValue(value, &result->hasSpoiler);
+                break;
+        }
+    });
     return result;
 }
 
@@ -28,20 +98,20 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputMediaVideo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("media", object->media);
-        json.put("thumbnail", object->thumbnail);
-        json.put("cover", object->cover);
-        json.put("start_timestamp", object->startTimestamp);
         json.put("caption", object->caption);
-        json.put("parse_mode", object->parseMode);
         json.put("caption_entities", object->captionEntities);
-        json.put("show_caption_above_media", object->showCaptionAboveMedia);
-        json.put("width", object->width);
-        json.put("height", object->height);
+        json.put("cover", object->cover);
         json.put("duration", object->duration);
-        json.put("supports_streaming", object->supportsStreaming);
         json.put("has_spoiler", object->hasSpoiler);
+        json.put("height", object->height);
+        json.put("media", object->media);
+        json.put("parse_mode", object->parseMode);
+        json.put("show_caption_above_media", object->showCaptionAboveMedia);
+        json.put("start_timestamp", object->startTimestamp);
+        json.put("supports_streaming", object->supportsStreaming);
+        json.put("thumbnail", object->thumbnail);
+        json.put("type", object->type);
+        json.put("width", object->width);
     }
     return json;
 }
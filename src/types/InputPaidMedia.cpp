@@ -7,38 +7,26 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<InputPaidMedia>>({
+    {"live_photo", detail::subtype<InputPaidMedia, InputPaidMediaLivePhoto>()},
+    {"photo", detail::subtype<InputPaidMedia, InputPaidMediaPhoto>()},
+    {"video", detail::subtype<InputPaidMedia, InputPaidMediaVideo>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputPaidMedia> parse(const nlohmann::json &data) {
-    std::string type;
-    InputPaidMedia::Ptr result;
-    parse(data, "type", &type);
-    if (type == "live_photo") {
-        result = parse<InputPaidMediaLivePhoto>(data);
-    } else if (type == "photo") {
-        result = parse<InputPaidMediaPhoto>(data);
-    } else if (type == "video") {
-        result = parse<InputPaidMediaVideo>(data);
-    } else {
-        throw invalidType("InputPaidMedia", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "InputPaidMedia");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<InputPaidMedia> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "live_photo") {
-            json += put<InputPaidMediaLivePhoto>(object);
-        } else if (object->type == "photo") {
-            json += put<InputPaidMediaPhoto>(object);
-        } else if (object->type == "video") {
-            json += put<InputPaidMediaVideo>(object);
-        } else {
-            throw invalidType("InputPaidMedia", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "InputPaidMedia");
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    media,
+    photo,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"media", Field::media},
+    {"photo", Field::photo},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputPaidMediaLivePhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputPaidMediaLivePhoto>();
-    parse(data, "type", &result->type);
-    parse(data, "media", &result->media);
-    parse(data, "photo", &result->photo);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::media:
+                detail::parseValue(value, &result->media);
+                break;
+            case Field::photo:
+                detail::parseValue(value, &result->photo);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputPaidMediaLivePhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("media", object->media);
         json.put("photo", object->photo);
+        json.put("type", object->type);
     }
     return json;
 }
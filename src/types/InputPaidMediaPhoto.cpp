@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    media,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"media", Field::media},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputPaidMediaPhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputPaidMediaPhoto>();
-    parse(data, "type", &result->type);
-    parse(data, "media", &result->media);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::media:
+                detail::parseValue(value, &result->media);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputPaidMediaPhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("media", object->media);
+        json.put("type", object->type);
     }
     return json;
 }
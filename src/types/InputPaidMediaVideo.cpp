@@ -4,18 +4,68 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    media,
+    thumbnail,
+    cover,
+    startTimestamp,
+    width,
+    height,
+    duration,
+    supportsStreaming,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"media", Field::media},
+    {"thumbnail", Field::thumbnail},
+    {"cover", Field::cover},
+    {"start_timestamp", Field::startTimestamp},
+    {"width", Field::width},
+    {"height", Field::height},
+    {"duration", Field::duration},
+    {"supports_streaming", Field::supportsStreaming},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputPaidMediaVideo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputPaidMediaVideo>();
-    parse(data, "type", &result->type);
-    parse(data, "media", &result->media);
-    parse(data, "thumbnail", &result->thumbnail);
-    parse(data, "cover", &result->cover);
-    parse(data, "start_timestamp", &result->startTimestamp);
-    parse(data, "width", &result->width);
-    parse(data, "height", &result->height);
-    parse(data, "duration", &result->duration);
-    parse(data, "supports_streaming", &result->supportsStreaming);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::media:
+                detail::parseValue(value, &result->media);
+                break;
+            case Field::thumbnail:
+                detail::parseValue(value, &result->thumbnail);
+                break;
+            case Field::cover:
+                detail::parseValue(value, &result->cover);
+                break;
+            case Field::startTimestamp:
+                detail::parseValue(value, &result->startTimestamp);
+                break;
+            case Field::width:
+                detail::parseValue(value, &result->width);
+                break;
+            case Field::height:
+                detail::parseValue(value, &result->height);
+                break;
+            case Field::duration:
+                detail::parseValue(value, &result->duration);
+                break;
+            case Field::supportsStreaming:
+                detail::parseValue(value, &result->supportsStreaming);
+                break;
+        }
+    });
     return result;
 }
 
@@ -23,15 +73,15 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputPaidMediaVideo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("media", object->media);
-        json.put("thumbnail", object->thumbnail);
         json.put("cover", object->cover);
-        json.put("start_timestamp", object->startTimestamp);
-        json.put("width", object->width);
-        json.put("height", object->height);
         json.put("duration", object->duration);
+        json.put("height", object->height);
+        json.put("media", object->media);
+        json.put("start_timestamp", object->startTimestamp);
         json.put("supports_streaming", object->supportsStreaming);
+        json.put("thumbnail", object->thumbnail);
+        json.put("type", object->type);
+        json.put("width", object->width);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    text,
+    textParseMode,
+    textEntities,
+    media,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"text", Field::text},
+    {"text_parse_mode", Field::textParseMode},
+    {"text_entities", Field::textEntities},
+    {"media", Field::media},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputPollOption> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputPollOption>();
-    parse(data, "text", &result->text);
-    parse(data, "text_parse_mode", &result->textParseMode);
-    result->textEntities = parseArray<MessageEntity>(data, "text_entities");
-    result->media = parse<InputMedia>(data, "media");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::textParseMode:
+                detail::parseValue(value, &result->textParseMode);
+                break;
+            case Field::textEntities:
+                result->textEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::media:
+                result->media = parse<InputMedia>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputPollOption> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("media", object->media);
         json.put("text", object->text);
-        json.put("text_parse_mode", object->textParseMode);
         json.put("text_entities", object->textEntities);
-        json.put("media", object->media);
+        json.put("text_parse_mode", object->textParseMode);
     }
     return json;
 }
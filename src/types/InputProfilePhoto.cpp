@@ -6,34 +6,25 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<InputProfilePhoto>>({
+    {"static", detail::subtype<InputProfilePhoto, InputProfilePhotoStatic>()},
+    {"animated", detail::subtype<InputProfilePhoto, InputProfilePhotoAnimated>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputProfilePhoto> parse(const nlohmann::json &data) {
-    std::string type;
-    InputProfilePhoto::Ptr result;
-    parse(data, "type", &type);
-    if (type == "static") {
-        result = parse<InputProfilePhotoStatic>(data);
-    } else if (type == "animated") {
-        result = parse<InputProfilePhotoAnimated>(data);
-    } else {
-        throw invalidType("InputProfilePhoto", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "InputProfilePhoto");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<InputProfilePhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "static") {
-            json += put<InputProfilePhotoStatic>(object);
-        } else if (object->type == "animated") {
-            json += put<InputProfilePhotoAnimated>(object);
-        } else {
-            throw invalidType("InputProfilePhoto", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "InputProfilePhoto");
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    animation,
+    mainFrameTimestamp,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"animation", Field::animation},
+    {"main_frame_timestamp", Field::mainFrameTimestamp},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputProfilePhotoAnimated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputProfilePhotoAnimated>();
-    parse(data, "type", &result->type);
-    parse(data, "animation", &result->animation);
-    parse(data, "main_frame_timestamp", &result->mainFrameTimestamp);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::animation:
+                detail::parseValue(value, &result->animation);
+                break;
+            case Field::mainFrameTimestamp:
+                detail::parseValue(value, &result->mainFrameTimestamp);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputProfilePhotoAnimated> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("animation", object->animation);
         json.put("main_frame_timestamp", object->mainFrameTimestamp);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -25,110 +25,44 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<InputRichBlock>>({
+    {"paragraph", detail::subtype<InputRichBlock, InputRichBlockParagraph>()},
+    {"heading", detail::subtype<InputRichBlock, InputRichBlockSectionHeading>()},
+    {"pre", detail::subtype<InputRichBlock, InputRichBlockPreformatted>()},
+    {"footer", detail::subtype<InputRichBlock, InputRichBlockFooter>()},
+    {"divider", detail::subtype<InputRichBlock, InputRichBlockDivider>()},
+    {"mathematical_expression", detail::subtype<InputRichBlock, InputRichBlockMathematicalExpression>()},
+    {"anchor", detail::subtype<InputRichBlock, InputRichBlockAnchor>()},
+    {"list", detail::subtype<InputRichBlock, InputRichBlockList>()},
+    {"blockquote", detail::subtype<InputRichBlock, InputRichBlockBlockQuotation>()},
+    {"pullquote", detail::subtype<InputRichBlock, InputRichBlockPullQuotation>()},
+    {"collage", detail::subtype<InputRichBlock, InputRichBlockCollage>()},
+    {"slideshow", detail::subtype<InputRichBlock, InputRichBlockSlideshow>()},
+    {"table", detail::subtype<InputRichBlock, InputRichBlockTable>()},
+    {"details", detail::subtype<InputRichBlock, InputRichBlockDetails>()},
+    {"map", detail::subtype<InputRichBlock, InputRichBlockMap>()},
+    {"animation", detail::subtype<InputRichBlock, InputRichBlockAnimation>()},
+    {"audio", detail::subtype<InputRichBlock, InputRichBlockAudio>()},
+    {"photo", detail::subtype<InputRichBlock, InputRichBlockPhoto>()},
+    {"video", detail::subtype<InputRichBlock, InputRichBlockVideo>()},
+    {"voice_note", detail::subtype<InputRichBlock, InputRichBlockVoiceNote>()},
+    {"thinking", detail::subtype<InputRichBlock, InputRichBlockThinking>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlock> parse(const nlohmann::json &data) {
-    std::string type;
-    InputRichBlock::Ptr result;
-    parse(data, "type", &type);
-    if (type == "paragraph") {
-        result = parse<InputRichBlockParagraph>(data);
-    } else if (type == "heading") {
-        result = parse<InputRichBlockSectionHeading>(data);
-    } else if (type == "pre") {
-        result = parse<InputRichBlockPreformatted>(data);
-    } else if (type == "footer") {
-        result = parse<InputRichBlockFooter>(data);
-    } else if (type == "divider") {
-        result = parse<InputRichBlockDivider>(data);
-    } else if (type == "mathematical_expression") {
-        result = parse<InputRichBlockMathematicalExpression>(data);
-    } else if (type == "anchor") {
-        result = parse<InputRichBlockAnchor>(data);
-    } else if (type == "list") {
-        result = parse<InputRichBlockList>(data);
-    } else if (type == "blockquote") {
-        result = parse<InputRichBlockBlockQuotation>(data);
-    } else if (type == "pullquote") {
-        result = parse<InputRichBlockPullQuotation>(data);
-    } else if (type == "collage") {
-        result = parse<InputRichBlockCollage>(data);
-    } else if (type == "slideshow") {
-        result = parse<InputRichBlockSlideshow>(data);
-    } else if (type == "table") {
-        result = parse<InputRichBlockTable>(data);
-    } else if (type == "details") {
-        result = parse<InputRichBlockDetails>(data);
-    } else if (type == "map") {
-        result = parse<InputRichBlockMap>(data);
-    } else if (type == "animation") {
-        result = parse<InputRichBlockAnimation>(data);
-    } else if (type == "audio") {
-        result = parse<InputRichBlockAudio>(data);
-    } else if (type == "photo") {
-        result = parse<InputRichBlockPhoto>(data);
-    } else if (type == "video") {
-        result = parse<InputRichBlockVideo>(data);
-    } else if (type == "voice_note") {
-        result = parse<InputRichBlockVoiceNote>(data);
-    } else if (type == "thinking") {
-        result = parse<InputRichBlockThinking>(data);
-    } else {
-        throw invalidType("InputRichBlock", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "InputRichBlock");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlock> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "paragraph") {
-            json += put<InputRichBlockParagraph>(object);
-        } else if (object->type == "heading") {
-            json += put<InputRichBlockSectionHeading>(object);
-        } else if (object->type == "pre") {
-            json += put<InputRichBlockPreformatted>(object);
-        } else if (object->type == "footer") {
-            json += put<InputRichBlockFooter>(object);
-        } else if (object->type == "divider") {
-            json += put<InputRichBlockDivider>(object);
-        } else if (object->type == "mathematical_expression") {
-            json += put<InputRichBlockMathematicalExpression>(object);
-        } else if (object->type == "anchor") {
-            json += put<InputRichBlockAnchor>(object);
-        } else if (object->type == "list") {
-            json += put<InputRichBlockList>(object);
-        } else if (object->type == "blockquote") {
-            json += put<InputRichBlockBlockQuotation>(object);
-        } else if (object->type == "pullquote") {
-            json += put<InputRichBlockPullQuotation>(object);
-        } else if (object->type == "collage") {
-            json += put<InputRichBlockCollage>(object);
-        } else if (object->type == "slideshow") {
-            json += put<InputRichBlockSlideshow>(object);
-        } else if (object->type == "table") {
-            json += put<InputRichBlockTable>(object);
-        } else if (object->type == "details") {
-            json += put<InputRichBlockDetails>(object);
-        } else if (object->type == "map") {
-            json += put<InputRichBlockMap>(object);
-        } else if (object->type == "animation") {
-            json += put<InputRichBlockAnimation>(object);
-        } else if (object->type == "audio") {
-            json += put<InputRichBlockAudio>(object);
-        } else if (object->type == "photo") {
-            json += put<InputRichBlockPhoto>(object);
-        } else if (object->type == "video") {
-            json += put<InputRichBlockVideo>(object);
-        } else if (object->type == "voice_note") {
-            json += put<InputRichBlockVoiceNote>(object);
-        } else if (object->type == "thinking") {
-            json += put<InputRichBlockThinking>(object);
-        } else {
-            throw invalidType("InputRichBlock", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "InputRichBlock");
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    name,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"name", Field::name},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockAnchor> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockAnchor>();
-    parse(data, "type", &result->type);
-    parse(data, "name", &result->name);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockAnchor> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("name", object->name);
+        json.put("type", object->type);
     }
     return json;
 }
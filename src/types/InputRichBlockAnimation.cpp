@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    animation,
+    caption,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"animation", Field::animation},
+    {"caption", Field::caption},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockAnimation> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockAnimation>();
-    parse(data, "type", &result->type);
-    result->animation = parseRequired<InputMediaAnimation>(data, "animation");
-    result->caption = parse<RichBlockCaption>(data, "caption");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::animation:
+                result->animation = parse<InputMediaAnimation>(value);
+                break;
+            case Field::caption:
+                result->caption = parse<RichBlockCaption>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockAnimation> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("animation", object->animation);
         json.put("caption", object->caption);
+        json.put("type", object->type);
     }
     return json;
 }
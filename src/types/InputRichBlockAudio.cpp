@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    audio,
+    caption,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"audio", Field::audio},
+    {"caption", Field::caption},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockAudio> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockAudio>();
-    parse(data, "type", &result->type);
-    result->audio = parseRequired<InputMediaAudio>(data, "audio");
-    result->caption = parse<RichBlockCaption>(data, "caption");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::audio:
+                result->audio = parse<InputMediaAudio>(value);
+                break;
+            case Field::caption:
+                result->caption = parse<RichBlockCaption>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockAudio> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("audio", object->audio);
         json.put("caption", object->caption);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    blocks,
+    credit,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"blocks", Field::blocks},
+    {"credit", Field::credit},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockBlockQuotation> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockBlockQuotation>();
-    parse(data, "type", &result->type);
-    result->blocks = parseRequiredArray<InputRichBlock>(data, "blocks");
-    result->credit = parse<RichText>(data, "credit");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::blocks:
+                result->blocks = parseArray<InputRichBlock>(value);
+                break;
+            case Field::credit:
+                result->credit = parse<RichText>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockBlockQuotation> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("blocks", object->blocks);
         json.put("credit", object->credit);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    items,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"items", Field::items},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockList> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockList>();
-    parse(data, "type", &result->type);
-    result->items = parseRequiredArray<InputRichBlockListItem>(data, "items");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::items:
+                result->items = parseArray<InputRichBlockListItem>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockList> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("items", object->items);
+        json.put("type", object->type);
     }
     return json;
 }
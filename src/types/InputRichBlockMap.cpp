@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    location,
+    zoom,
+    width,
+    height,
+    caption,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"location", Field::location},
+    {"zoom", Field::zoom},
+    {"width", Field::width},
+    {"height", Field::height},
+    {"caption", Field::caption},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockMap> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockMap>();
-    parse(data, "type", &result->type);
-    result->location = parseRequired<Location>(data, "location");
-    parse(data, "zoom", &result->zoom);
-    parse(data, "width", &result->width);
-    parse(data, "height", &result->height);
-    result->caption = parse<RichBlockCaption>(data, "caption");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::location:
+                result->location = parse<Location>(value);
+                break;
+            case Field::zoom:
+                detail::parseValue(value, &result->zoom);
+                break;
+            case Field::width:
+                detail::parseValue(value, &result->width);
+                break;
+            case Field::height:
+                detail::parseValue(value, &result->height);
+                break;
+            case Field::caption:
+                result->caption = parse<RichBlockCaption>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockMap> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("caption", object->caption);
+        json.put("height", object->height);
         json.put("location", object->location);
-        json.put("zoom", object->zoom);
+        json.put("type", object->type);
         json.put("width", object->width);
-        json.put("height", object->height);
-        json.put("caption", object->caption);
+        json.put("zoom", object->zoom);
     }
     return json;
 }
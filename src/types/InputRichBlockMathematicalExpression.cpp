@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    expression,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"expression", Field::expression},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockMathematicalExpression> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockMathematicalExpression>();
-    parse(data, "type", &result->type);
-    parse(data, "expression", &result->expression);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::expression:
+                detail::parseValue(value, &result->expression);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockMathematicalExpression> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("expression", object->expression);
+        json.put("type", object->type);
     }
     return json;
 }
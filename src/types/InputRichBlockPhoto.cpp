@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    photo,
+    caption,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"photo", Field::photo},
+    {"caption", Field::caption},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockPhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockPhoto>();
-    parse(data, "type", &result->type);
-    result->photo = parseRequired<InputMediaPhoto>(data, "photo");
-    result->caption = parse<RichBlockCaption>(data, "caption");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::photo:
+                result->photo = parse<InputMediaPhoto>(value);
+                break;
+            case Field::caption:
+                result->caption = parse<RichBlockCaption>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockPhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("photo", object->photo);
         json.put("caption", object->caption);
+        json.put("photo", object->photo);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    language,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"language", Field::language},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockPreformatted> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockPreformatted>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "language", &result->language);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::language:
+                detail::parseValue(value, &result->language);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockPreformatted> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("language", object->language);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
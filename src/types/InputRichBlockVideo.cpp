@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    video,
+    caption,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"video", Field::video},
+    {"caption", Field::caption},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockVideo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockVideo>();
-    parse(data, "type", &result->type);
-    result->video = parseRequired<InputMediaVideo>(data, "video");
-    result->caption = parse<RichBlockCaption>(data, "caption");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::video:
+                result->video = parse<InputMediaVideo>(value);
+                break;
+            case Field::caption:
+                result->caption = parse<RichBlockCaption>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockVideo> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("caption", object->caption);
         json.put("type", object->type);
         json.put("video", object->video);
-        json.put("caption", object->caption);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    voiceNote,
+    caption,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"voice_note", Field::voiceNote},
+    {"caption", Field::caption},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichBlockVoiceNote> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichBlockVoiceNote>();
-    parse(data, "type", &result->type);
-    result->voiceNote = parseRequired<InputMediaVoiceNote>(data, "voice_note");
-    result->caption = parse<RichBlockCaption>(data, "caption");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::voiceNote:
+                result->voiceNote = parse<InputMediaVoiceNote>(value);
+                break;
+            case Field::caption:
+                result->caption = parse<RichBlockCaption>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputRichBlockVoiceNote> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("caption", object->caption);
         json.put("type", object->type);
         json.put("voice_note", object->voiceNote);
-        json.put("caption", object->caption);
     }
     return json;
 }
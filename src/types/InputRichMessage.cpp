@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    blocks,
+    html,
+    markdown,
+    media,
+    isRtl,
+    skipEntityDetection,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"blocks", Field::blocks},
+    {"html", Field::html},
+    {"markdown", Field::markdown},
+    {"media", Field::media},
+    {"is_rtl", Field::isRtl},
+    {"skip_entity_detection", Field::skipEntityDetection},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichMessage> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichMessage>();
-    result->blocks = parseArray<InputRichBlock>(data, "blocks");
-    parse(data, "html", &result->html);
-    parse(data, "markdown", &result->markdown);
-    result->media = parseArray<InputRichMessageMedia>(data, "media");
-    parse(data, "is_rtl", &result->isRtl);
-    parse(data, "skip_entity_detection", &result->skipEntityDetection);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::blocks:
+                result->blocks = parseArray<InputRichBlock>(value);
+                break;
+            case Field::html:
+                detail::parseValue(value, &result->html);
+                break;
+            case Field::markdown:
+                detail::parseValue(value, &result->markdown);
+                break;
+            case Field::media:
+                result->media = parseArray<InputRichMessageMedia>(value);
+                break;
+            case Field::isRtl:
+                detail::parseValue(value, &result->isRtl);
+                break;
+            case Field::skipEntityDetection:
+                detail::parseValue(value, &result->skipEntityDetection);
+                break;
+        }
+    });
     return result;
 }
 
@@ -22,9 +60,9 @@ nlohmann::json put(const std::shared_ptr<InputRichMessage> &object) {
     if (object) {
         json.put("blocks", object->blocks);
         json.put("html", object->html);
+        json.put("is_rtl", object->isRtl);
         json.put("markdown", object->markdown);
         json.put("media", object->media);
-        json.put("is_rtl", object->isRtl);
         json.put("skip_entity_detection", object->skipEntityDetection);
     }
     return json;
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    richMessage,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"rich_message", Field::richMessage},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichMessageContent> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichMessageContent>();
-    result->richMessage = parseRequired<InputRichMessage>(data, "rich_message");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::richMessage:
+                result->richMessage = parse<InputRichMessage>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    media,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"media", Field::media},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputRichMessageMedia> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputRichMessageMedia>();
-    parse(data, "id", &result->id);
-    result->media = parseRequired<InputMedia>(data, "media");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::media:
+                result->media = parse<InputMedia>(value);
+                break;
+        }
+    });
     return result;
 }
 
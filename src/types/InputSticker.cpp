@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    sticker,
+    format,
+    emojiList,
+    maskPosition,
+    keywords,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"sticker", Field::sticker},
+    {"format", Field::format},
+    {"emoji_list", Field::emojiList},
+    {"mask_position", Field::maskPosition},
+    {"keywords", Field::keywords},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputSticker> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputSticker>();
-    parse(data, "sticker", &result->sticker);
-    parse(data, "format", &result->format);
-    result->emojiList = parsePrimitiveRequiredArray<std::string>(data, "emoji_list");
-    result->maskPosition = parse<MaskPosition>(data, "mask_position");
-    result->keywords = parsePrimitiveArray<std::string>(data, "keywords");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::sticker:
+                detail::parseValue(value, &result->sticker);
+                break;
+            case Field::format:
+                detail::parseValue(value, &result->format);
+                break;
+            case Field::emojiList:
+                result->emojiList = parsePrimitiveArray<std::string>(value);
+                break;
+            case Field::maskPosition:
+                result->maskPosition = parse<MaskPosition>(value);
+                break;
+            case Field::keywords:
+                result->keywords = parsePrimitiveArray<std::string>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputSticker> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("sticker", object->sticker);
-        json.put("format", object->format);
         json.put("emoji_list", object->emojiList);
-        json.put("mask_position", object->maskPosition);
+        json.put("format", object->format);
         json.put("keywords", object->keywords);
+        json.put("mask_position", object->maskPosition);
+        json.put("sticker", object->sticker);
     }
     return json;
 }
@@ -6,34 +6,25 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<InputStoryContent>>({
+    {"photo", detail::subtype<InputStoryContent, InputStoryContentPhoto>()},
+    {"video", detail::subtype<InputStoryContent, InputStoryContentVideo>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputStoryContent> parse(const nlohmann::json &data) {
-    std::string type;
-    InputStoryContent::Ptr result;
-    parse(data, "type", &type);
-    if (type == "photo") {
-        result = parse<InputStoryContentPhoto>(data);
-    } else if (type == "video") {
-        result = parse<InputStoryContentVideo>(data);
-    } else {
-        throw invalidType("InputStoryContent", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "InputStoryContent");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<InputStoryContent> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "photo") {
-            json += put<InputStoryContentPhoto>(object);
-        } else if (object->type == "video") {
-            json += put<InputStoryContentVideo>(object);
-        } else {
-            throw invalidType("InputStoryContent", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "InputStoryContent");
     }
     return json;
 }
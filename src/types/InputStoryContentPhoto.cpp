@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    photo,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"photo", Field::photo},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputStoryContentPhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputStoryContentPhoto>();
-    parse(data, "type", &result->type);
-    parse(data, "photo", &result->photo);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::photo:
+                detail::parseValue(value, &result->photo);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputStoryContentPhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("photo", object->photo);
+        json.put("type", object->type);
     }
     return json;
 }
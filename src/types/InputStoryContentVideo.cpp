@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    video,
+    duration,
+    coverFrameTimestamp,
+    isAnimation,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"video", Field::video},
+    {"duration", Field::duration},
+    {"cover_frame_timestamp", Field::coverFrameTimestamp},
+    {"is_animation", Field::isAnimation},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputStoryContentVideo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputStoryContentVideo>();
-    parse(data, "type", &result->type);
-    parse(data, "video", &result->video);
-    parse(data, "duration", &result->duration);
-    parse(data, "cover_frame_timestamp", &result->coverFrameTimestamp);
-    parse(data, "is_animation", &result->isAnimation);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::video:
+                detail::parseValue(value, &result->video);
+                break;
+            case Field::duration:
+                detail::parseValue(value, &result->duration);
+                break;
+            case Field::coverFrameTimestamp:
+                detail::parseValue(value, &result->coverFrameTimestamp);
+                break;
+            case Field::isAnimation:
+                detail::parseValue(value, &result->isAnimation);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputStoryContentVideo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("video", object->video);
-        json.put("duration", object->duration);
         json.put("cover_frame_timestamp", object->coverFrameTimestamp);
+        json.put("duration", object->duration);
         json.put("is_animation", object->isAnimation);
+        json.put("type", object->type);
+        json.put("video", object->video);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    messageText,
+    parseMode,
+    entities,
+    linkPreviewOptions,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"message_text", Field::messageText},
+    {"parse_mode", Field::parseMode},
+    {"entities", Field::entities},
+    {"link_preview_options", Field::linkPreviewOptions},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<InputTextMessageContent> parse(const nlohmann::json &data) {
     auto result = std::make_shared<InputTextMessageContent>();
-    parse(data, "message_text", &result->messageText);
-    parse(data, "parse_mode", &result->parseMode);
-    result->entities = parseArray<MessageEntity>(data, "entities");
-    result->linkPreviewOptions = parse<LinkPreviewOptions>(data, "link_preview_options");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::messageText:
+                detail::parseValue(value, &result->messageText);
+                break;
+            case Field::parseMode:
+                detail::parseValue(value, &result->parseMode);
+                break;
+            case Field::entities:
+                result->entities = parseArray<MessageEntity>(value);
+                break;
+            case Field::linkPreviewOptions:
+                result->linkPreviewOptions = parse<LinkPreviewOptions>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<InputTextMessageContent> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("message_text", object->messageText);
-        json.put("parse_mode", object->parseMode);
         json.put("entities", object->entities);
         json.put("link_preview_options", object->linkPreviewOptions);
+        json.put("message_text", object->messageText);
+        json.put("parse_mode", object->parseMode);
     }
     return json;
 }
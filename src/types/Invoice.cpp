@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    title,
+    description,
+    startParameter,
+    currency,
+    totalAmount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"title", Field::title},
+    {"description", Field::description},
+    {"start_parameter", Field::startParameter},
+    {"currency", Field::currency},
+    {"total_amount", Field::totalAmount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Invoice> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Invoice>();
-    parse(data, "title", &result->title);
-    parse(data, "description", &result->description);
-    parse(data, "start_parameter", &result->startParameter);
-    parse(data, "currency", &result->currency);
-    parse(data, "total_amount", &result->totalAmount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::startParameter:
+                detail::parseValue(value, &result->startParameter);
+                break;
+            case Field::currency:
+                detail::parseValue(value, &result->currency);
+                break;
+            case Field::totalAmount:
+                detail::parseValue(value, &result->totalAmount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,10 +53,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<Invoice> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("title", object->title);
+        json.put("currency", object->currency);
         json.put("description", object->description);
         json.put("start_parameter", object->startParameter);
-        json.put("currency", object->currency);
+        json.put("title", object->title);
         json.put("total_amount", object->totalAmount);
     }
     return json;
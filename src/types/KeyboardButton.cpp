@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    text,
+    iconCustomEmojiId,
+    style,
+    requestUsers,
+    requestChat,
+    requestManagedBot,
+    requestContact,
+    requestLocation,
+    requestPoll,
+    webApp,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"text", Field::text},
+    {"icon_custom_emoji_id", Field::iconCustomEmojiId},
+    {"style", Field::style},
+    {"request_users", Field::requestUsers},
+    {"request_chat", Field::requestChat},
+    {"request_managed_bot", Field::requestManagedBot},
+    {"request_contact", Field::requestContact},
+    {"request_location", Field::requestLocation},
+    {"request_poll", Field::requestPoll},
+    {"web_app", Field::webApp},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<KeyboardButton> parse(const nlohmann::json &data) {
     auto result = std::make_shared<KeyboardButton>();
-    parse(data, "text", &result->text);
-    parse(data, "icon_custom_emoji_id", &result->iconCustomEmojiId);
-    parse(data, "style", &result->style);
-    result->requestUsers = parse<KeyboardButtonRequestUsers>(data, "request_users");
-    result->requestChat = parse<KeyboardButtonRequestChat>(data, "request_chat");
-    result->requestManagedBot = parse<KeyboardButtonRequestManagedBot>(data, "request_managed_bot");
-    parse(data, "request_contact", &result->requestContact);
-    parse(data, "request_location", &result->requestLocation);
-    result->requestPoll = parse<KeyboardButtonPollType>(data, "request_poll");
-    result->webApp = parse<WebAppInfo>(data, "web_app");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::iconCustomEmojiId:
+                detail::parseValue(value, &result->iconCustomEmojiId);
+                break;
+            case Field::style:
+                detail::parseValue(value, &result->style);
+                break;
+            case Field::requestUsers:
+                result->requestUsers = parse<KeyboardButtonRequestUsers>(value);
+                break;
+            case Field::requestChat:
+                result->requestChat = parse<KeyboardButtonRequestChat>(value);
+                break;
+            case Field::requestManagedBot:
+                result->requestManagedBot = parse<KeyboardButtonRequestManagedBot>(value);
+                break;
+            case Field::requestContact:
+                detail::parseValue(value, &result->requestContact);
+                break;
+            case Field::requestLocation:
+                detail::parseValue(value, &result->requestLocation);
+                break;
+            case Field::requestPoll:
+                result->requestPoll = parse<KeyboardButtonPollType>(value);
+                break;
+            case Field::webApp:
+                result->webApp = parse<WebAppInfo>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -24,15 +78,15 @@ template <>
 nlohmann::json put(const std::shared_ptr<KeyboardButton> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("text", object->text);
         json.put("icon_custom_emoji_id", object->iconCustomEmojiId);
-        json.put("style", object->style);
-        json.put("request_users", object->requestUsers);
         json.put("request_chat", object->requestChat);
-        json.put("request_managed_bot", object->requestManagedBot);
         json.put("request_contact", object->requestContact);
         json.put("request_location", object->requestLocation);
+        json.put("request_managed_bot", object->requestManagedBot);
         json.put("request_poll", object->requestPoll);
+        json.put("request_users", object->requestUsers);
+        json.put("style", object->style);
+        json.put("text", object->text);
         json.put("web_app", object->webApp);
     }
     return json;
@@ -4,20 +4,78 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    requestId,
+    chatIsChannel,
+    chatIsForum,
+    chatHasUsername,
+    chatIsCreated,
+    userAdministratorRights,
+    botAdministratorRights,
+    botIsMember,
+    requestTitle,
+    requestUsername,
+    requestPhoto,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"request_id", Field::requestId},
+    {"chat_is_channel", Field::chatIsChannel},
+    {"chat_is_forum", Field::chatIsForum},
+    {"chat_has_username", Field::chatHasUsername},
+    {"chat_is_created", Field::chatIsCreated},
+    {"user_administrator_rights", Field::userAdministratorRights},
+    {"bot_administrator_rights", Field::botAdministratorRights},
+    {"bot_is_member", Field::botIsMember},
+    {"request_title", Field::requestTitle},
+    {"request_username", Field::requestUsername},
+    {"request_photo", Field::requestPhoto},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<KeyboardButtonRequestChat> parse(const nlohmann::json &data) {
     auto result = std::make_shared<KeyboardButtonRequestChat>();
-    parse(data, "request_id", &result->requestId);
-    parse(data, "chat_is_channel", &result->chatIsChannel);
-    parse(data, "chat_is_forum", &result->chatIsForum);
-    parse(data, "chat_has_username", &result->chatHasUsername);
-    parse(data, "chat_is_created", &result->chatIsCreated);
-    result->userAdministratorRights = parse<ChatAdministratorRights>(data, "user_administrator_rights");
-    result->botAdministratorRights = parse<ChatAdministratorRights>(data, "bot_administrator_rights");
-    parse(data, "bot_is_member", &result->botIsMember);
-    parse(data, "request_title", &result->requestTitle);
-    parse(data, "request_username", &result->requestUsername);
-    parse(data, "request_photo", &result->requestPhoto);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::requestId:
+                detail::parseValue(value, &result->requestId);
+                break;
+            case Field::chatIsChannel:
+                detail::parseValue(value, &result->chatIsChannel);
+                break;
+            case Field::chatIsForum:
+                detail::parseValue(value, &result->chatIsForum);
+                break;
+            case Field::chatHasUsername:
+                detail::parseValue(value, &result->chatHasUsername);
+                break;
+            case Field::chatIsCreated:
+                detail::parseValue(value, &result->chatIsCreated);
+                break;
+            case Field::userAdministratorRights:
+                result->userAdministratorRights = parse<ChatAdministratorRights>(value);
+                break;
+            case Field::botAdministratorRights:
+                result->botAdministratorRights = parse<ChatAdministratorRights>(value);
+                break;
+            case Field::botIsMember:
+                detail::parseValue(value, &result->botIsMember);
+                break;
+            case Field::requestTitle:
+                detail::parseValue(value, &result->requestTitle);
+                break;
+            case Field::requestUsername:
+                detail::parseValue(value, &result->requestUsername);
+                break;
+            case Field::requestPhoto:
+                detail::parseValue(value, &result->requestPhoto);
+                break;
+        }
+    });
     return result;
 }
 
@@ -25,17 +83,17 @@ template <>
 nlohmann::json put(const std::shared_ptr<KeyboardButtonRequestChat> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("request_id", object->requestId);
-        json.put("chat_is_channel", object->chatIsChannel);
-        json.put("chat_is_forum", object->chatIsForum);
-        json.put("chat_has_username", object->chatHasUsername);
-        json.put("chat_is_created", object->chatIsCreated);
-        json.put("user_administrator_rights", object->userAdministratorRights);
         json.put("bot_administrator_rights", object->botAdministratorRights);
         json.put("bot_is_member", object->botIsMember);
+        json.put("chat_has_username", object->chatHasUsername);
+        json.put("chat_is_channel", object->chatIsChannel);
+        json.put("chat_is_created", object->chatIsCreated);
+        json.put("chat_is_forum", object->chatIsForum);
+        json.put("request_id", object->requestId);
+        json.put("request_photo", object->requestPhoto);
         json.put("request_title", object->requestTitle);
         json.put("request_username", object->requestUsername);
-        json.put("request_photo", object->requestPhoto);
+        json.put("user_administrator_rights", object->userAdministratorRights);
     }
     return json;
 }
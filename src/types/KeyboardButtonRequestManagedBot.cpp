@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    requestId,
+    suggestedName,
+    suggestedUsername,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"request_id", Field::requestId},
+    {"suggested_name", Field::suggestedName},
+    {"suggested_username", Field::suggestedUsername},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<KeyboardButtonRequestManagedBot> parse(const nlohmann::json &data) {
     auto result = std::make_shared<KeyboardButtonRequestManagedBot>();
-    parse(data, "request_id", &result->requestId);
-    parse(data, "suggested_name", &result->suggestedName);
-    parse(data, "suggested_username", &result->suggestedUsername);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::requestId:
+                detail::parseValue(value, &result->requestId);
+                break;
+            case Field::suggestedName:
+                detail::parseValue(value, &result->suggestedName);
+                break;
+            case Field::suggestedUsername:
+                detail::parseValue(value, &result->suggestedUsername);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,16 +4,58 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    requestId,
+    userIsBot,
+    userIsPremium,
+    maxQuantity,
+    requestName,
+    requestUsername,
+    requestPhoto,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"request_id", Field::requestId},
+    {"user_is_bot", Field::userIsBot},
+    {"user_is_premium", Field::userIsPremium},
+    {"max_quantity", Field::maxQuantity},
+    {"request_name", Field::requestName},
+    {"request_username", Field::requestUsername},
+    {"request_photo", Field::requestPhoto},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<KeyboardButtonRequestUsers> parse(const nlohmann::json &data) {
     auto result = std::make_shared<KeyboardButtonRequestUsers>();
-    parse(data, "request_id", &result->requestId);
-    parse(data, "user_is_bot", &result->userIsBot);
-    parse(data, "user_is_premium", &result->userIsPremium);
-    parse(data, "max_quantity", &result->maxQuantity);
-    parse(data, "request_name", &result->requestName);
-    parse(data, "request_username", &result->requestUsername);
-    parse(data, "request_photo", &result->requestPhoto);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::requestId:
+                detail::parseValue(value, &result->requestId);
+                break;
+            case Field::userIsBot:
+                detail::parseValue(value, &result->userIsBot);
+                break;
+            case Field::userIsPremium:
+                detail::parseValue(value, &result->userIsPremium);
+                break;
+            case Field::maxQuantity:
+                detail::parseValue(value, &result->maxQuantity);
+                break;
+            case Field::requestName:
+                detail::parseValue(value, &result->requestName);
+                break;
+            case Field::requestUsername:
+                detail::parseValue(value, &result->requestUsername);
+                break;
+            case Field::requestPhoto:
+                detail::parseValue(value, &result->requestPhoto);
+                break;
+        }
+    });
     return result;
 }
 
@@ -21,13 +63,13 @@ template <>
 nlohmann::json put(const std::shared_ptr<KeyboardButtonRequestUsers> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("request_id", object->requestId);
-        json.put("user_is_bot", object->userIsBot);
-        json.put("user_is_premium", object->userIsPremium);
         json.put("max_quantity", object->maxQuantity);
+        json.put("request_id", object->requestId);
         json.put("request_name", object->requestName);
-        json.put("request_username", object->requestUsername);
         json.put("request_photo", object->requestPhoto);
+        json.put("request_username", object->requestUsername);
+        json.put("user_is_bot", object->userIsBot);
+        json.put("user_is_premium", object->userIsPremium);
     }
     return json;
 }
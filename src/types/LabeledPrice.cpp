@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    label,
+    amount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"label", Field::label},
+    {"amount", Field::amount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<LabeledPrice> parse(const nlohmann::json &data) {
     auto result = std::make_shared<LabeledPrice>();
-    parse(data, "label", &result->label);
-    parse(data, "amount", &result->amount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::label:
+                detail::parseValue(value, &result->label);
+                break;
+            case Field::amount:
+                detail::parseValue(value, &result->amount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<LabeledPrice> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("label", object->label);
         json.put("amount", object->amount);
+        json.put("label", object->label);
     }
     return json;
 }
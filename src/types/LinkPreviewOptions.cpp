@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    isDisabled,
+    url,
+    preferSmallMedia,
+    preferLargeMedia,
+    showAboveText,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"is_disabled", Field::isDisabled},
+    {"url", Field::url},
+    {"prefer_small_media", Field::preferSmallMedia},
+    {"prefer_large_media", Field::preferLargeMedia},
+    {"show_above_text", Field::showAboveText},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<LinkPreviewOptions> parse(const nlohmann::json &data) {
     auto result = std::make_shared<LinkPreviewOptions>();
-    parse(data, "is_disabled", &result->isDisabled);
-    parse(data, "url", &result->url);
-    parse(data, "prefer_small_media", &result->preferSmallMedia);
-    parse(data, "prefer_large_media", &result->preferLargeMedia);
-    parse(data, "show_above_text", &result->showAboveText);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::isDisabled:
+                detail::parseValue(value, &result->isDisabled);
+                break;
+            case Field::url:
+                detail::parseValue(value, &result->url);
+                break;
+            case Field::preferSmallMedia:
+                detail::parseValue(value, &result->preferSmallMedia);
+                break;
+            case Field::preferLargeMedia:
+                detail::parseValue(value, &result->preferLargeMedia);
+                break;
+            case Field::showAboveText:
+                detail::parseValue(value, &result->showAboveText);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,10 +54,10 @@ nlohmann::json put(const std::shared_ptr<LinkPreviewOptions> &object) {
     JsonWrapper json;
     if (object) {
         json.put("is_disabled", object->isDisabled);
-        json.put("url", object->url);
-        json.put("prefer_small_media", object->preferSmallMedia);
         json.put("prefer_large_media", object->preferLargeMedia);
+        json.put("prefer_small_media", object->preferSmallMedia);
         json.put("show_above_text", object->showAboveText);
+        json.put("url", object->url);
     }
     return json;
 }
@@ -4,17 +4,63 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    photo,
+    fileId,
+    fileUniqueId,
+    width,
+    height,
+    duration,
+    mimeType,
+    fileSize,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"photo", Field::photo},
+    {"file_id", Field::fileId},
+    {"file_unique_id", Field::fileUniqueId},
+    {"width", Field::width},
+    {"height", Field::height},
+    {"duration", Field::duration},
+    {"mime_type", Field::mimeType},
+    {"file_size", Field::fileSize},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<LivePhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<LivePhoto>();
-    result->photo = parseArray<PhotoSize>(data, "photo");
-    parse(data, "file_id", &result->fileId);
-    parse(data, "file_unique_id", &result->fileUniqueId);
-    parse(data, "width", &result->width);
-    parse(data, "height", &result->height);
-    parse(data, "duration", &result->duration);
-    parse(data, "mime_type", &result->mimeType);
-    parse(data, "file_size", &result->fileSize);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::photo:
+                result->photo = parseArray<PhotoSize>(value);
+                break;
+            case Field::fileId:
+                detail::parseValue(value, &result->fileId);
+                break;
+            case Field::fileUniqueId:
+                detail::parseValue(value, &result->fileUniqueId);
+                break;
+            case Field::width:
+                detail::parseValue(value, &result->width);
+                break;
+            case Field::height:
+                detail::parseValue(value, &result->height);
+                break;
+            case Field::duration:
+                detail::parseValue(value, &result->duration);
+                break;
+            case Field::mimeType:
+                detail::parseValue(value, &result->mimeType);
+                break;
+            case Field::fileSize:
+                detail::parseValue(value, &result->fileSize);
+                break;
+        }
+    });
     return result;
 }
 
@@ -22,14 +68,14 @@ template <>
 nlohmann::json put(const std::shared_ptr<LivePhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("photo", object->photo);
+        json.put("duration", object->duration);
         json.put("file_id", object->fileId);
+        json.put("file_size", object->fileSize);
         json.put("file_unique_id", object->fileUniqueId);
-        json.put("width", object->width);
         json.put("height", object->height);
-        json.put("duration", object->duration);
         json.put("mime_type", object->mimeType);
-        json.put("file_size", object->fileSize);
+        json.put("photo", object->photo);
+        json.put("width", object->width);
     }
     return json;
 }
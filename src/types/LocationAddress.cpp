@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    countryCode,
+    state,
+    city,
+    street,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"country_code", Field::countryCode},
+    {"state", Field::state},
+    {"city", Field::city},
+    {"street", Field::street},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<LocationAddress> parse(const nlohmann::json &data) {
     auto result = std::make_shared<LocationAddress>();
-    parse(data, "country_code", &result->countryCode);
-    parse(data, "state", &result->state);
-    parse(data, "city", &result->city);
-    parse(data, "street", &result->street);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::countryCode:
+                detail::parseValue(value, &result->countryCode);
+                break;
+            case Field::state:
+                detail::parseValue(value, &result->state);
+                break;
+            case Field::city:
+                detail::parseValue(value, &result->city);
+                break;
+            case Field::street:
+                detail::parseValue(value, &result->street);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,9 +48,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<LocationAddress> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("city", object->city);
         json.put("country_code", object->countryCode);
         json.put("state", object->state);
-        json.put("city", object->city);
         json.put("street", object->street);
     }
     return json;
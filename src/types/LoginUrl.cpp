@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    url,
+    forwardText,
+    botUsername,
+    requestWriteAccess,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"url", Field::url},
+    {"forward_text", Field::forwardText},
+    {"bot_username", Field::botUsername},
+    {"request_write_access", Field::requestWriteAccess},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<LoginUrl> parse(const nlohmann::json &data) {
     auto result = std::make_shared<LoginUrl>();
-    parse(data, "url", &result->url);
-    parse(data, "forward_text", &result->forwardText);
-    parse(data, "bot_username", &result->botUsername);
-    parse(data, "request_write_access", &result->requestWriteAccess);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::url:
+                detail::parseValue(value, &result->url);
+                break;
+            case Field::forwardText:
+                detail::parseValue(value, &result->forwardText);
+                break;
+            case Field::botUsername:
+                detail::parseValue(value, &result->botUsername);
+                break;
+            case Field::requestWriteAccess:
+                detail::parseValue(value, &result->requestWriteAccess);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<LoginUrl> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("url", object->url);
-        json.put("forward_text", object->forwardText);
         json.put("bot_username", object->botUsername);
+        json.put("forward_text", object->forwardText);
         json.put("request_write_access", object->requestWriteAccess);
+        json.put("url", object->url);
     }
     return json;
 }
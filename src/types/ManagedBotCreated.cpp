@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    bot,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"bot", Field::bot},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ManagedBotCreated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ManagedBotCreated>();
-    result->bot = parseRequired<User>(data, "bot");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::bot:
+                result->bot = parse<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
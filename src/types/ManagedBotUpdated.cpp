@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    user,
+    bot,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"user", Field::user},
+    {"bot", Field::bot},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ManagedBotUpdated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ManagedBotUpdated>();
-    result->user = parseRequired<User>(data, "user");
-    result->bot = parseRequired<User>(data, "bot");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::bot:
+                result->bot = parse<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ManagedBotUpdated> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("user", object->user);
         json.put("bot", object->bot);
+        json.put("user", object->user);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    point,
+    xShift,
+    yShift,
+    scale,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"point", Field::point},
+    {"x_shift", Field::xShift},
+    {"y_shift", Field::yShift},
+    {"scale", Field::scale},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MaskPosition> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MaskPosition>();
-    parse(data, "point", &result->point);
-    parse(data, "x_shift", &result->xShift);
-    parse(data, "y_shift", &result->yShift);
-    parse(data, "scale", &result->scale);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::point:
+                detail::parseValue(value, &result->point);
+                break;
+            case Field::xShift:
+                detail::parseValue(value, &result->xShift);
+                break;
+            case Field::yShift:
+                detail::parseValue(value, &result->yShift);
+                break;
+            case Field::scale:
+                detail::parseValue(value, &result->scale);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,9 +49,9 @@ nlohmann::json put(const std::shared_ptr<MaskPosition> &object) {
     JsonWrapper json;
     if (object) {
         json.put("point", object->point);
+        json.put("scale", object->scale);
         json.put("x_shift", object->xShift);
         json.put("y_shift", object->yShift);
-        json.put("scale", object->scale);
     }
     return json;
 }
@@ -7,38 +7,26 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<MenuButton>>({
+    {"commands", detail::subtype<MenuButton, MenuButtonCommands>()},
+    {"web_app", detail::subtype<MenuButton, MenuButtonWebApp>()},
+    {"default", detail::subtype<MenuButton, MenuButtonDefault>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MenuButton> parse(const nlohmann::json &data) {
-    std::string type;
-    MenuButton::Ptr result;
-    parse(data, "type", &type);
-    if (type == "commands") {
-        result = parse<MenuButtonCommands>(data);
-    } else if (type == "web_app") {
-        result = parse<MenuButtonWebApp>(data);
-    } else if (type == "default") {
-        result = parse<MenuButtonDefault>(data);
-    } else {
-        throw invalidType("MenuButton", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "MenuButton");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<MenuButton> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "commands") {
-            json += put<MenuButtonCommands>(object);
-        } else if (object->type == "web_app") {
-            json += put<MenuButtonWebApp>(object);
-        } else if (object->type == "default") {
-            json += put<MenuButtonDefault>(object);
-        } else {
-            throw invalidType("MenuButton", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "MenuButton");
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    webApp,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"web_app", Field::webApp},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MenuButtonWebApp> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MenuButtonWebApp>();
-    parse(data, "type", &result->type);
-    parse(data, "text", &result->text);
-    result->webApp = parseRequired<WebAppInfo>(data, "web_app");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::webApp:
+                result->webApp = parse<WebAppInfo>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,8 +43,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<MenuButtonWebApp> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("text", object->text);
+        json.put("type", object->type);
         json.put("web_app", object->webApp);
     }
     return json;
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    messageAutoDeleteTime,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"message_auto_delete_time", Field::messageAutoDeleteTime},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MessageAutoDeleteTimerChanged> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MessageAutoDeleteTimerChanged>();
-    parse(data, "message_auto_delete_time", &result->messageAutoDeleteTime);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::messageAutoDeleteTime:
+                detail::parseValue(value, &result->messageAutoDeleteTime);
+                break;
+        }
+    });
     return result;
 }
 
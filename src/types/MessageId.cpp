@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    messageId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"message_id", Field::messageId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MessageId> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MessageId>();
-    parse(data, "message_id", &result->messageId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::messageId:
+                detail::parseValue(value, &result->messageId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -8,42 +8,27 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<MessageOrigin>>({
+    {"user", detail::subtype<MessageOrigin, MessageOriginUser>()},
+    {"hidden_user", detail::subtype<MessageOrigin, MessageOriginHiddenUser>()},
+    {"chat", detail::subtype<MessageOrigin, MessageOriginChat>()},
+    {"channel", detail::subtype<MessageOrigin, MessageOriginChannel>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MessageOrigin> parse(const nlohmann::json &data) {
-    std::string type;
-    MessageOrigin::Ptr result;
-    parse(data, "type", &type);
-    if (type == "user") {
-        result = parse<MessageOriginUser>(data);
-    } else if (type == "hidden_user") {
-        result = parse<MessageOriginHiddenUser>(data);
-    } else if (type == "chat") {
-        result = parse<MessageOriginChat>(data);
-    } else if (type == "channel") {
-        result = parse<MessageOriginChannel>(data);
-    } else {
-        throw invalidType("MessageOrigin", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "MessageOrigin");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<MessageOrigin> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "user") {
-            json += put<MessageOriginUser>(object);
-        } else if (object->type == "hidden_user") {
-            json += put<MessageOriginHiddenUser>(object);
-        } else if (object->type == "chat") {
-            json += put<MessageOriginChat>(object);
-        } else if (object->type == "channel") {
-            json += put<MessageOriginChannel>(object);
-        } else {
-            throw invalidType("MessageOrigin", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "MessageOrigin");
     }
     return json;
 }
@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    date,
+    chat,
+    messageId,
+    authorSignature,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"date", Field::date},
+    {"chat", Field::chat},
+    {"message_id", Field::messageId},
+    {"author_signature", Field::authorSignature},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MessageOriginChannel> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MessageOriginChannel>();
-    parse(data, "type", &result->type);
-    parse(data, "date", &result->date);
-    result->chat = parseRequired<Chat>(data, "chat");
-    parse(data, "message_id", &result->messageId);
-    parse(data, "author_signature", &result->authorSignature);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::messageId:
+                detail::parseValue(value, &result->messageId);
+                break;
+            case Field::authorSignature:
+                detail::parseValue(value, &result->authorSignature);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<MessageOriginChannel> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("date", object->date);
+        json.put("author_signature", object->authorSignature);
         json.put("chat", object->chat);
+        json.put("date", object->date);
         json.put("message_id", object->messageId);
-        json.put("author_signature", object->authorSignature);
+        json.put("type", object->type);
     }
     return json;
 }
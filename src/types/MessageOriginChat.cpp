@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    date,
+    senderChat,
+    authorSignature,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"date", Field::date},
+    {"sender_chat", Field::senderChat},
+    {"author_signature", Field::authorSignature},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MessageOriginChat> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MessageOriginChat>();
-    parse(data, "type", &result->type);
-    parse(data, "date", &result->date);
-    result->senderChat = parseRequired<Chat>(data, "sender_chat");
-    parse(data, "author_signature", &result->authorSignature);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::senderChat:
+                result->senderChat = parse<Chat>(value);
+                break;
+            case Field::authorSignature:
+                detail::parseValue(value, &result->authorSignature);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<MessageOriginChat> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("author_signature", object->authorSignature);
         json.put("date", object->date);
         json.put("sender_chat", object->senderChat);
-        json.put("author_signature", object->authorSignature);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    date,
+    senderUserName,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"date", Field::date},
+    {"sender_user_name", Field::senderUserName},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MessageOriginHiddenUser> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MessageOriginHiddenUser>();
-    parse(data, "type", &result->type);
-    parse(data, "date", &result->date);
-    parse(data, "sender_user_name", &result->senderUserName);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::senderUserName:
+                detail::parseValue(value, &result->senderUserName);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<MessageOriginHiddenUser> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("date", object->date);
         json.put("sender_user_name", object->senderUserName);
+        json.put("type", object->type);
     }
     return json;
 }
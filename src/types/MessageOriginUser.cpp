@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    date,
+    senderUser,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"date", Field::date},
+    {"sender_user", Field::senderUser},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MessageOriginUser> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MessageOriginUser>();
-    parse(data, "type", &result->type);
-    parse(data, "date", &result->date);
-    result->senderUser = parseRequired<User>(data, "sender_user");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::senderUser:
+                result->senderUser = parse<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<MessageOriginUser> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("date", object->date);
         json.put("sender_user", object->senderUser);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chat,
+    messageId,
+    date,
+    reactions,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chat", Field::chat},
+    {"message_id", Field::messageId},
+    {"date", Field::date},
+    {"reactions", Field::reactions},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MessageReactionCountUpdated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MessageReactionCountUpdated>();
-    result->chat = parseRequired<Chat>(data, "chat");
-    parse(data, "message_id", &result->messageId);
-    parse(data, "date", &result->date);
-    result->reactions = parseRequiredArray<ReactionCount>(data, "reactions");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::messageId:
+                detail::parseValue(value, &result->messageId);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::reactions:
+                result->reactions = parseArray<ReactionCount>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,8 +49,8 @@ nlohmann::json put(const std::shared_ptr<MessageReactionCountUpdated> &object) {
     JsonWrapper json;
     if (object) {
         json.put("chat", object->chat);
-        json.put("message_id", object->messageId);
         json.put("date", object->date);
+        json.put("message_id", object->messageId);
         json.put("reactions", object->reactions);
     }
     return json;
@@ -4,16 +4,58 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chat,
+    messageId,
+    user,
+    actorChat,
+    date,
+    oldReaction,
+    newReaction,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chat", Field::chat},
+    {"message_id", Field::messageId},
+    {"user", Field::user},
+    {"actor_chat", Field::actorChat},
+    {"date", Field::date},
+    {"old_reaction", Field::oldReaction},
+    {"new_reaction", Field::newReaction},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<MessageReactionUpdated> parse(const nlohmann::json &data) {
     auto result = std::make_shared<MessageReactionUpdated>();
-    result->chat = parseRequired<Chat>(data, "chat");
-    parse(data, "message_id", &result->messageId);
-    result->user = parse<User>(data, "user");
-    result->actorChat = parse<Chat>(data, "actor_chat");
-    parse(data, "date", &result->date);
-    result->oldReaction = parseRequiredArray<ReactionType>(data, "old_reaction");
-    result->newReaction = parseRequiredArray<ReactionType>(data, "new_reaction");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::messageId:
+                detail::parseValue(value, &result->messageId);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::actorChat:
+                result->actorChat = parse<Chat>(value);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::oldReaction:
+                result->oldReaction = parseArray<ReactionType>(value);
+                break;
+            case Field::newReaction:
+                result->newReaction = parseArray<ReactionType>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -21,13 +63,13 @@ template <>
 nlohmann::json put(const std::shared_ptr<MessageReactionUpdated> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("chat", object->chat);
-        json.put("message_id", object->messageId);
-        json.put("user", object->user);
         json.put("actor_chat", object->actorChat);
+        json.put("chat", object->chat);
         json.put("date", object->date);
-        json.put("old_reaction", object->oldReaction);
+        json.put("message_id", object->messageId);
         json.put("new_reaction", object->newReaction);
+        json.put("old_reaction", object->oldReaction);
+        json.put("user", object->user);
     }
     return json;
 }
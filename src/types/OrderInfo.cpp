@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    name,
+    phoneNumber,
+    email,
+    shippingAddress,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"name", Field::name},
+    {"phone_number", Field::phoneNumber},
+    {"email", Field::email},
+    {"shipping_address", Field::shippingAddress},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<OrderInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<OrderInfo>();
-    parse(data, "name", &result->name);
-    parse(data, "phone_number", &result->phoneNumber);
-    parse(data, "email", &result->email);
-    result->shippingAddress = parse<ShippingAddress>(data, "shipping_address");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+            case Field::phoneNumber:
+                detail::parseValue(value, &result->phoneNumber);
+                break;
+            case Field::email:
+                detail::parseValue(value, &result->email);
+                break;
+            case Field::shippingAddress:
+                result->shippingAddress = parse<ShippingAddress>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,9 +48,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<OrderInfo> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("email", object->email);
         json.put("name", object->name);
         json.put("phone_number", object->phoneNumber);
-        json.put("email", object->email);
         json.put("shipping_address", object->shippingAddress);
     }
     return json;
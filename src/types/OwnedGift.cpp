@@ -6,34 +6,25 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<OwnedGift>>({
+    {"regular", detail::subtype<OwnedGift, OwnedGiftRegular>()},
+    {"unique", detail::subtype<OwnedGift, OwnedGiftUnique>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<OwnedGift> parse(const nlohmann::json &data) {
-    std::string type;
-    OwnedGift::Ptr result;
-    parse(data, "type", &type);
-    if (type == "regular") {
-        result = parse<OwnedGiftRegular>(data);
-    } else if (type == "unique") {
-        result = parse<OwnedGiftUnique>(data);
-    } else {
-        throw invalidType("OwnedGift", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "OwnedGift");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<OwnedGift> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "regular") {
-            json += put<OwnedGiftRegular>(object);
-        } else if (object->type == "unique") {
-            json += put<OwnedGiftUnique>(object);
-        } else {
-            throw invalidType("OwnedGift", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "OwnedGift");
     }
     return json;
 }
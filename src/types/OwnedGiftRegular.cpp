@@ -4,24 +4,98 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    gift,
+    ownedGiftId,
+    senderUser,
+    sendDate,
+    text,
+    entities,
+    isPrivate,
+    isSaved,
+    canBeUpgraded,
+    wasRefunded,
+    convertStarCount,
+    prepaidUpgradeStarCount,
+    isUpgradeSeparate,
+    uniqueGiftNumber,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"gift", Field::gift},
+    {"owned_gift_id", Field::ownedGiftId},
+    {"sender_user", Field::senderUser},
+    {"send_date", Field::sendDate},
+    {"text", Field::text},
+    {"entities", Field::entities},
+    {"is_private", Field::isPrivate},
+    {"is_saved", Field::isSaved},
+    {"can_be_upgraded", Field::canBeUpgraded},
+    {"was_refunded", Field::wasRefunded},
+    {"convert_star_count", Field::convertStarCount},
+    {"prepaid_upgrade_star_count", Field::prepaidUpgradeStarCount},
+    {"is_upgrade_separate", Field::isUpgradeSeparate},
+    {"unique_gift_number", Field::uniqueGiftNumber},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<OwnedGiftRegular> parse(const nlohmann::json &data) {
     auto result = std::make_shared<OwnedGiftRegular>();
-    parse(data, "type", &result->type);
-    result->gift = parseRequired<Gift>(data, "gift");
-    parse(data, "owned_gift_id", &result->ownedGiftId);
-    result->senderUser = parse<User>(data, "sender_user");
-    parse(data, "send_date", &result->sendDate);
-    parse(data, "text", &result->text);
-    result->entities = parseArray<MessageEntity>(data, "entities");
-    parse(data, "is_private", &result->isPrivate);
-    parse(data, "is_saved", &result->isSaved);
-    parse(data, "can_be_upgraded", &result->canBeUpgraded);
-    parse(data, "was_refunded", &result->wasRefunded);
-    parse(data, "convert_star_count", &result->convertStarCount);
-    parse(data, "prepaid_upgrade_star_count", &result->prepaidUpgradeStarCount);
-    parse(data, "is_upgrade_separate", &result->isUpgradeSeparate);
-    parse(data, "unique_gift_number", &result->uniqueGiftNumber);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::gift:
+                result->gift = parse<Gift>(value);
+                break;
+            case Field::ownedGiftId:
+                detail::parseValue(value, &result->ownedGiftId);
+                break;
+            case Field::senderUser:
+                result->senderUser = parse<User>(value);
+                break;
+            case Field::sendDate:
+                detail::parseValue(value, &result->sendDate);
+                break;
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::entities:
+                result->entities = parseArray<MessageEntity>(value);
+                break;
+            case Field::isPrivate:
+                detail::parseValue(value, &result->isPrivate);
+                break;
+            case Field::isSaved:
+                detail::parseValue(value, &result->isSaved);
+                break;
+            case Field::canBeUpgraded:
+                detail::parseValue(value, &result->canBeUpgraded);
+                break;
+            case Field::wasRefunded:
+                detail::parseValue(value, &result->wasRefunded);
+                break;
+            case Field::convertStarCount:
+                detail::parseValue(value, &result->convertStarCount);
+                break;
+            case Field::prepaidUpgradeStarCount:
+                detail::parseValue(value, &result->prepaidUpgradeStarCount);
+                break;
+            case Field::isUpgradeSeparate:
+                detail::parseValue(value, &result->isUpgradeSeparate);
+                break;
+            case Field::uniqueGiftNumber:
+                detail::parseValue(value, &result->uniqueGiftNumber);
+                break;
+        }
+    });
     return result;
 }
 
@@ -29,21 +103,21 @@ template <>
 nlohmann::json put(const std::shared_ptr<OwnedGiftRegular> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("gift", object->gift);
-        json.put("owned_gift_id", object->ownedGiftId);
-        json.put("sender_user", object->senderUser);
-        json.put("send_date", object->sendDate);
-        json.put("text", object->text);
+        json.put("can_be_upgraded", object->canBeUpgraded);
+        json.put("convert_star_count", object->convertStarCount);
         json.put("entities", object->entities);
+        json.put("gift", object->gift);
         json.put("is_private", object->isPrivate);
         json.put("is_saved", object->isSaved);
-        json.put("can_be_upgraded", object->canBeUpgraded);
-        json.put("was_refunded", object->wasRefunded);
-        json.put("convert_star_count", object->convertStarCount);
-        json.put("prepaid_upgrade_star_count", object->prepaidUpgradeStarCount);
         json.put("is_upgrade_separate", object->isUpgradeSeparate);
+        json.put("owned_gift_id", object->ownedGiftId);
+        json.put("prepaid_upgrade_star_count", object->prepaidUpgradeStarCount);
+        json.put("send_date", object->sendDate);
+        json.put("sender_user", object->senderUser);
+        json.put("text", object->text);
+        json.put("type", object->type);
         json.put("unique_gift_number", object->uniqueGiftNumber);
+        json.put("was_refunded", object->wasRefunded);
     }
     return json;
 }
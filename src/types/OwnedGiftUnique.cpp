@@ -4,18 +4,68 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    gift,
+    ownedGiftId,
+    senderUser,
+    sendDate,
+    isSaved,
+    canBeTransferred,
+    transferStarCount,
+    nextTransferDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"gift", Field::gift},
+    {"owned_gift_id", Field::ownedGiftId},
+    {"sender_user", Field::senderUser},
+    {"send_date", Field::sendDate},
+    {"is_saved", Field::isSaved},
+    {"can_be_transferred", Field::canBeTransferred},
+    {"transfer_star_count", Field::transferStarCount},
+    {"next_transfer_date", Field::nextTransferDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<OwnedGiftUnique> parse(const nlohmann::json &data) {
     auto result = std::make_shared<OwnedGiftUnique>();
-    parse(data, "type", &result->type);
-    result->gift = parseRequired<UniqueGift>(data, "gift");
-    parse(data, "owned_gift_id", &result->ownedGiftId);
-    result->senderUser = parse<User>(data, "sender_user");
-    parse(data, "send_date", &result->sendDate);
-    parse(data, "is_saved", &result->isSaved);
-    parse(data, "can_be_transferred", &result->canBeTransferred);
-    parse(data, "transfer_star_count", &result->transferStarCount);
-    parse(data, "next_transfer_date", &result->nextTransferDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::gift:
+                result->gift = parse<UniqueGift>(value);
+                break;
+            case Field::ownedGiftId:
+                detail::parseValue(value, &result->ownedGiftId);
+                break;
+            case Field::senderUser:
+                result->senderUser = parse<User>(value);
+                break;
+            case Field::sendDate:
+                detail::parseValue(value, &result->sendDate);
+                break;
+            case Field::isSaved:
+                detail::parseValue(value, &result->isSaved);
+                break;
+            case Field::canBeTransferred:
+                detail::parseValue(value, &result->canBeTransferred);
+                break;
+            case Field::transferStarCount:
+                detail::parseValue(value, &result->transferStarCount);
+                break;
+            case Field::nextTransferDate:
+                detail::parseValue(value, &result->nextTransferDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -23,15 +73,15 @@ template <>
 nlohmann::json put(const std::shared_ptr<OwnedGiftUnique> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("can_be_transferred", object->canBeTransferred);
         json.put("gift", object->gift);
+        json.put("is_saved", object->isSaved);
+        json.put("next_transfer_date", object->nextTransferDate);
         json.put("owned_gift_id", object->ownedGiftId);
-        json.put("sender_user", object->senderUser);
         json.put("send_date", object->sendDate);
-        json.put("is_saved", object->isSaved);
-        json.put("can_be_transferred", object->canBeTransferred);
+        json.put("sender_user", object->senderUser);
         json.put("transfer_star_count", object->transferStarCount);
-        json.put("next_transfer_date", object->nextTransferDate);
+        json.put("type", object->type);
     }
     return json;
 }
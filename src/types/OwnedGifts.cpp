@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    totalCount,
+    gifts,
+    nextOffset,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"total_count", Field::totalCount},
+    {"gifts", Field::gifts},
+    {"next_offset", Field::nextOffset},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<OwnedGifts> parse(const nlohmann::json &data) {
     auto result = std::make_shared<OwnedGifts>();
-    parse(data, "total_count", &result->totalCount);
-    result->gifts = parseRequiredArray<OwnedGift>(data, "gifts");
-    parse(data, "next_offset", &result->nextOffset);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::totalCount:
+                detail::parseValue(value, &result->totalCount);
+                break;
+            case Field::gifts:
+                result->gifts = parseArray<OwnedGift>(value);
+                break;
+            case Field::nextOffset:
+                detail::parseValue(value, &result->nextOffset);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<OwnedGifts> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("total_count", object->totalCount);
         json.put("gifts", object->gifts);
         json.put("next_offset", object->nextOffset);
+        json.put("total_count", object->totalCount);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    starCount,
+    paidMedia,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"star_count", Field::starCount},
+    {"paid_media", Field::paidMedia},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PaidMediaInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PaidMediaInfo>();
-    parse(data, "star_count", &result->starCount);
-    result->paidMedia = parseRequiredArray<PaidMedia>(data, "paid_media");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::starCount:
+                detail::parseValue(value, &result->starCount);
+                break;
+            case Field::paidMedia:
+                result->paidMedia = parseArray<PaidMedia>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<PaidMediaInfo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("star_count", object->starCount);
         json.put("paid_media", object->paidMedia);
+        json.put("star_count", object->starCount);
     }
     return json;
 }
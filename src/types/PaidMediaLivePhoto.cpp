@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    livePhoto,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"live_photo", Field::livePhoto},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PaidMediaLivePhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PaidMediaLivePhoto>();
-    parse(data, "type", &result->type);
-    result->livePhoto = parseRequired<LivePhoto>(data, "live_photo");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::livePhoto:
+                result->livePhoto = parse<LivePhoto>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<PaidMediaLivePhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("live_photo", object->livePhoto);
+        json.put("type", object->type);
     }
     return json;
 }
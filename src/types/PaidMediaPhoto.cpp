@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    photo,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"photo", Field::photo},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PaidMediaPhoto> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PaidMediaPhoto>();
-    parse(data, "type", &result->type);
-    result->photo = parseRequiredArray<PhotoSize>(data, "photo");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::photo:
+                result->photo = parseArray<PhotoSize>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<PaidMediaPhoto> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("photo", object->photo);
+        json.put("type", object->type);
     }
     return json;
 }
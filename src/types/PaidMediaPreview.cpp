@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    width,
+    height,
+    duration,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"width", Field::width},
+    {"height", Field::height},
+    {"duration", Field::duration},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PaidMediaPreview> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PaidMediaPreview>();
-    parse(data, "type", &result->type);
-    parse(data, "width", &result->width);
-    parse(data, "height", &result->height);
-    parse(data, "duration", &result->duration);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::width:
+                detail::parseValue(value, &result->width);
+                break;
+            case Field::height:
+                detail::parseValue(value, &result->height);
+                break;
+            case Field::duration:
+                detail::parseValue(value, &result->duration);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<PaidMediaPreview> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("duration", object->duration);
+        json.put("height", object->height);
         json.put("type", object->type);
         json.put("width", object->width);
-        json.put("height", object->height);
-        json.put("duration", object->duration);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    from,
+    paidMediaPayload,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"from", Field::from},
+    {"paid_media_payload", Field::paidMediaPayload},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PaidMediaPurchased> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PaidMediaPurchased>();
-    result->from = parseRequired<User>(data, "from");
-    parse(data, "paid_media_payload", &result->paidMediaPayload);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::from:
+                result->from = parse<User>(value);
+                break;
+            case Field::paidMediaPayload:
+                detail::parseValue(value, &result->paidMediaPayload);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    video,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"video", Field::video},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PaidMediaVideo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PaidMediaVideo>();
-    parse(data, "type", &result->type);
-    result->video = parseRequired<Video>(data, "video");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::video:
+                result->video = parse<Video>(value);
+                break;
+        }
+    });
     return result;
 }
 
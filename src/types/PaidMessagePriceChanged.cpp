@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    paidMessageStarCount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"paid_message_star_count", Field::paidMessageStarCount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PaidMessagePriceChanged> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PaidMessagePriceChanged>();
-    parse(data, "paid_message_star_count", &result->paidMessageStarCount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::paidMessageStarCount:
+                detail::parseValue(value, &result->paidMessageStarCount);
+                break;
+        }
+    });
     return result;
 }
 
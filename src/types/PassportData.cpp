@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    data,
+    credentials,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"data", Field::data},
+    {"credentials", Field::credentials},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PassportData> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PassportData>();
-    result->data = parseRequiredArray<EncryptedPassportElement>(data, "data");
-    result->credentials = parseRequired<EncryptedCredentials>(data, "credentials");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::data:
+                result->data = parseArray<EncryptedPassportElement>(value);
+                break;
+            case Field::credentials:
+                result->credentials = parse<EncryptedCredentials>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<PassportData> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("data", object->data);
         json.put("credentials", object->credentials);
+        json.put("data", object->data);
     }
     return json;
 }
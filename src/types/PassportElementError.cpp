@@ -13,62 +13,32 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<PassportElementError>>({
+    {"data", detail::subtype<PassportElementError, PassportElementErrorDataField>()},
+    {"front_side", detail::subtype<PassportElementError, PassportElementErrorFrontSide>()},
+    {"reverse_side", detail::subtype<PassportElementError, PassportElementErrorReverseSide>()},
+    {"selfie", detail::subtype<PassportElementError, PassportElementErrorSelfie>()},
+    {"file", detail::subtype<PassportElementError, PassportElementErrorFile>()},
+    {"files", detail::subtype<PassportElementError, PassportElementErrorFiles>()},
+    {"translation_file", detail::subtype<PassportElementError, PassportElementErrorTranslationFile>()},
+    {"translation_files", detail::subtype<PassportElementError, PassportElementErrorTranslationFiles>()},
+    {"unspecified", detail::subtype<PassportElementError, PassportElementErrorUnspecified>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PassportElementError> parse(const nlohmann::json &data) {
-    std::string type;
-    PassportElementError::Ptr result;
-    parse(data, "source", &type);
-    if (type == "data") {
-        result = parse<PassportElementErrorDataField>(data);
-    } else if (type == "front_side") {
-        result = parse<PassportElementErrorFrontSide>(data);
-    } else if (type == "reverse_side") {
-        result = parse<PassportElementErrorReverseSide>(data);
-    } else if (type == "selfie") {
-        result = parse<PassportElementErrorSelfie>(data);
-    } else if (type == "file") {
-        result = parse<PassportElementErrorFile>(data);
-    } else if (type == "files") {
-        result = parse<PassportElementErrorFiles>(data);
-    } else if (type == "translation_file") {
-        result = parse<PassportElementErrorTranslationFile>(data);
-    } else if (type == "translation_files") {
-        result = parse<PassportElementErrorTranslationFiles>(data);
-    } else if (type == "unspecified") {
-        result = parse<PassportElementErrorUnspecified>(data);
-    } else {
-        throw invalidType("PassportElementError", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "source", subtypes, "PassportElementError");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<PassportElementError> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("source", object->source);
-        if (object->source == "data") {
-            json += put<PassportElementErrorDataField>(object);
-        } else if (object->source == "front_side") {
-            json += put<PassportElementErrorFrontSide>(object);
-        } else if (object->source == "reverse_side") {
-            json += put<PassportElementErrorReverseSide>(object);
-        } else if (object->source == "selfie") {
-            json += put<PassportElementErrorSelfie>(object);
-        } else if (object->source == "file") {
-            json += put<PassportElementErrorFile>(object);
-        } else if (object->source == "files") {
-            json += put<PassportElementErrorFiles>(object);
-        } else if (object->source == "translation_file") {
-            json += put<PassportElementErrorTranslationFile>(object);
-        } else if (object->source == "translation_files") {
-            json += put<PassportElementErrorTranslationFiles>(object);
-        } else if (object->source == "unspecified") {
-            json += put<PassportElementErrorUnspecified>(object);
-        } else {
-            throw invalidType("PassportElementError", object->source);
-        }
+        json = detail::putSubtype(object, object->source, subtypes, "PassportElementError");
     }
     return json;
 }
@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    source,
+    type,
+    fieldName,
+    dataHash,
+    message,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"source", Field::source},
+    {"type", Field::type},
+    {"field_name", Field::fieldName},
+    {"data_hash", Field::dataHash},
+    {"message", Field::message},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PassportElementErrorDataField> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PassportElementErrorDataField>();
-    parse(data, "source", &result->source);
-    parse(data, "type", &result->type);
-    parse(data, "field_name", &result->fieldName);
-    parse(data, "data_hash", &result->dataHash);
-    parse(data, "message", &result->message);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::source:
+                detail::parseValue(value, &result->source);
+                break;
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::fieldName:
+                detail::parseValue(value, &result->fieldName);
+                break;
+            case Field::dataHash:
+                detail::parseValue(value, &result->dataHash);
+                break;
+            case Field::message:
+                detail::parseValue(value, &result->message);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<PassportElementErrorDataField> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("source", object->source);
-        json.put("type", object->type);
-        json.put("field_name", object->fieldName);
         json.put("data_hash", object->dataHash);
+        json.put("field_name", object->fieldName);
         json.put("message", object->message);
+        json.put("source", object->source);
+        json.put("type", object->type);
     }
     return json;
 }
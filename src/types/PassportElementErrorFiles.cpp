@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    source,
+    type,
+    fileHashes,
+    message,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"source", Field::source},
+    {"type", Field::type},
+    {"file_hashes", Field::fileHashes},
+    {"message", Field::message},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PassportElementErrorFiles> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PassportElementErrorFiles>();
-    parse(data, "source", &result->source);
-    parse(data, "type", &result->type);
-    result->fileHashes = parsePrimitiveRequiredArray<std::string>(data, "file_hashes");
-    parse(data, "message", &result->message);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::source:
+                detail::parseValue(value, &result->source);
+                break;
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::fileHashes:
+                result->fileHashes = parsePrimitiveArray<std::string>(value);
+                break;
+            case Field::message:
+                detail::parseValue(value, &result->message);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<PassportElementErrorFiles> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("source", object->source);
-        json.put("type", object->type);
         json.put("file_hashes", object->fileHashes);
         json.put("message", object->message);
+        json.put("source", object->source);
+        json.put("type", object->type);
     }
     return json;
 }
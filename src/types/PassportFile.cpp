@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    fileId,
+    fileUniqueId,
+    fileSize,
+    fileDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"file_id", Field::fileId},
+    {"file_unique_id", Field::fileUniqueId},
+    {"file_size", Field::fileSize},
+    {"file_date", Field::fileDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PassportFile> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PassportFile>();
-    parse(data, "file_id", &result->fileId);
-    parse(data, "file_unique_id", &result->fileUniqueId);
-    parse(data, "file_size", &result->fileSize);
-    parse(data, "file_date", &result->fileDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::fileId:
+                detail::parseValue(value, &result->fileId);
+                break;
+            case Field::fileUniqueId:
+                detail::parseValue(value, &result->fileUniqueId);
+                break;
+            case Field::fileSize:
+                detail::parseValue(value, &result->fileSize);
+                break;
+            case Field::fileDate:
+                detail::parseValue(value, &result->fileDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<PassportFile> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("file_date", object->fileDate);
         json.put("file_id", object->fileId);
-        json.put("file_unique_id", object->fileUniqueId);
         json.put("file_size", object->fileSize);
-        json.put("file_date", object->fileDate);
+        json.put("file_unique_id", object->fileUniqueId);
     }
     return json;
 }
@@ -4,30 +4,128 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    question,
+    questionEntities,
+    options,
+    totalVoterCount,
+    isClosed,
+    isAnonymous,
+    type,
+    allowsMultipleAnswers,
+    allowsRevoting,
+    membersOnly,
+    countryCodes,
+    correctOptionIds,
+    explanation,
+    explanationEntities,
+    explanationMedia,
+    openPeriod,
+    closeDate,
+    description,
+    descriptionEntities,
+    media,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"question", Field::question},
+    {"question_entities", Field::questionEntities},
+    {"options", Field::options},
+    {"total_voter_count", Field::totalVoterCount},
+    {"is_closed", Field::isClosed},
+    {"is_anonymous", Field::isAnonymous},
+    {"type", Field::type},
+    {"allows_multiple_answers", Field::allowsMultipleAnswers},
+    {"allows_revoting", Field::allowsRevoting},
+    {"members_only", Field::membersOnly},
+    {"country_codes", Field::countryCodes},
+    {"correct_option_ids", Field::correctOptionIds},
+    {"explanation", Field::explanation},
+    {"explanation_entities", Field::explanationEntities},
+    {"explanation_media", Field::explanationMedia},
+    {"open_period", Field::openPeriod},
+    {"close_date", Field::closeDate},
+    {"description", Field::description},
+    {"description_entities", Field::descriptionEntities},
+    {"media", Field::media},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Poll> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Poll>();
-    parse(data, "id", &result->id);
-    parse(data, "question", &result->question);
-    result->questionEntities = parseArray<MessageEntity>(data, "question_entities");
-    result->options = parseRequiredArray<PollOption>(data, "options");
-    parse(data, "total_voter_count", &result->totalVoterCount);
-    parse(data, "is_closed", &result->isClosed);
-    parse(data, "is_anonymous", &result->isAnonymous);
-    parse(data, "type", &result->type);
-    parse(data, "allows_multiple_answers", &result->allowsMultipleAnswers);
-    parse(data, "allows_revoting", &result->allowsRevoting);
-    parse(data, "members_only", &result->membersOnly);
-    result->countryCodes = parsePrimitiveArray<std::string>(data, "country_codes");
-    result->correctOptionIds = parsePrimitiveArray<std::int64_t>(data, "correct_option_ids");
-    parse(data, "explanation", &result->explanation);
-    result->explanationEntities = parseArray<MessageEntity>(data, "explanation_entities");
-    result->explanationMedia = parse<PollMedia>(data, "explanation_media");
-    parse(data, "open_period", &result->openPeriod);
-    parse(data, "close_date", &result->closeDate);
-    parse(data, "description", &result->description);
-    result->descriptionEntities = parseArray<MessageEntity>(data, "description_entities");
-    result->media = parse<PollMedia>(data, "media");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::question:
+                detail::parseValue(value, &result->question);
+                break;
+            case Field::questionEntities:
+                result->questionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::options:
+                result->options = parseArray<PollOption>(value);
+                break;
+            case Field::totalVoterCount:
+                detail::parseValue(value, &result->totalVoterCount);
+                break;
+            case Field::isClosed:
+                detail::parseValue(value, &result->isClosed);
+                break;
+            case Field::isAnonymous:
+                detail::parseValue(value, &result->isAnonymous);
+                break;
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::allowsMultipleAnswers:
+                detail::parseValue(value, &result->allowsMultipleAnswers);
+                break;
+            case Field::allowsRevoting:
+                detail::parseValue(value, &result->allowsRevoting);
+                break;
+            case Field::membersOnly:
+                detail::parseValue(value, &result->membersOnly);
+                break;
+            case Field::countryCodes:
+                result->countryCodes = parsePrimitiveArray<std::string>(value);
+                break;
+            case Field::correctOptionIds:
+                result->correctOptionIds = parsePrimitiveArray<std::int64_t>(value);
+                break;
+            case Field::explanation:
+                detail::parseValue(value, &result->explanation);
+                break;
+            case Field::explanationEntities:
+                result->explanationEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::explanationMedia:
+                result->explanationMedia = parse<PollMedia>(value);
+                break;
+            case Field::openPeriod:
+                detail::parseValue(value, &result->openPeriod);
+                break;
+            case Field::closeDate:
+                detail::parseValue(value, &result->closeDate);
+                break;
+            case Field::description:
+                detail::parseValue(value, &result->description);
+                break;
+            case Field::descriptionEntities:
+                result->descriptionEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::media:
+                result->media = parse<PollMedia>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -35,27 +133,27 @@ template <>
 nlohmann::json put(const std::shared_ptr<Poll> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("id", object->id);
-        json.put("question", object->question);
-        json.put("question_entities", object->questionEntities);
-        json.put("options", object->options);
-        json.put("total_voter_count", object->totalVoterCount);
-        json.put("is_closed", object->isClosed);
-        json.put("is_anonymous", object->isAnonymous);
-        json.put("type", object->type);
         json.put("allows_multiple_answers", object->allowsMultipleAnswers);
         json.put("allows_revoting", object->allowsRevoting);
-        json.put("members_only", object->membersOnly);
-        json.put("country_codes", object->countryCodes);
+        json.put("close_date", object->closeDate);
         json.put("correct_option_ids", object->correctOptionIds);
+        json.put("country_codes", object->countryCodes);
+        json.put("description", object->description);
+        json.put("description_entities", object->descriptionEntities);
         json.put("explanation", object->explanation);
         json.put("explanation_entities", object->explanationEntities);
         json.put("explanation_media", object->explanationMedia);
-        json.put("open_period", object->openPeriod);
-        json.put("close_date", object->closeDate);
-        json.put("description", object->description);
-        json.put("description_entities", object->descriptionEntities);
+        json.put("id", object->id);
+        json.put("is_anonymous", object->isAnonymous);
+        json.put("is_closed", object->isClosed);
         json.put("media", object->media);
+        json.put("members_only", object->membersOnly);
+        json.put("open_period", object->openPeriod);
+        json.put("options", object->options);
+        json.put("question", object->question);
+        json.put("question_entities", object->questionEntities);
+        json.put("total_voter_count", object->totalVoterCount);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    pollId,
+    voterChat,
+    user,
+    optionIds,
+    optionPersistentIds,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"poll_id", Field::pollId},
+    {"voter_chat", Field::voterChat},
+    {"user", Field::user},
+    {"option_ids", Field::optionIds},
+    {"option_persistent_ids", Field::optionPersistentIds},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PollAnswer> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PollAnswer>();
-    parse(data, "poll_id", &result->pollId);
-    result->voterChat = parse<Chat>(data, "voter_chat");
-    result->user = parse<User>(data, "user");
-    result->optionIds = parsePrimitiveRequiredArray<std::int32_t>(data, "option_ids");
-    result->optionPersistentIds = parsePrimitiveRequiredArray<std::string>(data, "option_persistent_ids");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::pollId:
+                detail::parseValue(value, &result->pollId);
+                break;
+            case Field::voterChat:
+                result->voterChat = parse<Chat>(value);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::optionIds:
+                result->optionIds = parsePrimitiveArray<std::int32_t>(value);
+                break;
+            case Field::optionPersistentIds:
+                result->optionPersistentIds = parsePrimitiveArray<std::string>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<PollAnswer> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("poll_id", object->pollId);
-        json.put("voter_chat", object->voterChat);
-        json.put("user", object->user);
         json.put("option_ids", object->optionIds);
         json.put("option_persistent_ids", object->optionPersistentIds);
+        json.put("poll_id", object->pollId);
+        json.put("user", object->user);
+        json.put("voter_chat", object->voterChat);
     }
     return json;
 }
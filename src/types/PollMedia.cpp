@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    animation,
+    audio,
+    document,
+    link,
+    livePhoto,
+    location,
+    photo,
+    sticker,
+    venue,
+    video,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"animation", Field::animation},
+    {"audio", Field::audio},
+    {"document", Field::document},
+    {"link", Field::link},
+    {"live_photo", Field::livePhoto},
+    {"location", Field::location},
+    {"photo", Field::photo},
+    {"sticker", Field::sticker},
+    {"venue", Field::venue},
+    {"video", Field::video},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PollMedia> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PollMedia>();
-    result->animation = parse<Animation>(data, "animation");
-    result->audio = parse<Audio>(data, "audio");
-    result->document = parse<Document>(data, "document");
-    result->link = parse<Link>(data, "link");
-    result->livePhoto = parse<LivePhoto>(data, "live_photo");
-    result->location = parse<Location>(data, "location");
-    result->photo = parseArray<PhotoSize>(data, "photo");
-    result->sticker = parse<Sticker>(data, "sticker");
-    result->venue = parse<Venue>(data, "venue");
-    result->video = parse<Video>(data, "video");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::animation:
+                result->animation = parse<Animation>(value);
+                break;
+            case Field::audio:
+                result->audio = parse<Audio>(value);
+                break;
+            case Field::document:
+                result->document = parse<Document>(value);
+                break;
+            case Field::link:
+                result->link = parse<Link>(value);
+                break;
+            case Field::livePhoto:
+                result->livePhoto = parse<LivePhoto>(value);
+                break;
+            case Field::location:
+                result->location = parse<Location>(value);
+                break;
+            case Field::photo:
+                result->photo = parseArray<PhotoSize>(value);
+                break;
+            case Field::sticker:
+                result->sticker = parse<Sticker>(value);
+                break;
+            case Field::venue:
+                result->venue = parse<Venue>(value);
+                break;
+            case Field::video:
+                result->video = parse<Video>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,17 +4,63 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    persistentId,
+    text,
+    textEntities,
+    media,
+    voterCount,
+    addedByUser,
+    addedByChat,
+    additionDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"persistent_id", Field::persistentId},
+    {"text", Field::text},
+    {"text_entities", Field::textEntities},
+    {"media", Field::media},
+    {"voter_count", Field::voterCount},
+    {"added_by_user", Field::addedByUser},
+    {"added_by_chat", Field::addedByChat},
+    {"addition_date", Field::additionDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PollOption> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PollOption>();
-    parse(data, "persistent_id", &result->persistentId);
-    parse(data, "text", &result->text);
-    result->textEntities = parseArray<MessageEntity>(data, "text_entities");
-    result->media = parse<PollMedia>(data, "media");
-    parse(data, "voter_count", &result->voterCount);
-    result->addedByUser = parse<User>(data, "added_by_user");
-    result->addedByChat = parse<Chat>(data, "added_by_chat");
-    parse(data, "addition_date", &result->additionDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::persistentId:
+                detail::parseValue(value, &result->persistentId);
+                break;
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::textEntities:
+                result->textEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::media:
+                result->media = parse<PollMedia>(value);
+                break;
+            case Field::voterCount:
+                detail::parseValue(value, &result->voterCount);
+                break;
+            case Field::addedByUser:
+                result->addedByUser = parse<User>(value);
+                break;
+            case Field::addedByChat:
+                result->addedByChat = parse<Chat>(value);
+                break;
+            case Field::additionDate:
+                detail::parseValue(value, &result->additionDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -22,14 +68,14 @@ template <>
 nlohmann::json put(const std::shared_ptr<PollOption> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("added_by_chat", object->addedByChat);
+        json.put("added_by_user", object->addedByUser);
+        json.put("addition_date", object->additionDate);
+        json.put("media", object->media);
         json.put("persistent_id", object->persistentId);
         json.put("text", object->text);
         json.put("text_entities", object->textEntities);
-        json.put("media", object->media);
         json.put("voter_count", object->voterCount);
-        json.put("added_by_user", object->addedByUser);
-        json.put("added_by_chat", object->addedByChat);
-        json.put("addition_date", object->additionDate);
     }
     return json;
 }
@@ -4,15 +4,45 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    pollMessage,
+    optionPersistentId,
+    optionText,
+    optionTextEntities,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"poll_message", Field::pollMessage},
+    {"option_persistent_id", Field::optionPersistentId},
+    {"option_text", Field::optionText},
+    {"option_text_entities", Field::optionTextEntities},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PollOptionDeleted> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PollOptionDeleted>();
-    if (data.contains("poll_message") && !data["poll_message"].is_null()) {
-        result->pollMessage = parse(data["poll_message"]);
-    }
-    parse(data, "option_persistent_id", &result->optionPersistentId);
-    parse(data, "option_text", &result->optionText);
-    result->optionTextEntities = parseArray<MessageEntity>(data, "option_text_entities");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::pollMessage:
+                if (!value.is_null()) {
+                    result->pollMessage = parse(value);
+                }
+                break;
+            case Field::optionPersistentId:
+                detail::parseValue(value, &result->optionPersistentId);
+                break;
+            case Field::optionText:
+                detail::parseValue(value, &result->optionText);
+                break;
+            case Field::optionTextEntities:
+                result->optionTextEntities = parseArray<MessageEntity>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,10 +50,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<PollOptionDeleted> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("poll_message", object->pollMessage);
         json.put("option_persistent_id", object->optionPersistentId);
         json.put("option_text", object->optionText);
         json.put("option_text_entities", object->optionTextEntities);
+        json.put("poll_message", object->pollMessage);
     }
     return json;
 }
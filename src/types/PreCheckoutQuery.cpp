@@ -4,16 +4,58 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    from,
+    currency,
+    totalAmount,
+    invoicePayload,
+    shippingOptionId,
+    orderInfo,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"from", Field::from},
+    {"currency", Field::currency},
+    {"total_amount", Field::totalAmount},
+    {"invoice_payload", Field::invoicePayload},
+    {"shipping_option_id", Field::shippingOptionId},
+    {"order_info", Field::orderInfo},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PreCheckoutQuery> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PreCheckoutQuery>();
-    parse(data, "id", &result->id);
-    result->from = parseRequired<User>(data, "from");
-    parse(data, "currency", &result->currency);
-    parse(data, "total_amount", &result->totalAmount);
-    parse(data, "invoice_payload", &result->invoicePayload);
-    parse(data, "shipping_option_id", &result->shippingOptionId);
-    result->orderInfo = parse<OrderInfo>(data, "order_info");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::from:
+                result->from = parse<User>(value);
+                break;
+            case Field::currency:
+                detail::parseValue(value, &result->currency);
+                break;
+            case Field::totalAmount:
+                detail::parseValue(value, &result->totalAmount);
+                break;
+            case Field::invoicePayload:
+                detail::parseValue(value, &result->invoicePayload);
+                break;
+            case Field::shippingOptionId:
+                detail::parseValue(value, &result->shippingOptionId);
+                break;
+            case Field::orderInfo:
+                result->orderInfo = parse<OrderInfo>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -21,13 +63,13 @@ template <>
 nlohmann::json put(const std::shared_ptr<PreCheckoutQuery> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("id", object->id);
-        json.put("from", object->from);
         json.put("currency", object->currency);
-        json.put("total_amount", object->totalAmount);
+        json.put("from", object->from);
+        json.put("id", object->id);
         json.put("invoice_payload", object->invoicePayload);
-        json.put("shipping_option_id", object->shippingOptionId);
         json.put("order_info", object->orderInfo);
+        json.put("shipping_option_id", object->shippingOptionId);
+        json.put("total_amount", object->totalAmount);
     }
     return json;
 }
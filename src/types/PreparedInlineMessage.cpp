@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    expirationDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"expiration_date", Field::expirationDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PreparedInlineMessage> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PreparedInlineMessage>();
-    parse(data, "id", &result->id);
-    parse(data, "expiration_date", &result->expirationDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::expirationDate:
+                detail::parseValue(value, &result->expirationDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<PreparedInlineMessage> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("id", object->id);
         json.put("expiration_date", object->expirationDate);
+        json.put("id", object->id);
     }
     return json;
 }
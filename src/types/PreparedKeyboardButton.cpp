@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<PreparedKeyboardButton> parse(const nlohmann::json &data) {
     auto result = std::make_shared<PreparedKeyboardButton>();
-    parse(data, "id", &result->id);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+        }
+    });
     return result;
 }
 
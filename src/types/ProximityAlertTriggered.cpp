@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    traveler,
+    watcher,
+    distance,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"traveler", Field::traveler},
+    {"watcher", Field::watcher},
+    {"distance", Field::distance},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ProximityAlertTriggered> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ProximityAlertTriggered>();
-    result->traveler = parseRequired<User>(data, "traveler");
-    result->watcher = parseRequired<User>(data, "watcher");
-    parse(data, "distance", &result->distance);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::traveler:
+                result->traveler = parse<User>(value);
+                break;
+            case Field::watcher:
+                result->watcher = parse<User>(value);
+                break;
+            case Field::distance:
+                detail::parseValue(value, &result->distance);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<ProximityAlertTriggered> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("distance", object->distance);
         json.put("traveler", object->traveler);
         json.put("watcher", object->watcher);
-        json.put("distance", object->distance);
     }
     return json;
 }
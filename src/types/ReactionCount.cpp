@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    totalCount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"total_count", Field::totalCount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ReactionCount> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ReactionCount>();
-    result->type = parseRequired<ReactionType>(data, "type");
-    parse(data, "total_count", &result->totalCount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                result->type = parse<ReactionType>(value);
+                break;
+            case Field::totalCount:
+                detail::parseValue(value, &result->totalCount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ReactionCount> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("total_count", object->totalCount);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -7,38 +7,26 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<ReactionType>>({
+    {"emoji", detail::subtype<ReactionType, ReactionTypeEmoji>()},
+    {"custom_emoji", detail::subtype<ReactionType, ReactionTypeCustomEmoji>()},
+    {"paid", detail::subtype<ReactionType, ReactionTypePaid>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ReactionType> parse(const nlohmann::json &data) {
-    std::string type;
-    ReactionType::Ptr result;
-    parse(data, "type", &type);
-    if (type == "emoji") {
-        result = parse<ReactionTypeEmoji>(data);
-    } else if (type == "custom_emoji") {
-        result = parse<ReactionTypeCustomEmoji>(data);
-    } else if (type == "paid") {
-        result = parse<ReactionTypePaid>(data);
-    } else {
-        throw invalidType("ReactionType", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "ReactionType");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<ReactionType> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "emoji") {
-            json += put<ReactionTypeEmoji>(object);
-        } else if (object->type == "custom_emoji") {
-            json += put<ReactionTypeCustomEmoji>(object);
-        } else if (object->type == "paid") {
-            json += put<ReactionTypePaid>(object);
-        } else {
-            throw invalidType("ReactionType", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "ReactionType");
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    customEmojiId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"custom_emoji_id", Field::customEmojiId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ReactionTypeCustomEmoji> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ReactionTypeCustomEmoji>();
-    parse(data, "type", &result->type);
-    parse(data, "custom_emoji_id", &result->customEmojiId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::customEmojiId:
+                detail::parseValue(value, &result->customEmojiId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ReactionTypeCustomEmoji> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("custom_emoji_id", object->customEmojiId);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    emoji,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"emoji", Field::emoji},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ReactionTypeEmoji> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ReactionTypeEmoji>();
-    parse(data, "type", &result->type);
-    parse(data, "emoji", &result->emoji);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::emoji:
+                detail::parseValue(value, &result->emoji);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ReactionTypeEmoji> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("emoji", object->emoji);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    currency,
+    totalAmount,
+    invoicePayload,
+    telegramPaymentChargeId,
+    providerPaymentChargeId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"currency", Field::currency},
+    {"total_amount", Field::totalAmount},
+    {"invoice_payload", Field::invoicePayload},
+    {"telegram_payment_charge_id", Field::telegramPaymentChargeId},
+    {"provider_payment_charge_id", Field::providerPaymentChargeId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RefundedPayment> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RefundedPayment>();
-    parse(data, "currency", &result->currency);
-    parse(data, "total_amount", &result->totalAmount);
-    parse(data, "invoice_payload", &result->invoicePayload);
-    parse(data, "telegram_payment_charge_id", &result->telegramPaymentChargeId);
-    parse(data, "provider_payment_charge_id", &result->providerPaymentChargeId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::currency:
+                detail::parseValue(value, &result->currency);
+                break;
+            case Field::totalAmount:
+                detail::parseValue(value, &result->totalAmount);
+                break;
+            case Field::invoicePayload:
+                detail::parseValue(value, &result->invoicePayload);
+                break;
+            case Field::telegramPaymentChargeId:
+                detail::parseValue(value, &result->telegramPaymentChargeId);
+                break;
+            case Field::providerPaymentChargeId:
+                detail::parseValue(value, &result->providerPaymentChargeId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,10 +54,10 @@ nlohmann::json put(const std::shared_ptr<RefundedPayment> &object) {
     JsonWrapper json;
     if (object) {
         json.put("currency", object->currency);
-        json.put("total_amount", object->totalAmount);
         json.put("invoice_payload", object->invoicePayload);
-        json.put("telegram_payment_charge_id", object->telegramPaymentChargeId);
         json.put("provider_payment_charge_id", object->providerPaymentChargeId);
+        json.put("telegram_payment_charge_id", object->telegramPaymentChargeId);
+        json.put("total_amount", object->totalAmount);
     }
     return json;
 }
@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    keyboard,
+    isPersistent,
+    resizeKeyboard,
+    oneTimeKeyboard,
+    inputFieldPlaceholder,
+    selective,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"keyboard", Field::keyboard},
+    {"is_persistent", Field::isPersistent},
+    {"resize_keyboard", Field::resizeKeyboard},
+    {"one_time_keyboard", Field::oneTimeKeyboard},
+    {"input_field_placeholder", Field::inputFieldPlaceholder},
+    {"selective", Field::selective},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ReplyKeyboardMarkup> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ReplyKeyboardMarkup>();
-    result->keyboard = parseMatrix<KeyboardButton>(data, "keyboard");
-    parse(data, "is_persistent", &result->isPersistent);
-    parse(data, "resize_keyboard", &result->resizeKeyboard);
-    parse(data, "one_time_keyboard", &result->oneTimeKeyboard);
-    parse(data, "input_field_placeholder", &result->inputFieldPlaceholder);
-    parse(data, "selective", &result->selective);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::keyboard:
+                result->keyboard = parseMatrix<KeyboardButton>(value);
+                break;
+            case Field::isPersistent:
+                detail::parseValue(value, &result->isPersistent);
+                break;
+            case Field::resizeKeyboard:
+                detail::parseValue(value, &result->resizeKeyboard);
+                break;
+            case Field::oneTimeKeyboard:
+                detail::parseValue(value, &result->oneTimeKeyboard);
+                break;
+            case Field::inputFieldPlaceholder:
+                detail::parseValue(value, &result->inputFieldPlaceholder);
+                break;
+            case Field::selective:
+                detail::parseValue(value, &result->selective);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,11 +58,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<ReplyKeyboardMarkup> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("keyboard", object->keyboard);
+        json.put("input_field_placeholder", object->inputFieldPlaceholder);
         json.put("is_persistent", object->isPersistent);
-        json.put("resize_keyboard", object->resizeKeyboard);
+        json.put("keyboard", object->keyboard);
         json.put("one_time_keyboard", object->oneTimeKeyboard);
-        json.put("input_field_placeholder", object->inputFieldPlaceholder);
+        json.put("resize_keyboard", object->resizeKeyboard);
         json.put("selective", object->selective);
     }
     return json;
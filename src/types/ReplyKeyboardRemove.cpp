@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    removeKeyboard,
+    selective,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"remove_keyboard", Field::removeKeyboard},
+    {"selective", Field::selective},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ReplyKeyboardRemove> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ReplyKeyboardRemove>();
-    parse(data, "remove_keyboard", &result->removeKeyboard);
-    parse(data, "selective", &result->selective);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::removeKeyboard:
+                detail::parseValue(value, &result->removeKeyboard);
+                break;
+            case Field::selective:
+                detail::parseValue(value, &result->selective);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    messageId,
+    chatId,
+    ephemeralMessageId,
+    allowSendingWithoutReply,
+    quote,
+    quoteParseMode,
+    quoteEntities,
+    quotePosition,
+    checklistTaskId,
+    pollOptionId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"message_id", Field::messageId},
+    {"chat_id", Field::chatId},
+    {"ephemeral_message_id", Field::ephemeralMessageId},
+    {"allow_sending_without_reply", Field::allowSendingWithoutReply},
+    {"quote", Field::quote},
+    {"quote_parse_mode", Field::quoteParseMode},
+    {"quote_entities", Field::quoteEntities},
+    {"quote_position", Field::quotePosition},
+    {"checklist_task_id", Field::checklistTaskId},
+    {"poll_option_id", Field::pollOptionId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ReplyParameters> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ReplyParameters>();
-    parse(data, "message_id", &result->messageId);
-    parse(data, "chat_id", &result->chatId);
-    parse(data, "ephemeral_message_id", &result->ephemeralMessageId);
-    parse(data, "allow_sending_without_reply", &result->allowSendingWithoutReply);
-    parse(data, "quote", &result->quote);
-    parse(data, "quote_parse_mode", &result->quoteParseMode);
-    result->quoteEntities = parseArray<MessageEntity>(data, "quote_entities");
-    parse(data, "quote_position", &result->quotePosition);
-    parse(data, "checklist_task_id", &result->checklistTaskId);
-    parse(data, "poll_option_id", &result->pollOptionId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::messageId:
+                detail::parseValue(value, &result->messageId);
+                break;
+            case Field::chatId:
+                detail::parseValue(value, &result->chatId);
+                break;
+            case Field::ephemeralMessageId:
+                detail::parseValue(value, &result->ephemeralMessageId);
+                break;
+            case Field::allowSendingWithoutReply:
+                detail::parseValue(value, &result->allowSendingWithoutReply);
+                break;
+            case Field::quote:
+                detail::parseValue(value, &result->quote);
+                break;
+            case Field::quoteParseMode:
+                detail::parseValue(value, &result->quoteParseMode);
+                break;
+            case Field::quoteEntities:
+                result->quoteEntities = parseArray<MessageEntity>(value);
+                break;
+            case Field::quotePosition:
+                detail::parseValue(value, &result->quotePosition);
+                break;
+            case Field::checklistTaskId:
+                detail::parseValue(value, &result->checklistTaskId);
+                break;
+            case Field::pollOptionId:
+                detail::parseValue(value, &result->pollOptionId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -24,16 +78,16 @@ template <>
 nlohmann::json put(const std::shared_ptr<ReplyParameters> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("message_id", object->messageId);
+        json.put("allow_sending_without_reply", object->allowSendingWithoutReply);
         json.put("chat_id", object->chatId);
+        json.put("checklist_task_id", object->checklistTaskId);
         json.put("ephemeral_message_id", object->ephemeralMessageId);
-        json.put("allow_sending_without_reply", object->allowSendingWithoutReply);
+        json.put("message_id", object->messageId);
+        json.put("poll_option_id", object->pollOptionId);
         json.put("quote", object->quote);
-        json.put("quote_parse_mode", object->quoteParseMode);
         json.put("quote_entities", object->quoteEntities);
+        json.put("quote_parse_mode", object->quoteParseMode);
         json.put("quote_position", object->quotePosition);
-        json.put("checklist_task_id", object->checklistTaskId);
-        json.put("poll_option_id", object->pollOptionId);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    migrateToChatId,
+    retryAfter,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"migrate_to_chat_id", Field::migrateToChatId},
+    {"retry_after", Field::retryAfter},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ResponseParameters> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ResponseParameters>();
-    parse(data, "migrate_to_chat_id", &result->migrateToChatId);
-    parse(data, "retry_after", &result->retryAfter);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::migrateToChatId:
+                detail::parseValue(value, &result->migrateToChatId);
+                break;
+            case Field::retryAfter:
+                detail::parseValue(value, &result->retryAfter);
+                break;
+        }
+    });
     return result;
 }
 
@@ -7,38 +7,26 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<RevenueWithdrawalState>>({
+    {"pending", detail::subtype<RevenueWithdrawalState, RevenueWithdrawalStatePending>()},
+    {"succeeded", detail::subtype<RevenueWithdrawalState, RevenueWithdrawalStateSucceeded>()},
+    {"failed", detail::subtype<RevenueWithdrawalState, RevenueWithdrawalStateFailed>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RevenueWithdrawalState> parse(const nlohmann::json &data) {
-    std::string type;
-    RevenueWithdrawalState::Ptr result;
-    parse(data, "type", &type);
-    if (type == "pending") {
-        result = parse<RevenueWithdrawalStatePending>(data);
-    } else if (type == "succeeded") {
-        result = parse<RevenueWithdrawalStateSucceeded>(data);
-    } else if (type == "failed") {
-        result = parse<RevenueWithdrawalStateFailed>(data);
-    } else {
-        throw invalidType("RevenueWithdrawalState", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "RevenueWithdrawalState");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<RevenueWithdrawalState> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "pending") {
-            json += put<RevenueWithdrawalStatePending>(object);
-        } else if (object->type == "succeeded") {
-            json += put<RevenueWithdrawalStateSucceeded>(object);
-        } else if (object->type == "failed") {
-            json += put<RevenueWithdrawalStateFailed>(object);
-        } else {
-            throw invalidType("RevenueWithdrawalState", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "RevenueWithdrawalState");
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    date,
+    url,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"date", Field::date},
+    {"url", Field::url},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RevenueWithdrawalStateSucceeded> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RevenueWithdrawalStateSucceeded>();
-    parse(data, "type", &result->type);
-    parse(data, "date", &result->date);
-    parse(data, "url", &result->url);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::url:
+                detail::parseValue(value, &result->url);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,8 +43,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<RevenueWithdrawalStateSucceeded> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("date", object->date);
+        json.put("type", object->type);
         json.put("url", object->url);
     }
     return json;
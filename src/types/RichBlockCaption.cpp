@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    text,
+    credit,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"text", Field::text},
+    {"credit", Field::credit},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockCaption> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockCaption>();
-    result->text = parseRequired<RichText>(data, "text");
-    result->credit = parse<RichText>(data, "credit");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::credit:
+                result->credit = parse<RichText>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockCaption> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("text", object->text);
         json.put("credit", object->credit);
+        json.put("text", object->text);
     }
     return json;
 }
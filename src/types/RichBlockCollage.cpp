@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    blocks,
+    caption,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"blocks", Field::blocks},
+    {"caption", Field::caption},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockCollage> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockCollage>();
-    parse(data, "type", &result->type);
-    result->blocks = parseRequiredArray<RichBlock>(data, "blocks");
-    result->caption = parse<RichBlockCaption>(data, "caption");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::blocks:
+                result->blocks = parseArray<RichBlock>(value);
+                break;
+            case Field::caption:
+                result->caption = parse<RichBlockCaption>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockCollage> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("blocks", object->blocks);
         json.put("caption", object->caption);
+        json.put("type", object->type);
     }
     return json;
 }
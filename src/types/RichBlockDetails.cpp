@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    summary,
+    blocks,
+    isOpen,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"summary", Field::summary},
+    {"blocks", Field::blocks},
+    {"is_open", Field::isOpen},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockDetails> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockDetails>();
-    parse(data, "type", &result->type);
-    result->summary = parseRequired<RichText>(data, "summary");
-    result->blocks = parseRequiredArray<RichBlock>(data, "blocks");
-    parse(data, "is_open", &result->isOpen);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::summary:
+                result->summary = parse<RichText>(value);
+                break;
+            case Field::blocks:
+                result->blocks = parseArray<RichBlock>(value);
+                break;
+            case Field::isOpen:
+                detail::parseValue(value, &result->isOpen);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockDetails> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("summary", object->summary);
         json.put("blocks", object->blocks);
         json.put("is_open", object->isOpen);
+        json.put("summary", object->summary);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockFooter> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockFooter>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockFooter> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    label,
+    blocks,
+    hasCheckbox,
+    isChecked,
+    value,
+    type,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"label", Field::label},
+    {"blocks", Field::blocks},
+    {"has_checkbox", Field::hasCheckbox},
+    {"is_checked", Field::isChecked},
+    {"value", Field::value},
+    {"type", Field::type},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockListItem> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockListItem>();
-    parse(data, "label", &result->label);
-    result->blocks = parseRequiredArray<RichBlock>(data, "blocks");
-    parse(data, "has_checkbox", &result->hasCheckbox);
-    parse(data, "is_checked", &result->isChecked);
-    parse(data, "value", &result->value);
-    parse(data, "type", &result->type);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::label:
+                detail::parseValue(value, &result->label);
+                break;
+            case Field::blocks:
+                result->blocks = parseArray<RichBlock>(value);
+                break;
+            case Field::hasCheckbox:
+                detail::parseValue(value, &result->hasCheckbox);
+                break;
+            case Field::isChecked:
+                detail::parseValue(value, &result->isChecked);
+                break;
+            case Field::value:
+                detail::parseValue(value, &result->value);
+                break;
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockListItem> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("label", object->label);
         json.put("blocks", object->blocks);
         json.put("has_checkbox", object->hasCheckbox);
         json.put("is_checked", object->isChecked);
-        json.put("value", object->value);
+        json.put("label", object->label);
         json.put("type", object->type);
+        json.put("value", object->value);
     }
     return json;
 }
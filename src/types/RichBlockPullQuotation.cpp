@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    credit,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"credit", Field::credit},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockPullQuotation> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockPullQuotation>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    result->credit = parse<RichText>(data, "credit");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::credit:
+                result->credit = parse<RichText>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockPullQuotation> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("credit", object->credit);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    size,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"size", Field::size},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockSectionHeading> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockSectionHeading>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "size", &result->size);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::size:
+                detail::parseValue(value, &result->size);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockSectionHeading> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("size", object->size);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
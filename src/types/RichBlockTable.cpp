@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    cells,
+    isBordered,
+    isStriped,
+    caption,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"cells", Field::cells},
+    {"is_bordered", Field::isBordered},
+    {"is_striped", Field::isStriped},
+    {"caption", Field::caption},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockTable> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockTable>();
-    parse(data, "type", &result->type);
-    result->cells = parseMatrix<RichBlockTableCell>(data, "cells");
-    parse(data, "is_bordered", &result->isBordered);
-    parse(data, "is_striped", &result->isStriped);
-    result->caption = parse<RichText>(data, "caption");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::cells:
+                result->cells = parseMatrix<RichBlockTableCell>(value);
+                break;
+            case Field::isBordered:
+                detail::parseValue(value, &result->isBordered);
+                break;
+            case Field::isStriped:
+                detail::parseValue(value, &result->isStriped);
+                break;
+            case Field::caption:
+                result->caption = parse<RichText>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockTable> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("caption", object->caption);
         json.put("cells", object->cells);
         json.put("is_bordered", object->isBordered);
         json.put("is_striped", object->isStriped);
-        json.put("caption", object->caption);
+        json.put("type", object->type);
     }
     return json;
 }
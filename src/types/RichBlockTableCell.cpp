@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    text,
+    isHeader,
+    colspan,
+    rowspan,
+    align,
+    valign,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"text", Field::text},
+    {"is_header", Field::isHeader},
+    {"colspan", Field::colspan},
+    {"rowspan", Field::rowspan},
+    {"align", Field::align},
+    {"valign", Field::valign},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockTableCell> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockTableCell>();
-    result->text = parse<RichText>(data, "text");
-    parse(data, "is_header", &result->isHeader);
-    parse(data, "colspan", &result->colspan);
-    parse(data, "rowspan", &result->rowspan);
-    parse(data, "align", &result->align);
-    parse(data, "valign", &result->valign);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::isHeader:
+                detail::parseValue(value, &result->isHeader);
+                break;
+            case Field::colspan:
+                detail::parseValue(value, &result->colspan);
+                break;
+            case Field::rowspan:
+                detail::parseValue(value, &result->rowspan);
+                break;
+            case Field::align:
+                detail::parseValue(value, &result->align);
+                break;
+            case Field::valign:
+                detail::parseValue(value, &result->valign);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,11 +58,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockTableCell> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("text", object->text);
-        json.put("is_header", object->isHeader);
+        json.put("align", object->align);
         json.put("colspan", object->colspan);
+        json.put("is_header", object->isHeader);
         json.put("rowspan", object->rowspan);
-        json.put("align", object->align);
+        json.put("text", object->text);
         json.put("valign", object->valign);
     }
     return json;
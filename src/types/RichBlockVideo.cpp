@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    video,
+    hasSpoiler,
+    caption,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"video", Field::video},
+    {"has_spoiler", Field::hasSpoiler},
+    {"caption", Field::caption},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichBlockVideo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichBlockVideo>();
-    parse(data, "type", &result->type);
-    result->video = parseRequired<Video>(data, "video");
-    parse(data, "has_spoiler", &result->hasSpoiler);
-    result->caption = parse<RichBlockCaption>(data, "caption");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::video:
+                result->video = parse<Video>(value);
+                break;
+            case Field::hasSpoiler:
+                detail::parseValue(value, &result->hasSpoiler);
+                break;
+            case Field::caption:
+                result->caption = parse<RichBlockCaption>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichBlockVideo> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("caption", object->caption);
+        json.put("has_spoiler", object->hasSpoiler);
         json.put("type", object->type);
         json.put("video", object->video);
-        json.put("has_spoiler", object->hasSpoiler);
-        json.put("caption", object->caption);
     }
     return json;
 }
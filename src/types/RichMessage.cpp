@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    blocks,
+    isRtl,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"blocks", Field::blocks},
+    {"is_rtl", Field::isRtl},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichMessage> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichMessage>();
-    result->blocks = parseRequiredArray<RichBlock>(data, "blocks");
-    parse(data, "is_rtl", &result->isRtl);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::blocks:
+                result->blocks = parseArray<RichBlock>(value);
+                break;
+            case Field::isRtl:
+                detail::parseValue(value, &result->isRtl);
+                break;
+        }
+    });
     return result;
 }
 
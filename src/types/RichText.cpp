@@ -31,6 +31,39 @@
 
 namespace TgBot {
 
+namespace {
+
+// The styled nodes, told apart by "type".
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<RichText>>({
+    {"bold", detail::subtype<RichText, RichTextBold>()},
+    {"italic", detail::subtype<RichText, RichTextItalic>()},
+    {"underline", detail::subtype<RichText, RichTextUnderline>()},
+    {"strikethrough", detail::subtype<RichText, RichTextStrikethrough>()},
+    {"spoiler", detail::subtype<RichText, RichTextSpoiler>()},
+    {"date_time", detail::subtype<RichText, RichTextDateTime>()},
+    {"text_mention", detail::subtype<RichText, RichTextTextMention>()},
+    {"subscript", detail::subtype<RichText, RichTextSubscript>()},
+    {"superscript", detail::subtype<RichText, RichTextSuperscript>()},
+    {"marked", detail::subtype<RichText, RichTextMarked>()},
+    {"code", detail::subtype<RichText, RichTextCode>()},
+    {"custom_emoji", detail::subtype<RichText, RichTextCustomEmoji>()},
+    {"mathematical_expression", detail::subtype<RichText, RichTextMathematicalExpression>()},
+    {"url", detail::subtype<RichText, RichTextUrl>()},
+    {"email_address", detail::subtype<RichText, RichTextEmailAddress>()},
+    {"phone_number", detail::subtype<RichText, RichTextPhoneNumber>()},
+    {"bank_card_number", detail::subtype<RichText, RichTextBankCardNumber>()},
+    {"mention", detail::subtype<RichText, RichTextMention>()},
+    {"hashtag", detail::subtype<RichText, RichTextHashtag>()},
+    {"cashtag", detail::subtype<RichText, RichTextCashtag>()},
+    {"bot_command", detail::subtype<RichText, RichTextBotCommand>()},
+    {"anchor", detail::subtype<RichText, RichTextAnchor>()},
+    {"anchor_link", detail::subtype<RichText, RichTextAnchorLink>()},
+    {"reference", detail::subtype<RichText, RichTextReference>()},
+    {"reference_link", detail::subtype<RichText, RichTextReferenceLink>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichText> parse(const nlohmann::json &data) {
     if (data.is_string()) {
@@ -43,61 +76,7 @@ std::shared_ptr<RichText> parse(const nlohmann::json &data) {
         result->items = parseArray<RichText>(data);
         return result;
     }
-    std::string type;
-    parse(data, "type", &type);
-    if (type == "bold") {
-        return parse<RichTextBold>(data);
-    } else if (type == "italic") {
-        return parse<RichTextItalic>(data);
-    } else if (type == "underline") {
-        return parse<RichTextUnderline>(data);
-    } else if (type == "strikethrough") {
-        return parse<RichTextStrikethrough>(data);
-    } else if (type == "spoiler") {
-        return parse<RichTextSpoiler>(data);
-    } else if (type == "date_time") {
-        return parse<RichTextDateTime>(data);
-    } else if (type == "text_mention") {
-        return parse<RichTextTextMention>(data);
-    } else if (type == "subscript") {
-        return parse<RichTextSubscript>(data);
-    } else if (type == "superscript") {
-        return parse<RichTextSuperscript>(data);
-    } else if (type == "marked") {
-        return parse<RichTextMarked>(data);
-    } else if (type == "code") {
-        return parse<RichTextCode>(data);
-    } else if (type == "custom_emoji") {
-        return parse<RichTextCustomEmoji>(data);
-    } else if (type == "mathematical_expression") {
-        return parse<RichTextMathematicalExpression>(data);
-    } else if (type == "url") {
-        return parse<RichTextUrl>(data);
-    } else if (type == "email_address") {
-        return parse<RichTextEmailAddress>(data);
-    } else if (type == "phone_number") {
-        return parse<RichTextPhoneNumber>(data);
-    } else if (type == "bank_card_number") {
-        return parse<RichTextBankCardNumber>(data);
-    } else if (type == "mention") {
-        return parse<RichTextMention>(data);
-    } else if (type == "hashtag") {
-        return parse<RichTextHashtag>(data);
-    } else if (type == "cashtag") {
-        return parse<RichTextCashtag>(data);
-    } else if (type == "bot_command") {
-        return parse<RichTextBotCommand>(data);
-    } else if (type == "anchor") {
-        return parse<RichTextAnchor>(data);
-    } else if (type == "anchor_link") {
-        return parse<RichTextAnchorLink>(data);
-    } else if (type == "reference") {
-        return parse<RichTextReference>(data);
-    } else if (type == "reference_link") {
-        return parse<RichTextReferenceLink>(data);
-    } else {
-        throw invalidType("RichText", type);
-    }
+    return detail::parseSubtype(data, "type", subtypes, "RichText");
 }
 
 template <>
@@ -111,62 +90,7 @@ nlohmann::json put(const std::shared_ptr<RichText> &object) {
     if (object->kind == RichText::Kind::Array) {
         return put(std::static_pointer_cast<RichTextArray>(object)->items);
     }
-    JsonWrapper json;
-    json.put("type", object->type);
-    if (object->type == "bold") {
-        json += put<RichTextBold>(object);
-    } else if (object->type == "italic") {
-        json += put<RichTextItalic>(object);
-    } else if (object->type == "underline") {
-        json += put<RichTextUnderline>(object);
-    } else if (object->type == "strikethrough") {
-        json += put<RichTextStrikethrough>(object);
-    } else if (object->type == "spoiler") {
-        json += put<RichTextSpoiler>(object);
-    } else if (object->type == "date_time") {
-        json += put<RichTextDateTime>(object);
-    } else if (object->type == "text_mention") {
-        json += put<RichTextTextMention>(object);
-    } else if (object->type == "subscript") {
-        json += put<RichTextSubscript>(object);
-    } else if (object->type == "superscript") {
-        json += put<RichTextSuperscript>(object);
-    } else if (object->type == "marked") {
-        json += put<RichTextMarked>(object);
-    } else if (object->type == "code") {
-        json += put<RichTextCode>(object);
-    } else if (object->type == "custom_emoji") {
-        json += put<RichTextCustomEmoji>(object);
-    } else if (object->type == "mathematical_expression") {
-        json += put<RichTextMathematicalExpression>(object);
-    } else if (object->type == "url") {
-        json += put<RichTextUrl>(object);
-    } else if (object->type == "email_address") {
-        json += put<RichTextEmailAddress>(object);
-    } else if (object->type == "phone_number") {
-        json += put<RichTextPhoneNumber>(object);
-    } else if (object->type == "bank_card_number") {
-        json += put<RichTextBankCardNumber>(object);
-    } else if (object->type == "mention") {
-        json += put<RichTextMention>(object);
-    } else if (object->type == "hashtag") {
-        json += put<RichTextHashtag>(object);
-    } else if (object->type == "cashtag") {
-        json += put<RichTextCashtag>(object);
-    } else if (object->type == "bot_command") {
-        json += put<RichTextBotCommand>(object);
-    } else if (object->type == "anchor") {
-        json += put<RichTextAnchor>(object);
-    } else if (object->type == "anchor_link") {
-        json += put<RichTextAnchorLink>(object);
-    } else if (object->type == "reference") {
-        json += put<RichTextReference>(object);
-    } else if (object->type == "reference_link") {
-        json += put<RichTextReferenceLink>(object);
-    } else {
-        throw invalidType("RichText", object->type);
-    }
-    return json;
+    return detail::putSubtype(object, object->type, subtypes, "RichText");
 }
 
 } // namespace TgBot
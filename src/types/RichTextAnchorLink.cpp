@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    anchorName,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"anchor_name", Field::anchorName},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextAnchorLink> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextAnchorLink>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "anchor_name", &result->anchorName);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::anchorName:
+                detail::parseValue(value, &result->anchorName);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextAnchorLink> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("anchor_name", object->anchorName);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    bankCardNumber,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"bank_card_number", Field::bankCardNumber},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextBankCardNumber> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextBankCardNumber>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "bank_card_number", &result->bankCardNumber);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::bankCardNumber:
+                detail::parseValue(value, &result->bankCardNumber);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextBankCardNumber> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("bank_card_number", object->bankCardNumber);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
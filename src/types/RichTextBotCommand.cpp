@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    botCommand,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"bot_command", Field::botCommand},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextBotCommand> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextBotCommand>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "bot_command", &result->botCommand);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::botCommand:
+                detail::parseValue(value, &result->botCommand);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextBotCommand> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("bot_command", object->botCommand);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
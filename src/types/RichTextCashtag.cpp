@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    cashtag,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"cashtag", Field::cashtag},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextCashtag> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextCashtag>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "cashtag", &result->cashtag);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::cashtag:
+                detail::parseValue(value, &result->cashtag);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextCashtag> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("cashtag", object->cashtag);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
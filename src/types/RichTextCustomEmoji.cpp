@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    customEmojiId,
+    alternativeText,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"custom_emoji_id", Field::customEmojiId},
+    {"alternative_text", Field::alternativeText},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextCustomEmoji> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextCustomEmoji>();
-    parse(data, "type", &result->type);
-    parse(data, "custom_emoji_id", &result->customEmojiId);
-    parse(data, "alternative_text", &result->alternativeText);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::customEmojiId:
+                detail::parseValue(value, &result->customEmojiId);
+                break;
+            case Field::alternativeText:
+                detail::parseValue(value, &result->alternativeText);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextCustomEmoji> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("custom_emoji_id", object->customEmojiId);
         json.put("alternative_text", object->alternativeText);
+        json.put("custom_emoji_id", object->customEmojiId);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    unixTime,
+    dateTimeFormat,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"unix_time", Field::unixTime},
+    {"date_time_format", Field::dateTimeFormat},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextDateTime> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextDateTime>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "unix_time", &result->unixTime);
-    parse(data, "date_time_format", &result->dateTimeFormat);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::unixTime:
+                detail::parseValue(value, &result->unixTime);
+                break;
+            case Field::dateTimeFormat:
+                detail::parseValue(value, &result->dateTimeFormat);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextDateTime> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("date_time_format", object->dateTimeFormat);
         json.put("text", object->text);
+        json.put("type", object->type);
         json.put("unix_time", object->unixTime);
-        json.put("date_time_format", object->dateTimeFormat);
     }
     return json;
 }
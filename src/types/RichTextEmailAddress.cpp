@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    emailAddress,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"email_address", Field::emailAddress},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextEmailAddress> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextEmailAddress>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "email_address", &result->emailAddress);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::emailAddress:
+                detail::parseValue(value, &result->emailAddress);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextEmailAddress> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("email_address", object->emailAddress);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
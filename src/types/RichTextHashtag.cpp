@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    hashtag,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"hashtag", Field::hashtag},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextHashtag> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextHashtag>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "hashtag", &result->hashtag);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::hashtag:
+                detail::parseValue(value, &result->hashtag);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextHashtag> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("hashtag", object->hashtag);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
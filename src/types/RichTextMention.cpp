@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    username,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"username", Field::username},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextMention> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextMention>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "username", &result->username);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::username:
+                detail::parseValue(value, &result->username);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,8 +43,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextMention> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("text", object->text);
+        json.put("type", object->type);
         json.put("username", object->username);
     }
     return json;
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    phoneNumber,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"phone_number", Field::phoneNumber},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextPhoneNumber> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextPhoneNumber>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "phone_number", &result->phoneNumber);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::phoneNumber:
+                detail::parseValue(value, &result->phoneNumber);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextPhoneNumber> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("phone_number", object->phoneNumber);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
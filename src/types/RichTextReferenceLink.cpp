@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    referenceName,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"reference_name", Field::referenceName},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextReferenceLink> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextReferenceLink>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    parse(data, "reference_name", &result->referenceName);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::referenceName:
+                detail::parseValue(value, &result->referenceName);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextReferenceLink> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("text", object->text);
         json.put("reference_name", object->referenceName);
+        json.put("text", object->text);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    text,
+    user,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"text", Field::text},
+    {"user", Field::user},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<RichTextTextMention> parse(const nlohmann::json &data) {
     auto result = std::make_shared<RichTextTextMention>();
-    parse(data, "type", &result->type);
-    result->text = parseRequired<RichText>(data, "text");
-    result->user = parseRequired<User>(data, "user");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::text:
+                result->text = parse<RichText>(value);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,8 +43,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<RichTextTextMention> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("text", object->text);
+        json.put("type", object->type);
         json.put("user", object->user);
     }
     return json;
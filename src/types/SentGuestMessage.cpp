@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    inlineMessageId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"inline_message_id", Field::inlineMessageId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SentGuestMessage> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SentGuestMessage>();
-    parse(data, "inline_message_id", &result->inlineMessageId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::inlineMessageId:
+                detail::parseValue(value, &result->inlineMessageId);
+                break;
+        }
+    });
     return result;
 }
 
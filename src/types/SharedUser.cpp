@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    userId,
+    firstName,
+    lastName,
+    username,
+    photo,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"user_id", Field::userId},
+    {"first_name", Field::firstName},
+    {"last_name", Field::lastName},
+    {"username", Field::username},
+    {"photo", Field::photo},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SharedUser> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SharedUser>();
-    parse(data, "user_id", &result->userId);
-    parse(data, "first_name", &result->firstName);
-    parse(data, "last_name", &result->lastName);
-    parse(data, "username", &result->username);
-    result->photo = parseArray<PhotoSize>(data, "photo");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::userId:
+                detail::parseValue(value, &result->userId);
+                break;
+            case Field::firstName:
+                detail::parseValue(value, &result->firstName);
+                break;
+            case Field::lastName:
+                detail::parseValue(value, &result->lastName);
+                break;
+            case Field::username:
+                detail::parseValue(value, &result->username);
+                break;
+            case Field::photo:
+                result->photo = parseArray<PhotoSize>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<SharedUser> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("user_id", object->userId);
         json.put("first_name", object->firstName);
         json.put("last_name", object->lastName);
-        json.put("username", object->username);
         json.put("photo", object->photo);
+        json.put("user_id", object->userId);
+        json.put("username", object->username);
     }
     return json;
 }
@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    countryCode,
+    state,
+    city,
+    streetLine1,
+    streetLine2,
+    postCode,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"country_code", Field::countryCode},
+    {"state", Field::state},
+    {"city", Field::city},
+    {"street_line1", Field::streetLine1},
+    {"street_line2", Field::streetLine2},
+    {"post_code", Field::postCode},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ShippingAddress> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ShippingAddress>();
-    parse(data, "country_code", &result->countryCode);
-    parse(data, "state", &result->state);
-    parse(data, "city", &result->city);
-    parse(data, "street_line1", &result->streetLine1);
-    parse(data, "street_line2", &result->streetLine2);
-    parse(data, "post_code", &result->postCode);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::countryCode:
+                detail::parseValue(value, &result->countryCode);
+                break;
+            case Field::state:
+                detail::parseValue(value, &result->state);
+                break;
+            case Field::city:
+                detail::parseValue(value, &result->city);
+                break;
+            case Field::streetLine1:
+                detail::parseValue(value, &result->streetLine1);
+                break;
+            case Field::streetLine2:
+                detail::parseValue(value, &result->streetLine2);
+                break;
+            case Field::postCode:
+                detail::parseValue(value, &result->postCode);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<ShippingAddress> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("city", object->city);
         json.put("country_code", object->countryCode);
+        json.put("post_code", object->postCode);
         json.put("state", object->state);
-        json.put("city", object->city);
         json.put("street_line1", object->streetLine1);
         json.put("street_line2", object->streetLine2);
-        json.put("post_code", object->postCode);
     }
     return json;
 }
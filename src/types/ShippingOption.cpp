@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    title,
+    prices,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"title", Field::title},
+    {"prices", Field::prices},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ShippingOption> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ShippingOption>();
-    parse(data, "id", &result->id);
-    parse(data, "title", &result->title);
-    result->prices = parseRequiredArray<LabeledPrice>(data, "prices");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::prices:
+                result->prices = parseArray<LabeledPrice>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,8 +44,8 @@ nlohmann::json put(const std::shared_ptr<ShippingOption> &object) {
     JsonWrapper json;
     if (object) {
         json.put("id", object->id);
-        json.put("title", object->title);
         json.put("prices", object->prices);
+        json.put("title", object->title);
     }
     return json;
 }
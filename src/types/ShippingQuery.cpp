@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    from,
+    invoicePayload,
+    shippingAddress,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"from", Field::from},
+    {"invoice_payload", Field::invoicePayload},
+    {"shipping_address", Field::shippingAddress},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<ShippingQuery> parse(const nlohmann::json &data) {
     auto result = std::make_shared<ShippingQuery>();
-    parse(data, "id", &result->id);
-    result->from = parseRequired<User>(data, "from");
-    parse(data, "invoice_payload", &result->invoicePayload);
-    result->shippingAddress = parseRequired<ShippingAddress>(data, "shipping_address");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::from:
+                result->from = parse<User>(value);
+                break;
+            case Field::invoicePayload:
+                detail::parseValue(value, &result->invoicePayload);
+                break;
+            case Field::shippingAddress:
+                result->shippingAddress = parse<ShippingAddress>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,8 +48,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<ShippingQuery> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("id", object->id);
         json.put("from", object->from);
+        json.put("id", object->id);
         json.put("invoice_payload", object->invoicePayload);
         json.put("shipping_address", object->shippingAddress);
     }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    amount,
+    nanostarAmount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"amount", Field::amount},
+    {"nanostar_amount", Field::nanostarAmount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<StarAmount> parse(const nlohmann::json &data) {
     auto result = std::make_shared<StarAmount>();
-    parse(data, "amount", &result->amount);
-    parse(data, "nanostar_amount", &result->nanostarAmount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::amount:
+                detail::parseValue(value, &result->amount);
+                break;
+            case Field::nanostarAmount:
+                detail::parseValue(value, &result->nanostarAmount);
+                break;
+        }
+    });
     return result;
 }
 
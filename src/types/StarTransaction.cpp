@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    amount,
+    nanostarAmount,
+    date,
+    source,
+    receiver,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"amount", Field::amount},
+    {"nanostar_amount", Field::nanostarAmount},
+    {"date", Field::date},
+    {"source", Field::source},
+    {"receiver", Field::receiver},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<StarTransaction> parse(const nlohmann::json &data) {
     auto result = std::make_shared<StarTransaction>();
-    parse(data, "id", &result->id);
-    parse(data, "amount", &result->amount);
-    parse(data, "nanostar_amount", &result->nanostarAmount);
-    parse(data, "date", &result->date);
-    result->source = parse<TransactionPartner>(data, "source");
-    result->receiver = parse<TransactionPartner>(data, "receiver");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::amount:
+                detail::parseValue(value, &result->amount);
+                break;
+            case Field::nanostarAmount:
+                detail::parseValue(value, &result->nanostarAmount);
+                break;
+            case Field::date:
+                detail::parseValue(value, &result->date);
+                break;
+            case Field::source:
+                result->source = parse<TransactionPartner>(value);
+                break;
+            case Field::receiver:
+                result->receiver = parse<TransactionPartner>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<StarTransaction> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("id", object->id);
         json.put("amount", object->amount);
-        json.put("nanostar_amount", object->nanostarAmount);
         json.put("date", object->date);
-        json.put("source", object->source);
+        json.put("id", object->id);
+        json.put("nanostar_amount", object->nanostarAmount);
         json.put("receiver", object->receiver);
+        json.put("source", object->source);
     }
     return json;
 }
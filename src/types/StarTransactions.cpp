@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    transactions,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"transactions", Field::transactions},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<StarTransactions> parse(const nlohmann::json &data) {
     auto result = std::make_shared<StarTransactions>();
-    result->transactions = parseRequiredArray<StarTransaction>(data, "transactions");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::transactions:
+                result->transactions = parseArray<StarTransaction>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -1,3 +1,4 @@
+#include <tgbot/ParseCache.h>
 #include <tgbot/TgTypeParser.h>
 #include <tgbot/types/Sticker.h>
 #include <nlohmann/json.hpp>
@@ -6,6 +7,10 @@ namespace TgBot {
 
 template <>
 std::shared_ptr<Sticker> parse(const nlohmann::json &data) {
+    const auto key = detail::cacheKey(detail::CachedType::Sticker, data);
+    if (auto cached = detail::findCached<Sticker>(key)) {
+        return cached;
+    }
     auto result = std::make_shared<Sticker>();
     parse(data, "file_id", &result->fileId);
     parse(data, "file_unique_id", &result->fileUniqueId);
@@ -31,6 +36,7 @@ std::shared_ptr<Sticker> parse(const nlohmann::json &data) {
     parse(data, "custom_emoji_id", &result->customEmojiId);
     parse(data, "needs_repainting", &result->needsRepainting);
     parse(data, "file_size", &result->fileSize);
+    detail::storeCached(key, result);
     return result;
 }
 
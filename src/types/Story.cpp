@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    chat,
+    id,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"chat", Field::chat},
+    {"id", Field::id},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Story> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Story>();
-    result->chat = parseRequired<Chat>(data, "chat");
-    parse(data, "id", &result->id);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    position,
+    type,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"position", Field::position},
+    {"type", Field::type},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<StoryArea> parse(const nlohmann::json &data) {
     auto result = std::make_shared<StoryArea>();
-    result->position = parseRequired<StoryAreaPosition>(data, "position");
-    result->type = parseRequired<StoryAreaType>(data, "type");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::position:
+                result->position = parse<StoryAreaPosition>(value);
+                break;
+            case Field::type:
+                result->type = parse<StoryAreaType>(value);
+                break;
+        }
+    });
     return result;
 }
 
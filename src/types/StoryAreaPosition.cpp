@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    xPercentage,
+    yPercentage,
+    widthPercentage,
+    heightPercentage,
+    rotationAngle,
+    cornerRadiusPercentage,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"x_percentage", Field::xPercentage},
+    {"y_percentage", Field::yPercentage},
+    {"width_percentage", Field::widthPercentage},
+    {"height_percentage", Field::heightPercentage},
+    {"rotation_angle", Field::rotationAngle},
+    {"corner_radius_percentage", Field::cornerRadiusPercentage},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<StoryAreaPosition> parse(const nlohmann::json &data) {
     auto result = std::make_shared<StoryAreaPosition>();
-    parse(data, "x_percentage", &result->xPercentage);
-    parse(data, "y_percentage", &result->yPercentage);
-    parse(data, "width_percentage", &result->widthPercentage);
-    parse(data, "height_percentage", &result->heightPercentage);
-    parse(data, "rotation_angle", &result->rotationAngle);
-    parse(data, "corner_radius_percentage", &result->cornerRadiusPercentage);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::xPercentage:
+                detail::parseValue(value, &result->xPercentage);
+                break;
+            case Field::yPercentage:
+                detail::parseValue(value, &result->yPercentage);
+                break;
+            case Field::widthPercentage:
+                detail::parseValue(value, &result->widthPercentage);
+                break;
+            case Field::heightPercentage:
+                detail::parseValue(value, &result->heightPercentage);
+                break;
+            case Field::rotationAngle:
+                detail::parseValue(value, &result->rotationAngle);
+                break;
+            case Field::cornerRadiusPercentage:
+                detail::parseValue(value, &result->cornerRadiusPercentage);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<StoryAreaPosition> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("x_percentage", object->xPercentage);
-        json.put("y_percentage", object->yPercentage);
-        json.put("width_percentage", object->widthPercentage);
+        json.put("corner_radius_percentage", object->cornerRadiusPercentage);
         json.put("height_percentage", object->heightPercentage);
         json.put("rotation_angle", object->rotationAngle);
-        json.put("corner_radius_percentage", object->cornerRadiusPercentage);
+        json.put("width_percentage", object->widthPercentage);
+        json.put("x_percentage", object->xPercentage);
+        json.put("y_percentage", object->yPercentage);
     }
     return json;
 }
@@ -9,46 +9,28 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<StoryAreaType>>({
+    {"location", detail::subtype<StoryAreaType, StoryAreaTypeLocation>()},
+    {"suggested_reaction", detail::subtype<StoryAreaType, StoryAreaTypeSuggestedReaction>()},
+    {"link", detail::subtype<StoryAreaType, StoryAreaTypeLink>()},
+    {"weather", detail::subtype<StoryAreaType, StoryAreaTypeWeather>()},
+    {"unique_gift", detail::subtype<StoryAreaType, StoryAreaTypeUniqueGift>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<StoryAreaType> parse(const nlohmann::json &data) {
-    std::string type;
-    StoryAreaType::Ptr result;
-    parse(data, "type", &type);
-    if (type == "location") {
-        result = parse<StoryAreaTypeLocation>(data);
-    } else if (type == "suggested_reaction") {
-        result = parse<StoryAreaTypeSuggestedReaction>(data);
-    } else if (type == "link") {
-        result = parse<StoryAreaTypeLink>(data);
-    } else if (type == "weather") {
-        result = parse<StoryAreaTypeWeather>(data);
-    } else if (type == "unique_gift") {
-        result = parse<StoryAreaTypeUniqueGift>(data);
-    } else {
-        throw invalidType("StoryAreaType", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "StoryAreaType");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<StoryAreaType> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "location") {
-            json += put<StoryAreaTypeLocation>(object);
-        } else if (object->type == "suggested_reaction") {
-            json += put<StoryAreaTypeSuggestedReaction>(object);
-        } else if (object->type == "link") {
-            json += put<StoryAreaTypeLink>(object);
-        } else if (object->type == "weather") {
-            json += put<StoryAreaTypeWeather>(object);
-        } else if (object->type == "unique_gift") {
-            json += put<StoryAreaTypeUniqueGift>(object);
-        } else {
-            throw invalidType("StoryAreaType", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "StoryAreaType");
     }
     return json;
 }
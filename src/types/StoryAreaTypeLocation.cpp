@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    latitude,
+    longitude,
+    address,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"latitude", Field::latitude},
+    {"longitude", Field::longitude},
+    {"address", Field::address},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<StoryAreaTypeLocation> parse(const nlohmann::json &data) {
     auto result = std::make_shared<StoryAreaTypeLocation>();
-    parse(data, "type", &result->type);
-    parse(data, "latitude", &result->latitude);
-    parse(data, "longitude", &result->longitude);
-    result->address = parse<LocationAddress>(data, "address");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::latitude:
+                detail::parseValue(value, &result->latitude);
+                break;
+            case Field::longitude:
+                detail::parseValue(value, &result->longitude);
+                break;
+            case Field::address:
+                result->address = parse<LocationAddress>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<StoryAreaTypeLocation> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
+        json.put("address", object->address);
         json.put("latitude", object->latitude);
         json.put("longitude", object->longitude);
-        json.put("address", object->address);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    reactionType,
+    isDark,
+    isFlipped,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"reaction_type", Field::reactionType},
+    {"is_dark", Field::isDark},
+    {"is_flipped", Field::isFlipped},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<StoryAreaTypeSuggestedReaction> parse(const nlohmann::json &data) {
     auto result = std::make_shared<StoryAreaTypeSuggestedReaction>();
-    parse(data, "type", &result->type);
-    result->reactionType = parseRequired<ReactionType>(data, "reaction_type");
-    parse(data, "is_dark", &result->isDark);
-    parse(data, "is_flipped", &result->isFlipped);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::reactionType:
+                result->reactionType = parse<ReactionType>(value);
+                break;
+            case Field::isDark:
+                detail::parseValue(value, &result->isDark);
+                break;
+            case Field::isFlipped:
+                detail::parseValue(value, &result->isFlipped);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<StoryAreaTypeSuggestedReaction> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("reaction_type", object->reactionType);
         json.put("is_dark", object->isDark);
         json.put("is_flipped", object->isFlipped);
+        json.put("reaction_type", object->reactionType);
+        json.put("type", object->type);
     }
     return json;
 }
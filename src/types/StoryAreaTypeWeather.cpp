@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    temperature,
+    emoji,
+    backgroundColor,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"temperature", Field::temperature},
+    {"emoji", Field::emoji},
+    {"background_color", Field::backgroundColor},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<StoryAreaTypeWeather> parse(const nlohmann::json &data) {
     auto result = std::make_shared<StoryAreaTypeWeather>();
-    parse(data, "type", &result->type);
-    parse(data, "temperature", &result->temperature);
-    parse(data, "emoji", &result->emoji);
-    parse(data, "background_color", &result->backgroundColor);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::temperature:
+                detail::parseValue(value, &result->temperature);
+                break;
+            case Field::emoji:
+                detail::parseValue(value, &result->emoji);
+                break;
+            case Field::backgroundColor:
+                detail::parseValue(value, &result->backgroundColor);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<StoryAreaTypeWeather> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("temperature", object->temperature);
-        json.put("emoji", object->emoji);
         json.put("background_color", object->backgroundColor);
+        json.put("emoji", object->emoji);
+        json.put("temperature", object->temperature);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    currency,
+    totalAmount,
+    invoicePayload,
+    subscriptionExpirationDate,
+    isRecurring,
+    isFirstRecurring,
+    shippingOptionId,
+    orderInfo,
+    telegramPaymentChargeId,
+    providerPaymentChargeId,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"currency", Field::currency},
+    {"total_amount", Field::totalAmount},
+    {"invoice_payload", Field::invoicePayload},
+    {"subscription_expiration_date", Field::subscriptionExpirationDate},
+    {"is_recurring", Field::isRecurring},
+    {"is_first_recurring", Field::isFirstRecurring},
+    {"shipping_option_id", Field::shippingOptionId},
+    {"order_info", Field::orderInfo},
+    {"telegram_payment_charge_id", Field::telegramPaymentChargeId},
+    {"provider_payment_charge_id", Field::providerPaymentChargeId},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SuccessfulPayment> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SuccessfulPayment>();
-    parse(data, "currency", &result->currency);
-    parse(data, "total_amount", &result->totalAmount);
-    parse(data, "invoice_payload", &result->invoicePayload);
-    parse(data, "subscription_expiration_date", &result->subscriptionExpirationDate);
-    parse(data, "is_recurring", &result->isRecurring);
-    parse(data, "is_first_recurring", &result->isFirstRecurring);
-    parse(data, "shipping_option_id", &result->shippingOptionId);
-    result->orderInfo = parse<OrderInfo>(data, "order_info");
-    parse(data, "telegram_payment_charge_id", &result->telegramPaymentChargeId);
-    parse(data, "provider_payment_charge_id", &result->providerPaymentChargeId);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::currency:
+                detail::parseValue(value, &result->currency);
+                break;
+            case Field::totalAmount:
+                detail::parseValue(value, &result->totalAmount);
+                break;
+            case Field::invoicePayload:
+                detail::parseValue(value, &result->invoicePayload);
+                break;
+            case Field::subscriptionExpirationDate:
+                detail::parseValue(value, &result->subscriptionExpirationDate);
+                break;
+            case Field::isRecurring:
+                detail::parseValue(value, &result->isRecurring);
+                break;
+            case Field::isFirstRecurring:
+                detail::parseValue(value, &result->isFirstRecurring);
+                break;
+            case Field::shippingOptionId:
+                detail::parseValue(value, &result->shippingOptionId);
+                break;
+            case Field::orderInfo:
+                result->orderInfo = parse<OrderInfo>(value);
+                break;
+            case Field::telegramPaymentChargeId:
+                detail::parseValue(value, &result->telegramPaymentChargeId);
+                break;
+            case Field::providerPaymentChargeId:
+                detail::parseValue(value, &result->providerPaymentChargeId);
+                break;
+        }
+    });
     return result;
 }
 
@@ -25,15 +79,15 @@ nlohmann::json put(const std::shared_ptr<SuccessfulPayment> &object) {
     JsonWrapper json;
     if (object) {
         json.put("currency", object->currency);
-        json.put("total_amount", object->totalAmount);
         json.put("invoice_payload", object->invoicePayload);
-        json.put("subscription_expiration_date", object->subscriptionExpirationDate);
-        json.put("is_recurring", object->isRecurring);
         json.put("is_first_recurring", object->isFirstRecurring);
-        json.put("shipping_option_id", object->shippingOptionId);
+        json.put("is_recurring", object->isRecurring);
         json.put("order_info", object->orderInfo);
-        json.put("telegram_payment_charge_id", object->telegramPaymentChargeId);
         json.put("provider_payment_charge_id", object->providerPaymentChargeId);
+        json.put("shipping_option_id", object->shippingOptionId);
+        json.put("subscription_expiration_date", object->subscriptionExpirationDate);
+        json.put("telegram_payment_charge_id", object->telegramPaymentChargeId);
+        json.put("total_amount", object->totalAmount);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    suggestedPostMessage,
+    price,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"suggested_post_message", Field::suggestedPostMessage},
+    {"price", Field::price},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SuggestedPostApprovalFailed> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SuggestedPostApprovalFailed>();
-    result->suggestedPostMessage = parse<Message>(data, "suggested_post_message");
-    result->price = parseRequired<SuggestedPostPrice>(data, "price");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::suggestedPostMessage:
+                result->suggestedPostMessage = parse<Message>(value);
+                break;
+            case Field::price:
+                result->price = parse<SuggestedPostPrice>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<SuggestedPostApprovalFailed> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("suggested_post_message", object->suggestedPostMessage);
         json.put("price", object->price);
+        json.put("suggested_post_message", object->suggestedPostMessage);
     }
     return json;
 }
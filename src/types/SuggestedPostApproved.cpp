@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    suggestedPostMessage,
+    price,
+    sendDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"suggested_post_message", Field::suggestedPostMessage},
+    {"price", Field::price},
+    {"send_date", Field::sendDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SuggestedPostApproved> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SuggestedPostApproved>();
-    result->suggestedPostMessage = parse<Message>(data, "suggested_post_message");
-    result->price = parse<SuggestedPostPrice>(data, "price");
-    parse(data, "send_date", &result->sendDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::suggestedPostMessage:
+                result->suggestedPostMessage = parse<Message>(value);
+                break;
+            case Field::price:
+                result->price = parse<SuggestedPostPrice>(value);
+                break;
+            case Field::sendDate:
+                detail::parseValue(value, &result->sendDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<SuggestedPostApproved> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("suggested_post_message", object->suggestedPostMessage);
         json.put("price", object->price);
         json.put("send_date", object->sendDate);
+        json.put("suggested_post_message", object->suggestedPostMessage);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    suggestedPostMessage,
+    comment,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"suggested_post_message", Field::suggestedPostMessage},
+    {"comment", Field::comment},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SuggestedPostDeclined> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SuggestedPostDeclined>();
-    result->suggestedPostMessage = parse<Message>(data, "suggested_post_message");
-    parse(data, "comment", &result->comment);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::suggestedPostMessage:
+                result->suggestedPostMessage = parse<Message>(value);
+                break;
+            case Field::comment:
+                detail::parseValue(value, &result->comment);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<SuggestedPostDeclined> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("suggested_post_message", object->suggestedPostMessage);
         json.put("comment", object->comment);
+        json.put("suggested_post_message", object->suggestedPostMessage);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    state,
+    price,
+    sendDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"state", Field::state},
+    {"price", Field::price},
+    {"send_date", Field::sendDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SuggestedPostInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SuggestedPostInfo>();
-    parse(data, "state", &result->state);
-    result->price = parse<SuggestedPostPrice>(data, "price");
-    parse(data, "send_date", &result->sendDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::state:
+                detail::parseValue(value, &result->state);
+                break;
+            case Field::price:
+                result->price = parse<SuggestedPostPrice>(value);
+                break;
+            case Field::sendDate:
+                detail::parseValue(value, &result->sendDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<SuggestedPostInfo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("state", object->state);
         json.put("price", object->price);
         json.put("send_date", object->sendDate);
+        json.put("state", object->state);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    suggestedPostMessage,
+    currency,
+    amount,
+    starAmount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"suggested_post_message", Field::suggestedPostMessage},
+    {"currency", Field::currency},
+    {"amount", Field::amount},
+    {"star_amount", Field::starAmount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SuggestedPostPaid> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SuggestedPostPaid>();
-    result->suggestedPostMessage = parse<Message>(data, "suggested_post_message");
-    parse(data, "currency", &result->currency);
-    parse(data, "amount", &result->amount);
-    result->starAmount = parse<StarAmount>(data, "star_amount");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::suggestedPostMessage:
+                result->suggestedPostMessage = parse<Message>(value);
+                break;
+            case Field::currency:
+                detail::parseValue(value, &result->currency);
+                break;
+            case Field::amount:
+                detail::parseValue(value, &result->amount);
+                break;
+            case Field::starAmount:
+                result->starAmount = parse<StarAmount>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<SuggestedPostPaid> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("suggested_post_message", object->suggestedPostMessage);
-        json.put("currency", object->currency);
         json.put("amount", object->amount);
+        json.put("currency", object->currency);
         json.put("star_amount", object->starAmount);
+        json.put("suggested_post_message", object->suggestedPostMessage);
     }
     return json;
 }
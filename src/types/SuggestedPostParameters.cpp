@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    price,
+    sendDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"price", Field::price},
+    {"send_date", Field::sendDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SuggestedPostParameters> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SuggestedPostParameters>();
-    result->price = parse<SuggestedPostPrice>(data, "price");
-    parse(data, "send_date", &result->sendDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::price:
+                result->price = parse<SuggestedPostPrice>(value);
+                break;
+            case Field::sendDate:
+                detail::parseValue(value, &result->sendDate);
+                break;
+        }
+    });
     return result;
 }
 
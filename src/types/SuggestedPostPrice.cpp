@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    currency,
+    amount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"currency", Field::currency},
+    {"amount", Field::amount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SuggestedPostPrice> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SuggestedPostPrice>();
-    parse(data, "currency", &result->currency);
-    parse(data, "amount", &result->amount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::currency:
+                detail::parseValue(value, &result->currency);
+                break;
+            case Field::amount:
+                detail::parseValue(value, &result->amount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<SuggestedPostPrice> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("currency", object->currency);
         json.put("amount", object->amount);
+        json.put("currency", object->currency);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    suggestedPostMessage,
+    reason,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"suggested_post_message", Field::suggestedPostMessage},
+    {"reason", Field::reason},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SuggestedPostRefunded> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SuggestedPostRefunded>();
-    result->suggestedPostMessage = parse<Message>(data, "suggested_post_message");
-    parse(data, "reason", &result->reason);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::suggestedPostMessage:
+                result->suggestedPostMessage = parse<Message>(value);
+                break;
+            case Field::reason:
+                detail::parseValue(value, &result->reason);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<SuggestedPostRefunded> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("suggested_post_message", object->suggestedPostMessage);
         json.put("reason", object->reason);
+        json.put("suggested_post_message", object->suggestedPostMessage);
     }
     return json;
 }
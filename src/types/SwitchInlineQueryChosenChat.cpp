@@ -4,14 +4,48 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    query,
+    allowUserChats,
+    allowBotChats,
+    allowGroupChats,
+    allowChannelChats,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"query", Field::query},
+    {"allow_user_chats", Field::allowUserChats},
+    {"allow_bot_chats", Field::allowBotChats},
+    {"allow_group_chats", Field::allowGroupChats},
+    {"allow_channel_chats", Field::allowChannelChats},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<SwitchInlineQueryChosenChat> parse(const nlohmann::json &data) {
     auto result = std::make_shared<SwitchInlineQueryChosenChat>();
-    parse(data, "query", &result->query);
-    parse(data, "allow_user_chats", &result->allowUserChats);
-    parse(data, "allow_bot_chats", &result->allowBotChats);
-    parse(data, "allow_group_chats", &result->allowGroupChats);
-    parse(data, "allow_channel_chats", &result->allowChannelChats);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::query:
+                detail::parseValue(value, &result->query);
+                break;
+            case Field::allowUserChats:
+                detail::parseValue(value, &result->allowUserChats);
+                break;
+            case Field::allowBotChats:
+                detail::parseValue(value, &result->allowBotChats);
+                break;
+            case Field::allowGroupChats:
+                detail::parseValue(value, &result->allowGroupChats);
+                break;
+            case Field::allowChannelChats:
+                detail::parseValue(value, &result->allowChannelChats);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,11 +53,11 @@ template <>
 nlohmann::json put(const std::shared_ptr<SwitchInlineQueryChosenChat> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("query", object->query);
-        json.put("allow_user_chats", object->allowUserChats);
         json.put("allow_bot_chats", object->allowBotChats);
-        json.put("allow_group_chats", object->allowGroupChats);
         json.put("allow_channel_chats", object->allowChannelChats);
+        json.put("allow_group_chats", object->allowGroupChats);
+        json.put("allow_user_chats", object->allowUserChats);
+        json.put("query", object->query);
     }
     return json;
 }
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    text,
+    entities,
+    position,
+    isManual,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"text", Field::text},
+    {"entities", Field::entities},
+    {"position", Field::position},
+    {"is_manual", Field::isManual},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<TextQuote> parse(const nlohmann::json &data) {
     auto result = std::make_shared<TextQuote>();
-    parse(data, "text", &result->text);
-    result->entities = parseArray<MessageEntity>(data, "entities");
-    parse(data, "position", &result->position);
-    parse(data, "is_manual", &result->isManual);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::text:
+                detail::parseValue(value, &result->text);
+                break;
+            case Field::entities:
+                result->entities = parseArray<MessageEntity>(value);
+                break;
+            case Field::position:
+                detail::parseValue(value, &result->position);
+                break;
+            case Field::isManual:
+                detail::parseValue(value, &result->isManual);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<TextQuote> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("text", object->text);
         json.put("entities", object->entities);
-        json.put("position", object->position);
         json.put("is_manual", object->isManual);
+        json.put("position", object->position);
+        json.put("text", object->text);
     }
     return json;
 }
@@ -11,54 +11,30 @@
 
 namespace TgBot {
 
+namespace {
+
+constexpr auto subtypes = detail::makeTypeTable<detail::Subtype<TransactionPartner>>({
+    {"user", detail::subtype<TransactionPartner, TransactionPartnerUser>()},
+    {"chat", detail::subtype<TransactionPartner, TransactionPartnerChat>()},
+    {"affiliate_program", detail::subtype<TransactionPartner, TransactionPartnerAffiliateProgram>()},
+    {"fragment", detail::subtype<TransactionPartner, TransactionPartnerFragment>()},
+    {"telegram_ads", detail::subtype<TransactionPartner, TransactionPartnerTelegramAds>()},
+    {"telegram_api", detail::subtype<TransactionPartner, TransactionPartnerTelegramApi>()},
+    {"other", detail::subtype<TransactionPartner, TransactionPartnerOther>()},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<TransactionPartner> parse(const nlohmann::json &data) {
-    std::string type;
-    TransactionPartner::Ptr result;
-    parse(data, "type", &type);
-    if (type == "user") {
-        result = parse<TransactionPartnerUser>(data);
-    } else if (type == "chat") {
-        result = parse<TransactionPartnerChat>(data);
-    } else if (type == "affiliate_program") {
-        result = parse<TransactionPartnerAffiliateProgram>(data);
-    } else if (type == "fragment") {
-        result = parse<TransactionPartnerFragment>(data);
-    } else if (type == "telegram_ads") {
-        result = parse<TransactionPartnerTelegramAds>(data);
-    } else if (type == "telegram_api") {
-        result = parse<TransactionPartnerTelegramApi>(data);
-    } else if (type == "other") {
-        result = parse<TransactionPartnerOther>(data);
-    } else {
-        throw invalidType("TransactionPartner", type);
-    }
-
-    return result;
+    return detail::parseSubtype(data, "type", subtypes, "TransactionPartner");
 }
 
 template <>
 nlohmann::json put(const std::shared_ptr<TransactionPartner> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        if (object->type == "user") {
-            json += put<TransactionPartnerUser>(object);
-        } else if (object->type == "chat") {
-            json += put<TransactionPartnerChat>(object);
-        } else if (object->type == "affiliate_program") {
-            json += put<TransactionPartnerAffiliateProgram>(object);
-        } else if (object->type == "fragment") {
-            json += put<TransactionPartnerFragment>(object);
-        } else if (object->type == "telegram_ads") {
-            json += put<TransactionPartnerTelegramAds>(object);
-        } else if (object->type == "telegram_api") {
-            json += put<TransactionPartnerTelegramApi>(object);
-        } else if (object->type == "other") {
-            json += put<TransactionPartnerOther>(object);
-        } else {
-            throw invalidType("TransactionPartner", object->type);
-        }
+        json = detail::putSubtype(object, object->type, subtypes, "TransactionPartner");
     }
     return json;
 }
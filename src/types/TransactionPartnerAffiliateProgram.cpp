@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    sponsorUser,
+    commissionPerMille,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"sponsor_user", Field::sponsorUser},
+    {"commission_per_mille", Field::commissionPerMille},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<TransactionPartnerAffiliateProgram> parse(const nlohmann::json &data) {
     auto result = std::make_shared<TransactionPartnerAffiliateProgram>();
-    parse(data, "type", &result->type);
-    result->sponsorUser = parse<User>(data, "sponsor_user");
-    parse(data, "commission_per_mille", &result->commissionPerMille);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::sponsorUser:
+                result->sponsorUser = parse<User>(value);
+                break;
+            case Field::commissionPerMille:
+                detail::parseValue(value, &result->commissionPerMille);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<TransactionPartnerAffiliateProgram> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("sponsor_user", object->sponsorUser);
         json.put("commission_per_mille", object->commissionPerMille);
+        json.put("sponsor_user", object->sponsorUser);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    chat,
+    gift,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"chat", Field::chat},
+    {"gift", Field::gift},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<TransactionPartnerChat> parse(const nlohmann::json &data) {
     auto result = std::make_shared<TransactionPartnerChat>();
-    parse(data, "type", &result->type);
-    result->chat = parseRequired<Chat>(data, "chat");
-    result->gift = parse<Gift>(data, "gift");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::chat:
+                result->chat = parse<Chat>(value);
+                break;
+            case Field::gift:
+                result->gift = parse<Gift>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<TransactionPartnerChat> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("chat", object->chat);
         json.put("gift", object->gift);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    withdrawalState,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"withdrawal_state", Field::withdrawalState},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<TransactionPartnerFragment> parse(const nlohmann::json &data) {
     auto result = std::make_shared<TransactionPartnerFragment>();
-    parse(data, "type", &result->type);
-    result->withdrawalState = parse<RevenueWithdrawalState>(data, "withdrawal_state");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::withdrawalState:
+                result->withdrawalState = parse<RevenueWithdrawalState>(value);
+                break;
+        }
+    });
     return result;
 }
 
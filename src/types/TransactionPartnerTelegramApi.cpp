@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    requestCount,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"request_count", Field::requestCount},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<TransactionPartnerTelegramApi> parse(const nlohmann::json &data) {
     auto result = std::make_shared<TransactionPartnerTelegramApi>();
-    parse(data, "type", &result->type);
-    parse(data, "request_count", &result->requestCount);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::requestCount:
+                detail::parseValue(value, &result->requestCount);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<TransactionPartnerTelegramApi> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
         json.put("request_count", object->requestCount);
+        json.put("type", object->type);
     }
     return json;
 }
@@ -4,19 +4,73 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    type,
+    transactionType,
+    user,
+    affiliate,
+    invoicePayload,
+    subscriptionPeriod,
+    paidMedia,
+    paidMediaPayload,
+    gift,
+    premiumSubscriptionDuration,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"type", Field::type},
+    {"transaction_type", Field::transactionType},
+    {"user", Field::user},
+    {"affiliate", Field::affiliate},
+    {"invoice_payload", Field::invoicePayload},
+    {"subscription_period", Field::subscriptionPeriod},
+    {"paid_media", Field::paidMedia},
+    {"paid_media_payload", Field::paidMediaPayload},
+    {"gift", Field::gift},
+    {"premium_subscription_duration", Field::premiumSubscriptionDuration},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<TransactionPartnerUser> parse(const nlohmann::json &data) {
     auto result = std::make_shared<TransactionPartnerUser>();
-    parse(data, "type", &result->type);
-    parse(data, "transaction_type", &result->transactionType);
-    result->user = parseRequired<User>(data, "user");
-    result->affiliate = parse<AffiliateInfo>(data, "affiliate");
-    parse(data, "invoice_payload", &result->invoicePayload);
-    parse(data, "subscription_period", &result->subscriptionPeriod);
-    result->paidMedia = parseArray<PaidMedia>(data, "paid_media");
-    parse(data, "paid_media_payload", &result->paidMediaPayload);
-    result->gift = parse<Gift>(data, "gift");
-    parse(data, "premium_subscription_duration", &result->premiumSubscriptionDuration);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::type:
+                detail::parseValue(value, &result->type);
+                break;
+            case Field::transactionType:
+                detail::parseValue(value, &result->transactionType);
+                break;
+            case Field::user:
+                result->user = parse<User>(value);
+                break;
+            case Field::affiliate:
+                result->affiliate = parse<AffiliateInfo>(value);
+                break;
+            case Field::invoicePayload:
+                detail::parseValue(value, &result->invoicePayload);
+                break;
+            case Field::subscriptionPeriod:
+                detail::parseValue(value, &result->subscriptionPeriod);
+                break;
+            case Field::paidMedia:
+                result->paidMedia = parseArray<PaidMedia>(value);
+                break;
+            case Field::paidMediaPayload:
+                detail::parseValue(value, &result->paidMediaPayload);
+                break;
+            case Field::gift:
+                result->gift = parse<Gift>(value);
+                break;
+            case Field::premiumSubscriptionDuration:
+                detail::parseValue(value, &result->premiumSubscriptionDuration);
+                break;
+        }
+    });
     return result;
 }
 
@@ -24,16 +78,16 @@ template <>
 nlohmann::json put(const std::shared_ptr<TransactionPartnerUser> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("type", object->type);
-        json.put("transaction_type", object->transactionType);
-        json.put("user", object->user);
         json.put("affiliate", object->affiliate);
+        json.put("gift", object->gift);
         json.put("invoice_payload", object->invoicePayload);
-        json.put("subscription_period", object->subscriptionPeriod);
         json.put("paid_media", object->paidMedia);
         json.put("paid_media_payload", object->paidMediaPayload);
-        json.put("gift", object->gift);
         json.put("premium_subscription_duration", object->premiumSubscriptionDuration);
+        json.put("subscription_period", object->subscriptionPeriod);
+        json.put("transaction_type", object->transactionType);
+        json.put("type", object->type);
+        json.put("user", object->user);
     }
     return json;
 }
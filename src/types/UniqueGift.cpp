@@ -4,21 +4,83 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    giftId,
+    baseName,
+    name,
+    number,
+    model,
+    symbol,
+    backdrop,
+    isPremium,
+    isBurned,
+    isFromBlockchain,
+    colors,
+    publisherChat,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"gift_id", Field::giftId},
+    {"base_name", Field::baseName},
+    {"name", Field::name},
+    {"number", Field::number},
+    {"model", Field::model},
+    {"symbol", Field::symbol},
+    {"backdrop", Field::backdrop},
+    {"is_premium", Field::isPremium},
+    {"is_burned", Field::isBurned},
+    {"is_from_blockchain", Field::isFromBlockchain},
+    {"colors", Field::colors},
+    {"publisher_chat", Field::publisherChat},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UniqueGift> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UniqueGift>();
-    parse(data, "gift_id", &result->giftId);
-    parse(data, "base_name", &result->baseName);
-    parse(data, "name", &result->name);
-    parse(data, "number", &result->number);
-    result->model = parseRequired<UniqueGiftModel>(data, "model");
-    result->symbol = parseRequired<UniqueGiftSymbol>(data, "symbol");
-    result->backdrop = parseRequired<UniqueGiftBackdrop>(data, "backdrop");
-    parse(data, "is_premium", &result->isPremium);
-    parse(data, "is_burned", &result->isBurned);
-    parse(data, "is_from_blockchain", &result->isFromBlockchain);
-    result->colors = parse<UniqueGiftColors>(data, "colors");
-    result->publisherChat = parse<Chat>(data, "publisher_chat");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::giftId:
+                detail::parseValue(value, &result->giftId);
+                break;
+            case Field::baseName:
+                detail::parseValue(value, &result->baseName);
+                break;
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+            case Field::number:
+                detail::parseValue(value, &result->number);
+                break;
+            case Field::model:
+                result->model = parse<UniqueGiftModel>(value);
+                break;
+            case Field::symbol:
+                result->symbol = parse<UniqueGiftSymbol>(value);
+                break;
+            case Field::backdrop:
+                result->backdrop = parse<UniqueGiftBackdrop>(value);
+                break;
+            case Field::isPremium:
+                detail::parseValue(value, &result->isPremium);
+                break;
+            case Field::isBurned:
+                detail::parseValue(value, &result->isBurned);
+                break;
+            case Field::isFromBlockchain:
+                detail::parseValue(value, &result->isFromBlockchain);
+                break;
+            case Field::colors:
+                result->colors = parse<UniqueGiftColors>(value);
+                break;
+            case Field::publisherChat:
+                result->publisherChat = parse<Chat>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -26,18 +88,18 @@ template <>
 nlohmann::json put(const std::shared_ptr<UniqueGift> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("gift_id", object->giftId);
-        json.put("base_name", object->baseName);
-        json.put("name", object->name);
-        json.put("number", object->number);
-        json.put("model", object->model);
-        json.put("symbol", object->symbol);
         json.put("backdrop", object->backdrop);
-        json.put("is_premium", object->isPremium);
+        json.put("base_name", object->baseName);
+        json.put("colors", object->colors);
+        json.put("gift_id", object->giftId);
         json.put("is_burned", object->isBurned);
         json.put("is_from_blockchain", object->isFromBlockchain);
-        json.put("colors", object->colors);
+        json.put("is_premium", object->isPremium);
+        json.put("model", object->model);
+        json.put("name", object->name);
+        json.put("number", object->number);
         json.put("publisher_chat", object->publisherChat);
+        json.put("symbol", object->symbol);
     }
     return json;
 }
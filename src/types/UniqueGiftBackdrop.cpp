@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    name,
+    colors,
+    rarityPerMille,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"name", Field::name},
+    {"colors", Field::colors},
+    {"rarity_per_mille", Field::rarityPerMille},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UniqueGiftBackdrop> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UniqueGiftBackdrop>();
-    parse(data, "name", &result->name);
-    result->colors = parseRequired<UniqueGiftBackdropColors>(data, "colors");
-    parse(data, "rarity_per_mille", &result->rarityPerMille);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+            case Field::colors:
+                result->colors = parse<UniqueGiftBackdropColors>(value);
+                break;
+            case Field::rarityPerMille:
+                detail::parseValue(value, &result->rarityPerMille);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,8 +43,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<UniqueGiftBackdrop> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("name", object->name);
         json.put("colors", object->colors);
+        json.put("name", object->name);
         json.put("rarity_per_mille", object->rarityPerMille);
     }
     return json;
@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    centerColor,
+    edgeColor,
+    symbolColor,
+    textColor,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"center_color", Field::centerColor},
+    {"edge_color", Field::edgeColor},
+    {"symbol_color", Field::symbolColor},
+    {"text_color", Field::textColor},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UniqueGiftBackdropColors> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UniqueGiftBackdropColors>();
-    parse(data, "center_color", &result->centerColor);
-    parse(data, "edge_color", &result->edgeColor);
-    parse(data, "symbol_color", &result->symbolColor);
-    parse(data, "text_color", &result->textColor);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::centerColor:
+                detail::parseValue(value, &result->centerColor);
+                break;
+            case Field::edgeColor:
+                detail::parseValue(value, &result->edgeColor);
+                break;
+            case Field::symbolColor:
+                detail::parseValue(value, &result->symbolColor);
+                break;
+            case Field::textColor:
+                detail::parseValue(value, &result->textColor);
+                break;
+        }
+    });
     return result;
 }
 
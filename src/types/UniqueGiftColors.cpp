@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    modelCustomEmojiId,
+    symbolCustomEmojiId,
+    lightThemeMainColor,
+    lightThemeOtherColors,
+    darkThemeMainColor,
+    darkThemeOtherColors,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"model_custom_emoji_id", Field::modelCustomEmojiId},
+    {"symbol_custom_emoji_id", Field::symbolCustomEmojiId},
+    {"light_theme_main_color", Field::lightThemeMainColor},
+    {"light_theme_other_colors", Field::lightThemeOtherColors},
+    {"dark_theme_main_color", Field::darkThemeMainColor},
+    {"dark_theme_other_colors", Field::darkThemeOtherColors},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UniqueGiftColors> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UniqueGiftColors>();
-    parse(data, "model_custom_emoji_id", &result->modelCustomEmojiId);
-    parse(data, "symbol_custom_emoji_id", &result->symbolCustomEmojiId);
-    parse(data, "light_theme_main_color", &result->lightThemeMainColor);
-    result->lightThemeOtherColors = parsePrimitiveRequiredArray<std::int64_t>(data, "light_theme_other_colors");
-    parse(data, "dark_theme_main_color", &result->darkThemeMainColor);
-    result->darkThemeOtherColors = parsePrimitiveRequiredArray<std::int64_t>(data, "dark_theme_other_colors");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::modelCustomEmojiId:
+                detail::parseValue(value, &result->modelCustomEmojiId);
+                break;
+            case Field::symbolCustomEmojiId:
+                detail::parseValue(value, &result->symbolCustomEmojiId);
+                break;
+            case Field::lightThemeMainColor:
+                detail::parseValue(value, &result->lightThemeMainColor);
+                break;
+            case Field::lightThemeOtherColors:
+                result->lightThemeOtherColors = parsePrimitiveArray<std::int64_t>(value);
+                break;
+            case Field::darkThemeMainColor:
+                detail::parseValue(value, &result->darkThemeMainColor);
+                break;
+            case Field::darkThemeOtherColors:
+                result->darkThemeOtherColors = parsePrimitiveArray<std::int64_t>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<UniqueGiftColors> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("model_custom_emoji_id", object->modelCustomEmojiId);
-        json.put("symbol_custom_emoji_id", object->symbolCustomEmojiId);
-        json.put("light_theme_main_color", object->lightThemeMainColor);
-        json.put("light_theme_other_colors", object->lightThemeOtherColors);
         json.put("dark_theme_main_color", object->darkThemeMainColor);
         json.put("dark_theme_other_colors", object->darkThemeOtherColors);
+        json.put("light_theme_main_color", object->lightThemeMainColor);
+        json.put("light_theme_other_colors", object->lightThemeOtherColors);
+        json.put("model_custom_emoji_id", object->modelCustomEmojiId);
+        json.put("symbol_custom_emoji_id", object->symbolCustomEmojiId);
     }
     return json;
 }
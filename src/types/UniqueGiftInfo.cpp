@@ -4,16 +4,58 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    gift,
+    origin,
+    lastResaleCurrency,
+    lastResaleAmount,
+    ownedGiftId,
+    transferStarCount,
+    nextTransferDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"gift", Field::gift},
+    {"origin", Field::origin},
+    {"last_resale_currency", Field::lastResaleCurrency},
+    {"last_resale_amount", Field::lastResaleAmount},
+    {"owned_gift_id", Field::ownedGiftId},
+    {"transfer_star_count", Field::transferStarCount},
+    {"next_transfer_date", Field::nextTransferDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UniqueGiftInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UniqueGiftInfo>();
-    result->gift = parseRequired<UniqueGift>(data, "gift");
-    parse(data, "origin", &result->origin);
-    parse(data, "last_resale_currency", &result->lastResaleCurrency);
-    parse(data, "last_resale_amount", &result->lastResaleAmount);
-    parse(data, "owned_gift_id", &result->ownedGiftId);
-    parse(data, "transfer_star_count", &result->transferStarCount);
-    parse(data, "next_transfer_date", &result->nextTransferDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::gift:
+                result->gift = parse<UniqueGift>(value);
+                break;
+            case Field::origin:
+                detail::parseValue(value, &result->origin);
+                break;
+            case Field::lastResaleCurrency:
+                detail::parseValue(value, &result->lastResaleCurrency);
+                break;
+            case Field::lastResaleAmount:
+                detail::parseValue(value, &result->lastResaleAmount);
+                break;
+            case Field::ownedGiftId:
+                detail::parseValue(value, &result->ownedGiftId);
+                break;
+            case Field::transferStarCount:
+                detail::parseValue(value, &result->transferStarCount);
+                break;
+            case Field::nextTransferDate:
+                detail::parseValue(value, &result->nextTransferDate);
+                break;
+        }
+    });
     return result;
 }
 
@@ -22,12 +64,12 @@ nlohmann::json put(const std::shared_ptr<UniqueGiftInfo> &object) {
     JsonWrapper json;
     if (object) {
         json.put("gift", object->gift);
-        json.put("origin", object->origin);
-        json.put("last_resale_currency", object->lastResaleCurrency);
         json.put("last_resale_amount", object->lastResaleAmount);
+        json.put("last_resale_currency", object->lastResaleCurrency);
+        json.put("next_transfer_date", object->nextTransferDate);
+        json.put("origin", object->origin);
         json.put("owned_gift_id", object->ownedGiftId);
         json.put("transfer_star_count", object->transferStarCount);
-        json.put("next_transfer_date", object->nextTransferDate);
     }
     return json;
 }
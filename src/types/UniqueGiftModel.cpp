@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    name,
+    sticker,
+    rarityPerMille,
+    rarity,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"name", Field::name},
+    {"sticker", Field::sticker},
+    {"rarity_per_mille", Field::rarityPerMille},
+    {"rarity", Field::rarity},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UniqueGiftModel> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UniqueGiftModel>();
-    parse(data, "name", &result->name);
-    result->sticker = parseRequired<Sticker>(data, "sticker");
-    parse(data, "rarity_per_mille", &result->rarityPerMille);
-    parse(data, "rarity", &result->rarity);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+            case Field::sticker:
+                result->sticker = parse<Sticker>(value);
+                break;
+            case Field::rarityPerMille:
+                detail::parseValue(value, &result->rarityPerMille);
+                break;
+            case Field::rarity:
+                detail::parseValue(value, &result->rarity);
+                break;
+        }
+    });
     return result;
 }
 
@@ -19,9 +49,9 @@ nlohmann::json put(const std::shared_ptr<UniqueGiftModel> &object) {
     JsonWrapper json;
     if (object) {
         json.put("name", object->name);
-        json.put("sticker", object->sticker);
-        json.put("rarity_per_mille", object->rarityPerMille);
         json.put("rarity", object->rarity);
+        json.put("rarity_per_mille", object->rarityPerMille);
+        json.put("sticker", object->sticker);
     }
     return json;
 }
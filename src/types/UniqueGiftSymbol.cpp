@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    name,
+    sticker,
+    rarityPerMille,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"name", Field::name},
+    {"sticker", Field::sticker},
+    {"rarity_per_mille", Field::rarityPerMille},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UniqueGiftSymbol> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UniqueGiftSymbol>();
-    parse(data, "name", &result->name);
-    result->sticker = parseRequired<Sticker>(data, "sticker");
-    parse(data, "rarity_per_mille", &result->rarityPerMille);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::name:
+                detail::parseValue(value, &result->name);
+                break;
+            case Field::sticker:
+                result->sticker = parse<Sticker>(value);
+                break;
+            case Field::rarityPerMille:
+                detail::parseValue(value, &result->rarityPerMille);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,8 +44,8 @@ nlohmann::json put(const std::shared_ptr<UniqueGiftSymbol> &object) {
     JsonWrapper json;
     if (object) {
         json.put("name", object->name);
-        json.put("sticker", object->sticker);
         json.put("rarity_per_mille", object->rarityPerMille);
+        json.put("sticker", object->sticker);
     }
     return json;
 }
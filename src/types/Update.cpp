@@ -4,36 +4,158 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    updateId,
+    message,
+    editedMessage,
+    channelPost,
+    editedChannelPost,
+    businessConnection,
+    businessMessage,
+    editedBusinessMessage,
+    deletedBusinessMessages,
+    guestMessage,
+    messageReaction,
+    messageReactionCount,
+    inlineQuery,
+    chosenInlineResult,
+    callbackQuery,
+    shippingQuery,
+    preCheckoutQuery,
+    purchasedPaidMedia,
+    poll,
+    pollAnswer,
+    myChatMember,
+    chatMember,
+    chatJoinRequest,
+    chatBoost,
+    removedChatBoost,
+    managedBot,
+    subscription,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"update_id", Field::updateId},
+    {"message", Field::message},
+    {"edited_message", Field::editedMessage},
+    {"channel_post", Field::channelPost},
+    {"edited_channel_post", Field::editedChannelPost},
+    {"business_connection", Field::businessConnection},
+    {"business_message", Field::businessMessage},
+    {"edited_business_message", Field::editedBusinessMessage},
+    {"deleted_business_messages", Field::deletedBusinessMessages},
+    {"guest_message", Field::guestMessage},
+    {"message_reaction", Field::messageReaction},
+    {"message_reaction_count", Field::messageReactionCount},
+    {"inline_query", Field::inlineQuery},
+    {"chosen_inline_result", Field::chosenInlineResult},
+    {"callback_query", Field::callbackQuery},
+    {"shipping_query", Field::shippingQuery},
+    {"pre_checkout_query", Field::preCheckoutQuery},
+    {"purchased_paid_media", Field::purchasedPaidMedia},
+    {"poll", Field::poll},
+    {"poll_answer", Field::pollAnswer},
+    {"my_chat_member", Field::myChatMember},
+    {"chat_member", Field::chatMember},
+    {"chat_join_request", Field::chatJoinRequest},
+    {"chat_boost", Field::chatBoost},
+    {"removed_chat_boost", Field::removedChatBoost},
+    {"managed_bot", Field::managedBot},
+    {"subscription", Field::subscription},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Update> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Update>();
-    parse(data, "update_id", &result->updateId);
-    result->message = parse<Message>(data, "message");
-    result->editedMessage = parse<Message>(data, "edited_message");
-    result->channelPost = parse<Message>(data, "channel_post");
-    result->editedChannelPost = parse<Message>(data, "edited_channel_post");
-    result->businessConnection = parse<BusinessConnection>(data, "business_connection");
-    result->businessMessage = parse<Message>(data, "business_message");
-    result->editedBusinessMessage = parse<Message>(data, "edited_business_message");
-    result->deletedBusinessMessages = parse<BusinessMessagesDeleted>(data, "deleted_business_messages");
-    result->guestMessage = parse<Message>(data, "guest_message");
-    result->messageReaction = parse<MessageReactionUpdated>(data, "message_reaction");
-    result->messageReactionCount = parse<MessageReactionCountUpdated>(data, "message_reaction_count");
-    result->inlineQuery = parse<InlineQuery>(data, "inline_query");
-    result->chosenInlineResult = parse<ChosenInlineResult>(data, "chosen_inline_result");
-    result->callbackQuery = parse<CallbackQuery>(data, "callback_query");
-    result->shippingQuery = parse<ShippingQuery>(data, "shipping_query");
-    result->preCheckoutQuery = parse<PreCheckoutQuery>(data, "pre_checkout_query");
-    result->purchasedPaidMedia = parse<PaidMediaPurchased>(data, "purchased_paid_media");
-    result->poll = parse<Poll>(data, "poll");
-    result->pollAnswer = parse<PollAnswer>(data, "poll_answer");
-    result->myChatMember = parse<ChatMemberUpdated>(data, "my_chat_member");
-    result->chatMember = parse<ChatMemberUpdated>(data, "chat_member");
-    result->chatJoinRequest = parse<ChatJoinRequest>(data, "chat_join_request");
-    result->chatBoost = parse<ChatBoostUpdated>(data, "chat_boost");
-    result->removedChatBoost = parse<ChatBoostRemoved>(data, "removed_chat_boost");
-    result->managedBot = parse<ManagedBotUpdated>(data, "managed_bot");
-    result->subscription = parse<BotSubscriptionUpdated>(data, "subscription");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::updateId:
+                detail::parseValue(value, &result->updateId);
+                break;
+            case Field::message:
+                result->message = parse<Message>(value);
+                break;
+            case Field::editedMessage:
+                result->editedMessage = parse<Message>(value);
+                break;
+            case Field::channelPost:
+                result->channelPost = parse<Message>(value);
+                break;
+            case Field::editedChannelPost:
+                result->editedChannelPost = parse<Message>(value);
+                break;
+            case Field::businessConnection:
+                result->businessConnection = parse<BusinessConnection>(value);
+                break;
+            case Field::businessMessage:
+                result->businessMessage = parse<Message>(value);
+                break;
+            case Field::editedBusinessMessage:
+                result->editedBusinessMessage = parse<Message>(value);
+                break;
+            case Field::deletedBusinessMessages:
+                result->deletedBusinessMessages = parse<BusinessMessagesDeleted>(value);
+                break;
+            case Field::guestMessage:
+                result->guestMessage = parse<Message>(value);
+                break;
+            case Field::messageReaction:
+                result->messageReaction = parse<MessageReactionUpdated>(value);
+                break;
+            case Field::messageReactionCount:
+                result->messageReactionCount = parse<MessageReactionCountUpdated>(value);
+                break;
+            case Field::inlineQuery:
+                result->inlineQuery = parse<InlineQuery>(value);
+                break;
+            case Field::chosenInlineResult:
+                result->chosenInlineResult = parse<ChosenInlineResult>(value);
+                break;
+            case Field::callbackQuery:
+                result->callbackQuery = parse<CallbackQuery>(value);
+                break;
+            case Field::shippingQuery:
+                result->shippingQuery = parse<ShippingQuery>(value);
+                break;
+            case Field::preCheckoutQuery:
+                result->preCheckoutQuery = parse<PreCheckoutQuery>(value);
+                break;
+            case Field::purchasedPaidMedia:
+                result->purchasedPaidMedia = parse<PaidMediaPurchased>(value);
+                break;
+            case Field::poll:
+                result->poll = parse<Poll>(value);
+                break;
+            case Field::pollAnswer:
+                result->pollAnswer = parse<PollAnswer>(value);
+                break;
+            case Field::myChatMember:
+                result->myChatMember = parse<ChatMemberUpdated>(value);
+                break;
+            case Field::chatMember:
+                result->chatMember = parse<ChatMemberUpdated>(value);
+                break;
+            case Field::chatJoinRequest:
+                result->chatJoinRequest = parse<ChatJoinRequest>(value);
+                break;
+            case Field::chatBoost:
+                result->chatBoost = parse<ChatBoostUpdated>(value);
+                break;
+            case Field::removedChatBoost:
+                result->removedChatBoost = parse<ChatBoostRemoved>(value);
+                break;
+            case Field::managedBot:
+                result->managedBot = parse<ManagedBotUpdated>(value);
+                break;
+            case Field::subscription:
+                result->subscription = parse<BotSubscriptionUpdated>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -41,33 +163,33 @@ template <>
 nlohmann::json put(const std::shared_ptr<Update> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("update_id", object->updateId);
-        json.put("message", object->message);
-        json.put("edited_message", object->editedMessage);
-        json.put("channel_post", object->channelPost);
-        json.put("edited_channel_post", object->editedChannelPost);
         json.put("business_connection", object->businessConnection);
         json.put("business_message", object->businessMessage);
-        json.put("edited_business_message", object->editedBusinessMessage);
+        json.put("callback_query", object->callbackQuery);
+        json.put("channel_post", object->channelPost);
+        json.put("chat_boost", object->chatBoost);
+        json.put("chat_join_request", object->chatJoinRequest);
+        json.put("chat_member", object->chatMember);
+        json.put("chosen_inline_result", object->chosenInlineResult);
         json.put("deleted_business_messages", object->deletedBusinessMessages);
+        json.put("edited_business_message", object->editedBusinessMessage);
+        json.put("edited_channel_post", object->editedChannelPost);
+        json.put("edited_message", object->editedMessage);
         json.put("guest_message", object->guestMessage);
+        json.put("inline_query", object->inlineQuery);
+        json.put("managed_bot", object->managedBot);
+        json.put("message", object->message);
         json.put("message_reaction", object->messageReaction);
         json.put("message_reaction_count", object->messageReactionCount);
-        json.put("inline_query", object->inlineQuery);
-        json.put("chosen_inline_result", object->chosenInlineResult);
-        json.put("callback_query", object->callbackQuery);
-        json.put("shipping_query", object->shippingQuery);
-        json.put("pre_checkout_query", object->preCheckoutQuery);
-        json.put("purchased_paid_media", object->purchasedPaidMedia);
+        json.put("my_chat_member", object->myChatMember);
         json.put("poll", object->poll);
         json.put("poll_answer", object->pollAnswer);
-        json.put("my_chat_member", object->myChatMember);
-        json.put("chat_member", object->chatMember);
-        json.put("chat_join_request", object->chatJoinRequest);
-        json.put("chat_boost", object->chatBoost);
+        json.put("pre_checkout_query", object->preCheckoutQuery);
+        json.put("purchased_paid_media", object->purchasedPaidMedia);
         json.put("removed_chat_boost", object->removedChatBoost);
-        json.put("managed_bot", object->managedBot);
+        json.put("shipping_query", object->shippingQuery);
         json.put("subscription", object->subscription);
+        json.put("update_id", object->updateId);
     }
     return json;
 }
@@ -1,30 +1,122 @@
+#include <tgbot/ParseCache.h>
 #include <tgbot/TgTypeParser.h>
 #include <tgbot/types/User.h>
 #include <nlohmann/json.hpp>
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    id,
+    isBot,
+    firstName,
+    lastName,
+    username,
+    languageCode,
+    isPremium,
+    addedToAttachmentMenu,
+    canJoinGroups,
+    canReadAllGroupMessages,
+    supportsGuestQueries,
+    supportsInlineQueries,
+    canConnectToBusiness,
+    hasMainWebApp,
+    hasTopicsEnabled,
+    allowsUsersToCreateTopics,
+    canManageBots,
+    supportsJoinRequestQueries,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"id", Field::id},
+    {"is_bot", Field::isBot},
+    {"first_name", Field::firstName},
+    {"last_name", Field::lastName},
+    {"username", Field::username},
+    {"language_code", Field::languageCode},
+    {"is_premium", Field::isPremium},
+    {"added_to_attachment_menu", Field::addedToAttachmentMenu},
+    {"can_join_groups", Field::canJoinGroups},
+    {"can_read_all_group_messages", Field::canReadAllGroupMessages},
+    {"supports_guest_queries", Field::supportsGuestQueries},
+    {"supports_inline_queries", Field::supportsInlineQueries},
+    {"can_connect_to_business", Field::canConnectToBusiness},
+    {"has_main_web_app", Field::hasMainWebApp},
+    {"has_topics_enabled", Field::hasTopicsEnabled},
+    {"allows_users_to_create_topics", Field::allowsUsersToCreateTopics},
+    {"can_manage_bots", Field::canManageBots},
+    {"supports_join_request_queries", Field::supportsJoinRequestQueries},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<User> parse(const nlohmann::json &data) {
+    const auto key = detail::cacheKey(detail::CachedType::User, data);
+    if (auto cached = detail::findCached<User>(key)) {
+        return cached;
+    }
     auto result = std::make_shared<User>();
-    parse(data, "id", &result->id);
-    parse(data, "is_bot", &result->isBot);
-    parse(data, "first_name", &result->firstName);
-    parse(data, "last_name", &result->lastName);
-    parse(data, "username", &result->username);
-    parse(data, "language_code", &result->languageCode);
-    parse(data, "is_premium", &result->isPremium);
-    parse(data, "added_to_attachment_menu", &result->addedToAttachmentMenu);
-    parse(data, "can_join_groups", &result->canJoinGroups);
-    parse(data, "can_read_all_group_messages", &result->canReadAllGroupMessages);
-    parse(data, "supports_guest_queries", &result->supportsGuestQueries);
-    parse(data, "supports_inline_queries", &result->supportsInlineQueries);
-    parse(data, "can_connect_to_business", &result->canConnectToBusiness);
-    parse(data, "has_main_web_app", &result->hasMainWebApp);
-    parse(data, "has_topics_enabled", &result->hasTopicsEnabled);
-    parse(data, "allows_users_to_create_topics", &result->allowsUsersToCreateTopics);
-    parse(data, "can_manage_bots", &result->canManageBots);
-    parse(data, "supports_join_request_queries", &result->supportsJoinRequestQueries);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::id:
+                detail::parseValue(value, &result->id);
+                break;
+            case Field::isBot:
+                detail::parseValue(value, &result->isBot);
+                break;
+            case Field::firstName:
+                detail::parseValue(value, &result->firstName);
+                break;
+            case Field::lastName:
+                detail::parseValue(value, &result->lastName);
+                break;
+            case Field::username:
+                detail::parseValue(value, &result->username);
+                break;
+            case Field::languageCode:
+                detail::parseValue(value, &result->languageCode);
+                break;
+            case Field::isPremium:
+                detail::parseValue(value, &result->isPremium);
+                break;
+            case Field::addedToAttachmentMenu:
+                detail::parseValue(value, &result->addedToAttachmentMenu);
+                break;
+            case Field::canJoinGroups:
+                detail::parseValue(value, &result->canJoinGroups);
+                break;
+            case Field::canReadAllGroupMessages:
+                detail::parseValue(value, &result->canReadAllGroupMessages);
+                break;
+            case Field::supportsGuestQueries:
+                detail::parseValue(value, &result->supportsGuestQueries);
+                break;
+            case Field::supportsInlineQueries:
+                detail::parseValue(value, &result->supportsInlineQueries);
+                break;
+            case Field::canConnectToBusiness:
+                detail::parseValue(value, &result->canConnectToBusiness);
+                break;
+            case Field::hasMainWebApp:
+                detail::parseValue(value, &result->hasMainWebApp);
+                break;
+            case Field::hasTopicsEnabled:
+                detail::parseValue(value, &result->hasTopicsEnabled);
+                break;
+            case Field::allowsUsersToCreateTopics:
+                detail::parseValue(value, &result->allowsUsersToCreateTopics);
+                break;
+            case Field::canManageBots:
+                detail::parseValue(value, &result->canManageBots);
+                break;
+            case Field::supportsJoinRequestQueries:
+                detail::parseValue(value, &result->supportsJoinRequestQueries);
+                break;
+        }
+    });
+    detail::storeCached(key, result);
     return result;
 }
 
@@ -32,24 +124,24 @@ template <>
 nlohmann::json put(const std::shared_ptr<User> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("id", object->id);
-        json.put("is_bot", object->isBot);
-        json.put("first_name", object->firstName);
-        json.put("last_name", object->lastName);
-        json.put("username", object->username);
-        json.put("language_code", object->languageCode);
-        json.put("is_premium", object->isPremium);
         json.put("added_to_attachment_menu", object->addedToAttachmentMenu);
+        json.put("allows_users_to_create_topics", object->allowsUsersToCreateTopics);
+        json.put("can_connect_to_business", object->canConnectToBusiness);
         json.put("can_join_groups", object->canJoinGroups);
+        json.put("can_manage_bots", object->canManageBots);
         json.put("can_read_all_group_messages", object->canReadAllGroupMessages);
-        json.put("supports_guest_queries", object->supportsGuestQueries);
-        json.put("supports_inline_queries", object->supportsInlineQueries);
-        json.put("can_connect_to_business", object->canConnectToBusiness);
+        json.put("first_name", object->firstName);
         json.put("has_main_web_app", object->hasMainWebApp);
         json.put("has_topics_enabled", object->hasTopicsEnabled);
-        json.put("allows_users_to_create_topics", object->allowsUsersToCreateTopics);
-        json.put("can_manage_bots", object->canManageBots);
+        json.put("id", object->id);
+        json.put("is_bot", object->isBot);
+        json.put("is_premium", object->isPremium);
+        json.put("language_code", object->languageCode);
+        json.put("last_name", object->lastName);
+        json.put("supports_guest_queries", object->supportsGuestQueries);
+        json.put("supports_inline_queries", object->supportsInlineQueries);
         json.put("supports_join_request_queries", object->supportsJoinRequestQueries);
+        json.put("username", object->username);
     }
     return json;
 }
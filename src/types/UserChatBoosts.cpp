@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    boosts,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"boosts", Field::boosts},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UserChatBoosts> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UserChatBoosts>();
-    result->boosts = parseRequiredArray<ChatBoost>(data, "boosts");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::boosts:
+                result->boosts = parseArray<ChatBoost>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    totalCount,
+    audios,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"total_count", Field::totalCount},
+    {"audios", Field::audios},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UserProfileAudios> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UserProfileAudios>();
-    parse(data, "total_count", &result->totalCount);
-    result->audios = parseRequiredArray<Audio>(data, "audios");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::totalCount:
+                detail::parseValue(value, &result->totalCount);
+                break;
+            case Field::audios:
+                result->audios = parseArray<Audio>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<UserProfileAudios> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("total_count", object->totalCount);
         json.put("audios", object->audios);
+        json.put("total_count", object->totalCount);
     }
     return json;
 }
@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    totalCount,
+    photos,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"total_count", Field::totalCount},
+    {"photos", Field::photos},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UserProfilePhotos> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UserProfilePhotos>();
-    parse(data, "total_count", &result->totalCount);
-    result->photos = parseMatrix<PhotoSize>(data, "photos");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::totalCount:
+                detail::parseValue(value, &result->totalCount);
+                break;
+            case Field::photos:
+                result->photos = parseMatrix<PhotoSize>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<UserProfilePhotos> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("total_count", object->totalCount);
         json.put("photos", object->photos);
+        json.put("total_count", object->totalCount);
     }
     return json;
 }
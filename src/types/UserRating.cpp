@@ -4,13 +4,43 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    level,
+    rating,
+    currentLevelRating,
+    nextLevelRating,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"level", Field::level},
+    {"rating", Field::rating},
+    {"current_level_rating", Field::currentLevelRating},
+    {"next_level_rating", Field::nextLevelRating},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UserRating> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UserRating>();
-    parse(data, "level", &result->level);
-    parse(data, "rating", &result->rating);
-    parse(data, "current_level_rating", &result->currentLevelRating);
-    parse(data, "next_level_rating", &result->nextLevelRating);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::level:
+                detail::parseValue(value, &result->level);
+                break;
+            case Field::rating:
+                detail::parseValue(value, &result->rating);
+                break;
+            case Field::currentLevelRating:
+                detail::parseValue(value, &result->currentLevelRating);
+                break;
+            case Field::nextLevelRating:
+                detail::parseValue(value, &result->nextLevelRating);
+                break;
+        }
+    });
     return result;
 }
 
@@ -18,10 +48,10 @@ template <>
 nlohmann::json put(const std::shared_ptr<UserRating> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("level", object->level);
-        json.put("rating", object->rating);
         json.put("current_level_rating", object->currentLevelRating);
+        json.put("level", object->level);
         json.put("next_level_rating", object->nextLevelRating);
+        json.put("rating", object->rating);
     }
     return json;
 }
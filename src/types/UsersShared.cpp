@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    requestId,
+    users,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"request_id", Field::requestId},
+    {"users", Field::users},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<UsersShared> parse(const nlohmann::json &data) {
     auto result = std::make_shared<UsersShared>();
-    parse(data, "request_id", &result->requestId);
-    result->users = parseRequiredArray<SharedUser>(data, "users");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::requestId:
+                detail::parseValue(value, &result->requestId);
+                break;
+            case Field::users:
+                result->users = parseArray<SharedUser>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,16 +4,58 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    location,
+    title,
+    address,
+    foursquareId,
+    foursquareType,
+    googlePlaceId,
+    googlePlaceType,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"location", Field::location},
+    {"title", Field::title},
+    {"address", Field::address},
+    {"foursquare_id", Field::foursquareId},
+    {"foursquare_type", Field::foursquareType},
+    {"google_place_id", Field::googlePlaceId},
+    {"google_place_type", Field::googlePlaceType},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<Venue> parse(const nlohmann::json &data) {
     auto result = std::make_shared<Venue>();
-    result->location = parseRequired<Location>(data, "location");
-    parse(data, "title", &result->title);
-    parse(data, "address", &result->address);
-    parse(data, "foursquare_id", &result->foursquareId);
-    parse(data, "foursquare_type", &result->foursquareType);
-    parse(data, "google_place_id", &result->googlePlaceId);
-    parse(data, "google_place_type", &result->googlePlaceType);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::location:
+                result->location = parse<Location>(value);
+                break;
+            case Field::title:
+                detail::parseValue(value, &result->title);
+                break;
+            case Field::address:
+                detail::parseValue(value, &result->address);
+                break;
+            case Field::foursquareId:
+                detail::parseValue(value, &result->foursquareId);
+                break;
+            case Field::foursquareType:
+                detail::parseValue(value, &result->foursquareType);
+                break;
+            case Field::googlePlaceId:
+                detail::parseValue(value, &result->googlePlaceId);
+                break;
+            case Field::googlePlaceType:
+                detail::parseValue(value, &result->googlePlaceType);
+                break;
+        }
+    });
     return result;
 }
 
@@ -21,13 +63,13 @@ template <>
 nlohmann::json put(const std::shared_ptr<Venue> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("location", object->location);
-        json.put("title", object->title);
         json.put("address", object->address);
         json.put("foursquare_id", object->foursquareId);
         json.put("foursquare_type", object->foursquareType);
         json.put("google_place_id", object->googlePlaceId);
         json.put("google_place_type", object->googlePlaceType);
+        json.put("location", object->location);
+        json.put("title", object->title);
     }
     return json;
 }
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    duration,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"duration", Field::duration},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<VideoChatEnded> parse(const nlohmann::json &data) {
     auto result = std::make_shared<VideoChatEnded>();
-    parse(data, "duration", &result->duration);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::duration:
+                detail::parseValue(value, &result->duration);
+                break;
+        }
+    });
     return result;
 }
 
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    users,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"users", Field::users},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<VideoChatParticipantsInvited> parse(const nlohmann::json &data) {
     auto result = std::make_shared<VideoChatParticipantsInvited>();
-    result->users = parseRequiredArray<User>(data, "users");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::users:
+                result->users = parseArray<User>(value);
+                break;
+        }
+    });
     return result;
 }
 
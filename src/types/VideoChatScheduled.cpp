@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    startDate,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"start_date", Field::startDate},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<VideoChatScheduled> parse(const nlohmann::json &data) {
     auto result = std::make_shared<VideoChatScheduled>();
-    parse(data, "start_date", &result->startDate);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::startDate:
+                detail::parseValue(value, &result->startDate);
+                break;
+        }
+    });
     return result;
 }
 
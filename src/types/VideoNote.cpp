@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    fileId,
+    fileUniqueId,
+    length,
+    duration,
+    thumbnail,
+    fileSize,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"file_id", Field::fileId},
+    {"file_unique_id", Field::fileUniqueId},
+    {"length", Field::length},
+    {"duration", Field::duration},
+    {"thumbnail", Field::thumbnail},
+    {"file_size", Field::fileSize},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<VideoNote> parse(const nlohmann::json &data) {
     auto result = std::make_shared<VideoNote>();
-    parse(data, "file_id", &result->fileId);
-    parse(data, "file_unique_id", &result->fileUniqueId);
-    parse(data, "length", &result->length);
-    parse(data, "duration", &result->duration);
-    result->thumbnail = parse<PhotoSize>(data, "thumbnail");
-    parse(data, "file_size", &result->fileSize);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::fileId:
+                detail::parseValue(value, &result->fileId);
+                break;
+            case Field::fileUniqueId:
+                detail::parseValue(value, &result->fileUniqueId);
+                break;
+            case Field::length:
+                detail::parseValue(value, &result->length);
+                break;
+            case Field::duration:
+                detail::parseValue(value, &result->duration);
+                break;
+            case Field::thumbnail:
+                result->thumbnail = parse<PhotoSize>(value);
+                break;
+            case Field::fileSize:
+                detail::parseValue(value, &result->fileSize);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<VideoNote> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("duration", object->duration);
         json.put("file_id", object->fileId);
+        json.put("file_size", object->fileSize);
         json.put("file_unique_id", object->fileUniqueId);
         json.put("length", object->length);
-        json.put("duration", object->duration);
         json.put("thumbnail", object->thumbnail);
-        json.put("file_size", object->fileSize);
     }
     return json;
 }
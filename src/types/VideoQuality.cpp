@@ -4,15 +4,53 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    fileId,
+    fileUniqueId,
+    width,
+    height,
+    codec,
+    fileSize,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"file_id", Field::fileId},
+    {"file_unique_id", Field::fileUniqueId},
+    {"width", Field::width},
+    {"height", Field::height},
+    {"codec", Field::codec},
+    {"file_size", Field::fileSize},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<VideoQuality> parse(const nlohmann::json &data) {
     auto result = std::make_shared<VideoQuality>();
-    parse(data, "file_id", &result->fileId);
-    parse(data, "file_unique_id", &result->fileUniqueId);
-    parse(data, "width", &result->width);
-    parse(data, "height", &result->height);
-    parse(data, "codec", &result->codec);
-    parse(data, "file_size", &result->fileSize);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::fileId:
+                detail::parseValue(value, &result->fileId);
+                break;
+            case Field::fileUniqueId:
+                detail::parseValue(value, &result->fileUniqueId);
+                break;
+            case Field::width:
+                detail::parseValue(value, &result->width);
+                break;
+            case Field::height:
+                detail::parseValue(value, &result->height);
+                break;
+            case Field::codec:
+                detail::parseValue(value, &result->codec);
+                break;
+            case Field::fileSize:
+                detail::parseValue(value, &result->fileSize);
+                break;
+        }
+    });
     return result;
 }
 
@@ -20,12 +58,12 @@ template <>
 nlohmann::json put(const std::shared_ptr<VideoQuality> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("codec", object->codec);
         json.put("file_id", object->fileId);
+        json.put("file_size", object->fileSize);
         json.put("file_unique_id", object->fileUniqueId);
-        json.put("width", object->width);
         json.put("height", object->height);
-        json.put("codec", object->codec);
-        json.put("file_size", object->fileSize);
+        json.put("width", object->width);
     }
     return json;
 }
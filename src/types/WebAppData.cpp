@@ -4,11 +4,33 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    data,
+    buttonText,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"data", Field::data},
+    {"button_text", Field::buttonText},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<WebAppData> parse(const nlohmann::json &data) {
     auto result = std::make_shared<WebAppData>();
-    parse(data, "data", &result->data);
-    parse(data, "button_text", &result->buttonText);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::data:
+                detail::parseValue(value, &result->data);
+                break;
+            case Field::buttonText:
+                detail::parseValue(value, &result->buttonText);
+                break;
+        }
+    });
     return result;
 }
 
@@ -16,8 +38,8 @@ template <>
 nlohmann::json put(const std::shared_ptr<WebAppData> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("data", object->data);
         json.put("button_text", object->buttonText);
+        json.put("data", object->data);
     }
     return json;
 }
@@ -4,10 +4,28 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    url,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"url", Field::url},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<WebAppInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<WebAppInfo>();
-    parse(data, "url", &result->url);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::url:
+                detail::parseValue(value, &result->url);
+                break;
+        }
+    });
     return result;
 }
 
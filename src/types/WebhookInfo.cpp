@@ -4,18 +4,68 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    url,
+    hasCustomCertificate,
+    pendingUpdateCount,
+    ipAddress,
+    lastErrorDate,
+    lastErrorMessage,
+    lastSynchronizationErrorDate,
+    maxConnections,
+    allowedUpdates,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"url", Field::url},
+    {"has_custom_certificate", Field::hasCustomCertificate},
+    {"pending_update_count", Field::pendingUpdateCount},
+    {"ip_address", Field::ipAddress},
+    {"last_error_date", Field::lastErrorDate},
+    {"last_error_message", Field::lastErrorMessage},
+    {"last_synchronization_error_date", Field::lastSynchronizationErrorDate},
+    {"max_connections", Field::maxConnections},
+    {"allowed_updates", Field::allowedUpdates},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<WebhookInfo> parse(const nlohmann::json &data) {
     auto result = std::make_shared<WebhookInfo>();
-    parse(data, "url", &result->url);
-    parse(data, "has_custom_certificate", &result->hasCustomCertificate);
-    parse(data, "pending_update_count", &result->pendingUpdateCount);
-    parse(data, "ip_address", &result->ipAddress);
-    parse(data, "last_error_date", &result->lastErrorDate);
-    parse(data, "last_error_message", &result->lastErrorMessage);
-    parse(data, "last_synchronization_error_date", &result->lastSynchronizationErrorDate);
-    parse(data, "max_connections", &result->maxConnections);
-    result->allowedUpdates = parsePrimitiveArray<std::string>(data, "allowed_updates");
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::url:
+                detail::parseValue(value, &result->url);
+                break;
+            case Field::hasCustomCertificate:
+                detail::parseValue(value, &result->hasCustomCertificate);
+                break;
+            case Field::pendingUpdateCount:
+                detail::parseValue(value, &result->pendingUpdateCount);
+                break;
+            case Field::ipAddress:
+                detail::parseValue(value, &result->ipAddress);
+                break;
+            case Field::lastErrorDate:
+                detail::parseValue(value, &result->lastErrorDate);
+                break;
+            case Field::lastErrorMessage:
+                detail::parseValue(value, &result->lastErrorMessage);
+                break;
+            case Field::lastSynchronizationErrorDate:
+                detail::parseValue(value, &result->lastSynchronizationErrorDate);
+                break;
+            case Field::maxConnections:
+                detail::parseValue(value, &result->maxConnections);
+                break;
+            case Field::allowedUpdates:
+                result->allowedUpdates = parsePrimitiveArray<std::string>(value);
+                break;
+        }
+    });
     return result;
 }
 
@@ -23,15 +73,15 @@ template <>
 nlohmann::json put(const std::shared_ptr<WebhookInfo> &object) {
     JsonWrapper json;
     if (object) {
-        json.put("url", object->url);
+        json.put("allowed_updates", object->allowedUpdates);
         json.put("has_custom_certificate", object->hasCustomCertificate);
-        json.put("pending_update_count", object->pendingUpdateCount);
         json.put("ip_address", object->ipAddress);
         json.put("last_error_date", object->lastErrorDate);
         json.put("last_error_message", object->lastErrorMessage);
         json.put("last_synchronization_error_date", object->lastSynchronizationErrorDate);
         json.put("max_connections", object->maxConnections);
-        json.put("allowed_updates", object->allowedUpdates);
+        json.put("pending_update_count", object->pendingUpdateCount);
+        json.put("url", object->url);
     }
     return json;
 }
@@ -4,12 +4,38 @@
 
 namespace TgBot {
 
+namespace {
+
+enum class Field {
+    fromRequest,
+    webAppName,
+    fromAttachmentMenu,
+};
+
+constexpr auto fields = detail::makeTypeTable<Field>({
+    {"from_request", Field::fromRequest},
+    {"web_app_name", Field::webAppName},
+    {"from_attachment_menu", Field::fromAttachmentMenu},
+});
+
+}  // namespace
+
 template <>
 std::shared_ptr<WriteAccessAllowed> parse(const nlohmann::json &data) {
     auto result = std::make_shared<WriteAccessAllowed>();
-    parse(data, "from_request", &result->fromRequest);
-    parse(data, "web_app_name", &result->webAppName);
-    parse(data, "from_attachment_menu", &result->fromAttachmentMenu);
+    detail::parseFields(data, fields, [&result](Field field, const nlohmann::json &value) {
+        switch (field) {
+            case Field::fromRequest:
+                detail::parseValue(value, &result->fromRequest);
+                break;
+            case Field::webAppName:
+                detail::parseValue(value, &result->webAppName);
+                break;
+            case Field::fromAttachmentMenu:
+                detail::parseValue(value, &result->fromAttachmentMenu);
+                break;
+        }
+    });
     return result;
 }
 
@@ -17,9 +43,9 @@ template <>
 nlohmann::json put(const std::shared_ptr<WriteAccessAllowed> &object) {
     JsonWrapper json;
     if (object) {
+        json.put("from_attachment_menu", object->fromAttachmentMenu);
         json.put("from_request", object->fromRequest);
         json.put("web_app_name", object->webAppName);
-        json.put("from_attachment_menu", object->fromAttachmentMenu);
     }
     return json;
 }
@@ -0,0 +1,455 @@
+#include "fake/FakeBotApiServer.h"
+
+#include "net/httplib_wrapper.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <ctime>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <tgbot/net/Url.h>
+
+namespace TgBot::testing {
+
+namespace {
+
+constexpr std::int64_t kBotId = 100000001;
+
+std::int64_t unixTime() {
+    return static_cast<std::int64_t>(std::time(nullptr));
+}
+
+template <typename T>
+T param(const FakeBotApiServer::Call& call, const char* name, T fallback) {
+    auto it = call.params.find(name);
+    if (it == call.params.end() || it->second.empty()) {
+        return fallback;
+    }
+    try {
+        return static_cast<T>(std::stoll(it->second));
+    } catch (const std::exception&) {
+        return fallback;
+    }
+}
+
+void reply(httplib::Response& res, const nlohmann::json& result) {
+    res.set_content(nlohmann::json{{"ok", true}, {"result", result}}.dump(),
+                    "application/json");
+}
+
+void fail(httplib::Response& res, int code, const std::string& description,
+          nlohmann::json parameters = nullptr) {
+    nlohmann::json body{
+        {"ok", false}, {"error_code", code}, {"description", description}};
+    if (!parameters.is_null()) {
+        body["parameters"] = std::move(parameters);
+    }
+    res.status = code;
+    res.set_content(body.dump(), "application/json");
+}
+
+}  // namespace
+
+struct FakeBotApiServer::Impl {
+    std::string token;
+    httplib::Server server;
+    int port = 0;
+    std::thread listener;
+    std::vector<std::thread> deliverers;
+
+    mutable std::mutex mutex;
+    std::condition_variable updatesChanged;
+    bool stopping = false;
+    // Sorted by update_id as long as ids are assigned by the server.
+    std::deque<nlohmann::json> updates;
+    std::int32_t nextUpdateId = 1;
+    std::int32_t nextMessageId = 1;
+    std::string webhookUrl;
+    std::string webhookSecretToken;
+    std::size_t rateLimitCount = 0;
+    std::int32_t retryAfter = 0;
+    std::size_t rateLimitedCount = 0;
+    std::map<std::string, std::string> filePaths;
+    std::map<std::string, std::string> fileContents;
+    std::map<std::string, nlohmann::json> results;
+    std::vector<Call> calls;
+    std::function<void(const Call&)> observer;
+
+    Impl(std::string token_, std::size_t webhookConnections)
+        : token(std::move(token_)) {
+        const auto apiHandler = [this](const httplib::Request& req,
+                                       httplib::Response& res) {
+            handleMethod(req, res);
+        };
+        server.Get(R"(/bot([^/]+)/([A-Za-z]+))", apiHandler);
+        server.Post(R"(/bot([^/]+)/([A-Za-z]+))", apiHandler);
+        server.Get(R"(/file/bot([^/]+)/(.+))",
+                   [this](const httplib::Request& req,
+                          httplib::Response& res) { handleFile(req, res); });
+
+        server.set_tcp_nodelay(true);
+        port = server.bind_to_any_port("127.0.0.1");
+        if (port < 0) {
+            throw std::runtime_error("FakeBotApiServer: cannot bind");
+        }
+        listener = std::thread([this] { server.listen_after_bind(); });
+        server.wait_until_ready();
+
+        for (std::size_t i = 0; i < std::max<std::size_t>(webhookConnections, 1);
+             ++i) {
+            deliverers.emplace_back([this] { deliverWebhooks(); });
+        }
+    }
+
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        updatesChanged.notify_all();
+        server.stop();
+        listener.join();
+        for (auto& deliverer : deliverers) {
+            deliverer.join();
+        }
+    }
+
+    static Call readCall(const httplib::Request& req) {
+        Call call{req.matches[2], {}};
+        for (const auto& [name, value] : req.params) {
+            call.params[name] = value;
+        }
+        for (const auto& [name, field] : req.form.fields) {
+            call.params[name] = field.content;
+        }
+        for (const auto& [name, file] : req.form.files) {
+            call.params[name] = file.content;
+        }
+        return call;
+    }
+
+    void handleMethod(const httplib::Request& req, httplib::Response& res) {
+        if (req.matches[1] != token) {
+            fail(res, 401, "Unauthorized");
+            return;
+        }
+        const Call call = readCall(req);
+        const bool isSend = call.method.compare(0, 4, "send") == 0;
+
+        std::function<void(const Call&)> notify;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (isSend && rateLimitCount > 0) {
+                --rateLimitCount;
+                ++rateLimitedCount;
+                fail(res, 429,
+                     "Too Many Requests: retry after " +
+                         std::to_string(retryAfter),
+                     {{"retry_after", retryAfter}});
+                return;
+            }
+            calls.push_back(call);
+            notify = observer;
+        }
+        if (notify) {
+            notify(call);
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (auto it = results.find(call.method); it != results.end()) {
+            reply(res, it->second);
+        } else if (call.method == "getUpdates") {
+            getUpdates(call, res, lock);
+        } else if (isSend) {
+            reply(res, message(call));
+        } else if (call.method == "getMe") {
+            reply(res, {{"id", kBotId},
+                        {"is_bot", true},
+                        {"first_name", "Fake"},
+                        {"username", "fake_bot"}});
+        } else if (call.method == "getFile") {
+            getFile(call, res);
+        } else if (call.method == "setWebhook") {
+            webhookUrl = call.params.count("url") ? call.params.at("url") : "";
+            webhookSecretToken = call.params.count("secret_token")
+                                     ? call.params.at("secret_token")
+                                     : "";
+            lock.unlock();
+            updatesChanged.notify_all();
+            reply(res, true);
+        } else if (call.method == "deleteWebhook") {
+            webhookUrl.clear();
+            auto drop = call.params.find("drop_pending_updates");
+            if (drop != call.params.end() &&
+                (drop->second == "true" || drop->second == "1")) {
+                updates.clear();
+            }
+            reply(res, true);
+        } else if (call.method == "getWebhookInfo") {
+            reply(res, {{"url", webhookUrl},
+                        {"has_custom_certificate", false},
+                        {"pending_update_count", updates.size()}});
+        } else {
+            fail(res, 404, "Not Found");
+        }
+    }
+
+    // Caller holds the lock.
+    void getUpdates(const Call& call, httplib::Response& res,
+                    std::unique_lock<std::mutex>& lock) {
+        if (!webhookUrl.empty()) {
+            fail(res, 409,
+                 "Conflict: can't use getUpdates method while webhook is "
+                 "active; use deleteWebhook to delete the webhook first");
+            return;
+        }
+        const auto offset = param<std::int32_t>(call, "offset", 0);
+        const auto limit = std::clamp(param<int>(call, "limit", 100), 1, 100);
+        const auto timeout = param<int>(call, "timeout", 0);
+
+        // A getUpdates call with an offset confirms all updates before it.
+        updates.erase(std::remove_if(updates.begin(), updates.end(),
+                                     [&](const nlohmann::json& update) {
+                                         return update["update_id"]
+                                                    .get<std::int32_t>() <
+                                                offset;
+                                     }),
+                      updates.end());
+        updatesChanged.wait_for(lock, std::chrono::seconds(timeout), [&] {
+            return stopping || !updates.empty() || !webhookUrl.empty();
+        });
+
+        nlohmann::json result = nlohmann::json::array();
+        for (const auto& update : updates) {
+            if (result.size() >= static_cast<std::size_t>(limit)) {
+                break;
+            }
+            result.push_back(update);
+        }
+        reply(res, result);
+    }
+
+    // Caller holds the lock.
+    nlohmann::json message(const Call& call) {
+        const auto chatId = param<std::int64_t>(call, "chat_id", 0);
+        nlohmann::json result{
+            {"message_id", nextMessageId++},
+            {"date", unixTime()},
+            {"from",
+             {{"id", kBotId}, {"is_bot", true}, {"first_name", "Fake"}}},
+            {"chat",
+             {{"id", chatId}, {"type", chatId > 0 ? "private" : "supergroup"}}},
+        };
+        if (auto it = call.params.find("text"); it != call.params.end()) {
+            result["text"] = it->second;
+        }
+        if (auto it = call.params.find("caption"); it != call.params.end()) {
+            result["caption"] = it->second;
+        }
+        return result;
+    }
+
+    // Caller holds the lock.
+    void getFile(const Call& call, httplib::Response& res) {
+        const auto fileId = call.params.find("file_id");
+        if (fileId == call.params.end() ||
+            !filePaths.count(fileId->second)) {
+            fail(res, 400, "Bad Request: invalid file_id");
+            return;
+        }
+        const std::string& path = filePaths.at(fileId->second);
+        reply(res, {{"file_id", fileId->second},
+                    {"file_unique_id", "u" + fileId->second},
+                    {"file_size", fileContents.at(path).size()},
+                    {"file_path", path}});
+    }
+
+    void handleFile(const httplib::Request& req, httplib::Response& res) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = fileContents.find(req.matches[2]);
+        if (req.matches[1] != token || it == fileContents.end()) {
+            fail(res, 404, "Not Found");
+            return;
+        }
+        res.set_content(it->second, "application/octet-stream");
+    }
+
+    // Pushes queued updates to the webhook while one is set. Like Telegram,
+    // an update the webhook does not acknowledge with 2xx is retried.
+    void deliverWebhooks() {
+        std::unique_ptr<httplib::Client> client;
+        std::string clientUrl;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            updatesChanged.wait(lock, [&] {
+                return stopping || (!webhookUrl.empty() && !updates.empty());
+            });
+            if (stopping) {
+                return;
+            }
+            nlohmann::json update = std::move(updates.front());
+            updates.pop_front();
+            const std::string url = webhookUrl;
+            httplib::Headers headers;
+            if (!webhookSecretToken.empty()) {
+                headers.emplace("X-Telegram-Bot-Api-Secret-Token",
+                                webhookSecretToken);
+            }
+            lock.unlock();
+
+            const Url target(url);
+            if (url != clientUrl) {
+                client = std::make_unique<httplib::Client>(target.protocol +
+                                                           "://" + target.host);
+                client->set_tcp_nodelay(true);
+                clientUrl = url;
+            }
+            auto result = client->Post(target.path.empty() ? "/" : target.path,
+                                       headers, update.dump(),
+                                       "application/json");
+            const bool delivered =
+                result && result->status >= 200 && result->status < 300;
+            if (!delivered) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+
+            lock.lock();
+            if (!delivered) {
+                updates.push_front(std::move(update));
+            }
+        }
+    }
+};
+
+FakeBotApiServer::FakeBotApiServer(std::string token,
+                                   std::size_t webhookConnections)
+    : _impl(std::make_unique<Impl>(std::move(token), webhookConnections)) {}
+
+FakeBotApiServer::~FakeBotApiServer() = default;
+
+unsigned short FakeBotApiServer::freePort() {
+    const auto sock = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    const bool ok =
+        sock != INVALID_SOCKET &&
+        ::bind(sock, reinterpret_cast<sockaddr*>(&addr), len) == 0 &&
+        ::getsockname(sock, reinterpret_cast<sockaddr*>(&addr), &len) == 0;
+    httplib::detail::close_socket(sock);
+    if (!ok) {
+        throw std::runtime_error("FakeBotApiServer: no free port");
+    }
+    return ntohs(addr.sin_port);
+}
+
+int FakeBotApiServer::post(const std::string& url, const std::string& path,
+                           const std::string& body,
+                           const std::map<std::string, std::string>& headers) {
+    httplib::Client client(url);
+    httplib::Headers requestHeaders(headers.begin(), headers.end());
+    std::string contentType = "application/json";
+    if (auto it = requestHeaders.find("Content-Type");
+        it != requestHeaders.end()) {
+        contentType = it->second;
+        requestHeaders.erase(it);
+    }
+    const auto res = client.Post(path, requestHeaders, body, contentType);
+    return res ? res->status : -1;
+}
+
+std::string FakeBotApiServer::url() const {
+    return "http://127.0.0.1:" + std::to_string(_impl->port);
+}
+
+const std::string& FakeBotApiServer::token() const { return _impl->token; }
+
+std::int32_t FakeBotApiServer::pushUpdate(nlohmann::json update) {
+    std::int32_t id;
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        if (update.contains("update_id")) {
+            id = update["update_id"].get<std::int32_t>();
+            _impl->nextUpdateId = std::max(_impl->nextUpdateId, id + 1);
+        } else {
+            id = _impl->nextUpdateId++;
+            update["update_id"] = id;
+        }
+        _impl->updates.push_back(std::move(update));
+    }
+    _impl->updatesChanged.notify_all();
+    return id;
+}
+
+std::int32_t FakeBotApiServer::pushMessage(std::int64_t chatId,
+                                           std::string_view text) {
+    std::int32_t messageId;
+    {
+        std::lock_guard<std::mutex> lock(_impl->mutex);
+        messageId = _impl->nextMessageId++;
+    }
+    return pushUpdate(
+        {{"message",
+          {{"message_id", messageId},
+           {"date", unixTime()},
+           {"from", {{"id", chatId}, {"is_bot", false}, {"first_name", "User"}}},
+           {"chat", {{"id", chatId}, {"type", "private"}}},
+           {"text", text}}}});
+}
+
+void FakeBotApiServer::rateLimit(std::size_t count, std::int32_t retryAfter) {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    _impl->rateLimitCount = count;
+    _impl->retryAfter = retryAfter;
+}
+
+void FakeBotApiServer::addFile(std::string fileId, std::string filePath,
+                               std::string content) {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    _impl->fileContents[filePath] = std::move(content);
+    _impl->filePaths[std::move(fileId)] = std::move(filePath);
+}
+
+void FakeBotApiServer::setResult(std::string method, nlohmann::json result) {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    _impl->results[std::move(method)] = std::move(result);
+}
+
+void FakeBotApiServer::onCall(std::function<void(const Call&)> observer) {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    _impl->observer = std::move(observer);
+}
+
+std::vector<FakeBotApiServer::Call> FakeBotApiServer::calls() const {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    return _impl->calls;
+}
+
+std::size_t FakeBotApiServer::callCount(std::string_view method) const {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    return static_cast<std::size_t>(
+        std::count_if(_impl->calls.begin(), _impl->calls.end(),
+                      [&](const Call& call) { return call.method == method; }));
+}
+
+std::size_t FakeBotApiServer::rateLimited() const {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    return _impl->rateLimitedCount;
+}
+
+std::size_t FakeBotApiServer::pendingUpdates() const {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    return _impl->updates.size();
+}
+
+std::string FakeBotApiServer::webhookUrl() const {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    return _impl->webhookUrl;
+}
+
+}  // namespace TgBot::testing
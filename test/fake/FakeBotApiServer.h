@@ -0,0 +1,132 @@
+#ifndef TGBOT_TEST_FAKEBOTAPISERVER_H
+#define TGBOT_TEST_FAKEBOTAPISERVER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace TgBot::testing {
+
+/**
+ * @brief In-process stand-in for the Telegram Bot API, served over real HTTP
+ * on 127.0.0.1 so the whole client stack (HttplibClient, connection reuse,
+ * retries, TgLongPoll, webhooks) can be exercised offline.
+ *
+ * It implements getUpdates with long polling and offset confirmation,
+ * setWebhook/deleteWebhook with webhook delivery (sending secret_token in
+ * X-Telegram-Bot-Api-Secret-Token), getMe, getFile and the file download
+ * endpoint, and answers every send* method with a Message. Any other method
+ * answers 404 unless a result is configured with setResult(). 429 responses
+ * with retry_after can be injected with rateLimit().
+ *
+ * All methods are thread-safe.
+ */
+class FakeBotApiServer {
+   public:
+    /// One Bot API call received by the server.
+    struct Call {
+        std::string method;
+        /// Form fields, query parameters and uploaded file contents by name.
+        std::map<std::string, std::string> params;
+    };
+
+    /**
+     * @param token Token accepted in request paths; others get 401.
+     * @param webhookConnections Number of updates delivered to a webhook in
+     * parallel, like max_connections of setWebhook.
+     */
+    explicit FakeBotApiServer(std::string token = "123456:fake-token",
+                              std::size_t webhookConnections = 4);
+    ~FakeBotApiServer();
+
+    FakeBotApiServer(const FakeBotApiServer&) = delete;
+    FakeBotApiServer& operator=(const FakeBotApiServer&) = delete;
+
+    /**
+     * @brief A TCP port on 127.0.0.1 that was free a moment ago, for a
+     * webhook server under test.
+     */
+    static unsigned short freePort();
+
+    /**
+     * @brief POSTs @p body to @p url + @p path with @p headers, like a
+     * webhook delivery or a stray client would.
+     * @return The response status, or -1 if the request failed.
+     */
+    static int post(const std::string& url, const std::string& path,
+                    const std::string& body,
+                    const std::map<std::string, std::string>& headers = {});
+
+    /// Base url to pass to Bot or Api, e.g. "http://127.0.0.1:40123".
+    [[nodiscard]] std::string url() const;
+
+    [[nodiscard]] const std::string& token() const;
+
+    /**
+     * @brief Queues an update for getUpdates or the webhook. An update_id is
+     * assigned unless @p update already has one.
+     * @return The update_id.
+     */
+    std::int32_t pushUpdate(nlohmann::json update);
+
+    /**
+     * @brief Queues a private text message from @p chatId.
+     * @return The update_id.
+     */
+    std::int32_t pushMessage(std::int64_t chatId, std::string_view text);
+
+    /**
+     * @brief Answers the next @p count send* calls with 429 Too Many Requests
+     * and parameters.retry_after = @p retryAfter.
+     */
+    void rateLimit(std::size_t count, std::int32_t retryAfter);
+
+    /**
+     * @brief Makes @p content downloadable: getFile(@p fileId) returns
+     * @p filePath, which is then served on /file/bot<token>/<filePath>.
+     */
+    void addFile(std::string fileId, std::string filePath, std::string content);
+
+    /**
+     * @brief Answers @p method with @p result instead of the built-in
+     * behaviour.
+     */
+    void setResult(std::string method, nlohmann::json result);
+
+    /**
+     * @brief Called for every accepted call, on the server thread handling
+     * it and before the response is sent. Set before issuing requests.
+     */
+    void onCall(std::function<void(const Call&)> observer);
+
+    /// All accepted calls so far, in arrival order.
+    [[nodiscard]] std::vector<Call> calls() const;
+
+    /// Number of accepted calls of @p method.
+    [[nodiscard]] std::size_t callCount(std::string_view method) const;
+
+    /// Number of 429 responses sent so far.
+    [[nodiscard]] std::size_t rateLimited() const;
+
+    /// Updates queued but not yet confirmed or delivered.
+    [[nodiscard]] std::size_t pendingUpdates() const;
+
+    /// Webhook url set with setWebhook, empty if none.
+    [[nodiscard]] std::string webhookUrl() const;
+
+   private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace TgBot::testing
+
+#endif  // TGBOT_TEST_FAKEBOTAPISERVER_H
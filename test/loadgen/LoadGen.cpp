@@ -0,0 +1,198 @@
+// Load generator: feeds updates into a bot through FakeBotApiServer, by long
+// polling and by webhook, and measures how long each update takes to come
+// back as a sendMessage call. Every update is a text message carrying its
+// push time; the bot echoes it, so the latency covers the Bot API client,
+// update parsing, dispatch and the outbound request.
+//
+//   TgBot_loadgen [--mode longpoll|webhook|both] [--updates N] [--rate R]
+//                 [--connections C] [--rate-limits K] [--deadline S]
+//                 [--client httplib|epoll]
+//
+// --rate is in updates per second (0 pushes as fast as possible),
+// --connections sizes the bot's HttpClient pool and --rate-limits answers
+// the first K sendMessage calls with 429 and retry_after 0. --client picks
+// the HttpClient, EpollHttpClient being Linux only. Exits non-zero if not
+// every update was answered within --deadline seconds.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <tgbot/Bot.h>
+#include <tgbot/Metrics.h>
+#include <tgbot/net/EpollHttpClient.h>
+#include <tgbot/net/HttplibClient.h>
+#include <tgbot/net/TgLongPoll.h>
+#include <tgbot/net/TgWebhookTcpServer.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+using TgBot::testing::FakeBotApiServer;
+
+namespace {
+
+struct Options {
+    std::string mode = "both";
+    std::size_t updates = 2000;
+    double rate = 0;
+    std::size_t connections = 4;
+    std::size_t rateLimits = 0;
+    int deadline = 60;
+    std::string client = "httplib";
+};
+
+std::shared_ptr<HttpClient> makeClient(const Options& options) {
+#ifdef __linux__
+    if (options.client == "epoll") {
+        return std::make_shared<EpollHttpClient>(std::chrono::seconds(10),
+                                                 options.connections);
+    }
+#endif
+    return std::make_shared<HttplibClient>(std::chrono::seconds(10),
+                                           options.connections);
+}
+
+std::int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+bool run(const Options& options, const std::string& mode) {
+    FakeBotApiServer server;
+    server.rateLimit(options.rateLimits, 0);
+
+    Histogram latency;
+    std::mutex mutex;
+    std::condition_variable answered;
+    std::size_t replies = 0;
+    server.onCall([&](const FakeBotApiServer::Call& call) {
+        if (call.method != "sendMessage") {
+            return;
+        }
+        latency.record(std::chrono::nanoseconds(
+            nowNs() - std::stoll(call.params.at("text"))));
+        std::lock_guard<std::mutex> lock(mutex);
+        if (++replies == options.updates) {
+            answered.notify_all();
+        }
+    });
+
+    Bot bot(server.token(), makeClient(options), server.url());
+    bot.getEvents().onAnyMessage([&bot](const Message::Ptr& message) {
+        bot.getApi().sendMessage(message->chat->id,
+                                 message->text.value_or(""));
+    });
+
+    std::atomic<bool> stop{false};
+    std::thread receiver;
+    TgWebhookTcpServer* webhook = nullptr;
+    if (mode == "webhook") {
+        const unsigned short port = FakeBotApiServer::freePort();
+        webhook = bot.createWebHookTcp(port, "/webhook");
+        receiver = std::thread([webhook] { webhook->start(); });
+        // The fake retries deliveries until the server is listening.
+        bot.getApi().setWebhook("http://127.0.0.1:" + std::to_string(port) +
+                                "/webhook");
+    } else {
+        TgLongPoll* longPoll = bot.createLongPoll(100, 1);
+        receiver = std::thread([&stop, longPoll] {
+            while (!stop) {
+                longPoll->start();
+            }
+        });
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < options.updates; ++i) {
+        if (options.rate > 0) {
+            std::this_thread::sleep_until(
+                started + std::chrono::duration_cast<
+                              std::chrono::steady_clock::duration>(
+                              std::chrono::duration<double>(i / options.rate)));
+        }
+        server.pushMessage(static_cast<std::int64_t>(1000 + i % 100),
+                           std::to_string(nowNs()));
+    }
+
+    bool complete;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        complete = answered.wait_for(
+            lock, std::chrono::seconds(options.deadline),
+            [&] { return replies >= options.updates; });
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - started;
+
+    stop = true;
+    if (webhook) {
+        webhook->stop();
+    }
+    receiver.join();
+
+    std::printf(
+        "%-8s updates=%zu answered=%llu elapsed=%.3fs throughput=%.1f/s "
+        "p50=%.3fms p99=%.3fms max=%.3fms rate_limited=%zu\n",
+        mode.c_str(), options.updates,
+        static_cast<unsigned long long>(latency.count()), elapsed.count(),
+        static_cast<double>(latency.count()) / elapsed.count(),
+        latency.quantile(0.5).count() / 1000.0,
+        latency.quantile(0.99).count() / 1000.0,
+        latency.max().count() / 1000.0, server.rateLimited());
+    if (!complete) {
+        std::fprintf(stderr, "%s: only %llu of %zu updates answered\n",
+                     mode.c_str(),
+                     static_cast<unsigned long long>(latency.count()),
+                     options.updates);
+    }
+    return complete;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "missing value for %s\n", arg.c_str());
+            return 2;
+        }
+        const char* value = argv[++i];
+        if (arg == "--mode") {
+            options.mode = value;
+        } else if (arg == "--updates") {
+            options.updates = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--rate") {
+            options.rate = std::strtod(value, nullptr);
+        } else if (arg == "--connections") {
+            options.connections = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--rate-limits") {
+            options.rateLimits = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--deadline") {
+            options.deadline = std::atoi(value);
+        } else if (arg == "--client") {
+            options.client = value;
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    bool ok = true;
+    if (options.mode == "longpoll" || options.mode == "both") {
+        ok = run(options, "longpoll") && ok;
+    }
+    if (options.mode == "webhook" || options.mode == "both") {
+        ok = run(options, "webhook") && ok;
+    }
+    return ok ? 0 : 1;
+}
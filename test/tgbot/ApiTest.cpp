@@ -1,15 +1,24 @@
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
 #include <map>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <tgbot/Api.h>
 #include <tgbot/TgException.h>
 #include <tgbot/net/HttpClient.h>
 #include <tgbot/net/HttpReqArg.h>
+#include <tgbot/net/RequestOptions.h>
+#include <tgbot/net/RetryPolicy.h>
 #include <tgbot/net/Url.h>
 #include <tgbot/tools/StringTools.h>
 
@@ -24,6 +33,8 @@ class MockHttpClient : public HttpClient {
     MockHttpClient() : HttpClient(std::chrono::seconds(1)) {}
 
     std::string response;
+    // Served one per request before falling back to response.
+    mutable std::deque<std::string> responses;
     mutable int callCount = 0;
     mutable std::string lastProtocol;
     mutable std::string lastHost;
@@ -40,10 +51,115 @@ class MockHttpClient : public HttpClient {
         for (const auto& arg : args) {
             lastArgs[arg->name] = arg->value;
         }
+        if (!responses.empty()) {
+            std::string next = std::move(responses.front());
+            responses.pop_front();
+            return next;
+        }
+        return response;
+    }
+};
+
+// HttpClient stub that holds every request open for a while, so concurrent
+// callers overlap deterministically.
+class SlowHttpClient : public HttpClient {
+   public:
+    SlowHttpClient() : HttpClient(std::chrono::seconds(1)) {}
+
+    std::string response;
+    mutable std::atomic<int> callCount{0};
+
+    std::string makeRequest(const Url& /*url*/,
+                            const HttpReqArg::Vec& /*args*/) const override {
+        ++callCount;
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
         return response;
     }
 };
 
+// HttpClient stub that holds every request until release(), within the
+// timeout of its RequestOptions.
+class GatedHttpClient : public HttpClient {
+   public:
+    GatedHttpClient() : HttpClient(std::chrono::seconds(10)) {}
+
+    std::string response;
+    mutable std::atomic<int> callCount{0};
+
+    void release() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _open = true;
+        }
+        _opened.notify_all();
+    }
+
+    // Spins until @p count requests have reached the client.
+    void awaitCalls(int count) const {
+        while (callCount < count) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::string makeRequest(const Url& url,
+                            const HttpReqArg::Vec& args) const override {
+        return makeRequest(url, args, {});
+    }
+
+    std::string makeRequest(const Url& /*url*/, const HttpReqArg::Vec& /*args*/,
+                            const RequestOptions& options) const override {
+        ++callCount;
+        std::unique_lock<std::mutex> lock(_mutex);
+        const auto open = [this] { return _open; };
+        if (!options.timeout) {
+            _opened.wait(lock, open);
+        } else if (!_opened.wait_for(lock, *options.timeout, open)) {
+            throw NetworkException(NetworkException::State::Timeout,
+                                   "Request timed out");
+        }
+        return response;
+    }
+
+   private:
+    mutable std::mutex _mutex;
+    mutable std::condition_variable _opened;
+    bool _open = false;
+};
+
+// HttpClient stub that fails with a network error while `failing` is set.
+class FlakyHttpClient : public HttpClient {
+   public:
+    FlakyHttpClient() : HttpClient(std::chrono::seconds(1)) {}
+
+    std::string response = R"({"ok":true,"result":true})";
+    std::atomic<bool> failing{true};
+    // Fails with something other than a NetworkException instead.
+    std::atomic<bool> failingUnexpectedly{false};
+    mutable std::atomic<int> callCount{0};
+
+    std::string makeRequest(const Url& /*url*/,
+                            const HttpReqArg::Vec& /*args*/) const override {
+        ++callCount;
+        if (failingUnexpectedly) {
+            throw std::runtime_error("client bug");
+        }
+        if (failing) {
+            throw NetworkException(NetworkException::State::Connect,
+                                   "connection refused");
+        }
+        return response;
+    }
+};
+
+RetryPolicy fastPolicy() {
+    RetryPolicy policy;
+    policy.baseDelay = std::chrono::milliseconds(5);
+    policy.maxDelay = std::chrono::milliseconds(20);
+    policy.retryBudget = -1;
+    policy.breakerThreshold = 0;
+    return policy;
+}
+
 }  // namespace
 
 BOOST_AUTO_TEST_SUITE(tApi)
@@ -99,6 +215,274 @@ BOOST_AUTO_TEST_CASE(apiError_throwsWithoutRetry) {
     BOOST_CHECK_EQUAL(http.callCount, 1);
 }
 
+BOOST_AUTO_TEST_CASE(apiError_carriesStructuredReason) {
+    MockHttpClient http;
+    http.response =
+        R"({"ok":false,"error_code":400,)"
+        R"("description":"Bad Request: group chat was upgraded to a supergroup)"
+        R"( chat","parameters":{"migrate_to_chat_id":-1001234}})";
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    try {
+        api.sendMessage(std::int64_t{-77}, "hi");
+        BOOST_FAIL("expected TgException");
+    } catch (const TgException& e) {
+        BOOST_CHECK(e.errorCode == TgException::ErrorCode::BadRequest);
+        BOOST_CHECK(e.reason == TgException::Reason::ChatMigrated);
+        BOOST_REQUIRE(e.migrateToChatId().has_value());
+        BOOST_CHECK_EQUAL(*e.migrateToChatId(), -1001234);
+        BOOST_CHECK(!e.retryAfter().has_value());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(validateAudience_usesOutcomeOfEarlierSends) {
+    MockHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    http.response =
+        R"({"ok":true,"result":{"message_id":1,"date":1,)"
+        R"("chat":{"id":5,"type":"private"},"text":"hi"}})";
+    api.sendMessage(std::int64_t{5}, "hi");
+    http.response =
+        R"({"ok":false,"error_code":403,)"
+        R"("description":"Forbidden: bot was blocked by the user"})";
+    BOOST_CHECK_THROW(api.sendMessage(std::int64_t{6}, "hi"), TgException);
+    http.response =
+        R"({"ok":false,"error_code":403,)"
+        R"("description":"Forbidden: user is deactivated"})";
+    BOOST_CHECK_THROW(api.sendMessage(std::int64_t{7}, "hi"), TgException);
+    const int sends = http.callCount;
+
+    const auto report = api.validateAudience({5, 6, 7, 8});
+
+    BOOST_CHECK_EQUAL(http.callCount, sends);
+    BOOST_REQUIRE_EQUAL(report.reachable.size(), 1);
+    BOOST_CHECK_EQUAL(report.reachable[0], 5);
+    BOOST_REQUIRE_EQUAL(report.unreachable.size(), 2);
+    BOOST_CHECK_EQUAL(report.unreachable[0].first, 6);
+    BOOST_CHECK(report.unreachable[0].second ==
+                TgException::Reason::BotBlocked);
+    BOOST_CHECK(report.unreachable[1].second ==
+                TgException::Reason::UserDeactivated);
+    BOOST_REQUIRE_EQUAL(report.unknown.size(), 1);
+    BOOST_CHECK_EQUAL(report.unknown[0], 8);
+
+    // Known chats are answered without probing.
+    BOOST_CHECK(api.blockedByUser(6));
+    BOOST_CHECK(!api.blockedByUser(5));
+    BOOST_CHECK_EQUAL(http.callCount, sends);
+}
+
+BOOST_AUTO_TEST_CASE(validateAudience_forgetsOldAndExcessOutcomes) {
+    MockHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    api.setAudienceLimits(2, std::chrono::milliseconds(100));
+
+    http.response =
+        R"({"ok":false,"error_code":403,)"
+        R"("description":"Forbidden: bot was blocked by the user"})";
+    for (std::int64_t chatId : {5, 6, 7}) {
+        BOOST_CHECK_THROW(api.sendMessage(chatId, "hi"), TgException);
+    }
+    auto report = api.validateAudience({5, 6, 7});
+    BOOST_REQUIRE_EQUAL(report.unknown.size(), 1);
+    BOOST_CHECK_EQUAL(report.unknown[0], 5);
+    BOOST_CHECK_EQUAL(report.unreachable.size(), 2);
+
+    // Once the user unblocked the bot, a stale answer is checked again.
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    http.response = R"({"ok":true,"result":true})";
+    const int sends = http.callCount;
+    BOOST_CHECK(!api.blockedByUser(6));
+    BOOST_CHECK_EQUAL(http.callCount, sends + 1);
+    report = api.validateAudience({6, 7});
+    BOOST_REQUIRE_EQUAL(report.reachable.size(), 1);
+    BOOST_CHECK_EQUAL(report.reachable[0], 6);
+    BOOST_REQUIRE_EQUAL(report.unknown.size(), 1);
+    BOOST_CHECK_EQUAL(report.unknown[0], 7);
+}
+
+BOOST_AUTO_TEST_CASE(migratedChat_isResentAndRemembered) {
+    MockHttpClient http;
+    http.responses.push_back(
+        R"({"ok":false,"error_code":400,)"
+        R"("description":"Bad Request: group chat was upgraded to a supergroup)"
+        R"( chat","parameters":{"migrate_to_chat_id":-1001234}})");
+    http.response =
+        R"({"ok":true,"result":{"message_id":1,"date":1,)"
+        R"("chat":{"id":-1001234,"type":"supergroup"},"text":"hi"}})";
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    auto msg = api.sendMessage(std::int64_t{-77}, "hi");
+
+    BOOST_CHECK_EQUAL(http.callCount, 2);
+    BOOST_CHECK_EQUAL(http.lastArgs["chat_id"], "-1001234");
+    BOOST_CHECK_EQUAL(msg->chat->id, -1001234);
+    BOOST_CHECK_EQUAL(api.resolveChatId(-77), -1001234);
+    BOOST_CHECK_EQUAL(api.chatMigrations().size(), 1);
+
+    // Later sends go to the supergroup straight away.
+    api.sendMessage(std::int64_t{-77}, "again");
+    BOOST_CHECK_EQUAL(http.callCount, 3);
+    BOOST_CHECK_EQUAL(http.lastArgs["chat_id"], "-1001234");
+}
+
+BOOST_AUTO_TEST_CASE(migratedChat_isNotGuessedForCopies) {
+    MockHttpClient http;
+    http.response =
+        R"({"ok":false,"error_code":400,)"
+        R"("description":"Bad Request: group chat was upgraded to a supergroup)"
+        R"( chat","parameters":{"migrate_to_chat_id":-1001234}})";
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    // The source group migrated, not the target chat: nothing may be
+    // recorded against chat_id.
+    BOOST_CHECK_EXCEPTION(
+        api.copyMessage(std::int64_t{5}, std::int64_t{-77}, 10),
+        TgException, [](const TgException& e) {
+            return e.reason == TgException::Reason::ChatMigrated;
+        });
+    BOOST_CHECK_EQUAL(http.callCount, 1);
+    BOOST_CHECK(api.chatMigrations().empty());
+    BOOST_CHECK_EQUAL(api.resolveChatId(5), 5);
+
+    // Once the application records it, the copy reads from the supergroup.
+    api.recordChatMigration(-77, -1001234);
+    http.response = R"({"ok":true,"result":{"message_id":3}})";
+    api.copyMessage(std::int64_t{5}, std::int64_t{-77}, 10);
+    BOOST_CHECK_EQUAL(http.lastArgs["chat_id"], "5");
+    BOOST_CHECK_EQUAL(http.lastArgs["from_chat_id"], "-1001234");
+}
+
+BOOST_AUTO_TEST_CASE(readRequests_coalesceConcurrentIdenticalCalls) {
+    SlowHttpClient http;
+    http.response =
+        R"({"ok":true,"result":{"id":-100,"type":"supergroup","title":"G"}})";
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    std::vector<Chat::Ptr> chats(8);
+    std::vector<std::thread> threads;
+    for (auto& chat : chats) {
+        threads.emplace_back(
+            [&api, &chat] { chat = api.getChat(std::int64_t{-100}); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    BOOST_CHECK_EQUAL(http.callCount, 1);
+    for (const auto& chat : chats) {
+        BOOST_REQUIRE(chat != nullptr);
+        BOOST_CHECK_EQUAL(chat->id, -100);
+    }
+    // Callers get their own objects, not one shared instance.
+    BOOST_CHECK(chats[0] != chats[1]);
+
+    // Nothing is cached once the shared request has completed.
+    api.getChat(std::int64_t{-100});
+    BOOST_CHECK_EQUAL(http.callCount, 2);
+}
+
+BOOST_AUTO_TEST_CASE(readRequests_followerGivesUpWithinItsOwnLimits) {
+    GatedHttpClient http;
+    http.response =
+        R"({"ok":true,"result":{"id":-100,"type":"supergroup","title":"G"}})";
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    Chat::Ptr leaderChat;
+    std::thread leader(
+        [&api, &leaderChat] { leaderChat = api.getChat(std::int64_t{-100}); });
+    http.awaitCalls(1);
+
+    const auto isState = [](NetworkException::State state) {
+        return [state](const NetworkException& e) { return e.state == state; };
+    };
+    {
+        CancellationSource source;
+        RequestOptions options;
+        options.cancellation = source.token();
+        RequestOptionsScope scope(options);
+        std::thread canceller([&source] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            source.cancel();
+        });
+        const auto started = std::chrono::steady_clock::now();
+        BOOST_CHECK_EXCEPTION(api.getChat(std::int64_t{-100}),
+                              NetworkException,
+                              isState(NetworkException::State::Cancelled));
+        canceller.join();
+        BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                    std::chrono::seconds(1));
+    }
+    {
+        RequestOptions options;
+        options.timeout = std::chrono::milliseconds(100);
+        RequestOptionsScope scope(options);
+        BOOST_CHECK_EXCEPTION(api.getChat(std::int64_t{-100}),
+                              NetworkException,
+                              isState(NetworkException::State::Timeout));
+    }
+
+    // The leader is still waiting for its response, unaffected.
+    BOOST_CHECK(!leaderChat);
+    http.release();
+    leader.join();
+    BOOST_REQUIRE(leaderChat);
+    BOOST_CHECK_EQUAL(leaderChat->id, -100);
+    BOOST_CHECK_EQUAL(http.callCount, 1);
+}
+
+BOOST_AUTO_TEST_CASE(readRequests_leaderTimeoutIsNotShared) {
+    GatedHttpClient http;
+    http.response =
+        R"({"ok":true,"result":{"id":-100,"type":"supergroup","title":"G"}})";
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    std::atomic<bool> leaderTimedOut{false};
+    std::thread leader([&api, &leaderTimedOut] {
+        RequestOptions options;
+        options.timeout = std::chrono::milliseconds(200);
+        RequestOptionsScope scope(options);
+        try {
+            api.getChat(std::int64_t{-100});
+        } catch (const NetworkException& e) {
+            leaderTimedOut = e.state == NetworkException::State::Timeout;
+        }
+    });
+    http.awaitCalls(1);
+
+    // Joins the leader's request, then sends its own once the leader gives up.
+    Chat::Ptr chat;
+    std::thread follower(
+        [&api, &chat] { chat = api.getChat(std::int64_t{-100}); });
+    http.awaitCalls(2);
+    http.release();
+    leader.join();
+    follower.join();
+
+    BOOST_CHECK(leaderTimedOut);
+    BOOST_REQUIRE(chat);
+    BOOST_CHECK_EQUAL(chat->id, -100);
+}
+
+BOOST_AUTO_TEST_CASE(writeRequests_areNeverCoalesced) {
+    SlowHttpClient http;
+    http.response =
+        R"({"ok":true,"result":{"message_id":1,"date":1,)"
+        R"("chat":{"id":5,"type":"private"},"text":"hi"}})";
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&api] { api.sendMessage(std::int64_t{5}, "hi"); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    BOOST_CHECK_EQUAL(http.callCount, 4);
+}
+
 BOOST_AUTO_TEST_CASE(downloadFile_classifiesEveryPathIndependently) {
     MockHttpClient http;
     http.response = "file bytes";
@@ -142,4 +526,120 @@ BOOST_AUTO_TEST_CASE(downloadFile_classifiesEveryPathIndependently) {
     BOOST_CHECK_EQUAL(http.lastPath, "/file/botTOKEN/documents/another.bin");
 }
 
+BOOST_AUTO_TEST_CASE(retryPolicy_appliesPerMethodClass) {
+    FlakyHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    RetryPolicy sends = fastPolicy();
+    sends.maxRetries = 2;
+    api.setRetryPolicy(MethodClass::Send, sends);
+    RetryPolicy reads = fastPolicy();
+    reads.maxRetries = 0;
+    api.setRetryPolicy(MethodClass::Read, reads);
+    BOOST_CHECK_EQUAL(api.retryPolicy(MethodClass::Send).maxRetries, 2);
+    BOOST_CHECK_EQUAL(api.retryPolicy(MethodClass::Upload).maxRetries, 1);
+
+    const auto started = std::chrono::steady_clock::now();
+    BOOST_CHECK_THROW(api.deleteMessage(std::int64_t{1}, 2), NetworkException);
+    BOOST_CHECK_EQUAL(http.callCount, 3);
+    // Three jittered delays of at most maxDelay, not seconds of backoff.
+    BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                std::chrono::milliseconds(500));
+
+    http.callCount = 0;
+    BOOST_CHECK_THROW(api.getChatMemberCount(std::int64_t{1}),
+                      NetworkException);
+    BOOST_CHECK_EQUAL(http.callCount, 1);
+}
+
+BOOST_AUTO_TEST_CASE(retryBudget_isSharedByCalls) {
+    FlakyHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    RetryPolicy policy = fastPolicy();
+    policy.maxRetries = 5;
+    policy.retryBudget = 3;
+    policy.budgetWindow = std::chrono::hours(1);
+    api.setRetryPolicy(MethodClass::Send, policy);
+
+    BOOST_CHECK_THROW(api.deleteMessage(std::int64_t{1}, 2), NetworkException);
+    BOOST_CHECK_THROW(api.deleteMessage(std::int64_t{1}, 2), NetworkException);
+    // Two first attempts plus the three retries the budget allowed.
+    BOOST_CHECK_EQUAL(http.callCount, 5);
+}
+
+BOOST_AUTO_TEST_CASE(circuitBreaker_failsFastThenProbes) {
+    FlakyHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    RetryPolicy policy = fastPolicy();
+    policy.maxRetries = 0;
+    policy.breakerThreshold = 2;
+    policy.breakerCooldown = std::chrono::milliseconds(100);
+    api.setRetryPolicy(MethodClass::Send, policy);
+
+    const auto isCircuitOpen = [](const NetworkException& e) {
+        return e.state == NetworkException::State::CircuitOpen;
+    };
+    BOOST_CHECK_THROW(api.deleteMessage(std::int64_t{1}, 2), NetworkException);
+    BOOST_CHECK_THROW(api.deleteMessage(std::int64_t{1}, 2), NetworkException);
+    BOOST_CHECK_EXCEPTION(api.deleteMessage(std::int64_t{1}, 2),
+                          NetworkException, isCircuitOpen);
+    BOOST_CHECK_EQUAL(http.callCount, 2);
+
+    // Other method classes have breakers of their own.
+    http.failing = false;
+    BOOST_CHECK_NO_THROW(api.getChatMemberCount(std::int64_t{1}));
+    BOOST_CHECK_EXCEPTION(api.deleteMessage(std::int64_t{1}, 2),
+                          NetworkException, isCircuitOpen);
+
+    // After the cooldown a probe goes out and closes the breaker.
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    BOOST_CHECK(api.deleteMessage(std::int64_t{1}, 2));
+    BOOST_CHECK(api.deleteMessage(std::int64_t{1}, 2));
+}
+
+BOOST_AUTO_TEST_CASE(circuitBreaker_probeEndingUnexpectedlyIsAbandoned) {
+    FlakyHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    RetryPolicy policy = fastPolicy();
+    policy.maxRetries = 0;
+    policy.breakerThreshold = 1;
+    policy.breakerCooldown = std::chrono::milliseconds(50);
+    api.setRetryPolicy(MethodClass::Send, policy);
+
+    BOOST_CHECK_THROW(api.deleteMessage(std::int64_t{1}, 2), NetworkException);
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    http.failingUnexpectedly = true;
+    BOOST_CHECK_THROW(api.deleteMessage(std::int64_t{1}, 2),
+                      std::runtime_error);
+
+    // The probe told nothing, so the next call probes again.
+    http.failingUnexpectedly = false;
+    http.failing = false;
+    BOOST_CHECK(api.deleteMessage(std::int64_t{1}, 2));
+    BOOST_CHECK_EQUAL(http.callCount, 3);
+}
+
+BOOST_AUTO_TEST_CASE(circuitBreaker_ignoresLongPolling) {
+    FlakyHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    RetryPolicy policy = fastPolicy();
+    policy.maxRetries = 0;
+    policy.breakerThreshold = 1;
+    policy.breakerCooldown = std::chrono::seconds(10);
+    api.setRetryPolicy(MethodClass::Read, policy);
+
+    const auto isCircuitOpen = [](const NetworkException& e) {
+        return e.state == NetworkException::State::CircuitOpen;
+    };
+    BOOST_CHECK_THROW(api.getChatMemberCount(std::int64_t{1}),
+                      NetworkException);
+
+    // getUpdates still goes out, and its success does not close the breaker
+    // of the other reads.
+    http.failing = false;
+    http.response = R"({"ok":true,"result":[]})";
+    BOOST_CHECK(api.getUpdates().empty());
+    BOOST_CHECK_EXCEPTION(api.getChatMemberCount(std::int64_t{1}),
+                          NetworkException, isCircuitOpen);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
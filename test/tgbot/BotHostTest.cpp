@@ -0,0 +1,243 @@
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tgbot/BotHost.h>
+#include <tgbot/Metrics.h>
+#include <tgbot/net/HttplibClient.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+using TgBot::testing::FakeBotApiServer;
+
+namespace {
+
+template <typename Predicate>
+bool waitFor(Predicate predicate) {
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+// Two fake Bot API servers, one per token, with an echo bot for each.
+struct TwoBots {
+    FakeBotApiServer first{"111:first"};
+    FakeBotApiServer second{"222:second"};
+    BotHost host;
+
+    explicit TwoBots(BotHost::Options options = {}) : host(options) {
+        addBots();
+    }
+
+    TwoBots(std::shared_ptr<HttpClient> httpClient, BotHost::Options options)
+        : host(std::move(httpClient), options) {
+        addBots();
+    }
+
+    void addBots() {
+        for (FakeBotApiServer* server : {&first, &second}) {
+            Bot& bot = host.addBot(server->token(), server->url());
+            bot.getEvents().onAnyMessage([&bot](const Message::Ptr& message) {
+                bot.getApi().sendMessage(message->chat->id, *message->text);
+            });
+        }
+    }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tBotHost)
+
+BOOST_AUTO_TEST_CASE(longPolling_servesEveryBot) {
+    auto metrics = std::make_shared<Metrics>();
+    setMetrics(metrics);
+
+    BotHost::Options options;
+    options.workerThreads = 2;
+    options.pollInterval = std::chrono::milliseconds(20);
+    TwoBots bots(options);
+    for (int i = 0; i < 5; ++i) {
+        bots.first.pushMessage(1, "a" + std::to_string(i));
+        bots.second.pushMessage(2, "b" + std::to_string(i));
+    }
+
+    std::thread runner([&bots] { bots.host.runLongPolling(); });
+    const bool answered = waitFor([&bots] {
+        return bots.first.callCount("sendMessage") == 5 &&
+               bots.second.callCount("sendMessage") == 5;
+    });
+    bots.host.stop();
+    runner.join();
+    setMetrics(nullptr);
+
+    BOOST_CHECK(answered);
+    // Each bot's updates are handled in order.
+    std::vector<std::string> texts;
+    for (const auto& call : bots.first.calls()) {
+        if (call.method == "sendMessage") {
+            texts.push_back(call.params.at("text"));
+        }
+    }
+    BOOST_CHECK(texts ==
+                std::vector<std::string>({"a0", "a1", "a2", "a3", "a4"}));
+
+    const std::string exposition = metrics->toPrometheus();
+    BOOST_CHECK(
+        exposition.find(R"(method="sendMessage",status="200",bot="111")") !=
+        std::string::npos);
+    BOOST_CHECK(
+        exposition.find(R"(method="sendMessage",status="200",bot="222")") !=
+        std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(longPolling_rateLimitedBotDoesNotStallOthers) {
+    BotHost::Options options;
+    options.workerThreads = 2;
+    options.pollInterval = std::chrono::milliseconds(20);
+    TwoBots bots(options);
+    bots.first.rateLimit(1, 2);
+    bots.first.pushMessage(1, "slow");
+    bots.second.pushMessage(2, "fast");
+
+    std::thread runner([&bots] { bots.host.runLongPolling(); });
+    const auto started = std::chrono::steady_clock::now();
+    BOOST_CHECK(waitFor(
+        [&bots] { return bots.second.callCount("sendMessage") == 1; }));
+    BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                std::chrono::seconds(2));
+    BOOST_CHECK(waitFor(
+        [&bots] { return bots.first.callCount("sendMessage") == 1; }));
+    bots.host.stop();
+    runner.join();
+}
+
+BOOST_AUTO_TEST_CASE(longPolling_idleBotsWaitOnTheServer) {
+    TwoBots bots;
+    std::thread runner([&bots] { bots.host.runLongPolling(); });
+    BOOST_REQUIRE(waitFor([&bots] {
+        return bots.first.callCount("getUpdates") == 1 &&
+               bots.second.callCount("getUpdates") == 1;
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    // The long poll that is waiting returns the update at once.
+    const auto pushed = std::chrono::steady_clock::now();
+    bots.first.pushMessage(1, "now");
+    BOOST_CHECK(waitFor(
+        [&bots] { return bots.first.callCount("sendMessage") == 1; }));
+    BOOST_CHECK(std::chrono::steady_clock::now() - pushed <
+                std::chrono::milliseconds(500));
+    BOOST_CHECK_EQUAL(bots.second.callCount("getUpdates"), 1);
+    BOOST_CHECK_EQUAL(bots.first.calls().front().params.at("timeout"), "25");
+
+    // stop() cancels the long polls instead of waiting them out.
+    const auto stopping = std::chrono::steady_clock::now();
+    bots.host.stop();
+    runner.join();
+    BOOST_CHECK(std::chrono::steady_clock::now() - stopping <
+                std::chrono::seconds(5));
+}
+
+BOOST_AUTO_TEST_CASE(longPolling_otherClientsArePolled) {
+    BotHost::Options options;
+    options.workerThreads = 2;
+    options.pollInterval = std::chrono::milliseconds(20);
+    TwoBots bots(std::make_shared<HttplibClient>(), options);
+    bots.first.pushMessage(1, "a");
+    bots.second.pushMessage(2, "b");
+
+    std::thread runner([&bots] { bots.host.runLongPolling(); });
+    BOOST_CHECK(waitFor([&bots] {
+        return bots.first.callCount("sendMessage") == 1 &&
+               bots.second.callCount("sendMessage") == 1;
+    }));
+    bots.host.stop();
+    runner.join();
+    BOOST_CHECK_EQUAL(bots.first.calls().front().params.at("timeout"), "0");
+}
+
+BOOST_AUTO_TEST_CASE(longPolling_skipsAnUpdateItsListenersKeepFailingOn) {
+    FakeBotApiServer server;
+    std::mutex mutex;
+    std::vector<std::string> handled;
+    std::vector<std::int32_t> dropped;
+    int attempts = 0;
+
+    BotHost::Options options;
+    options.maxUpdateAttempts = 2;
+    options.onDroppedUpdate = [&](Bot&, const Update::Ptr& update,
+                                  std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(mutex);
+        BOOST_CHECK(error != nullptr);
+        dropped.push_back(update->updateId);
+    };
+    BotHost host(options);
+    Bot& bot = host.addBot(server.token(), server.url());
+    bot.getEvents().onAnyMessage([&](const Message::Ptr& message) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (*message->text == "poison") {
+            ++attempts;
+            throw std::runtime_error("listener failed");
+        }
+        handled.push_back(*message->text);
+    });
+    const std::int32_t poison = server.pushMessage(1, "poison");
+    server.pushMessage(1, "next");
+
+    std::thread runner([&host] { host.runLongPolling(); });
+    BOOST_CHECK(waitFor([&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        return !handled.empty();
+    }));
+    host.stop();
+    runner.join();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    BOOST_CHECK_EQUAL(attempts, 2);
+    BOOST_CHECK(dropped == std::vector<std::int32_t>({poison}));
+    BOOST_CHECK(handled == std::vector<std::string>({"next"}));
+}
+
+BOOST_AUTO_TEST_CASE(webhook_routesEachBotOnOnePort) {
+    BotHost::Options options;
+    options.webhookSecretToken = "s3cret";
+    TwoBots bots(options);
+    const unsigned short port = FakeBotApiServer::freePort();
+    std::thread runner([&bots, port] { bots.host.runWebhook(port); });
+
+    const std::string base = "http://127.0.0.1:" + std::to_string(port);
+    for (FakeBotApiServer* server : {&bots.first, &bots.second}) {
+        Bot setup(server->token(), std::make_shared<HttplibClient>(),
+                  server->url());
+        setup.getApi().setWebhook(base + "/" + server->token(), nullptr, {},
+                                  {}, {}, {}, "s3cret");
+    }
+    bots.first.pushMessage(1, "to first");
+    bots.second.pushMessage(2, "to second");
+
+    BOOST_CHECK(waitFor([&bots] {
+        return bots.first.callCount("sendMessage") == 1 &&
+               bots.second.callCount("sendMessage") == 1;
+    }));
+    bots.host.stop();
+    runner.join();
+
+    BOOST_CHECK_EQUAL(bots.first.calls().back().params.at("text"), "to first");
+    BOOST_CHECK_EQUAL(bots.second.calls().back().params.at("text"),
+                      "to second");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,189 @@
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tgbot/Api.h>
+#include <tgbot/Broadcaster.h>
+#include <tgbot/net/HttpClient.h>
+#include <tgbot/net/HttpReqArg.h>
+#include <tgbot/net/Url.h>
+
+using namespace TgBot;
+
+namespace {
+
+// Answers sendMessage with a canned response per chat id (success if none).
+class ScriptedHttpClient : public HttpClient {
+   public:
+    ScriptedHttpClient() : HttpClient(std::chrono::seconds(1)) {}
+
+    std::map<std::string, std::string> errors;
+    mutable std::mutex mutex;
+    mutable std::vector<std::string> sentTo;
+
+    std::string makeRequest(const Url& /*url*/,
+                            const HttpReqArg::Vec& args) const override {
+        std::string chatId;
+        for (const auto& arg : args) {
+            if (arg->name == "chat_id") {
+                chatId = arg->value;
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            sentTo.push_back(chatId);
+        }
+        if (auto it = errors.find(chatId); it != errors.end()) {
+            return it->second;
+        }
+        return R"({"ok":true,"result":{"message_id":1,"date":1,"chat":{"id":)" +
+               chatId + R"(,"type":"private"}}})";
+    }
+};
+
+Broadcaster::RecipientSource fromVector(const std::vector<std::int64_t>& ids) {
+    auto next = std::make_shared<std::size_t>(0);
+    return [ids, next]() -> std::optional<std::int64_t> {
+        if (*next >= ids.size()) {
+            return std::nullopt;
+        }
+        return ids[(*next)++];
+    };
+}
+
+Broadcaster::Options fastOptions() {
+    Broadcaster::Options options;
+    options.globalRate = 10000;
+    options.privateChatInterval = std::chrono::milliseconds(0);
+    options.groupChatInterval = std::chrono::milliseconds(0);
+    options.workers = 3;
+    return options;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tBroadcaster)
+
+BOOST_AUTO_TEST_CASE(run_classifiesEveryRecipient) {
+    ScriptedHttpClient http;
+    http.errors["2"] =
+        R"({"ok":false,"error_code":403,)"
+        R"("description":"Forbidden: bot was blocked by the user"})";
+    http.errors["3"] =
+        R"({"ok":false,"error_code":403,)"
+        R"("description":"Forbidden: user is deactivated"})";
+    http.errors["-4"] =
+        R"({"ok":false,"error_code":400,"description":)"
+        R"("Bad Request: group chat was upgraded to a supergroup chat"})";
+    http.errors["5"] =
+        R"({"ok":false,"error_code":400,)"
+        R"("description":"Bad Request: chat not found"})";
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    Broadcaster broadcaster(api, fastOptions());
+    std::mutex mutex;
+    std::map<std::int64_t, Broadcaster::Outcome> outcomes;
+    broadcaster.onResult([&](const Broadcaster::Result& result) {
+        std::lock_guard<std::mutex> lock(mutex);
+        outcomes[result.chatId] = result.outcome;
+    });
+
+    const auto stats = broadcaster.run(fromVector({1, 2, 3, -4, 5, 6}),
+                                       Broadcaster::textMessage("hello"));
+
+    BOOST_CHECK_EQUAL(stats.processed, 6);
+    BOOST_CHECK_EQUAL(stats.delivered, 2);
+    BOOST_CHECK_EQUAL(stats.blocked, 1);
+    BOOST_CHECK_EQUAL(stats.deactivated, 1);
+    BOOST_CHECK_EQUAL(stats.migrated, 1);
+    BOOST_CHECK_EQUAL(stats.failed, 1);
+    BOOST_CHECK_EQUAL(stats.checkpoint, 6);
+    BOOST_CHECK(outcomes[2] == Broadcaster::Outcome::Blocked);
+    BOOST_CHECK(outcomes[3] == Broadcaster::Outcome::Deactivated);
+    BOOST_CHECK(outcomes[-4] == Broadcaster::Outcome::Migrated);
+    BOOST_CHECK(outcomes[5] == Broadcaster::Outcome::Failed);
+    BOOST_CHECK(outcomes[6] == Broadcaster::Outcome::Delivered);
+}
+
+BOOST_AUTO_TEST_CASE(run_resumesFromCheckpoint) {
+    ScriptedHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+
+    Broadcaster broadcaster(api, fastOptions());
+    const auto stats = broadcaster.run(fromVector({10, 11, 12, 13}),
+                                       Broadcaster::textMessage("hello"), 3);
+
+    BOOST_CHECK_EQUAL(stats.processed, 1);
+    BOOST_CHECK_EQUAL(stats.checkpoint, 4);
+    BOOST_REQUIRE_EQUAL(http.sentTo.size(), 1);
+    BOOST_CHECK_EQUAL(http.sentTo[0], "13");
+}
+
+BOOST_AUTO_TEST_CASE(run_reportsProgressWithWhatEscapesAWorker) {
+    ScriptedHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    Broadcaster broadcaster(api, fastOptions());
+
+    std::vector<std::int64_t> ids(50);
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        ids[i] = static_cast<std::int64_t>(i + 1);
+    }
+    try {
+        broadcaster.run(fromVector(ids),
+                        [](const Api& /*api*/, std::int64_t chatId) {
+                            if (chatId == 5) {
+                                throw 42;
+                            }
+                        });
+        BOOST_FAIL("run() did not throw");
+    } catch (const Broadcaster::Stopped& e) {
+        // Recipients 1 to 4 were fully processed before chat 5 threw.
+        BOOST_CHECK_EQUAL(e.stats.checkpoint, 4);
+        BOOST_CHECK_EQUAL(e.stats.delivered, e.stats.processed);
+        BOOST_CHECK_THROW(e.rethrow_nested(), int);
+    }
+
+    broadcaster.onResult([](const Broadcaster::Result& result) {
+        if (result.chatId == 5) {
+            throw std::runtime_error("listener failed");
+        }
+    });
+    try {
+        broadcaster.run(fromVector(ids), Broadcaster::textMessage("hello"));
+        BOOST_FAIL("run() did not throw");
+    } catch (const Broadcaster::Stopped& e) {
+        BOOST_CHECK_EQUAL(std::string(e.what()), "listener failed");
+        BOOST_CHECK_THROW(e.rethrow_nested(), std::runtime_error);
+        // The job stopped instead of working through every recipient.
+        BOOST_CHECK_LT(e.stats.processed, ids.size());
+    }
+    BOOST_CHECK_LT(http.sentTo.size(), ids.size());
+}
+
+BOOST_AUTO_TEST_CASE(cancel_beforeRunStopsIt) {
+    ScriptedHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    Broadcaster broadcaster(api, fastOptions());
+
+    broadcaster.cancel();
+    const auto stats = broadcaster.run(fromVector({10, 11, 12}),
+                                       Broadcaster::textMessage("hello"));
+    BOOST_CHECK_EQUAL(stats.processed, 0);
+    BOOST_CHECK(http.sentTo.empty());
+
+    // The next run is not cancelled anymore.
+    BOOST_CHECK_EQUAL(broadcaster
+                          .run(fromVector({10, 11, 12}),
+                               Broadcaster::textMessage("hello"))
+                          .delivered,
+                      3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
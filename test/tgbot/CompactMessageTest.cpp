@@ -0,0 +1,73 @@
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+#include <nlohmann/json.hpp>
+#include <tgbot/TgTypeParser.h>
+#include <tgbot/types/CompactMessage.h>
+
+using namespace TgBot;
+
+BOOST_AUTO_TEST_SUITE(tCompactMessage)
+
+// A text reply with a few rare fields, one of them in each bitmap word.
+BOOST_AUTO_TEST_CASE(sameJsonAsMessage) {
+    const auto in = nlohmann::json::parse(
+        R"({"message_id":7,"date":1700000000,)"
+        R"("chat":{"id":-100,"type":"supergroup","title":"t"},)"
+        R"("from":{"id":1,"is_bot":false,"first_name":"a"},)"
+        R"("text":"hi","entities":[{"type":"bold","offset":0,"length":2}],)"
+        R"("reply_to_message":{"message_id":6,"date":1,"chat":{"id":-100,"type":"supergroup"}},)"
+        R"("has_protected_content":true,"media_group_id":"g",)"
+        R"("migrate_to_chat_id":-1001234567890,)"
+        R"("pinned_message":{"message_id":5,"date":2,"chat":{"id":-100,"type":"supergroup"}},)"
+        R"("new_chat_members":[{"id":2,"is_bot":true,"first_name":"b"}],)"
+        R"("community_chat_removed":{}})");
+
+    const auto compact = parse<CompactMessage>(in);
+    BOOST_REQUIRE(compact);
+    BOOST_CHECK_EQUAL(compact->messageId, 7);
+    BOOST_CHECK(compact->text == "hi");
+    BOOST_CHECK_EQUAL(compact->sideFieldCount(), 6u);
+    BOOST_CHECK(compact->has<&Message::migrateToChatId>());
+    BOOST_CHECK(!compact->has<&Message::sticker>());
+    BOOST_CHECK(compact->get<&Message::migrateToChatId>() == -1001234567890);
+    BOOST_CHECK(compact->get<&Message::mediaGroupId>() == "g");
+    BOOST_REQUIRE(compact->get<&Message::newChatMembers>());
+    BOOST_CHECK_EQUAL((*compact->get<&Message::newChatMembers>())[0]->id, 2);
+
+    BOOST_CHECK_EQUAL(put(compact), put(parse<Message>(in)));
+    BOOST_CHECK_EQUAL(put(compact->expand()), put(parse<Message>(in)));
+    BOOST_CHECK_EQUAL(put(CompactMessage::compact(*parse<Message>(in))),
+                      put(compact));
+}
+
+BOOST_AUTO_TEST_CASE(setKeepsFieldsInOrder) {
+    CompactMessage message;
+    message.set<&Message::communityChatRemoved>(
+        std::make_shared<CommunityChatRemoved>());
+    message.set<&Message::senderBoostCount>(3);
+    message.set<&Message::groupChatCreated>(true);
+    BOOST_CHECK_EQUAL(message.sideFieldCount(), 3u);
+    BOOST_CHECK(message.get<&Message::senderBoostCount>() == 3);
+    BOOST_CHECK(message.get<&Message::groupChatCreated>() == true);
+    BOOST_CHECK(message.get<&Message::communityChatRemoved>().value());
+
+    message.set<&Message::senderBoostCount>(4);
+    BOOST_CHECK(message.get<&Message::senderBoostCount>() == 4);
+    message.set<&Message::groupChatCreated>(std::nullopt);
+    BOOST_CHECK(!message.has<&Message::groupChatCreated>());
+    BOOST_CHECK(!message.get<&Message::groupChatCreated>());
+    BOOST_CHECK(message.get<&Message::senderBoostCount>() == 4);
+    BOOST_CHECK(message.get<&Message::communityChatRemoved>().value());
+    BOOST_CHECK_EQUAL(message.sideFieldCount(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(muchSmallerThanMessage) {
+    BOOST_TEST_MESSAGE("sizeof(Message) = " << sizeof(Message)
+                       << ", sizeof(CompactMessage) = "
+                       << sizeof(CompactMessage));
+    BOOST_CHECK_LT(sizeof(CompactMessage) * 5, sizeof(Message));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tgbot/Logger.h>
+
+using namespace TgBot;
+
+namespace {
+
+class CollectingLogger : public Logger {
+   public:
+    explicit CollectingLogger(LogLevel minLevel = LogLevel::Trace)
+        : _minLevel(minLevel) {}
+
+    void log(LogLevel /*level*/, const std::string& message) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        messages.push_back(message);
+    }
+
+    void log(const LogRecord& record) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        records.push_back(record);
+    }
+
+    [[nodiscard]] LogLevel minLevel() const override { return _minLevel; }
+
+    std::mutex mutex;
+    std::vector<std::string> messages;
+    std::vector<LogRecord> records;
+
+   private:
+    LogLevel _minLevel;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tLogger)
+
+BOOST_AUTO_TEST_CASE(recordsBelowMinLevel_areDroppedBeforeFormatting) {
+    auto logger = std::make_shared<CollectingLogger>(LogLevel::Warning);
+    setLogger(logger);
+
+    BOOST_CHECK(!detail::enabled(LogLevel::Trace));
+    BOOST_CHECK(detail::enabled(LogLevel::Error));
+    detail::log(LogLevel::Debug, "dropped");
+    detail::log(LogLevel::Error, "kept", {{"method", "getMe"}});
+
+    BOOST_REQUIRE_EQUAL(logger->records.size(), 1);
+    BOOST_CHECK_EQUAL(logger->records[0].format(), "kept method=getMe");
+    setLogger(nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(asyncLogger_deliversEveryRecordInOrderPerThread) {
+    auto sink = std::make_shared<CollectingLogger>();
+    auto async = std::make_shared<AsyncLogger>(sink, 1 << 12);
+    setLogger(async);
+
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 500;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                detail::log(LogLevel::Info, "tick",
+                            {{"thread", std::to_string(t)},
+                             {"i", std::to_string(i)}});
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    async->flush();
+    setLogger(nullptr);
+
+    BOOST_CHECK_EQUAL(async->dropped(), 0);
+    BOOST_REQUIRE_EQUAL(sink->records.size(), kThreads * kPerThread);
+    std::vector<int> next(kThreads, 0);
+    for (const auto& record : sink->records) {
+        const int t = std::stoi(record.fields[0].value);
+        BOOST_CHECK_EQUAL(std::stoi(record.fields[1].value), next[t]++);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(setLogger_fromInsideLog_returns) {
+    // Replaces itself with the default logger on its first record.
+    class SelfReplacingLogger : public Logger {
+       public:
+        void log(LogLevel /*level*/, const std::string& /*message*/) override {}
+
+        void log(const LogRecord& record) override {
+            setLogger(nullptr);
+            // Still alive: the call that is running holds it.
+            messages.push_back(record.message);
+        }
+
+        [[nodiscard]] LogLevel minLevel() const override {
+            return LogLevel::Trace;
+        }
+
+        std::vector<std::string> messages;
+    };
+
+    auto logger = std::make_shared<SelfReplacingLogger>();
+    std::weak_ptr<SelfReplacingLogger> weak = logger;
+    setLogger(logger);
+    logger.reset();
+    detail::log(LogLevel::Error, "last words");
+    BOOST_CHECK(weak.expired());
+    BOOST_CHECK(getLogger() != nullptr);
+    setLogger(nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
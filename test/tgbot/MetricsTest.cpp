@@ -0,0 +1,147 @@
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <tgbot/Api.h>
+#include <tgbot/Metrics.h>
+#include <tgbot/net/HttpClient.h>
+
+using namespace TgBot;
+
+namespace {
+
+class FixedHttpClient : public HttpClient {
+   public:
+    FixedHttpClient() : HttpClient(std::chrono::seconds(1)) {}
+
+    std::string response;
+
+    std::string makeRequest(const Url& /*url*/,
+                            const HttpReqArg::Vec& /*args*/) const override {
+        return response;
+    }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tMetrics)
+
+BOOST_AUTO_TEST_CASE(histogram_quantilesWithinBucketPrecision) {
+    Histogram histogram;
+    for (int i = 1; i <= 1000; ++i) {
+        histogram.record(std::chrono::microseconds(i * 100));
+    }
+
+    BOOST_CHECK_EQUAL(histogram.count(), 1000);
+    BOOST_CHECK_EQUAL(histogram.max().count(), 100000);
+    const auto p50 = histogram.quantile(0.5).count();
+    const auto p99 = histogram.quantile(0.99).count();
+    BOOST_CHECK(p50 >= 50000 * 0.875 && p50 <= 50000 * 1.125);
+    BOOST_CHECK(p99 >= 99000 * 0.875 && p99 <= 100000);
+}
+
+BOOST_AUTO_TEST_CASE(histogram_bucketsCoverEveryValue) {
+    for (std::uint64_t value : {0ULL, 1ULL, 7ULL, 8ULL, 9ULL, 1000ULL,
+                                123456789ULL}) {
+        const std::size_t bucket = Histogram::bucketOf(value);
+        BOOST_CHECK(value < Histogram::bucketUpperBound(bucket));
+        if (bucket > 0) {
+            BOOST_CHECK(value >= Histogram::bucketUpperBound(bucket - 1));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(histogram_exportCountsNoRecordAboveItsBound) {
+    Histogram histogram;
+    for (int micros : {7, 499, 500, 501, 999, 1000, 1001}) {
+        histogram.record(std::chrono::microseconds(micros));
+    }
+    // 7us fills its bucket [7, 8) exactly; 499..501 share [480, 512), which
+    // straddles 500us, and 999..1001 [960, 1024), which straddles 1ms.
+    BOOST_CHECK_EQUAL(histogram.countAtOrBelow(std::chrono::microseconds(7)),
+                      1);
+    BOOST_CHECK_EQUAL(
+        histogram.countAtOrBelow(std::chrono::microseconds(500)), 1);
+    BOOST_CHECK_EQUAL(
+        histogram.countAtOrBelow(std::chrono::microseconds(1000)), 4);
+    BOOST_CHECK_EQUAL(
+        histogram.countAtOrBelow(std::chrono::microseconds(2500)), 7);
+
+    // A bucket is counted from the first bound at or above its largest
+    // value, never at a smaller one.
+    for (std::uint64_t bound = 1; bound < 100000; bound = bound * 3 + 1) {
+        for (std::uint64_t value : {bound - 1, bound, bound + 1}) {
+            Histogram single;
+            single.record(std::chrono::microseconds(value));
+            const std::uint64_t largest =
+                Histogram::bucketUpperBound(Histogram::bucketOf(value)) - 1;
+            BOOST_CHECK_EQUAL(
+                single.countAtOrBelow(std::chrono::microseconds(bound)),
+                largest <= bound ? 1 : 0);
+            BOOST_CHECK_EQUAL(
+                single.countAtOrBelow(std::chrono::microseconds(largest)), 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(setMetrics_releasesReplacedRegistries) {
+    auto metrics = std::make_shared<Metrics>();
+    const std::weak_ptr<Metrics> registered = metrics;
+    setMetrics(std::move(metrics));
+    BOOST_CHECK(getMetrics() == registered.lock());
+    {
+        // A recording in progress keeps it alive.
+        const auto recording = detail::metrics();
+        setMetrics(nullptr);
+        BOOST_CHECK(!getMetrics());
+        BOOST_CHECK(!registered.expired());
+    }
+    BOOST_CHECK(registered.expired());
+}
+
+BOOST_AUTO_TEST_CASE(api_recordsResponsesAndLatency) {
+    auto metrics = std::make_shared<Metrics>();
+    setMetrics(metrics);
+
+    FixedHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    http.response =
+        R"({"ok":true,"result":{"id":42,"is_bot":true,"first_name":"B"}})";
+    api.getMe();
+    http.response =
+        R"({"ok":false,"error_code":400,"description":"Bad Request"})";
+    BOOST_CHECK_THROW(api.getMe(), TgException);
+    setMetrics(nullptr);
+
+    BOOST_CHECK_EQUAL(
+        metrics
+            ->counter("tgbot_api_responses_total",
+                      {{"method", "getMe"}, {"status", "200"}})
+            .value(),
+        1);
+    BOOST_CHECK_EQUAL(
+        metrics
+            ->counter("tgbot_api_responses_total",
+                      {{"method", "getMe"}, {"status", "400"}})
+            .value(),
+        1);
+    BOOST_CHECK_EQUAL(metrics
+                          ->histogram("tgbot_api_request_duration_seconds",
+                                      {{"method", "getMe"}})
+                          .count(),
+                      2);
+
+    const std::string text = metrics->toPrometheus();
+    BOOST_CHECK(text.find("# TYPE tgbot_api_request_duration_seconds "
+                          "histogram") != std::string::npos);
+    BOOST_CHECK(text.find("tgbot_api_request_duration_seconds_bucket{"
+                          "method=\"getMe\",le=\"+Inf\"} 2") !=
+                std::string::npos);
+    BOOST_CHECK(text.find("tgbot_api_responses_total{method=\"getMe\","
+                          "status=\"400\"} 1") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
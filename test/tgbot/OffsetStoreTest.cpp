@@ -0,0 +1,202 @@
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <tgbot/Bot.h>
+#include <tgbot/OffsetStore.h>
+#include <tgbot/net/HttplibClient.h>
+#include <tgbot/net/TgLongPoll.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+using TgBot::testing::FakeBotApiServer;
+
+namespace {
+
+std::string tempPath(const std::string& name) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+std::unique_ptr<Bot> makeBot(const FakeBotApiServer& server,
+                             std::vector<std::string>& handled) {
+    auto bot = std::make_unique<Bot>(
+        server.token(),
+        std::make_unique<HttplibClient>(std::chrono::seconds(5)),
+        server.url());
+    bot->getEvents().onAnyMessage([&handled](const Message::Ptr& message) {
+        if (message->text == "fail") {
+            throw std::runtime_error("listener failed");
+        }
+        handled.push_back(*message->text);
+    });
+    return bot;
+}
+
+// Simulates a crash right after the state became durable, before the batch
+// was confirmed to Telegram.
+class CrashAfterSave : public OffsetStore {
+   public:
+    explicit CrashAfterSave(std::shared_ptr<OffsetStore> store)
+        : _store(std::move(store)) {}
+
+    OffsetState load() override { return _store->load(); }
+
+    void save(const OffsetState& state) override {
+        _store->save(state);
+        throw std::runtime_error("crash");
+    }
+
+   private:
+    std::shared_ptr<OffsetStore> _store;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tOffsetStore)
+
+BOOST_AUTO_TEST_CASE(fileStore_roundTrip) {
+    const std::string path = tempPath("tgbot_offset_roundtrip.txt");
+    FileOffsetStore store(path);
+    BOOST_CHECK_EQUAL(store.load().offset, 0);
+    BOOST_CHECK(store.load().handled.empty());
+
+    store.save({42, {39, 40, 41}});
+    const OffsetState state = FileOffsetStore(path).load();
+    BOOST_CHECK_EQUAL(state.offset, 42);
+    BOOST_CHECK(state.handled == std::vector<std::int32_t>({39, 40, 41}));
+    BOOST_CHECK(!std::filesystem::exists(path + ".tmp"));
+}
+
+BOOST_AUTO_TEST_CASE(fileStore_rejectsCorruptFiles) {
+    const std::string path = tempPath("tgbot_offset_corrupt.txt");
+    for (const char* content : {"", "garbage\n", "42\n39 4x 41\n"}) {
+        std::ofstream(path) << content;
+        BOOST_CHECK_THROW(FileOffsetStore(path).load(), std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fileStore_reportsIoErrorsWithErrno) {
+    FileOffsetStore store(
+        (std::filesystem::temp_directory_path() / "tgbot_no_such_dir" / "o")
+            .string());
+    BOOST_CHECK_EXCEPTION(
+        store.save({1, {}}), std::system_error,
+        [](const std::system_error& e) {
+            return e.code() == std::errc::no_such_file_or_directory;
+        });
+}
+
+BOOST_AUTO_TEST_CASE(longPoll_restartDoesNotReprocess) {
+    const std::string path = tempPath("tgbot_offset_restart.txt");
+    FakeBotApiServer server;
+    server.pushMessage(1, "a");
+    server.pushMessage(1, "b");
+
+    std::vector<std::string> handled;
+    {
+        auto bot = makeBot(server, handled);
+        TgLongPoll* longPoll = bot->createLongPoll(100, 0);
+        longPoll->setOffsetStore(std::make_shared<CrashAfterSave>(
+            std::make_shared<FileOffsetStore>(path)));
+        longPoll->start();
+        BOOST_CHECK_THROW(longPoll->start(), std::runtime_error);
+    }
+    // The state is saved after each handled update.
+    BOOST_CHECK_EQUAL(handled.size(), 1);
+    // Never confirmed, so Telegram still holds both updates.
+    BOOST_CHECK_EQUAL(server.pendingUpdates(), 2);
+
+    auto bot = makeBot(server, handled);
+    TgLongPoll* longPoll = bot->createLongPoll(100, 0);
+    longPoll->setOffsetStore(std::make_shared<FileOffsetStore>(path));
+    longPoll->start();
+    longPoll->start();
+    BOOST_CHECK_EQUAL(handled.size(), 2);
+    BOOST_CHECK_EQUAL(server.pendingUpdates(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(longPoll_failureMidBatchDoesNotReprocessEarlierUpdates) {
+    const std::string path = tempPath("tgbot_offset_midbatch.txt");
+    FakeBotApiServer server;
+    server.pushMessage(1, "a");
+    server.pushMessage(1, "fail");
+    server.pushMessage(1, "c");
+
+    std::vector<std::string> handled;
+    {
+        auto bot = makeBot(server, handled);
+        TgLongPoll* longPoll = bot->createLongPoll(100, 0);
+        longPoll->setOffsetStore(std::make_shared<FileOffsetStore>(path));
+        longPoll->start();
+        BOOST_CHECK_THROW(longPoll->start(), std::runtime_error);
+    }
+    BOOST_CHECK(handled == std::vector<std::string>({"a"}));
+
+    // The process restarts with the failure fixed; "a" is redelivered but
+    // was saved as handled before "fail" threw.
+    Bot bot(server.token(),
+            std::make_unique<HttplibClient>(std::chrono::seconds(5)),
+            server.url());
+    bot.getEvents().onAnyMessage([&handled](const Message::Ptr& message) {
+        handled.push_back(*message->text);
+    });
+    TgLongPoll* longPoll = bot.createLongPoll(100, 0);
+    longPoll->setOffsetStore(std::make_shared<FileOffsetStore>(path));
+    longPoll->start();
+    longPoll->start();
+    BOOST_CHECK(handled == std::vector<std::string>({"a", "fail", "c"}));
+    BOOST_CHECK_EQUAL(server.pendingUpdates(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(longPoll_throwingListenerResumesAtSameUpdate) {
+    FakeBotApiServer server;
+    server.pushMessage(1, "a");
+    const auto failing = server.pushMessage(1, "fail");
+    server.pushMessage(1, "c");
+
+    std::vector<std::string> handled;
+    auto bot = makeBot(server, handled);
+    TgLongPoll* longPoll = bot->createLongPoll(100, 0);
+    longPoll->start();
+    BOOST_CHECK_THROW(longPoll->start(), std::runtime_error);
+    BOOST_CHECK_THROW(longPoll->start(), std::runtime_error);
+    BOOST_CHECK(handled == std::vector<std::string>({"a"}));
+
+    // Nothing was confirmed past the failing update.
+    const auto calls = server.calls();
+    BOOST_CHECK(calls.back().params.count("offset") == 0 ||
+                std::stoi(calls.back().params.at("offset")) <= failing);
+}
+
+BOOST_AUTO_TEST_CASE(longPoll_skipsUpdatesInDedupWindow) {
+    const std::string path = tempPath("tgbot_offset_dedup.txt");
+    FileOffsetStore(path).save({0, {1, 2}});
+    FakeBotApiServer server;
+    server.pushMessage(1, "a");
+    server.pushMessage(1, "b");
+    server.pushMessage(1, "c");
+
+    std::vector<std::string> handled;
+    auto bot = makeBot(server, handled);
+    TgLongPoll* longPoll = bot->createLongPoll(100, 0);
+    longPoll->setOffsetStore(std::make_shared<FileOffsetStore>(path));
+    longPoll->start();
+    longPoll->start();
+    BOOST_CHECK(handled == std::vector<std::string>({"c"}));
+
+    const OffsetState state = FileOffsetStore(path).load();
+    BOOST_CHECK_EQUAL(state.offset, 4);
+    BOOST_CHECK(state.handled == std::vector<std::int32_t>({1, 2, 3}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,124 @@
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <tgbot/ParseCache.h>
+#include <tgbot/TgTypeParser.h>
+#include <tgbot/types/Chat.h>
+#include <tgbot/types/Sticker.h>
+#include <tgbot/types/Update.h>
+#include <tgbot/types/User.h>
+
+using namespace TgBot;
+
+namespace {
+
+// Keeps the process-wide cache enabled for one test case.
+struct CacheScope {
+    explicit CacheScope(std::size_t capacity = 4096) {
+        ParseCache::enable(capacity);
+    }
+    ~CacheScope() { ParseCache::disable(); }
+};
+
+nlohmann::json user(std::int64_t id, const char* name) {
+    return {{"id", id}, {"is_bot", false}, {"first_name", name}};
+}
+
+nlohmann::json update(std::int32_t id, const nlohmann::json& from) {
+    return {{"update_id", id},
+            {"message",
+             {{"message_id", id},
+              {"date", 0},
+              {"from", from},
+              {"chat", {{"id", from["id"]}, {"type", "private"}}},
+              {"text", "hi"}}}};
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tParseCache)
+
+BOOST_AUTO_TEST_CASE(disabledByDefault) {
+    BOOST_CHECK(!ParseCache::enabled());
+    BOOST_CHECK(parse<User>(user(1, "Ann")) != parse<User>(user(1, "Ann")));
+}
+
+BOOST_AUTO_TEST_CASE(identicalObjectsAreShared) {
+    CacheScope scope;
+    const auto first = parse<Update>(update(1, user(7, "Ann")));
+    const auto second = parse<Update>(update(2, user(7, "Ann")));
+    BOOST_REQUIRE(first->message && second->message);
+    const Message::Ptr& a = *first->message;
+    const Message::Ptr& b = *second->message;
+    BOOST_REQUIRE(a->from && b->from);
+    BOOST_CHECK(*a->from == *b->from);
+    BOOST_CHECK(a->chat == b->chat);
+    BOOST_CHECK_EQUAL((*a->from)->firstName, "Ann");
+
+    const auto stats = ParseCache::stats();
+    BOOST_CHECK_EQUAL(stats.hits, 2);
+    BOOST_CHECK_EQUAL(stats.misses, 2);
+    BOOST_CHECK_EQUAL(stats.size, 2);
+}
+
+BOOST_AUTO_TEST_CASE(changedContentIsParsedAgain) {
+    CacheScope scope;
+    const auto before = parse<User>(user(7, "Ann"));
+    const auto renamed = parse<User>(user(7, "Anna"));
+    BOOST_CHECK(before != renamed);
+    BOOST_CHECK_EQUAL(before->firstName, "Ann");
+    BOOST_CHECK_EQUAL(renamed->firstName, "Anna");
+    // The newer version replaced the older one.
+    BOOST_CHECK(parse<User>(user(7, "Anna")) == renamed);
+    BOOST_CHECK_EQUAL(ParseCache::stats().size, 1);
+}
+
+BOOST_AUTO_TEST_CASE(stickersAreKeyedByUniqueFileId) {
+    CacheScope scope;
+    const nlohmann::json sticker = {
+        {"file_id", "f"},       {"file_unique_id", "u"}, {"type", "regular"},
+        {"width", 512},         {"height", 512},         {"is_animated", false},
+        {"is_video", false}};
+    BOOST_CHECK(parse<Sticker>(sticker) == parse<Sticker>(sticker));
+    BOOST_CHECK(parse<Chat>(nlohmann::json::object()) !=
+                parse<Chat>(nlohmann::json::object()));
+}
+
+BOOST_AUTO_TEST_CASE(capacityIsBounded) {
+    CacheScope scope(64);
+    for (int id = 0; id < 10000; ++id) {
+        parse<User>(user(id, "x"));
+    }
+    // Rounded up to whole shards.
+    BOOST_CHECK_LE(ParseCache::stats().size, 64);
+}
+
+BOOST_AUTO_TEST_CASE(concurrentParsing) {
+    CacheScope scope(256);
+    std::atomic<int> wrong{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&wrong] {
+            for (int i = 0; i < 2000; ++i) {
+                const auto parsed = parse<User>(user(i % 100, "same"));
+                if (!parsed || parsed->id != i % 100) {
+                    ++wrong;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(wrong, 0);
+    const auto stats = ParseCache::stats();
+    BOOST_CHECK_EQUAL(stats.hits + stats.misses, 8000);
+    BOOST_CHECK_LE(stats.misses, 400);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -3,7 +3,9 @@
 #include <memory>
 
 #include <nlohmann/json.hpp>
+#include <tgbot/TgException.h>
 #include <tgbot/TgTypeParser.h>
+#include <tgbot/types/MessageEntity.h>
 #include <tgbot/types/RichBlock.h>
 #include <tgbot/types/RichBlockBlockQuotation.h>
 #include <tgbot/types/RichBlockParagraph.h>
@@ -61,4 +63,39 @@ BOOST_AUTO_TEST_CASE(richBlockRoundTrip) {
     BOOST_CHECK(put(rb) == in);
 }
 
+// Every styled node a level deeper than the previous one: each level is
+// dispatched on its "type" and put without re-merging the levels below.
+BOOST_AUTO_TEST_CASE(deeplyNestedRoundTrip) {
+    const char* const styles[] = {"bold", "italic", "underline",
+                                  "strikethrough", "spoiler", "code"};
+    nlohmann::json in = "leaf";
+    for (int depth = 0; depth < 120; ++depth) {
+        in = nlohmann::json{{"type", styles[depth % 6]},
+                            {"text", nlohmann::json::array({"x", in})}};
+    }
+
+    auto rt = parse<RichText>(in);
+
+    BOOST_REQUIRE(rt != nullptr);
+    BOOST_CHECK_EQUAL(rt->type, "code");
+    BOOST_CHECK(put(rt) == in);
+}
+
+BOOST_AUTO_TEST_CASE(unknownTypeIsRejected) {
+    const auto in = nlohmann::json::parse(R"({"type":"blink","text":"x"})");
+    BOOST_CHECK_THROW(parse<RichText>(in), TgException);
+    BOOST_CHECK_THROW(parse<RichBlock>(nlohmann::json::object()), TgException);
+}
+
+BOOST_AUTO_TEST_CASE(messageEntityTypeRoundTrip) {
+    const auto in = nlohmann::json::parse(
+        R"({"type":"expandable_blockquote","offset":1,"length":2})");
+
+    auto entity = parse<MessageEntity>(in);
+
+    BOOST_REQUIRE(entity != nullptr);
+    BOOST_CHECK(entity->type == MessageEntity::Type::ExpandableBlockquote);
+    BOOST_CHECK(put(entity) == in);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+#include <nlohmann/json.hpp>
+#include <tgbot/TgTypeParser.h>
+#include <tgbot/types/BusinessMessagesDeleted.h>
+#include <tgbot/types/ChatMemberOwner.h>
+#include <tgbot/types/User.h>
+#include <tgbot/types/UserProfilePhotos.h>
+
+using namespace TgBot;
+
+BOOST_AUTO_TEST_SUITE(tTgTypeParser)
+
+// Generated parsers walk the keys of the object and switch on the field each
+// one names, instead of looking every field up; these cases pin down that
+// they still behave like the lookups did.
+
+BOOST_AUTO_TEST_CASE(unknownKeysAreIgnored) {
+    const auto user = parse<User>(nlohmann::json::parse(
+        R"({"id":7,"first_name":"Ann","not_in_the_api":{"x":1},"is_bot":false})"));
+    BOOST_REQUIRE(user != nullptr);
+    BOOST_CHECK_EQUAL(user->id, 7);
+    BOOST_CHECK_EQUAL(user->firstName, "Ann");
+    BOOST_CHECK(user->isBot == false);
+    BOOST_CHECK(!user->username);
+}
+
+BOOST_AUTO_TEST_CASE(nullLeavesPrimitivesUnset) {
+    const auto user = parse<User>(nlohmann::json::parse(
+        R"({"id":7,"first_name":"Ann","username":null,"is_premium":true})"));
+    BOOST_CHECK(!user->username);
+    BOOST_CHECK(user->isPremium == true);
+}
+
+BOOST_AUTO_TEST_CASE(nonObjectGivesEmptyObject) {
+    const auto user = parse<User>(nlohmann::json::array({1, 2}));
+    BOOST_REQUIRE(user != nullptr);
+    BOOST_CHECK(user->firstName.empty());
+}
+
+BOOST_AUTO_TEST_CASE(nestedArraysRoundTrip) {
+    const auto in = nlohmann::json::parse(R"({
+        "total_count": 2,
+        "photos": [[{"file_id":"a","file_unique_id":"ua","width":1,"height":2}],
+                   []]
+    })");
+    const auto photos = parse<UserProfilePhotos>(in);
+    BOOST_CHECK_EQUAL(photos->totalCount, 2);
+    BOOST_REQUIRE_EQUAL(photos->photos.size(), 2);
+    BOOST_REQUIRE_EQUAL(photos->photos[0].size(), 1);
+    BOOST_CHECK_EQUAL(photos->photos[0][0]->fileId, "a");
+    BOOST_CHECK(put(photos) == in);
+
+    const auto deleted = parse<BusinessMessagesDeleted>(nlohmann::json::parse(
+        R"({"business_connection_id":"b","chat":{"id":1,"type":"private"},
+            "message_ids":[3,1,2]})"));
+    BOOST_CHECK(deleted->messageIds == std::vector<std::int32_t>({3, 1, 2}));
+    BOOST_REQUIRE(deleted->chat != nullptr);
+    BOOST_CHECK_EQUAL(deleted->chat->id, 1);
+}
+
+BOOST_AUTO_TEST_CASE(putMatchesParse) {
+    const auto in = nlohmann::json::parse(R"({
+        "status": "creator",
+        "user": {"id": 7, "is_bot": false, "first_name": "Ann"},
+        "is_anonymous": false,
+        "custom_title": "boss"
+    })");
+    const auto member = parse<ChatMemberOwner>(in);
+    BOOST_REQUIRE(member->user != nullptr);
+    BOOST_CHECK_EQUAL(member->user->firstName, "Ann");
+    BOOST_CHECK_EQUAL(put(member).dump(), in.dump());
+}
+
+BOOST_AUTO_TEST_CASE(keyedHelpersTakeStringViews) {
+    const auto data = nlohmann::json::parse(R"({"a":[1,2],"b":null})");
+    const std::string_view a = "a";
+    BOOST_CHECK(parsePrimitiveArray<int>(data, a) == std::vector<int>({1, 2}));
+    BOOST_CHECK(!parsePrimitiveArray<int>(data, "missing"));
+    std::optional<std::int64_t> b = 5;
+    parse(data, "b", &b);
+    BOOST_CHECK(b == 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tgbot/Api.h>
+#include <tgbot/Tracing.h>
+#include <tgbot/net/HttpClient.h>
+
+using namespace TgBot;
+
+namespace {
+
+class CollectingExporter : public SpanExporter {
+   public:
+    void exportSpan(const SpanData& span) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        spans.push_back(span);
+    }
+
+    std::mutex mutex;
+    std::vector<SpanData> spans;
+};
+
+class FixedHttpClient : public HttpClient {
+   public:
+    FixedHttpClient() : HttpClient(std::chrono::seconds(1)) {}
+
+    std::string makeRequest(const Url& /*url*/,
+                            const HttpReqArg::Vec& /*args*/) const override {
+        return R"({"ok":true,"result":{"message_id":1,"date":1,)"
+               R"("chat":{"id":5,"type":"private"},"text":"hi"}})";
+    }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tTracing)
+
+BOOST_AUTO_TEST_CASE(disabled_spansRecordNothing) {
+    setSpanExporter(nullptr);
+    Span span("noop");
+    BOOST_CHECK(!span.recording());
+    BOOST_CHECK(!Span::current().valid());
+}
+
+BOOST_AUTO_TEST_CASE(apiCalls_becomeChildrenOfTheCurrentSpan) {
+    auto exporter = std::make_shared<CollectingExporter>();
+    setSpanExporter(exporter);
+
+    FixedHttpClient http;
+    Api api("TOKEN", &http, "https://api.telegram.org");
+    SpanContext parent;
+    {
+        Span handler("handler");
+        parent = handler.context();
+        api.sendMessage(std::int64_t{5}, "hi");
+
+        // Context carried over to another thread.
+        std::thread([&api, parent] {
+            ContextScope scope(parent);
+            api.sendMessage(std::int64_t{5}, "from worker");
+        }).join();
+    }
+    setSpanExporter(nullptr);
+
+    BOOST_REQUIRE_EQUAL(exporter->spans.size(), 3);
+    for (int i = 0; i < 2; ++i) {
+        const SpanData& call = exporter->spans[i];
+        BOOST_CHECK_EQUAL(call.name, "sendMessage");
+        BOOST_CHECK(call.context.traceId == parent.traceId);
+        BOOST_CHECK(call.parentSpanId == parent.spanId);
+    }
+    BOOST_CHECK_EQUAL(exporter->spans[2].name, "handler");
+}
+
+BOOST_AUTO_TEST_CASE(traceparent_roundTrips) {
+    const std::string header =
+        "00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01";
+    auto context = SpanContext::fromTraceparent(header);
+    BOOST_REQUIRE(context.has_value());
+    BOOST_CHECK_EQUAL(context->toTraceparent(), header);
+    BOOST_CHECK(!SpanContext::fromTraceparent("00-zz").has_value());
+
+    const std::string ids =
+        "-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-";
+    // A later version may append fields; version 00 may not.
+    BOOST_CHECK(SpanContext::fromTraceparent("01" + ids + "00").has_value());
+    BOOST_CHECK(
+        SpanContext::fromTraceparent("01" + ids + "01-extra").has_value());
+    for (const std::string& malformed :
+         {"ff" + ids + "01", "0g" + ids + "01", "00" + ids + "0x",
+          "00" + ids + "1", "00" + ids + "01-extra", "01" + ids + "01extra",
+          "00" + ids + "0A"}) {
+        BOOST_CHECK_MESSAGE(!SpanContext::fromTraceparent(malformed),
+                            malformed);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(setSpanExporter_releasesReplacedExporters) {
+    auto exporter = std::make_shared<CollectingExporter>();
+    const std::weak_ptr<CollectingExporter> registered = exporter;
+    setSpanExporter(std::move(exporter));
+    {
+        // A span in flight ends into the exporter it started on.
+        Span span("in flight");
+        setSpanExporter(nullptr);
+        BOOST_CHECK(!registered.expired());
+    }
+    BOOST_CHECK(registered.expired());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
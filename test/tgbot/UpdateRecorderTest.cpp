@@ -0,0 +1,168 @@
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <tgbot/Bot.h>
+#include <tgbot/EventBroadcaster.h>
+#include <tgbot/EventHandler.h>
+#include <tgbot/UpdateRecorder.h>
+#include <tgbot/net/HttplibClient.h>
+#include <tgbot/net/TgLongPoll.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+
+namespace {
+
+std::string tempPath(const std::string& name) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+std::string message(int updateId, const std::string& text) {
+    return R"({"update_id":)" + std::to_string(updateId) +
+           R"(,"message":{"message_id":1,"date":0,"chat":{"id":5,"type":"private"},"text":")" +
+           text + R"("}})";
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tUpdateRecorder)
+
+BOOST_AUTO_TEST_CASE(records_roundTripWithTimestamps) {
+    const std::string path = tempPath("tgbot_capture_roundtrip.bin");
+    const auto time = std::chrono::system_clock::time_point(
+        std::chrono::microseconds(1700000000123456));
+    {
+        UpdateRecorder recorder(path);
+        recorder.record(message(1, "a"), time);
+        recorder.record(message(2, "b"), time + std::chrono::seconds(1));
+    }
+
+    UpdateReplayer replayer(path);
+    auto first = replayer.next();
+    BOOST_REQUIRE(first);
+    BOOST_CHECK(first->time == time);
+    BOOST_CHECK_EQUAL(first->payload, message(1, "a"));
+    auto second = replayer.next();
+    BOOST_REQUIRE(second);
+    BOOST_CHECK(second->time == time + std::chrono::seconds(1));
+    BOOST_CHECK(!replayer.next());
+}
+
+BOOST_AUTO_TEST_CASE(replay_skipsTruncatedTail) {
+    const std::string path = tempPath("tgbot_capture_truncated.bin");
+    {
+        UpdateRecorder recorder(path);
+        recorder.record(message(1, "a"));
+        recorder.record(message(2, "b"));
+    }
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 5);
+
+    EventBroadcaster broadcaster;
+    EventHandler handler(&broadcaster);
+    std::vector<std::string> texts;
+    broadcaster.onAnyMessage(
+        [&texts](const Message::Ptr& m) { texts.push_back(*m->text); });
+
+    UpdateReplayer replayer(path);
+    BOOST_CHECK_EQUAL(replayer.replay(handler, 0), 1);
+    BOOST_REQUIRE_EQUAL(texts.size(), 1);
+    BOOST_CHECK_EQUAL(texts[0], "a");
+}
+
+BOOST_AUTO_TEST_CASE(missingFile_throwsSystemError) {
+    const std::string path = tempPath("tgbot_capture_missing.bin");
+    BOOST_CHECK_EXCEPTION(
+        UpdateReplayer replayer(path), std::system_error,
+        [](const std::system_error& e) {
+            return e.code() == std::errc::no_such_file_or_directory;
+        });
+}
+
+BOOST_AUTO_TEST_CASE(replay_resyncsAfterDamagedRecords) {
+    const std::string path = tempPath("tgbot_capture_damaged.bin");
+    {
+        UpdateRecorder recorder(path);
+        recorder.record(message(1, "a"));
+        recorder.record(message(2, "torn"));
+    }
+    // A crash tore the last record, then a later run appended to the file.
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 5);
+    {
+        // A header claiming a 4 GiB payload must not be allocated.
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        out.write("\xF5TGU\0\0\0\0\0\0\0\0\xFF\xFF\xFF\xFF\0\0\0\0", 20);
+    }
+    {
+        UpdateRecorder recorder(path);
+        recorder.record(message(3, "b"));
+    }
+    {
+        // A flipped payload byte fails the checksum.
+        UpdateRecorder recorder(path);
+        recorder.record(message(4, "c"));
+    }
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-3, std::ios::end);
+        file.put('x');
+    }
+
+    UpdateReplayer replayer(path);
+    std::vector<std::string> payloads;
+    while (auto record = replayer.next()) {
+        payloads.push_back(record->payload);
+    }
+    BOOST_CHECK(payloads ==
+                std::vector<std::string>({message(1, "a"), message(3, "b")}));
+}
+
+BOOST_AUTO_TEST_CASE(replay_scalesOriginalPace) {
+    const std::string path = tempPath("tgbot_capture_pace.bin");
+    const auto time = std::chrono::system_clock::now();
+    {
+        UpdateRecorder recorder(path);
+        recorder.record(message(1, "a"), time);
+        recorder.record(message(2, "b"), time + std::chrono::milliseconds(400));
+    }
+
+    EventBroadcaster broadcaster;
+    EventHandler handler(&broadcaster);
+    UpdateReplayer replayer(path);
+    const auto started = std::chrono::steady_clock::now();
+    BOOST_CHECK_EQUAL(replayer.replay(handler, 2), 2);
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+    BOOST_CHECK(elapsed >= std::chrono::milliseconds(200));
+    BOOST_CHECK(elapsed < std::chrono::milliseconds(400));
+}
+
+BOOST_AUTO_TEST_CASE(longPoll_capturesReceivedUpdates) {
+    const std::string path = tempPath("tgbot_capture_longpoll.bin");
+    testing::FakeBotApiServer server;
+    server.pushMessage(9, "captured");
+    {
+        Bot bot(server.token(),
+                std::make_unique<HttplibClient>(std::chrono::seconds(5)),
+                server.url());
+        TgLongPoll* longPoll = bot.createLongPoll(100, 0);
+        longPoll->record(std::make_shared<UpdateRecorder>(path));
+        longPoll->start();
+    }
+
+    UpdateReplayer replayer(path);
+    auto record = replayer.next();
+    BOOST_REQUIRE(record);
+    BOOST_CHECK(record->payload.find("\"captured\"") != std::string::npos);
+    BOOST_CHECK(!replayer.next());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
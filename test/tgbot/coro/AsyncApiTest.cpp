@@ -0,0 +1,214 @@
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tgbot/TgException.h>
+#include <tgbot/coro/AsyncApi.h>
+#include <tgbot/coro/Task.h>
+#include <tgbot/net/EpollHttpClient.h>
+#include <tgbot/net/RequestOptions.h>
+#include <tgbot/types/InputFile.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+using namespace TgBot::coro;
+using TgBot::testing::FakeBotApiServer;
+
+namespace {
+
+// getFile, downloadFile and sendPhoto, one after the other.
+Task<Message::Ptr> forwardPhoto(const AsyncApi& api, std::int64_t chatId) {
+    const File::Ptr file = co_await api.getFile("photo1");
+    auto upload = std::make_shared<InputFile>();
+    upload->data = co_await api.downloadFile(file->filePath.value_or(""));
+    upload->mimeType = "image/png";
+    upload->fileName = "photo.png";
+    co_return co_await api.sendPhoto(chatId, upload, "forwarded");
+}
+
+Task<std::vector<std::int32_t>> receive(const AsyncApi& api,
+                                        std::size_t count) {
+    std::vector<std::int32_t> ids;
+    auto updates = api.updates(100, 1);
+    while (ids.size() < count) {
+        auto update = co_await updates.next();
+        if (!update) {
+            break;
+        }
+        ids.push_back((*update)->updateId);
+    }
+    co_return ids;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tAsyncApi)
+
+BOOST_AUTO_TEST_CASE(chainedCalls) {
+    FakeBotApiServer server;
+    AsyncApi api(server.token(), std::make_shared<EpollHttpClient>(),
+                 server.url());
+
+    const User::Ptr me = syncWait(api.getMe());
+    BOOST_REQUIRE(me);
+    BOOST_CHECK(me->username == "fake_bot");
+
+    server.addFile("photo1", "photos/file_1.png", std::string("PNG\0", 4));
+    const Message::Ptr sent = syncWait(forwardPhoto(api, 42));
+    BOOST_REQUIRE(sent);
+    BOOST_CHECK(sent->caption == "forwarded");
+    BOOST_CHECK(server.calls().back().params.at("photo") ==
+                std::string("PNG\0", 4));
+
+    BOOST_CHECK(syncWait(api.request<bool>("deleteWebhook")));
+    BOOST_CHECK_EXCEPTION(syncWait(api.call("noSuchMethod")), TgException,
+                          [](const TgException& e) {
+                              return e.errorCode ==
+                                     TgException::ErrorCode::NotFound;
+                          });
+}
+
+BOOST_AUTO_TEST_CASE(rateLimitIsWaitedOut) {
+    FakeBotApiServer server;
+    AsyncApi api(server.token(), std::make_shared<EpollHttpClient>(),
+                 server.url());
+    server.rateLimit(1, 1);
+    const Message::Ptr sent = syncWait(api.sendMessage(7, "later"));
+    BOOST_REQUIRE(sent);
+    BOOST_CHECK(sent->text == "later");
+    BOOST_CHECK_EQUAL(server.rateLimited(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(conversationsShareOneThread) {
+    FakeBotApiServer server;
+    AsyncApi api(server.token(),
+                 std::make_shared<EpollHttpClient>(std::chrono::seconds(20),
+                                                   16, 1),
+                 server.url());
+
+    constexpr int kConversations = 500;
+    std::mutex mutex;
+    std::condition_variable done;
+    int finished = 0;
+    std::atomic<int> failed{0};
+    std::set<std::thread::id> threads;
+    for (int i = 0; i < kConversations; ++i) {
+        spawn([](const AsyncApi& api, int chatId, std::mutex& mutex,
+                 std::condition_variable& done, int& finished,
+                 std::atomic<int>& failed,
+                 std::set<std::thread::id>& threads) -> Task<void> {
+            try {
+                co_await api.getMe();
+                const auto message =
+                    co_await api.sendMessage(chatId, "hello");
+                if (!message || message->chat->id != chatId) {
+                    ++failed;
+                }
+            } catch (...) {
+                ++failed;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+            if (++finished == kConversations) {
+                done.notify_one();
+            }
+        }(api, i + 1, mutex, done, finished, failed, threads));
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    BOOST_REQUIRE(done.wait_for(lock, std::chrono::seconds(30), [&] {
+        return finished == kConversations;
+    }));
+    BOOST_CHECK_EQUAL(failed, 0);
+    BOOST_CHECK_EQUAL(threads.size(), 1);
+    BOOST_CHECK_EQUAL(server.callCount("sendMessage"), kConversations);
+}
+
+BOOST_AUTO_TEST_CASE(updateStream) {
+    FakeBotApiServer server;
+    AsyncApi api(server.token(),
+                 std::make_shared<EpollHttpClient>(std::chrono::seconds(5)),
+                 server.url());
+    const std::int32_t first = server.pushMessage(1, "a");
+    const std::int32_t second = server.pushMessage(1, "b");
+    std::thread late([&server] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        server.pushMessage(2, "c");
+    });
+    const auto ids = syncWait(receive(api, 3));
+    late.join();
+    BOOST_REQUIRE_EQUAL(ids.size(), 3);
+    BOOST_CHECK_EQUAL(ids[0], first);
+    BOOST_CHECK_EQUAL(ids[1], second);
+    BOOST_CHECK_GT(ids[2], second);
+}
+
+BOOST_AUTO_TEST_CASE(streamResumesAfterHandledUpdates) {
+    FakeBotApiServer server;
+    AsyncApi api(server.token(),
+                 std::make_shared<EpollHttpClient>(std::chrono::seconds(5)),
+                 server.url());
+    const std::int32_t first = server.pushMessage(1, "a");
+    const std::int32_t second = server.pushMessage(1, "b");
+
+    // The consumer fails on the second update and abandons the stream.
+    BOOST_CHECK_THROW(
+        syncWait([](const AsyncApi& api, std::int32_t failing) -> Task<void> {
+            auto updates = api.updates(100, 1);
+            while (auto update = co_await updates.next()) {
+                if ((*update)->updateId == failing) {
+                    throw std::runtime_error("handler failed");
+                }
+            }
+        }(api, second)),
+        std::runtime_error);
+
+    // A new stream hands over the failed update again, but not the first.
+    const auto ids = syncWait(receive(api, 1));
+    BOOST_REQUIRE_EQUAL(ids.size(), 1);
+    BOOST_CHECK_EQUAL(ids[0], second);
+    BOOST_CHECK_NE(ids[0], first);
+}
+
+BOOST_AUTO_TEST_CASE(callsHonourRequestOptions) {
+    FakeBotApiServer server;
+    AsyncApi api(server.token(), std::make_shared<EpollHttpClient>(),
+                 server.url());
+
+    CancellationSource source;
+    source.cancel();
+    RequestOptions cancelled;
+    cancelled.cancellation = source.token();
+    {
+        RequestOptionsScope scope(cancelled);
+        BOOST_CHECK_EXCEPTION(
+            syncWait(api.getMe()), NetworkException,
+            [](const NetworkException& e) {
+                return e.state == NetworkException::State::Cancelled;
+            });
+    }
+    BOOST_CHECK_EQUAL(server.callCount("getMe"), 0);
+
+    // Network errors are not retried past the scoped maxRetries.
+    AsyncApi unreachable(
+        server.token(), std::make_shared<EpollHttpClient>(),
+        "http://127.0.0.1:" + std::to_string(FakeBotApiServer::freePort()));
+    RequestOptions once;
+    once.maxRetries = 0;
+    RequestOptionsScope scope(once);
+    const auto started = std::chrono::steady_clock::now();
+    BOOST_CHECK_THROW(syncWait(unreachable.getMe()), NetworkException);
+    BOOST_CHECK_LT(std::chrono::steady_clock::now() - started,
+                   HttpClient::kRequestBackoff);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,66 @@
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <tgbot/Tracing.h>
+#include <tgbot/coro/AsyncApi.h>
+#include <tgbot/coro/Task.h>
+#include <tgbot/net/EpollHttpClient.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+using namespace TgBot::coro;
+using TgBot::testing::FakeBotApiServer;
+
+namespace {
+
+class CollectingExporter : public SpanExporter {
+   public:
+    void exportSpan(const SpanData& span) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        spans.push_back(span);
+    }
+
+    std::mutex mutex;
+    std::vector<SpanData> spans;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tAsyncTracing)
+
+// The calls start on this thread and end on the event loop's; neither is
+// left with their span as its current one.
+BOOST_AUTO_TEST_CASE(asyncCalls_leaveTheThreadsContextAlone) {
+    FakeBotApiServer server;
+    AsyncApi api(server.token(), std::make_shared<EpollHttpClient>(),
+                 server.url());
+    auto exporter = std::make_shared<CollectingExporter>();
+    setSpanExporter(exporter);
+    {
+        Span handler("handler");
+        syncWait(api.getMe());
+        syncWait(api.getMe());
+        BOOST_CHECK(Span::current().spanId == handler.context().spanId);
+        Span after("after");
+        BOOST_CHECK(after.context().traceId == handler.context().traceId);
+    }
+    BOOST_CHECK(!Span::current().valid());
+    setSpanExporter(nullptr);
+
+    std::lock_guard<std::mutex> lock(exporter->mutex);
+    BOOST_REQUIRE_EQUAL(exporter->spans.size(), 4);
+    const SpanData& handler = exporter->spans.back();
+    BOOST_CHECK_EQUAL(handler.name, "handler");
+    for (std::size_t i = 0; i < 3; ++i) {
+        // Both calls and "after" are children of the handler.
+        BOOST_CHECK(exporter->spans[i].context.traceId ==
+                    handler.context.traceId);
+        BOOST_CHECK(exporter->spans[i].parentSpanId == handler.context.spanId);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,248 @@
+#ifdef __linux__
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tgbot/Bot.h>
+#include <tgbot/TgException.h>
+#include <tgbot/net/EpollHttpClient.h>
+#include <tgbot/net/RequestOptions.h>
+#include <tgbot/net/Url.h>
+#include <tgbot/types/InputFile.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+using TgBot::testing::FakeBotApiServer;
+
+BOOST_AUTO_TEST_SUITE(tEpollHttpClient)
+
+BOOST_AUTO_TEST_CASE(apiCalls_overHttp) {
+    FakeBotApiServer server;
+    Bot bot(server.token(),
+            std::make_shared<EpollHttpClient>(std::chrono::seconds(5)),
+            server.url());
+
+    auto me = bot.getApi().getMe();
+    BOOST_REQUIRE(me);
+    BOOST_CHECK(me->username == "fake_bot");
+
+    auto message = bot.getApi().sendMessage(42, "a&b=c ü");
+    BOOST_REQUIRE(message);
+    BOOST_CHECK(message->text == "a&b=c ü");
+
+    auto file = std::make_shared<InputFile>();
+    file->data = std::string("PNG\0DATA", 8);
+    file->mimeType = "image/png";
+    file->fileName = "a.png";
+    bot.getApi().sendDocument(7, file);
+    BOOST_CHECK(server.calls().back().params.at("document") == file->data);
+
+    server.addFile("file1", "documents/file_1.txt", "contents");
+    BOOST_CHECK_EQUAL(bot.getApi().downloadFile("documents/file_1.txt"),
+                      "contents");
+}
+
+BOOST_AUTO_TEST_CASE(errors_surfaceAsExceptions) {
+    FakeBotApiServer server;
+    Bot bot("1:wrong",
+            std::make_shared<EpollHttpClient>(std::chrono::seconds(1)),
+            server.url());
+    BOOST_CHECK_EXCEPTION(bot.getApi().getMe(), TgException,
+                          [](const TgException& e) {
+                              return e.errorCode ==
+                                     TgException::ErrorCode::Unauthorized;
+                          });
+
+    EpollHttpClient client(std::chrono::seconds(1));
+    const std::string refused = "http://127.0.0.1:" +
+                                std::to_string(FakeBotApiServer::freePort()) +
+                                "/botx/getMe";
+    BOOST_CHECK_THROW(client.makeRequest(Url(refused), {}), NetworkException);
+
+    // The fake holds the long poll for 3s, longer than the client waits.
+    const auto started = std::chrono::steady_clock::now();
+    BOOST_CHECK_THROW(
+        client.makeRequest(
+            Url(server.url() + "/bot" + server.token() +
+                "/getUpdates?timeout=3"),
+            {}),
+        NetworkException);
+    BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                std::chrono::milliseconds(2500));
+}
+
+BOOST_AUTO_TEST_CASE(requestOptions_boundAndCancelCalls) {
+    FakeBotApiServer server;
+    Bot bot(server.token(),
+            std::make_shared<EpollHttpClient>(std::chrono::seconds(1)),
+            server.url());
+    {
+        RequestOptions options;
+        options.timeout = std::chrono::milliseconds(300);
+        RequestOptionsScope scope(options);
+        BOOST_CHECK_EXCEPTION(bot.getApi().getUpdates(0, 100, 3),
+                              NetworkException,
+                              [](const NetworkException& e) {
+                                  return e.state ==
+                                         NetworkException::State::Timeout;
+                              });
+    }
+    CancellationSource source;
+    RequestOptions options;
+    options.cancellation = source.token();
+    RequestOptionsScope scope(options);
+    std::thread canceller([&source] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        source.cancel();
+    });
+    const auto started = std::chrono::steady_clock::now();
+    BOOST_CHECK_EXCEPTION(bot.getApi().getUpdates(0, 100, 3), NetworkException,
+                          [](const NetworkException& e) {
+                              return e.state ==
+                                     NetworkException::State::Cancelled;
+                          });
+    canceller.join();
+    BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                std::chrono::seconds(1));
+    // A cancelled token fails further calls at once.
+    BOOST_CHECK_THROW(bot.getApi().getMe(), NetworkException);
+}
+
+BOOST_AUTO_TEST_CASE(queuedRequests_areServedByPriority) {
+    FakeBotApiServer server;
+    for (const char* method : {"hold", "bulk", "normal", "answerCallbackQuery"}) {
+        server.setResult(method, true);
+    }
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool holding = false;
+    bool released = false;
+    std::vector<std::string> answered;
+    server.onCall([&](const FakeBotApiServer::Call& call) {
+        if (call.method != "hold") {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        holding = true;
+        changed.notify_all();
+        changed.wait_for(lock, std::chrono::seconds(5),
+                         [&released] { return released; });
+    });
+
+    // One shared connection and one for interactive requests.
+    EpollHttpClient client(std::chrono::seconds(5), 1, 1, 1);
+    const std::string base = server.url() + "/bot" + server.token() + "/";
+    const auto send = [&](const std::string& method, RequestPriority priority) {
+        RequestOptions options;
+        options.priority = priority;
+        client.makeRequestAsync(
+            Url(base + method), {},
+            [&, method](std::string /*body*/, std::exception_ptr error) {
+                std::lock_guard<std::mutex> lock(mutex);
+                answered.push_back(error ? "error" : method);
+                changed.notify_all();
+            },
+            options);
+    };
+
+    std::unique_lock<std::mutex> lock(mutex);
+    send("hold", RequestPriority::Normal);
+    BOOST_REQUIRE(changed.wait_for(lock, std::chrono::seconds(5),
+                                   [&holding] { return holding; }));
+    send("bulk", RequestPriority::Bulk);
+    send("normal", RequestPriority::Normal);
+    send("answerCallbackQuery", RequestPriority::Interactive);
+    BOOST_REQUIRE(changed.wait_for(lock, std::chrono::seconds(5),
+                                   [&answered] { return !answered.empty(); }));
+    BOOST_CHECK_EQUAL(answered.front(), "answerCallbackQuery");
+
+    released = true;
+    changed.notify_all();
+    BOOST_REQUIRE(changed.wait_for(lock, std::chrono::seconds(5), [&answered] {
+        return answered.size() == 4;
+    }));
+    const std::vector<std::string> expected{"answerCallbackQuery", "hold",
+                                            "normal", "bulk"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(answered.begin(), answered.end(),
+                                  expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(asyncRequests_multiplexOnOneThread) {
+    FakeBotApiServer server;
+    EpollHttpClient client(std::chrono::seconds(10), 16, 1);
+    const Url url(server.url() + "/bot" + server.token() + "/getMe");
+
+    constexpr int kRequests = 200;
+    std::mutex mutex;
+    std::condition_variable done;
+    int answered = 0;
+    std::atomic<int> failed{0};
+    std::atomic<int> threadsSeen{0};
+    std::thread::id loopThread;
+    for (int i = 0; i < kRequests; ++i) {
+        client.makeRequestAsync(
+            url, {}, [&](std::string body, std::exception_ptr error) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (error || body.find("fake_bot") == std::string::npos) {
+                    ++failed;
+                }
+                if (loopThread != std::this_thread::get_id()) {
+                    loopThread = std::this_thread::get_id();
+                    ++threadsSeen;
+                }
+                if (++answered == kRequests) {
+                    done.notify_one();
+                }
+            });
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    BOOST_REQUIRE(done.wait_for(lock, std::chrono::seconds(20),
+                                [&] { return answered == kRequests; }));
+    BOOST_CHECK_EQUAL(failed, 0);
+    BOOST_CHECK_EQUAL(threadsSeen, 1);
+    BOOST_CHECK_EQUAL(server.callCount("getMe"), kRequests);
+}
+
+BOOST_AUTO_TEST_CASE(hostNames_resolveOffTheLoop) {
+    FakeBotApiServer server;
+    EpollHttpClient client(std::chrono::seconds(5), 4, 1);
+
+    std::promise<std::exception_ptr> unresolved;
+    client.makeRequestAsync(
+        Url("http://tgbot-test.invalid/botx/getMe"), {},
+        [&unresolved](std::string, std::exception_ptr error) {
+            unresolved.set_value(error);
+        });
+    // Served by the same loop whatever the lookup above takes.
+    BOOST_CHECK(client
+                    .makeRequest(Url("http://localhost:" +
+                                     server.url().substr(
+                                         server.url().rfind(':') + 1) +
+                                     "/bot" + server.token() + "/getMe"),
+                                 {})
+                    .find("fake_bot") != std::string::npos);
+
+    auto error = unresolved.get_future();
+    BOOST_REQUIRE(error.wait_for(std::chrono::seconds(10)) ==
+                  std::future_status::ready);
+    BOOST_CHECK_EXCEPTION(std::rethrow_exception(error.get()),
+                          NetworkException, [](const NetworkException& e) {
+                              return e.state ==
+                                     NetworkException::State::Connect;
+                          });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif  // __linux__
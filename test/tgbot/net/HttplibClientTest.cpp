@@ -0,0 +1,320 @@
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tgbot/Api.h>
+#include <tgbot/Bot.h>
+#include <tgbot/TgException.h>
+#include <tgbot/net/HttplibClient.h>
+#include <tgbot/net/RequestOptions.h>
+#include <tgbot/net/TgLongPoll.h>
+#include <tgbot/types/InputFile.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+using TgBot::testing::FakeBotApiServer;
+
+namespace {
+
+std::unique_ptr<HttplibClient> client(std::size_t connections = 1) {
+    return std::make_unique<HttplibClient>(std::chrono::seconds(5),
+                                           connections);
+}
+
+// A custom client that only implements makeRequest(url, args) and bounds
+// every request by its own timeout().
+class MinimalClient : public HttpClient {
+   public:
+    explicit MinimalClient(std::chrono::seconds timeout)
+        : HttpClient(timeout) {}
+
+    std::string makeRequest(const Url& url,
+                            const HttpReqArg::Vec& args) const override {
+        return HttplibClient(timeout()).makeRequest(url, args);
+    }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tHttplibClient)
+
+BOOST_AUTO_TEST_CASE(getMe_overHttp) {
+    FakeBotApiServer server;
+    Bot bot(server.token(), client(), server.url());
+
+    auto me = bot.getApi().getMe();
+    BOOST_REQUIRE(me);
+    BOOST_CHECK(me->username == "fake_bot");
+    BOOST_CHECK_EQUAL(server.callCount("getMe"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(wrongToken_isUnauthorized) {
+    FakeBotApiServer server;
+    Bot bot("1:wrong", client(), server.url());
+
+    BOOST_CHECK_EXCEPTION(bot.getApi().getMe(), TgException,
+                          [](const TgException& e) {
+                              return e.errorCode ==
+                                     TgException::ErrorCode::Unauthorized;
+                          });
+}
+
+BOOST_AUTO_TEST_CASE(getUpdates_confirmsByOffset) {
+    FakeBotApiServer server;
+    Bot bot(server.token(), client(), server.url());
+    server.pushMessage(1, "first");
+    server.pushMessage(1, "second");
+
+    auto updates = bot.getApi().getUpdates(0, 100, 0);
+    BOOST_REQUIRE_EQUAL(updates.size(), 2);
+    BOOST_CHECK((*updates[1]->message)->text == "second");
+
+    updates = bot.getApi().getUpdates(updates[1]->updateId + 1, 100, 0);
+    BOOST_CHECK(updates.empty());
+    BOOST_CHECK_EQUAL(server.pendingUpdates(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(getUpdates_longPollWakesOnNewUpdate) {
+    FakeBotApiServer server;
+    Bot bot(server.token(), client(), server.url());
+
+    std::thread producer([&server] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        server.pushMessage(1, "late");
+    });
+    const auto started = std::chrono::steady_clock::now();
+    auto updates = bot.getApi().getUpdates(0, 100, 3);
+    producer.join();
+
+    BOOST_REQUIRE_EQUAL(updates.size(), 1);
+    BOOST_CHECK((*updates[0]->message)->text == "late");
+    BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                std::chrono::seconds(3));
+}
+
+BOOST_AUTO_TEST_CASE(requestOptions_boundAndCancelCalls) {
+    FakeBotApiServer server;
+    auto http = std::make_shared<HttplibClient>(std::chrono::seconds(1), 2);
+    Bot bot(server.token(), http, server.url());
+
+    // The long poll outlasts the client's timeout without changing it.
+    TgLongPoll longPoll(&bot, 2, 100, {});
+    longPoll.start();
+    BOOST_CHECK(http->timeout() == std::chrono::seconds(1));
+
+    const auto isState = [](NetworkException::State state) {
+        return [state](const NetworkException& e) { return e.state == state; };
+    };
+    {
+        RequestOptions options;
+        options.timeout = std::chrono::milliseconds(300);
+        RequestOptionsScope scope(options);
+        const auto started = std::chrono::steady_clock::now();
+        BOOST_CHECK_EXCEPTION(bot.getApi().getUpdates(0, 100, 3),
+                              NetworkException,
+                              isState(NetworkException::State::Timeout));
+        BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                    std::chrono::seconds(1));
+    }
+    {
+        CancellationSource source;
+        RequestOptions options;
+        options.cancellation = source.token();
+        RequestOptionsScope scope(options);
+        std::thread canceller([&source] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            source.cancel();
+        });
+        const auto started = std::chrono::steady_clock::now();
+        BOOST_CHECK_EXCEPTION(bot.getApi().getUpdates(0, 100, 3),
+                              NetworkException,
+                              isState(NetworkException::State::Cancelled));
+        canceller.join();
+        BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                    std::chrono::seconds(1));
+    }
+    // Outside the scopes, calls use the client's defaults again.
+    BOOST_CHECK(bot.getApi().getMe());
+}
+
+BOOST_AUTO_TEST_CASE(longPoll_throughCustomClient) {
+    FakeBotApiServer server;
+    auto http = std::make_shared<MinimalClient>(std::chrono::seconds(1));
+    Bot bot(server.token(), http, server.url());
+
+    // The client cannot be told about the long poll's budget, so its own
+    // timeout is raised to fit.
+    TgLongPoll longPoll(&bot, 2, 100, {});
+    BOOST_CHECK(http->timeout() == std::chrono::seconds(7));
+    BOOST_CHECK_NO_THROW(longPoll.start());
+    BOOST_CHECK_EQUAL(server.callCount("getUpdates"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(rateLimit_isRetriedAfterRetryAfter) {
+    FakeBotApiServer server;
+    Bot bot(server.token(), client(), server.url());
+    server.rateLimit(2, 0);
+
+    auto message = bot.getApi().sendMessage(42, "hello");
+    BOOST_REQUIRE(message);
+    BOOST_CHECK_EQUAL(message->chat->id, 42);
+    BOOST_CHECK(message->text == "hello");
+    BOOST_CHECK_EQUAL(server.rateLimited(), 2);
+    BOOST_CHECK_EQUAL(server.callCount("sendMessage"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(multipartUpload_reachesServer) {
+    FakeBotApiServer server;
+    Bot bot(server.token(), client(), server.url());
+    auto file = std::make_shared<InputFile>();
+    file->data = "PNGDATA";
+    file->mimeType = "image/png";
+    file->fileName = "a.png";
+
+    bot.getApi().sendDocument(7, file);
+    const auto calls = server.calls();
+    BOOST_REQUIRE_EQUAL(calls.size(), 1);
+    BOOST_CHECK_EQUAL(calls[0].params.at("document"), "PNGDATA");
+    BOOST_CHECK_EQUAL(calls[0].params.at("chat_id"), "7");
+}
+
+BOOST_AUTO_TEST_CASE(fileEndpoints_getFileAndDownload) {
+    FakeBotApiServer server;
+    Bot bot(server.token(), client(), server.url());
+    server.addFile("file1", "documents/file_1.txt", "contents");
+
+    auto file = bot.getApi().getFile("file1");
+    BOOST_REQUIRE(file);
+    BOOST_REQUIRE(file->filePath == "documents/file_1.txt");
+    BOOST_CHECK_EQUAL(bot.getApi().downloadFile(*file->filePath), "contents");
+}
+
+BOOST_AUTO_TEST_CASE(interactiveRequests_passBulkOnes) {
+    FakeBotApiServer server;
+    server.setResult("answerCallbackQuery", true);
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool uploading = false;
+    bool released = false;
+    server.onCall([&](const FakeBotApiServer::Call& call) {
+        if (call.method != "sendDocument") {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        uploading = true;
+        changed.notify_all();
+        changed.wait_for(lock, std::chrono::seconds(5),
+                         [&released] { return released; });
+    });
+    Bot bot(server.token(), client(1), server.url());
+    auto file = std::make_shared<InputFile>();
+    file->data = "PNGDATA";
+    file->mimeType = "image/png";
+    file->fileName = "a.png";
+
+    std::thread upload([&bot, &file] { bot.getApi().sendDocument(7, file); });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        BOOST_REQUIRE(changed.wait_for(lock, std::chrono::seconds(5),
+                                       [&uploading] { return uploading; }));
+    }
+    // The upload holds the only shared connection: the message waits, the
+    // callback answer takes the connection reserved for interactive calls.
+    std::atomic<bool> sent{false};
+    std::thread message([&bot, &sent] {
+        bot.getApi().sendMessage(7, "after the upload");
+        sent = true;
+    });
+    const auto started = std::chrono::steady_clock::now();
+    BOOST_CHECK(bot.getApi().answerCallbackQuery("query"));
+    BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                std::chrono::seconds(1));
+    BOOST_CHECK(!sent);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+    }
+    changed.notify_all();
+    upload.join();
+    message.join();
+    BOOST_CHECK(sent);
+}
+
+BOOST_AUTO_TEST_CASE(queuedRequests_honourTimeoutAndCancellation) {
+    FakeBotApiServer server;
+    HttplibClient http(std::chrono::seconds(5), 1, 0);
+    const std::string bot = server.url() + "/bot" + server.token();
+
+    // The long poll holds the only connection for 2s.
+    std::thread poll([&http, &bot] {
+        http.makeRequest(Url(bot + "/getUpdates?timeout=2"), {});
+    });
+    BOOST_REQUIRE(
+        [&server] {
+            for (int i = 0; i < 500 && server.callCount("getUpdates") == 0;
+                 ++i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            return server.callCount("getUpdates") == 1;
+        }());
+
+    RequestOptions bounded;
+    bounded.timeout = std::chrono::milliseconds(300);
+    auto started = std::chrono::steady_clock::now();
+    BOOST_CHECK_EXCEPTION(
+        http.makeRequest(Url(bot + "/getMe"), {}, bounded), NetworkException,
+        [](const NetworkException& e) {
+            return e.state == NetworkException::State::Timeout;
+        });
+    BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                std::chrono::seconds(1));
+
+    CancellationSource source;
+    RequestOptions cancellable;
+    cancellable.cancellation = source.token();
+    std::thread canceller([&source] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        source.cancel();
+    });
+    started = std::chrono::steady_clock::now();
+    BOOST_CHECK_EXCEPTION(
+        http.makeRequest(Url(bot + "/getMe"), {}, cancellable),
+        NetworkException, [](const NetworkException& e) {
+            return e.state == NetworkException::State::Cancelled;
+        });
+    BOOST_CHECK(std::chrono::steady_clock::now() - started <
+                std::chrono::seconds(1));
+    canceller.join();
+    poll.join();
+    // Neither was sent once the connection came free.
+    BOOST_CHECK_EQUAL(server.callCount("getMe"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(concurrentRequests_shareThePool) {
+    FakeBotApiServer server;
+    Bot bot(server.token(), client(4), server.url());
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&bot, t] {
+            for (int i = 0; i < 10; ++i) {
+                bot.getApi().sendMessage(t + 1, std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(server.callCount("sendMessage"), 80);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,166 @@
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tgbot/Bot.h>
+#include <tgbot/Metrics.h>
+#include <tgbot/net/HttplibClient.h>
+#include <tgbot/net/TgWebhookTcpServer.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+using TgBot::testing::FakeBotApiServer;
+
+namespace {
+
+const std::string kUpdate =
+    R"({"update_id":1,"message":{"message_id":1,"date":0,)"
+    R"("chat":{"id":1,"type":"private"},"text":"hi"}})";
+
+const std::map<std::string, std::string> kSecret = {
+    {"X-Telegram-Bot-Api-Secret-Token", "s3cret"}};
+
+// A bot's webhook server with a secret token, running on a free port.
+struct Webhook {
+    Bot bot{"111:webhook", std::make_shared<HttplibClient>(),
+            "http://127.0.0.1:1"};
+    std::atomic<int> handled{0};
+    std::shared_ptr<Metrics> metrics = std::make_shared<Metrics>();
+    std::string url;
+    TgWebhookTcpServer* server;
+    std::thread runner;
+
+    explicit Webhook(
+        std::function<void(TgWebhookServer&)> configure = {},
+        std::chrono::milliseconds listenerDelay = {}) {
+        setMetrics(metrics);
+        bot.getEvents().onAnyMessage(
+            [this, listenerDelay](const Message::Ptr&) {
+                std::this_thread::sleep_for(listenerDelay);
+                ++handled;
+            });
+        const unsigned short port = FakeBotApiServer::freePort();
+        url = "http://127.0.0.1:" + std::to_string(port);
+        server = bot.createWebHookTcp(port, "/hook");
+        server->setSecretToken("s3cret");
+        server->setMaxBodySize(1024);
+        if (configure) {
+            configure(*server);
+        }
+        runner = std::thread([this] { server->start(); });
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (FakeBotApiServer::post(url, "/", "") == -1 &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    ~Webhook() {
+        server->stop();
+        runner.join();
+        setMetrics(nullptr);
+    }
+
+    std::uint64_t rejected(const std::string& reason) {
+        return metrics
+            ->counter("tgbot_webhook_rejections_total", {{"reason", reason}})
+            .value();
+    }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tTgWebhookServer)
+
+BOOST_AUTO_TEST_CASE(acceptsUpdateWithSecretToken) {
+    Webhook webhook;
+    BOOST_CHECK_EQUAL(
+        FakeBotApiServer::post(
+            webhook.url, "/hook", kUpdate,
+            {{"X-Telegram-Bot-Api-Secret-Token", "s3cret"},
+             {"Content-Type", "application/json; charset=utf-8"}}),
+        200);
+    BOOST_CHECK_EQUAL(webhook.handled, 1);
+}
+
+BOOST_AUTO_TEST_CASE(rejectsBeforeParsing) {
+    Webhook webhook;
+    BOOST_CHECK_EQUAL(FakeBotApiServer::post(webhook.url, "/hook", kUpdate),
+                      403);
+    BOOST_CHECK_EQUAL(
+        FakeBotApiServer::post(webhook.url, "/hook", kUpdate,
+                               {{"X-Telegram-Bot-Api-Secret-Token", "s3creT"}}),
+        403);
+    BOOST_CHECK_EQUAL(webhook.rejected("secret_token"), 2);
+
+    BOOST_CHECK_EQUAL(
+        FakeBotApiServer::post(webhook.url, "/hook", kUpdate,
+                               {{"X-Telegram-Bot-Api-Secret-Token", "s3cret"},
+                                {"Content-Type", "text/plain"}}),
+        415);
+    BOOST_CHECK_EQUAL(webhook.rejected("content_type"), 1);
+
+    BOOST_CHECK_EQUAL(
+        FakeBotApiServer::post(webhook.url, "/hook", std::string(2048, ' '),
+                               {{"X-Telegram-Bot-Api-Secret-Token", "s3cret"}}),
+        413);
+    BOOST_CHECK_EQUAL(webhook.rejected("body_size"), 1);
+
+    BOOST_CHECK_EQUAL(
+        FakeBotApiServer::post(webhook.url, "/hook", "{not json",
+                               {{"X-Telegram-Bot-Api-Secret-Token", "s3cret"}}),
+        400);
+    BOOST_CHECK_EQUAL(webhook.rejected("malformed"), 1);
+
+    BOOST_CHECK_EQUAL(webhook.handled, 0);
+}
+
+BOOST_AUTO_TEST_CASE(acceptorsShareThePort) {
+    Webhook webhook([](TgWebhookServer& server) {
+        server.setAcceptors(4);
+        server.setWorkerThreads(4);
+        server.setKeepAlive(2, std::chrono::seconds(1));
+    });
+    std::vector<std::thread> clients;
+    std::atomic<int> accepted{0};
+    for (int i = 0; i < 4; ++i) {
+        clients.emplace_back([&webhook, &accepted] {
+            for (int j = 0; j < 10; ++j) {
+                if (FakeBotApiServer::post(webhook.url, "/hook", kUpdate,
+                                           kSecret) == 200) {
+                    ++accepted;
+                }
+            }
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    BOOST_CHECK_EQUAL(accepted, 40);
+    BOOST_CHECK_EQUAL(webhook.handled, 40);
+}
+
+BOOST_AUTO_TEST_CASE(stopDrainsUpdatesInFlight) {
+    Webhook webhook({}, std::chrono::milliseconds(300));
+    int status = 0;
+    std::thread client([&webhook, &status] {
+        status = FakeBotApiServer::post(webhook.url, "/hook", kUpdate, kSecret);
+    });
+    // Let the request reach the listener, then stop while it runs.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    webhook.server->stop();
+    BOOST_CHECK_EQUAL(webhook.handled, 1);
+    client.join();
+    BOOST_CHECK_EQUAL(status, 200);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
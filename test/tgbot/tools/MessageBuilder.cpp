@@ -0,0 +1,177 @@
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nlohmann/json.hpp>
+#include <tgbot/Bot.h>
+#include <tgbot/net/HttplibClient.h>
+#include <tgbot/tools/MessageBuilder.h>
+#include <tgbot/tools/Utf16.h>
+
+#include "fake/FakeBotApiServer.h"
+
+using namespace TgBot;
+using TgBot::testing::FakeBotApiServer;
+
+BOOST_AUTO_TEST_SUITE(tMessageBuilder)
+
+BOOST_AUTO_TEST_CASE(escapeMarkdownV2) {
+    BOOST_CHECK_EQUAL(TgBot::escapeMarkdownV2("plain text"), "plain text");
+    BOOST_CHECK_EQUAL(TgBot::escapeMarkdownV2("1+1=2. *really*!"),
+                      "1\\+1\\=2\\. \\*really\\*\\!");
+    BOOST_CHECK_EQUAL(TgBot::escapeMarkdownV2("a\\b [c](d)"),
+                      "a\\\\b \\[c\\]\\(d\\)");
+    BOOST_CHECK_EQUAL(TgBot::escapeMarkdownV2("привет_"), "привет\\_");
+}
+
+BOOST_AUTO_TEST_CASE(escapeHtml) {
+    BOOST_CHECK_EQUAL(TgBot::escapeHtml("plain"), "plain");
+    BOOST_CHECK_EQUAL(TgBot::escapeHtml("<b>\"Tom & Jerry\"</b>"),
+                      "&lt;b&gt;&quot;Tom &amp; Jerry&quot;&lt;/b&gt;");
+}
+
+BOOST_AUTO_TEST_CASE(entitiesCountUtf16Units) {
+    MessageBuilder builder;
+    builder.text("😀 ").bold("bold").text(" ").link("ссылка", "https://a.b");
+    BOOST_CHECK_EQUAL(builder.str(), "😀 bold ссылка");
+    BOOST_CHECK_EQUAL(builder.utf16Length(), 14);
+
+    const auto entities = builder.entities();
+    BOOST_REQUIRE_EQUAL(entities.size(), 2);
+    BOOST_CHECK(entities[0]->type == MessageEntity::Type::Bold);
+    BOOST_CHECK_EQUAL(entities[0]->offset, 3);
+    BOOST_CHECK_EQUAL(entities[0]->length, 4);
+    BOOST_CHECK(entities[1]->type == MessageEntity::Type::TextLink);
+    BOOST_CHECK_EQUAL(entities[1]->offset, 8);
+    BOOST_CHECK_EQUAL(entities[1]->length, 6);
+    BOOST_CHECK(entities[1]->url == "https://a.b");
+}
+
+BOOST_AUTO_TEST_CASE(nestedEntities) {
+    MessageBuilder builder;
+    builder.begin(MessageEntity::Type::Bold)
+        .text("see ")
+        .link("here", "https://a.b")
+        .end()
+        .pre("int x;", "cpp");
+    const auto entities = builder.entities();
+    BOOST_REQUIRE_EQUAL(entities.size(), 3);
+    BOOST_CHECK(entities[0]->type == MessageEntity::Type::Bold);
+    BOOST_CHECK_EQUAL(entities[0]->length, 8);
+    BOOST_CHECK_EQUAL(entities[1]->offset, 4);
+    BOOST_CHECK(entities[2]->language == "cpp");
+    BOOST_CHECK_THROW(builder.end(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(shortTextIsOnePart) {
+    MessageBuilder builder;
+    BOOST_CHECK(builder.build().empty());
+    builder.italic("hi");
+    const auto parts = builder.build();
+    BOOST_REQUIRE_EQUAL(parts.size(), 1);
+    BOOST_CHECK_EQUAL(parts[0].text, "hi");
+    BOOST_CHECK_EQUAL(parts[0].entities.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(splitsAtLineBreaks) {
+    MessageBuilder builder;
+    builder.text("first line\n").bold("second line").text(" and more");
+    const auto parts = builder.build(16);
+    BOOST_REQUIRE_EQUAL(parts.size(), 3);
+    BOOST_CHECK_EQUAL(parts[0].text, "first line");
+    BOOST_CHECK(parts[0].entities.empty());
+    BOOST_CHECK_EQUAL(parts[1].text, "second line and");
+    BOOST_REQUIRE_EQUAL(parts[1].entities.size(), 1);
+    BOOST_CHECK_EQUAL(parts[1].entities[0]->offset, 0);
+    BOOST_CHECK_EQUAL(parts[1].entities[0]->length, 11);
+    BOOST_CHECK_EQUAL(parts[2].text, "more");
+}
+
+BOOST_AUTO_TEST_CASE(skipsPartsOfOnlyWhitespace) {
+    MessageBuilder builder;
+    builder.text("first\n\n\n\n\n\n\n").bold("second").text("\n \n");
+    const auto parts = builder.build(6);
+    BOOST_REQUIRE_EQUAL(parts.size(), 2);
+    BOOST_CHECK_EQUAL(parts[0].text, "first");
+    BOOST_CHECK_EQUAL(parts[1].text, "second");
+    BOOST_REQUIRE_EQUAL(parts[1].entities.size(), 1);
+    BOOST_CHECK_EQUAL(parts[1].entities[0]->offset, 0);
+    BOOST_CHECK_EQUAL(parts[1].entities[0]->length, 6);
+
+    BOOST_CHECK(MessageBuilder().text(" \n\t ").build().empty());
+}
+
+BOOST_AUTO_TEST_CASE(entitiesContinueAcrossSplits) {
+    MessageBuilder builder;
+    builder.text("ab").code(std::string(10, 'x')).text("cd");
+    const auto parts = builder.build(6);
+    std::string joined;
+    std::size_t covered = 0;
+    for (const auto& part : parts) {
+        BOOST_CHECK_LE(utf16Length(part.text), 6);
+        joined += part.text;
+        for (const auto& entity : part.entities) {
+            BOOST_CHECK(entity->type == MessageEntity::Type::Code);
+            BOOST_CHECK_LE(entity->offset + entity->length,
+                           static_cast<std::int32_t>(utf16Length(part.text)));
+            covered += entity->length;
+        }
+    }
+    BOOST_CHECK_EQUAL(joined, builder.str());
+    BOOST_CHECK_EQUAL(covered, 10);
+}
+
+BOOST_AUTO_TEST_CASE(neverSplitsCharactersOrCustomEmoji) {
+    MessageBuilder builder;
+    builder.text("ab😀😀").customEmoji("👍🏽", "5368324170671202286");
+    for (std::size_t limit = 2; limit < 12; ++limit) {
+        std::string joined;
+        for (const auto& part : builder.build(limit)) {
+            BOOST_CHECK_LE(utf16Length(part.text), limit);
+            for (const auto& entity : part.entities) {
+                // Only cut when the emoji cannot fit in a message at all.
+                BOOST_CHECK_EQUAL(entity->length, limit >= 4 ? 4 : 2);
+            }
+            joined += part.text;
+        }
+        BOOST_CHECK_EQUAL(joined, builder.str());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(longTextIsSentInParts) {
+    MessageBuilder builder;
+    builder.begin(MessageEntity::Type::Bold);
+    for (int i = 0; i < 1000; ++i) {
+        builder.text("line " + std::to_string(i) + "\n");
+    }
+    builder.end();
+    BOOST_CHECK_GT(builder.utf16Length(), MessageBuilder::kMessageLimit);
+
+    FakeBotApiServer server;
+    Bot bot(server.token(),
+            std::make_unique<HttplibClient>(std::chrono::seconds(5)),
+            server.url());
+    const auto sent = builder.send(bot.getApi(), 42);
+    BOOST_CHECK_EQUAL(sent.size(), 3);
+    BOOST_CHECK_EQUAL(server.callCount("sendMessage"), 3);
+
+    // The line breaks at the splits are dropped.
+    std::string text;
+    for (const auto& call : server.calls()) {
+        if (call.method != "sendMessage") {
+            continue;
+        }
+        BOOST_CHECK(call.params.count("parse_mode") == 0);
+        const auto entities = nlohmann::json::parse(call.params.at("entities"));
+        BOOST_CHECK_EQUAL(entities[0]["type"], "bold");
+        BOOST_CHECK_EQUAL(entities[0]["offset"], 0);
+        text += (text.empty() ? "" : "\n") + call.params.at("text");
+    }
+    BOOST_CHECK_EQUAL(text, builder.str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
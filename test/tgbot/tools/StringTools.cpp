@@ -44,4 +44,13 @@ BOOST_AUTO_TEST_CASE(urlDecode) {
     BOOST_CHECK_MESSAGE(t == e, diffS(t, e));
 }
 
+BOOST_AUTO_TEST_CASE(constantTimeEquals) {
+    BOOST_CHECK(StringTools::constantTimeEquals("secret", "secret"));
+    BOOST_CHECK(StringTools::constantTimeEquals("", ""));
+    BOOST_CHECK(!StringTools::constantTimeEquals("secret", "secreT"));
+    BOOST_CHECK(!StringTools::constantTimeEquals("secret", "secret1"));
+    BOOST_CHECK(!StringTools::constantTimeEquals("secret", ""));
+    BOOST_CHECK(!StringTools::constantTimeEquals(std::string("a\0", 2), "a"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
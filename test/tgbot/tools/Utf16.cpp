@@ -0,0 +1,144 @@
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <tgbot/tools/Utf16.h>
+#include <tgbot/types/Message.h>
+
+using namespace TgBot;
+
+namespace {
+
+MessageEntity::Ptr entity(std::int32_t offset, std::int32_t length) {
+    auto result = std::make_shared<MessageEntity>();
+    result->type = MessageEntity::Type::Bold;
+    result->offset = offset;
+    result->length = length;
+    return result;
+}
+
+// Byte offset of the first character at or after UTF-16 offset units,
+// counted one byte at a time.
+std::size_t referenceByte(std::string_view text, std::size_t units) {
+    std::size_t seen = 0;
+    std::size_t pos = 0;
+    for (; pos < text.size(); ++pos) {
+        const auto byte = static_cast<unsigned char>(text[pos]);
+        const bool continuation = (byte & 0xC0) == 0x80;
+        if (seen >= units && !continuation) {
+            break;
+        }
+        seen += (continuation ? 0 : 1) + (byte >= 0xF0 ? 1 : 0);
+    }
+    return pos;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tUtf16)
+
+BOOST_AUTO_TEST_CASE(length) {
+    BOOST_CHECK_EQUAL(utf16Length(""), 0);
+    BOOST_CHECK_EQUAL(utf16Length("hello"), 5);
+    BOOST_CHECK_EQUAL(utf16Length("привет"), 6);
+    BOOST_CHECK_EQUAL(utf16Length("€"), 1);
+    BOOST_CHECK_EQUAL(utf16Length("😀"), 2);
+    BOOST_CHECK_EQUAL(utf16Length(std::string(1000, 'a') + "😀"), 1002);
+}
+
+BOOST_AUTO_TEST_CASE(messageEntities) {
+    const std::string text = "😀 /start @bot ссылка";
+    const auto ranges =
+        utf8Ranges(text, {entity(3, 6), entity(10, 4), entity(15, 6)});
+    BOOST_REQUIRE_EQUAL(ranges.size(), 3);
+    BOOST_CHECK_EQUAL(text.substr(ranges[0].offset, ranges[0].length),
+                      "/start");
+    BOOST_CHECK_EQUAL(text.substr(ranges[1].offset, ranges[1].length), "@bot");
+    BOOST_CHECK_EQUAL(text.substr(ranges[2].offset, ranges[2].length),
+                      "ссылка");
+
+    Message message;
+    message.caption = text;
+    message.captionEntities = std::vector<MessageEntity::Ptr>{entity(10, 4)};
+    const auto captionRanges = utf8Ranges(message);
+    BOOST_REQUIRE_EQUAL(captionRanges.size(), 1);
+    BOOST_CHECK_EQUAL(captionRanges[0].offset, ranges[1].offset);
+}
+
+BOOST_AUTO_TEST_CASE(outOfRangeIsClamped) {
+    const std::string text = "a😀b";
+    const auto ranges = utf8Ranges(text, {entity(2, 1), entity(3, 100)});
+    // Offset 2 is inside the surrogate pair; it moves past the character.
+    BOOST_CHECK_EQUAL(ranges[0].offset, 5);
+    BOOST_CHECK_EQUAL(ranges[0].length, 0);
+    BOOST_CHECK_EQUAL(ranges[1].offset, 5);
+    BOOST_CHECK_EQUAL(ranges[1].length, 1);
+}
+
+BOOST_AUTO_TEST_CASE(inverse) {
+    const std::string text = "€10 for 😀 pizza";
+    const std::size_t begin = text.find("pizza");
+    const auto entity =
+        makeEntity(text, {begin, 5}, MessageEntity::Type::Italic);
+    BOOST_CHECK(entity->type == MessageEntity::Type::Italic);
+    BOOST_CHECK_EQUAL(entity->offset, 11);
+    BOOST_CHECK_EQUAL(entity->length, 5);
+
+    // "10" follows the three bytes of the euro sign.
+    const auto units = utf16Ranges(text, {{3, 2}, {begin, 5}});
+    BOOST_CHECK_EQUAL(units[0].offset, 1);
+    BOOST_CHECK_EQUAL(units[0].length, 2);
+    BOOST_CHECK_EQUAL(units[1].offset, 11);
+}
+
+// Long texts go through the vectorized scan; it must agree with counting
+// byte by byte.
+BOOST_AUTO_TEST_CASE(matchesByteByByte) {
+    std::mt19937 random(42);
+    const char* pieces[] = {"a", "é", "€", "😀", " ", "xyz"};
+    for (int round = 0; round < 200; ++round) {
+        std::string text;
+        const int count = static_cast<int>(random() % 400);
+        for (int i = 0; i < count; ++i) {
+            text += pieces[random() % 6];
+        }
+        const std::size_t total = utf16Length(text);
+        BOOST_REQUIRE_EQUAL(referenceByte(text, total), text.size());
+
+        std::vector<MessageEntity::Ptr> entities;
+        for (int i = 0; i < 16; ++i) {
+            entities.push_back(
+                entity(static_cast<std::int32_t>(random() % (total + 2)),
+                       static_cast<std::int32_t>(random() % (total + 2))));
+        }
+        const auto ranges = utf8Ranges(text, entities);
+        std::vector<Utf8Range> byteRanges;
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            const std::size_t begin = referenceByte(text, entities[i]->offset);
+            const std::size_t end = referenceByte(
+                text, entities[i]->offset + entities[i]->length);
+            BOOST_REQUIRE_EQUAL(ranges[i].offset, begin);
+            BOOST_REQUIRE_EQUAL(ranges[i].length, end - begin);
+            byteRanges.push_back(ranges[i]);
+        }
+        const auto back = utf8Ranges(text, [&] {
+            std::vector<MessageEntity::Ptr> again;
+            for (const auto& range : byteRanges) {
+                again.push_back(
+                    makeEntity(text, range, MessageEntity::Type::Bold));
+            }
+            return again;
+        }());
+        for (std::size_t i = 0; i < byteRanges.size(); ++i) {
+            BOOST_REQUIRE_EQUAL(back[i].offset, byteRanges[i].offset);
+            BOOST_REQUIRE_EQUAL(back[i].length, byteRanges[i].length);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()